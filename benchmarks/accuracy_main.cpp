@@ -0,0 +1,315 @@
+// Accuracy against speed of every transcendental backend
+//
+// Usage: fixed64_accuracy [--samples N] [--repetitions N] [--filter NAME] [--json FILE]
+//
+// Each backend that a configuration macro can select is called directly, so one binary
+// compares them all: the error is measured in ulps (units of 2^-P) against long double on the
+// exact input value, the speed as the median throughput in ns per operation. Rows marked with
+// * are on the Pareto front of their function and precision: no other backend is both at
+// least as accurate (max ulp) and at least as fast.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.h"
+#include "fixed64.h"
+#include "fixed64_math.h"
+
+// The default backends are measured through Fixed64Math, the others through their kernels
+static_assert(!FIXED64_MATH_USE_LUT_EXP && !FIXED64_MATH_USE_POLY_SIN && !FIXED64_MATH_USE_CORDIC
+                  && !FIXED64_MATH_USE_FAST_TRIG,
+              "fixed64_accuracy must be built with the default backends disabled");
+
+using namespace benchmark;
+using math::fp::Fixed64;
+using math::fp::Fixed64Math;
+using math::fp::Primitives;
+namespace detail = math::fp::detail;
+
+namespace {
+
+// Inputs per timed call, taken from the start of the samples
+constexpr size_t kOpsPerCall = 4096;
+
+struct Options {
+    size_t samples = 20000;
+    int repetitions = 51;
+    std::string filter;
+    std::string json_path;
+};
+
+struct AccuracyResult {
+    std::string function;
+    int precision;
+    std::string backend;
+    std::string macro;  // Configuration that makes Fixed64Math use this backend
+    double max_ulp;
+    double mean_ulp;
+    double ns_per_op;
+    bool pareto = false;
+};
+
+// Input ranges; b is unused by unary functions
+struct Domain {
+    double a_lo, a_hi;
+    double b_lo = 0, b_hi = 1;
+};
+
+template <int P>
+long double exactValue(Fixed64<P> x) {
+    return std::ldexp(static_cast<long double>(x.value()), -P);
+}
+
+template <int P, typename Op, typename Reference>
+void evaluate(const std::string& function,
+              const std::string& backend,
+              const std::string& macro,
+              const Domain& domain,
+              Op op,
+              Reference reference,
+              const Options& options,
+              std::vector<AccuracyResult>& results) {
+    if (!options.filter.empty() && function.find(options.filter) == std::string::npos) {
+        return;
+    }
+
+    // Same seed for every backend and precision of a function, so all its rows see the same
+    // values; FNV-1a of the name, as in fixed64_microbench
+    uint64_t seed = kBenchmarkSeed ^ 0xCBF29CE484222325;
+    for (const char c : function) {
+        seed = (seed ^ static_cast<unsigned char>(c)) * 0x100000001B3;
+    }
+    std::mt19937_64 gen(seed);
+    const size_t count = std::max(options.samples, kOpsPerCall);
+    std::vector<Fixed64<P>> a(count);
+    std::vector<Fixed64<P>> b(count);
+    for (size_t i = 0; i < count; ++i) {
+        a[i] = Fixed64<P>(uniformDouble(gen, domain.a_lo, domain.a_hi));
+        b[i] = Fixed64<P>(uniformDouble(gen, domain.b_lo, domain.b_hi));
+    }
+
+    long double max_error = 0;
+    long double total_error = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const long double expected = std::ldexp(reference(exactValue(a[i]), exactValue(b[i])), P);
+        const long double error =
+            std::fabs(static_cast<long double>(op(a[i], b[i]).value()) - expected);
+        max_error = std::max(max_error, error);
+        total_error += error;
+    }
+
+    std::vector<Fixed64<P>> out(kOpsPerCall);
+    const OpStats stats = measureOps(
+        [&] {
+            for (size_t i = 0; i < kOpsPerCall; ++i) {
+                out[i] = op(a[i], b[i]);
+            }
+            doNotOptimize(out.data());
+        },
+        kOpsPerCall, options.repetitions);
+
+    results.push_back({function, P, backend, macro, static_cast<double>(max_error),
+                       static_cast<double>(total_error / static_cast<long double>(count)),
+                       stats.median_ns});
+}
+
+template <int P>
+void runPrecision(const Options& options, std::vector<AccuracyResult>& results) {
+    using F = Fixed64<P>;
+    using L = long double;
+    const auto raw = [](int64_t value) { return F(value, detail::nothing{}); };
+
+    const Domain angle{-10, 10};
+    const auto sin_ref = [](L x, L) { return std::sin(x); };
+    evaluate<P>("Sin", "lut", "FAST_TRIG=0", angle,
+                [&](F x, F) { return raw(detail::LookupSin<P>(x.value())); }, sin_ref, options,
+                results);
+    evaluate<P>("Sin", "lut-fast", "FAST_TRIG=1", angle,
+                [&](F x, F) { return raw(detail::LookupSinFast<P>(x.value())); }, sin_ref,
+                options, results);
+    evaluate<P>("Sin", "poly", "POLY_SIN=1", angle,
+                [&](F x, F) { return raw(detail::LookupSinPoly<P>(x.value())); }, sin_ref,
+                options, results);
+    evaluate<P>("Sin", "cordic", "CORDIC=1", angle,
+                [](F x, F) { return Fixed64Math::Cordic::Sin(x); }, sin_ref, options, results);
+
+    const Domain tan_domain{-1.4, 1.4};
+    const auto tan_ref = [](L x, L) { return std::tan(x); };
+    evaluate<P>("Tan", "lut", "FAST_TRIG=0", tan_domain,
+                [&](F x, F) { return raw(detail::LookupTan<P>(x.value())); }, tan_ref, options,
+                results);
+    evaluate<P>("Tan", "lut-fast", "FAST_TRIG=1", tan_domain,
+                [&](F x, F) { return raw(detail::LookupTanFast<P>(x.value())); }, tan_ref,
+                options, results);
+
+    const Domain atan_domain{-10, 10};
+    const auto atan_ref = [](L x, L) { return std::atan(x); };
+    evaluate<P>("Atan", "lut", "FAST_TRIG=0", atan_domain,
+                [&](F x, F) { return raw(detail::LookupAtan<P>(x.value())); }, atan_ref,
+                options, results);
+    evaluate<P>("Atan", "lut-fast", "FAST_TRIG=1", atan_domain,
+                [&](F x, F) { return raw(detail::LookupAtanFast<P>(x.value())); }, atan_ref,
+                options, results);
+
+    const Domain plane{-10, 10, -10, 10};
+    const auto atan2_ref = [](L y, L x) { return std::atan2(y, x); };
+    evaluate<P>("Atan2", "lut", "CORDIC=0", plane,
+                [](F y, F x) { return Fixed64Math::Atan2(y, x); }, atan2_ref, options, results);
+    evaluate<P>("Atan2", "cordic", "CORDIC=1", plane,
+                [](F y, F x) { return Fixed64Math::Cordic::Atan2(y, x); }, atan2_ref, options,
+                results);
+
+    evaluate<P>("Acos", "lut", "", {-1, 1}, [](F x, F) { return Fixed64Math::Acos(x); },
+                [](L x, L) { return std::acos(x); }, options, results);
+
+    const Domain exp_domain{-10, 10};
+    const auto exp_ref = [](L x, L) { return std::exp(x); };
+    evaluate<P>("Exp", "series", "LUT_EXP=0", exp_domain,
+                [](F x, F) { return Fixed64Math::Exp(x); }, exp_ref, options, results);
+    evaluate<P>("Exp", "lut", "LUT_EXP=1", exp_domain,
+                [&](F x, F) { return raw(detail::LookupExp<P>(x.value())); }, exp_ref, options,
+                results);
+
+    const Domain log_domain{0.001, 1000};
+    const auto log_ref = [](L x, L) { return std::log(x); };
+    evaluate<P>("Log", "series", "LUT_EXP=0", log_domain,
+                [](F x, F) { return Fixed64Math::Log(x); }, log_ref, options, results);
+    evaluate<P>("Log", "lut", "LUT_EXP=1", log_domain,
+                [&](F x, F) { return raw(detail::LookupLog<P>(x.value())); }, log_ref, options,
+                results);
+
+    const Domain pow_domain{0.1, 4, -2, 2};
+    const auto pow_ref = [](L x, L y) { return std::pow(x, y); };
+    evaluate<P>("Pow", "series", "LUT_EXP=0", pow_domain,
+                [](F x, F y) { return Fixed64Math::Pow(x, y); }, pow_ref, options, results);
+    evaluate<P>("Pow", "lut", "LUT_EXP=1", pow_domain,
+                [&](F x, F y) { return raw(detail::LookupPow<P>(x.value(), y.value())); },
+                pow_ref, options, results);
+
+    const Domain sqrt_domain{0, 1000};
+    const auto sqrt_ref = [](L x, L) { return std::sqrt(x); };
+    evaluate<P>("Sqrt", "fast", "", sqrt_domain, [](F x, F) { return Fixed64Math::Sqrt(x); },
+                sqrt_ref, options, results);
+    evaluate<P>("Sqrt", "exact", "", sqrt_domain,
+                [&](F x, F) { return raw(Primitives::Fixed64Sqrt(x.value(), P)); }, sqrt_ref,
+                options, results);
+}
+
+// Marks the rows that no other backend of the same function and precision dominates
+void markPareto(std::vector<AccuracyResult>& results) {
+    for (auto& r : results) {
+        r.pareto = std::none_of(results.begin(), results.end(), [&](const AccuracyResult& o) {
+            const bool same_group = o.function == r.function && o.precision == r.precision;
+            const bool no_worse = o.max_ulp <= r.max_ulp && o.ns_per_op <= r.ns_per_op;
+            const bool better = o.max_ulp < r.max_ulp || o.ns_per_op < r.ns_per_op;
+            return same_group && &o != &r && no_worse && better;
+        });
+    }
+}
+
+// Fixed notation, switching to scientific where the errors no longer fit the column
+std::string formatUlp(double ulp) {
+    std::ostringstream out;
+    if (ulp < 1e6) {
+        out << std::fixed << std::setprecision(2) << ulp;
+    } else {
+        out << std::scientific << std::setprecision(2) << ulp;
+    }
+    return out.str();
+}
+
+void printTable(const std::vector<AccuracyResult>& results) {
+    std::cout << std::left << std::setw(8) << "Function" << std::right << std::setw(4) << "P"
+              << "  " << std::left << std::setw(10) << "Backend" << std::setw(13) << "Macro"
+              << std::right << std::setw(14) << "max ulp" << std::setw(12) << "mean ulp"
+              << std::setw(10) << "ns/op" << "  Pareto" << std::endl;
+    std::cout << std::string(79, '-') << std::endl;
+    for (const auto& r : results) {
+        std::cout << std::left << std::setw(8) << r.function << std::right << std::setw(4)
+                  << r.precision << "  " << std::left << std::setw(10) << r.backend
+                  << std::setw(13) << (r.macro.empty() ? "-" : r.macro) << std::right
+                  << std::setw(14) << formatUlp(r.max_ulp) << std::setw(12)
+                  << formatUlp(r.mean_ulp) << std::setprecision(2) << std::fixed
+                  << std::setw(10) << r.ns_per_op
+                  << (r.pareto ? "  *" : "") << std::endl;
+    }
+}
+
+void writeJson(std::ostream& out,
+               const std::vector<AccuracyResult>& results,
+               const Options& options) {
+    out << "{\n";
+    out << "  \"benchmark\": \"fixed64_accuracy\",\n";
+    out << "  \"seed\": " << kBenchmarkSeed << ",\n";
+    out << "  \"samples\": " << std::max(options.samples, kOpsPerCall) << ",\n";
+    out << "  \"reference_digits\": " << std::numeric_limits<long double>::digits << ",\n";
+    out << "  \"results\": [\n";
+    out << std::setprecision(4) << std::fixed;
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        out << "    {\"function\": \"" << r.function << "\", \"precision\": " << r.precision
+            << ", \"backend\": \"" << r.backend << "\", \"macro\": \"" << r.macro
+            << "\", \"max_ulp\": " << r.max_ulp << ", \"mean_ulp\": " << r.mean_ulp
+            << ", \"ns_per_op\": " << r.ns_per_op
+            << ", \"pareto\": " << (r.pareto ? "true" : "false") << "}"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--samples") == 0 && has_value) {
+            options.samples = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+        } else if (std::strcmp(argv[i], "--repetitions") == 0 && has_value) {
+            options.repetitions = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--filter") == 0 && has_value) {
+            options.filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--json") == 0 && has_value) {
+            options.json_path = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--samples N] [--repetitions N] [--filter NAME] [--json FILE]"
+                      << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::vector<AccuracyResult> results;
+    runPrecision<16>(options, results);
+    runPrecision<32>(options, results);
+    runPrecision<40>(options, results);
+    markPareto(results);
+
+    printTable(results);
+    if (!options.json_path.empty()) {
+        std::ofstream json(options.json_path);
+        if (!json) {
+            std::cerr << "Cannot write " << options.json_path << std::endl;
+            return 1;
+        }
+        writeJson(json, results, options);
+    }
+    return 0;
+}
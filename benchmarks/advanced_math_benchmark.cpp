@@ -32,8 +32,7 @@ MathTestData generateMathTestData(int count) {
     data.atan2_pairs_softdouble.reserve(allocSize);
     data.pow_pairs_softdouble.reserve(allocSize);
 
-    random_device rd;
-    mt19937 gen(rd());
+    mt19937_64 gen(kBenchmarkSeed);
 
     // Different distributions for different function needs
     uniform_real_distribution<> unit_dist(-1.0, 1.0);          // For [-1, 1] range
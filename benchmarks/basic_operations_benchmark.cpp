@@ -14,8 +14,7 @@ TestData generateTestData(int count) {
     data.int64_values.reserve(allocSize);
     data.double_values.reserve(allocSize);
 
-    random_device rd;
-    mt19937 gen(rd());
+    mt19937_64 gen(kBenchmarkSeed);
     uniform_real_distribution<> dist(-100.0, 100.0);  // More reasonable range
     uniform_int_distribution<> idx_dist(0, allocSize - 1);
 
@@ -47,8 +46,7 @@ MultiplyDivideTestData generateMulDivTestData(int count) {
     data.int64_pairs.reserve(allocSize);
     data.double_pairs.reserve(allocSize);
 
-    random_device rd;
-    mt19937 gen(rd());
+    mt19937_64 gen(kBenchmarkSeed);
     uniform_real_distribution<> dist(-1000.0, 1000.0);
 
     for (int i = 0; i < allocSize; i++) {
@@ -97,8 +95,7 @@ SqrtTestData generateSqrtTestData(int count) {
     data.sf_values.reserve(allocSize);
     data.double_values.reserve(allocSize);
 
-    random_device rd;
-    mt19937 gen(rd());
+    mt19937_64 gen(kBenchmarkSeed);
     uniform_real_distribution<> dist(0.01, 1000.0);  // Positive values only
 
     // Generate positive values suitable for square root
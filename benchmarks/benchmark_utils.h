@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <iomanip>
 #include <iostream>
@@ -10,8 +13,22 @@
 #include <thread>
 #include <vector>
 
+// Time stamp counter for readTicks()
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define BENCHMARK_HAVE_TSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define BENCHMARK_HAVE_TSC 1
+#else
+#define BENCHMARK_HAVE_TSC 0
+#endif
+
 namespace benchmark {
 
+// Seed of every benchmark input, so runs of different builds and machines see the same data
+inline constexpr uint64_t kBenchmarkSeed = 0x5EEDF1C564;
+
 // Benchmark framework
 template <typename Func>
 double runBenchmark(const std::string& name, Func func, int iterations, bool printResult = true) {
@@ -26,14 +43,13 @@ double runBenchmark(const std::string& name, Func func, int iterations, bool pri
     double totalTime = 0.0;
 
     for (int run = 0; run < TIMING_RUNS; run++) {
-        auto start = std::chrono::high_resolution_clock::now();
+        auto start = std::chrono::steady_clock::now();
         // Call the function and get a result that must be used
         auto result = func(iterations);
-        auto end = std::chrono::high_resolution_clock::now();
+        auto end = std::chrono::steady_clock::now();
 
-        // Store the time
-        double time =
-            std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0;
+        // Store the time in milliseconds, measured in nanoseconds
+        double time = std::chrono::duration<double, std::milli>(end - start).count();
         totalTime += time;
 
         // Make sure the result is used to prevent optimization
@@ -52,4 +68,89 @@ struct BenchmarkResult {
     std::map<std::string, double> times;  // implementation -> time in ms
 };
 
-}  // namespace benchmark
\ No newline at end of file
+// Keeps a value alive so the computation producing it cannot be removed
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const volatile void* sink;
+    sink = &value;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+// Whether readTicks() counts time stamp counter ticks
+inline constexpr bool kHaveTicks = BENCHMARK_HAVE_TSC != 0;
+
+// Time stamp counter (reference cycles at the nominal frequency), 0 where there is none
+inline uint64_t readTicks() {
+#if BENCHMARK_HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// Uniform double in [lo, hi) from the 53 high bits of a draw: std::mt19937_64 is specified
+// bit for bit, unlike std::uniform_real_distribution, so every platform gets the same inputs
+inline double uniformDouble(std::mt19937_64& gen, double lo, double hi) {
+    return lo + static_cast<double>(gen() >> 11) * 0x1p-53 * (hi - lo);
+}
+
+// Distribution of the per-operation cost over repeated timed calls
+struct OpStats {
+    double median_ns = 0;
+    double p10_ns = 0;
+    double p90_ns = 0;
+    double p99_ns = 0;
+    double min_ns = 0;
+    double median_ticks = -1;  // -1 without a time stamp counter
+};
+
+// Nearest-rank percentile of sorted samples
+inline double percentile(const std::vector<double>& sorted, double fraction) {
+    const double rank = fraction * static_cast<double>(sorted.size() - 1);
+    return sorted[static_cast<size_t>(rank + 0.5)];
+}
+
+/**
+ * Time repeated calls of body, each performing opsPerCall operations
+ *
+ * Every call is timed separately with steady_clock (and the time stamp counter when there is
+ * one), so the statistics show the spread between calls instead of hiding it in an average.
+ */
+template <typename Body>
+OpStats measureOps(Body&& body, size_t opsPerCall, int repetitions, int warmupCalls = 10) {
+    for (int i = 0; i < warmupCalls; ++i) {
+        body();
+    }
+
+    std::vector<double> ns(static_cast<size_t>(repetitions));
+    std::vector<double> ticks(static_cast<size_t>(repetitions));
+    const double ops = static_cast<double>(opsPerCall);
+    for (int r = 0; r < repetitions; ++r) {
+        const uint64_t tick0 = readTicks();
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        const auto end = std::chrono::steady_clock::now();
+        const uint64_t tick1 = readTicks();
+        ns[r] = std::chrono::duration<double, std::nano>(end - start).count() / ops;
+        ticks[r] = static_cast<double>(tick1 - tick0) / ops;
+    }
+    std::sort(ns.begin(), ns.end());
+    std::sort(ticks.begin(), ticks.end());
+
+    OpStats stats;
+    stats.median_ns = percentile(ns, 0.5);
+    stats.p10_ns = percentile(ns, 0.1);
+    stats.p90_ns = percentile(ns, 0.9);
+    stats.p99_ns = percentile(ns, 0.99);
+    stats.min_ns = ns.front();
+    if (kHaveTicks) {
+        stats.median_ticks = percentile(ticks, 0.5);
+    }
+    return stats;
+}
+
+}  // namespace benchmark
@@ -0,0 +1,239 @@
+// Latency and throughput of the Fixed64 primitives at several precisions
+//
+// Usage: fixed64_microbench [--repetitions N] [--filter NAME] [--json FILE]
+//
+// Latency chains every operation on the result of the previous one, throughput runs
+// independent operations over an array. Both report the distribution over many timed calls;
+// the inputs come from kBenchmarkSeed, so results of different builds can be compared.
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.h"
+#include "fixed64.h"
+#include "fixed64_math.h"
+
+using namespace benchmark;
+using math::fp::Fixed64;
+using math::fp::Fixed64Math;
+
+namespace {
+
+// Operations per timed call: small enough for L1, long enough for the clock resolution
+constexpr size_t kOpsPerCall = 4096;
+
+// Link from one result to the next input; the compiler cannot see that it is zero
+volatile int64_t g_chain_mask = 0;
+
+struct Options {
+    int repetitions = 201;
+    std::string filter;
+    std::string json_path;
+};
+
+struct MicroResult {
+    std::string op;
+    int precision;
+    std::string mode;
+    OpStats stats;
+};
+
+// Input ranges of an operation; b is negated at random when signed_b is set
+struct Domain {
+    double a_lo, a_hi;
+    double b_lo, b_hi;
+    bool signed_b = false;
+};
+
+template <int P>
+struct Inputs {
+    std::vector<Fixed64<P>> a;
+    std::vector<Fixed64<P>> b;
+};
+
+template <int P>
+Inputs<P> makeInputs(const Domain& domain, uint64_t seed) {
+    std::mt19937_64 gen(seed);
+    Inputs<P> in;
+    in.a.reserve(kOpsPerCall);
+    in.b.reserve(kOpsPerCall);
+    for (size_t i = 0; i < kOpsPerCall; ++i) {
+        in.a.emplace_back(uniformDouble(gen, domain.a_lo, domain.a_hi));
+        const double b = uniformDouble(gen, domain.b_lo, domain.b_hi);
+        in.b.emplace_back(domain.signed_b && (gen() & 1) ? -b : b);
+    }
+    return in;
+}
+
+// Each operation takes its first input from the previous result, masked to zero
+template <int P, typename Op>
+OpStats measureLatency(const Inputs<P>& in, Op op, int repetitions) {
+    return measureOps(
+        [&] {
+            const int64_t mask = g_chain_mask;
+            int64_t previous = 0;
+            for (size_t i = 0; i < kOpsPerCall; ++i) {
+                const Fixed64<P> a(in.a[i].value() ^ (previous & mask),
+                                   math::fp::detail::nothing{});
+                previous = op(a, in.b[i]).value();
+            }
+            doNotOptimize(previous);
+        },
+        kOpsPerCall, repetitions);
+}
+
+template <int P, typename Op>
+OpStats measureThroughput(const Inputs<P>& in, Op op, int repetitions) {
+    std::vector<Fixed64<P>> out(kOpsPerCall);
+    return measureOps(
+        [&] {
+            for (size_t i = 0; i < kOpsPerCall; ++i) {
+                out[i] = op(in.a[i], in.b[i]);
+            }
+            doNotOptimize(out.data());
+        },
+        kOpsPerCall, repetitions);
+}
+
+template <int P, typename Op>
+void runOp(const std::string& name,
+           const Domain& domain,
+           Op op,
+           const Options& options,
+           std::vector<MicroResult>& results) {
+    if (!options.filter.empty() && name.find(options.filter) == std::string::npos) {
+        return;
+    }
+    // Same seed for every precision, so the sweep measures the same values; FNV-1a of the
+    // name rather than std::hash, which differs between standard libraries
+    uint64_t seed = kBenchmarkSeed ^ 0xCBF29CE484222325;
+    for (const char c : name) {
+        seed = (seed ^ static_cast<unsigned char>(c)) * 0x100000001B3;
+    }
+    const Inputs<P> in = makeInputs<P>(domain, seed);
+    results.push_back({name, P, "latency", measureLatency(in, op, options.repetitions)});
+    results.push_back({name, P, "throughput", measureThroughput(in, op, options.repetitions)});
+}
+
+template <int P>
+void runPrecision(const Options& options, std::vector<MicroResult>& results) {
+    using F = Fixed64<P>;
+    // The chain link costs about two cycles of latency, measured by this row
+    runOp<P>("Chain", {-100, 100, -100, 100}, [](F a, F) { return a; }, options, results);
+    runOp<P>("Add", {-100, 100, -100, 100}, [](F a, F b) { return a + b; }, options, results);
+    runOp<P>("Mul", {-100, 100, -100, 100}, [](F a, F b) { return a * b; }, options, results);
+    runOp<P>("Div", {-1000, 1000, 0.5, 100, true}, [](F a, F b) { return a / b; }, options,
+             results);
+    runOp<P>("Sqrt", {0.01, 1000, 0, 1}, [](F a, F) { return Fixed64Math::Sqrt(a); }, options,
+             results);
+    runOp<P>("Sin", {-10, 10, 0, 1}, [](F a, F) { return Fixed64Math::Sin(a); }, options,
+             results);
+    runOp<P>("Atan2", {-10, 10, -10, 10}, [](F a, F b) { return Fixed64Math::Atan2(a, b); },
+             options, results);
+    runOp<P>("Exp", {-10, 10, 0, 1}, [](F a, F) { return Fixed64Math::Exp(a); }, options,
+             results);
+    runOp<P>("Log", {0.01, 1000, 0, 1}, [](F a, F) { return Fixed64Math::Log(a); }, options,
+             results);
+}
+
+void printTable(const std::vector<MicroResult>& results) {
+    std::cout << std::left << std::setw(8) << "Op" << std::right << std::setw(4) << "P"
+              << std::setw(12) << "Mode" << std::setw(12) << "median ns" << std::setw(10)
+              << "p10 ns" << std::setw(10) << "p90 ns" << std::setw(12) << "ticks/op"
+              << std::endl;
+    std::cout << std::string(68, '-') << std::endl;
+    for (const auto& r : results) {
+        std::cout << std::left << std::setw(8) << r.op << std::right << std::setw(4)
+                  << r.precision << std::setw(12) << r.mode << std::fixed << std::setprecision(2)
+                  << std::setw(12) << r.stats.median_ns << std::setw(10) << r.stats.p10_ns
+                  << std::setw(10) << r.stats.p90_ns << std::setw(12);
+        if (r.stats.median_ticks >= 0) {
+            std::cout << r.stats.median_ticks;
+        } else {
+            std::cout << "N/A";
+        }
+        std::cout << std::endl;
+    }
+}
+
+void writeJson(std::ostream& out,
+               const std::vector<MicroResult>& results,
+               const Options& options) {
+    out << "{\n";
+    out << "  \"benchmark\": \"fixed64_microbench\",\n";
+    out << "  \"seed\": " << kBenchmarkSeed << ",\n";
+    out << "  \"ops_per_call\": " << kOpsPerCall << ",\n";
+    out << "  \"repetitions\": " << options.repetitions << ",\n";
+#if defined(__VERSION__)
+    out << "  \"compiler\": \"" << __VERSION__ << "\",\n";
+#elif defined(_MSC_FULL_VER)
+    out << "  \"compiler\": \"MSVC " << _MSC_FULL_VER << "\",\n";
+#endif
+    out << "  \"results\": [\n";
+    out << std::setprecision(4) << std::fixed;
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        out << "    {\"op\": \"" << r.op << "\", \"precision\": " << r.precision
+            << ", \"mode\": \"" << r.mode << "\", \"median_ns\": " << r.stats.median_ns
+            << ", \"p10_ns\": " << r.stats.p10_ns << ", \"p90_ns\": " << r.stats.p90_ns
+            << ", \"p99_ns\": " << r.stats.p99_ns << ", \"min_ns\": " << r.stats.min_ns
+            << ", \"median_ticks\": ";
+        if (r.stats.median_ticks >= 0) {
+            out << r.stats.median_ticks;
+        } else {
+            out << "null";
+        }
+        out << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--repetitions") == 0 && has_value) {
+            options.repetitions = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--filter") == 0 && has_value) {
+            options.filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--json") == 0 && has_value) {
+            options.json_path = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--repetitions N] [--filter NAME] [--json FILE]" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::vector<MicroResult> results;
+    runPrecision<16>(options, results);
+    runPrecision<32>(options, results);
+    runPrecision<40>(options, results);
+
+    printTable(results);
+    if (!options.json_path.empty()) {
+        std::ofstream json(options.json_path);
+        if (!json) {
+            std::cerr << "Cannot write " << options.json_path << std::endl;
+            return 1;
+        }
+        writeJson(json, results, options);
+    }
+    return 0;
+}
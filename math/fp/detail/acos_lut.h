@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include "lut_format.h"
 #include "primitives.h"
 
 
@@ -13,7 +14,7 @@ namespace math::fp::detail {
 // Region 2: 0.8-0.93 Hermite interpolation (128 segments = 258 points, with derivatives in separate
 // array) Region 3: 0.93-0.99 denser uniform (256+1 points) Region 4: 0.99-0.999 even denser (256+1
 // points) Region 5: 0.999-1.0 densest (256+1 points) Fixed-point format: Q31.32
-inline constexpr std::array<int64_t, 1286> AcosLut = {
+alignas(64) inline constexpr std::array<int64_t, 1286> AcosLut = {
     // Region 1: 0.0-0.8 uniform (256+1 points)
     6746518852LL,  // acos(0.0000000000) = 1.5707963268
     6733097057LL,  // acos(0.0031250000) = 1.5676713217
@@ -1308,7 +1309,7 @@ inline constexpr std::array<int64_t, 1286> AcosLut = {
 };
 
 // Derivatives for Region 2 (0.8-0.93)
-inline constexpr std::array<int64_t, 129> AcosDyDxLut = {
+alignas(64) inline constexpr std::array<int64_t, 129> AcosDyDxLut = {
     -7158278826LL,   // d(acos)/dx at x=0.8000000000 = -1.6666666667
     -7174499890LL,   // d(acos)/dx at x=0.8010156250 = -1.6704434273
     -7190852520LL,   // d(acos)/dx at x=0.8020312500 = -1.6742508208
@@ -1442,11 +1443,13 @@ inline constexpr std::array<int64_t, 129> AcosDyDxLut = {
 
 /**
  * @brief Calculate arccosine value with multi-region interpolation
- * @param x Fixed-point value in [-1,1] range with input_fraction_bits precision
- * @param input_fraction_bits Precision (fractional bits) of the input value
- * @return Fixed-point arccosine value with input_fraction_bits precision in [0, pi] range
+ * @tparam P Precision (fractional bits) of the input value
+ * @param x Fixed-point value in [-1,1] range with P fraction bits
+ * @return Fixed-point arccosine value with P fraction bits in [0, pi] range
  */
-inline int64_t LookupAcos(int64_t x, int input_fraction_bits) noexcept {
+template <int P>
+inline constexpr auto LookupAcos(int64_t x) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kAcosLookup);
     // Fixed-point constants
     constexpr int kFractionBits = 32;
     constexpr int64_t kOne = 1LL << kFractionBits;
@@ -1473,35 +1476,14 @@ inline int64_t LookupAcos(int64_t x, int input_fraction_bits) noexcept {
     constexpr int64_t kInvScale_5 = (1LL << (kFractionBits + 8)) / (kOne / 1000LL);
 
     // Adjust input to internal precision
-    int64_t scaled_x;
-    if (input_fraction_bits > kFractionBits) {
-        scaled_x = x >> (input_fraction_bits - kFractionBits);
-    } else if (input_fraction_bits < kFractionBits) {
-        scaled_x = x << (kFractionBits - input_fraction_bits);
-    } else {
-        scaled_x = x;
-    }
+    int64_t scaled_x = ToLutSaturated<P>(x);
 
     // Boundary check: ensure input is in [-kOne, kOne] range
     if (scaled_x >= kOne) {
-        int64_t result = 0;
-        // Adjust output precision
-        if (input_fraction_bits > kFractionBits) {
-            result = result << (input_fraction_bits - kFractionBits);
-        } else if (input_fraction_bits < kFractionBits) {
-            result = result >> (kFractionBits - input_fraction_bits);
-        }
-        return result;
+        return FromLutFormat<P>(0);
     }
     if (scaled_x <= -kOne) {
-        int64_t result = kPi;
-        // Adjust output precision
-        if (input_fraction_bits > kFractionBits) {
-            result = result << (input_fraction_bits - kFractionBits);
-        } else if (input_fraction_bits < kFractionBits) {
-            result = result >> (kFractionBits - input_fraction_bits);
-        }
-        return result;
+        return FromLutFormat<P>(kPi);
     }
 
     bool is_negative = scaled_x < 0;
@@ -1519,11 +1501,7 @@ inline int64_t LookupAcos(int64_t x, int input_fraction_bits) noexcept {
         }
 
         // Adjust output precision
-        if (input_fraction_bits > kFractionBits) {
-            result = result << (input_fraction_bits - kFractionBits);
-        } else if (input_fraction_bits < kFractionBits) {
-            result = result >> (kFractionBits - input_fraction_bits);
-        }
+        result = FromLutFormat<P>(result);
         return result;
     }
 
@@ -1616,11 +1594,7 @@ inline int64_t LookupAcos(int64_t x, int input_fraction_bits) noexcept {
     }
 
     // Adjust output precision
-    if (input_fraction_bits > kFractionBits) {
-        result = result << (input_fraction_bits - kFractionBits);
-    } else if (input_fraction_bits < kFractionBits) {
-        result = result >> (kFractionBits - input_fraction_bits);
-    }
+    result = FromLutFormat<P>(result);
 
     return result;
 }
@@ -3,12 +3,14 @@
 #include <array>
 #include <cstdint>
 
+#include "lut_format.h"
+
 namespace math::fp::detail {
 
 // Arctangent lookup table with 257 entries for atan2 implementation
 // Input range: [0, 1], Output: atan(x) in radians [0, pi/4]
 // Fixed-point format: Q31.32
-inline constexpr std::array<int64_t, 257> kAtan2LUT = {
+alignas(64) inline constexpr std::array<int64_t, 257> kAtan2LUT = {
     0LL,           // ratio=0.00000000000, angle=0.00000000000
     16842922LL,    // ratio=0.00392156863, angle=0.00392154852
     33685327LL,    // ratio=0.00784313725, angle=0.00784297644
@@ -271,20 +273,15 @@ inline constexpr std::array<int64_t, 257> kAtan2LUT = {
 /**
  * @brief Lookup arctangent value for atan2 implementation with linear interpolation
  * @param ratio Fixed-point ratio value (y/x or x/y) in [0,1] range
- * @param P Precision (fractional bits) of the input
+ * @tparam P Precision (fractional bits) of the input
  * @return Fixed-point arctangent value with P fractional bits in [0, pi/4] range
  */
-inline auto LookupAtan2(int64_t ratio, int P) noexcept -> int64_t {
+template <int P>
+inline constexpr auto LookupAtan2(int64_t ratio) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kAtan2Lookup);
     // Scale input to [0, 1] range in Q31.32 format
-    constexpr int kTableP = 32;
-    int64_t scaled_x;
-    if (P > kTableP) {
-        scaled_x = ratio >> (P - kTableP);
-    } else if (P < kTableP) {
-        scaled_x = ratio << (kTableP - P);
-    } else {
-        scaled_x = ratio;
-    }
+    constexpr int kTableP = kLutFractionBits;
+    int64_t scaled_x = ToLutFormat<P>(ratio);
 
     // Ensure input is in valid range
     constexpr int64_t kOne = 1LL << kTableP;
@@ -303,14 +300,8 @@ inline auto LookupAtan2(int64_t ratio, int P) noexcept -> int64_t {
     int64_t y1 = kAtan2LUT[index + 1];
     int64_t result = y0 + ((y1 - y0) * frac) / kIndexScale;
 
-    // Adjust precision if needed
-    if (P > kTableP) {
-        result = result << (P - kTableP);
-    } else if (P < kTableP) {
-        result = result >> (kTableP - P);
-    }
-
-    return result;
+    // Adjust precision
+    return FromLutFormat<P>(result);
 }
 
 }  // namespace math::fp::detail
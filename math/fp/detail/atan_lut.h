@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 #include <array>
+#include "lut_format.h"
 #include "primitives.h"
 
 // Atan lookup table with 513 entries
@@ -11,7 +12,7 @@
 namespace math::fp::detail {
 // Table maps x in [0,1] to atan(x)
 // Values stored in Q31.32 fixed-point format
-inline constexpr std::array<int64_t, 513> kAtanLut = {
+alignas(64) inline constexpr std::array<int64_t, 513> kAtanLut = {
     0x0000000000000000LL,  // atan(0.00000000000) = 0.00000000000
     0x0000000000804015LL,  // atan(0.00195694716) = 0.00195694466
     0x0000000001007FEALL,  // atan(0.00391389432) = 0.00391387434
@@ -528,10 +529,12 @@ inline constexpr std::array<int64_t, 513> kAtanLut = {
 };
 
 // Fast lookup atan(x) with linear interpolation between table entries
-// Input x is in fixed-point format with specified fraction bits representing a value in [-1,1]
+// Input x is in fixed-point format with P fraction bits representing a value in [-1,1]
 // Output is in fixed-point format with the same fraction bits representing atan(x)
-// Precision: ~3.1e-7 when fraction_bits=32
-inline constexpr auto LookupAtanFast(int64_t x, int input_fraction_bits) noexcept -> int64_t {
+// Precision: ~3.1e-7 when P=32
+template <int P>
+inline constexpr auto LookupAtanFast(int64_t x) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kAtanLookup);
     // Constants
     constexpr int kOutputFractionBits = 32;  // Internal calculation format
     constexpr int64_t kOne = 1LL << kOutputFractionBits;
@@ -543,14 +546,8 @@ inline constexpr auto LookupAtanFast(int64_t x, int input_fraction_bits) noexcep
         is_negative = true;
     }
 
-    // Convert input to internal format if needed
-    if (input_fraction_bits != kOutputFractionBits) {
-        if (input_fraction_bits < kOutputFractionBits) {
-            x <<= (kOutputFractionBits - input_fraction_bits);
-        } else {
-            x >>= (input_fraction_bits - kOutputFractionBits);
-        }
-    }
+    // Convert input to Q31.32
+    x = ToLutSaturated<P>(x);
 
     // 1. Ensure x is in [0,1] range
     if (x <= 0) {
@@ -561,12 +558,12 @@ inline constexpr auto LookupAtanFast(int64_t x, int input_fraction_bits) noexcep
         // For x > 1, use atan(x) = π/2 - atan(1/x)
         use_reciprocal = true;
         // Calculate 1/x in fixed-point
-        x = Primitives::Fixed64Div(kOne, x, kOutputFractionBits);
+        x = Primitives::Fixed64Div<kOutputFractionBits>(kOne, x);
     }
 
     // 2. Scale x to table index
     constexpr int64_t kScale = static_cast<int64_t>(kAtanLut.size() - 2);
-    const int64_t idx_scaled = Primitives::Fixed64Mul(x, kScale << kOutputFractionBits, kOutputFractionBits);
+    const int64_t idx_scaled = Primitives::Fixed64Mul<kOutputFractionBits>(x, kScale << kOutputFractionBits);
     const int64_t idx = idx_scaled >> kOutputFractionBits;
     const int64_t t = idx_scaled & ((1LL << kOutputFractionBits) - 1);  // Fractional part [0,1)
 
@@ -584,24 +581,20 @@ inline constexpr auto LookupAtanFast(int64_t x, int input_fraction_bits) noexcep
         result = kHalfPi - result;
     }
 
-    // 6. Convert result back to input format if needed
-    if (input_fraction_bits != kOutputFractionBits) {
-        if (input_fraction_bits < kOutputFractionBits) {
-            result >>= (kOutputFractionBits - input_fraction_bits);
-        } else {
-            result <<= (input_fraction_bits - kOutputFractionBits);
-        }
-    }
+    // 6. Convert result back to input format
+    result = FromLutFormat<P>(result);
 
     // Apply sign
     return is_negative ? -result : result;
 }
 
 // High precision lookup atan(x) with quadratic interpolation between table entries
-// Input x is in fixed-point format with specified fraction bits representing a value in [-1,1]
+// Input x is in fixed-point format with P fraction bits representing a value in [-1,1]
 // Output is in fixed-point format with the same fraction bits representing atan(x)
-// Precision: ~5.5e-10 when fraction_bits=32
-inline constexpr auto LookupAtan(int64_t x, int input_fraction_bits) noexcept -> int64_t {
+// Precision: ~5.5e-10 when P=32
+template <int P>
+inline constexpr auto LookupAtan(int64_t x) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kAtanLookup);
     // Constants
     constexpr int kOutputFractionBits = 32;  // Internal calculation format
     constexpr int64_t kOne = 1LL << kOutputFractionBits;
@@ -613,14 +606,8 @@ inline constexpr auto LookupAtan(int64_t x, int input_fraction_bits) noexcept ->
         is_negative = true;
     }
 
-    // Convert input to internal format if needed
-    if (input_fraction_bits != kOutputFractionBits) {
-        if (input_fraction_bits < kOutputFractionBits) {
-            x <<= (kOutputFractionBits - input_fraction_bits);
-        } else {
-            x >>= (input_fraction_bits - kOutputFractionBits);
-        }
-    }
+    // Convert input to Q31.32
+    x = ToLutSaturated<P>(x);
 
     // 1. Ensure x is in [0,1] range
     if (x <= 0) {
@@ -631,12 +618,12 @@ inline constexpr auto LookupAtan(int64_t x, int input_fraction_bits) noexcept ->
         // For x > 1, use atan(x) = π/2 - atan(1/x)
         use_reciprocal = true;
         // Calculate 1/x in fixed-point
-        x = Primitives::Fixed64Div(kOne, x, kOutputFractionBits);
+        x = Primitives::Fixed64Div<kOutputFractionBits>(kOne, x);
     }
 
     // 2. Scale x to table index
     constexpr int64_t kScale = static_cast<int64_t>(kAtanLut.size() - 2);
-    const int64_t idx_scaled = Primitives::Fixed64Mul(x, kScale << kOutputFractionBits, kOutputFractionBits);
+    const int64_t idx_scaled = Primitives::Fixed64Mul<kOutputFractionBits>(x, kScale << kOutputFractionBits);
     const int64_t idx = idx_scaled >> kOutputFractionBits;
     const int64_t t = idx_scaled & ((1LL << kOutputFractionBits) - 1);  // Fractional part [0,1)
 
@@ -664,10 +651,10 @@ inline constexpr auto LookupAtan(int64_t x, int input_fraction_bits) noexcept ->
     const int64_t c = y1;
 
     // Calculate polynomial a*t^2 + b*t + c
-    const int64_t t_squared = Primitives::Fixed64Mul(t, t, kOutputFractionBits);
+    const int64_t t_squared = Primitives::Fixed64Mul<kOutputFractionBits>(t, t);
     int64_t result = c;
-    result += Primitives::Fixed64Mul(b, t, kOutputFractionBits);
-    result += Primitives::Fixed64Mul(a, t_squared, kOutputFractionBits);
+    result += Primitives::Fixed64Mul<kOutputFractionBits>(b, t);
+    result += Primitives::Fixed64Mul<kOutputFractionBits>(a, t_squared);
 
     // Apply reciprocal formula if needed
     if (use_reciprocal) {
@@ -676,20 +663,14 @@ inline constexpr auto LookupAtan(int64_t x, int input_fraction_bits) noexcept ->
         result = kHalfPi - result;
     }
 
-    // 6. Convert result back to input format if needed
-    if (input_fraction_bits != kOutputFractionBits) {
-        if (input_fraction_bits < kOutputFractionBits) {
-            result >>= (kOutputFractionBits - input_fraction_bits);
-        } else {
-            result <<= (input_fraction_bits - kOutputFractionBits);
-        }
-    }
+    // 6. Convert result back to input format
+    result = FromLutFormat<P>(result);
 
     // Apply sign
     return is_negative ? -result : result;
 }
 
 // Fast lookup atan(x) with linear interpolation between table entries
-// Input x is in fixed-point format with specified fraction bits representing a value in [-1,1]
+// Input x is in fixed-point format with P fraction bits representing a value in [-1,1]
 // Output is in fixed-point format with the same fraction bits representing atan(x)
 }  // namespace math::fp::detail
\ No newline at end of file
@@ -0,0 +1,691 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "primitives.h"
+#include "simd_ops.h"
+
+namespace math::fp::detail {
+
+// Batch kernels operate on raw int64_t fixed-point values
+// The lane helpers below are written once against SimdOps and reproduce the scalar
+// primitives bit for bit. Fixed64MulLanes mirrors Primitives::Fixed64Mul:
+//   1. Split operands into sign mask and magnitude (two's complement, INT64_MIN stays 2^63)
+//   2. Form the exact 128-bit product from four 32x32->64 partial products
+//   3. Truncate by shifting right by P, then re-apply the sign
+// The partial products are recombined without carry detection: the middle column sum
+// (x0 >> 32) + lo32(x1) + lo32(x2) is at most 3 * (2^32 - 1) and cannot overflow 64 bits
+
+#if FIXED64_BATCH_HAS_SIMD
+inline constexpr size_t kBatchLanes = SimdOps::kLanes;
+
+using BatchVec = SimdOps::Vec;
+
+// Two's complement negation of the lanes selected by an all-ones sign mask
+inline auto ApplySignLanes(BatchVec v, BatchVec sign) noexcept -> BatchVec {
+    return SimdOps::Sub(SimdOps::Xor(v, sign), sign);
+}
+
+// Arithmetic shift by a compile-time amount, N = 0 is allowed
+template <int N>
+inline auto ShiftRightArithLanes(BatchVec v) noexcept -> BatchVec {
+    if constexpr (N == 0) {
+        return v;
+    } else {
+        return SimdOps::ShiftRightArith<N>(v);
+    }
+}
+
+template <int N>
+inline auto ShiftLeftLanes(BatchVec v) noexcept -> BatchVec {
+    if constexpr (N == 0) {
+        return v;
+    } else {
+        return SimdOps::ShiftLeft<N>(v);
+    }
+}
+
+// Full unsigned 64x64->128 product
+inline auto MulU64FullLanes(BatchVec u, BatchVec v, BatchVec& hi, BatchVec& lo) noexcept -> void {
+    const BatchVec kLowMask = SimdOps::Set1(0xFFFFFFFFLL);
+
+    // Partial products (only the low 32 bits of each lane are used by MulU32)
+    const BatchVec u_hi = SimdOps::ShiftRightLogical<32>(u);
+    const BatchVec v_hi = SimdOps::ShiftRightLogical<32>(v);
+    const BatchVec x0 = SimdOps::MulU32(u, v);
+    const BatchVec x1 = SimdOps::MulU32(u, v_hi);
+    const BatchVec x2 = SimdOps::MulU32(u_hi, v);
+    const BatchVec x3 = SimdOps::MulU32(u_hi, v_hi);
+
+    // Recombine into the 128-bit product (hi, lo)
+    const BatchVec mid =
+        SimdOps::Add(SimdOps::Add(SimdOps::ShiftRightLogical<32>(x0), SimdOps::And(x1, kLowMask)),
+                     SimdOps::And(x2, kLowMask));
+    hi = SimdOps::Add(SimdOps::Add(x3, SimdOps::ShiftRightLogical<32>(x1)),
+                      SimdOps::Add(SimdOps::ShiftRightLogical<32>(x2),
+                                   SimdOps::ShiftRightLogical<32>(mid)));
+    lo = SimdOps::Or(SimdOps::ShiftLeft<32>(mid), SimdOps::And(x0, kLowMask));
+}
+
+// Low 64 bits of the product, identical for signed and unsigned operands
+inline auto MulLo64Lanes(BatchVec a, BatchVec b) noexcept -> BatchVec {
+    const BatchVec cross = SimdOps::Add(SimdOps::MulU32(a, SimdOps::ShiftRightLogical<32>(b)),
+                                   SimdOps::MulU32(SimdOps::ShiftRightLogical<32>(a), b));
+    return SimdOps::Add(SimdOps::MulU32(a, b), SimdOps::ShiftLeft<32>(cross));
+}
+
+// == Primitives::MulU64Shifted(u, v, Shift) for 0 < Shift < 64
+template <int Shift>
+inline auto MulU64ShiftedLanes(BatchVec u, BatchVec v) noexcept -> BatchVec {
+    BatchVec hi;
+    BatchVec lo;
+    MulU64FullLanes(u, v, hi, lo);
+    return SimdOps::Or(SimdOps::ShiftRightLogical<Shift>(lo),
+                       SimdOps::ShiftLeft<64 - Shift>(hi));
+}
+
+// == Primitives::Fixed64Mul(a, b, P)
+template <int P>
+inline auto Fixed64MulLanes(BatchVec a, BatchVec b) noexcept -> BatchVec {
+    // Sign masks and magnitudes
+    const BatchVec s_a = SimdOps::ShiftRightArith<63>(a);
+    const BatchVec s_b = SimdOps::ShiftRightArith<63>(b);
+    const BatchVec u = ApplySignLanes(a, s_a);
+    const BatchVec v = ApplySignLanes(b, s_b);
+
+    return ApplySignLanes(MulU64ShiftedLanes<P>(u, v), SimdOps::Xor(s_a, s_b));
+}
+
+// == Primitives::Fixed64Mul(t, b, 32) for a fraction 0 <= t < 2^32
+// The high word of t is zero, so two partial products form the shifted product:
+// (t * |b|) >> 32 == (t * lo32(|b|) >> 32) + t * hi32(|b|)  (mod 2^64)
+inline auto MulFrac32Lanes(BatchVec t, BatchVec b) noexcept -> BatchVec {
+    const BatchVec s_b = SimdOps::ShiftRightArith<63>(b);
+    const BatchVec v = ApplySignLanes(b, s_b);
+    const BatchVec product =
+        SimdOps::Add(SimdOps::ShiftRightLogical<32>(SimdOps::MulU32(t, v)),
+                     SimdOps::MulU32(t, SimdOps::ShiftRightLogical<32>(v)));
+    return ApplySignLanes(product, s_b);
+}
+
+// == x % D (truncated toward zero, sign of x) for a positive divisor D < 2^62
+// Barrett reduction: with M = floor((2^64 - 1) / D) the quotient estimate hi(|x| * M) is
+// either exact or one too small, so a single conditional subtraction yields the remainder
+template <int64_t D>
+inline auto RemLanes(BatchVec x) noexcept -> BatchVec {
+    static_assert(D > 0 && D < (int64_t(1) << 62), "Divisor out of range");
+    constexpr int64_t kReciprocal = static_cast<int64_t>(~uint64_t(0) / uint64_t(D));
+
+    const BatchVec sign = SimdOps::ShiftRightArith<63>(x);
+    const BatchVec ax = ApplySignLanes(x, sign);
+
+    BatchVec q;
+    BatchVec lo;
+    MulU64FullLanes(ax, SimdOps::Set1(kReciprocal), q, lo);
+    BatchVec r = SimdOps::Sub(ax, MulLo64Lanes(q, SimdOps::Set1(D)));
+    r = SimdOps::Select(SimdOps::CmpGt(r, SimdOps::Set1(D - 1)), SimdOps::Sub(r, SimdOps::Set1(D)),
+                        r);
+    return ApplySignLanes(r, sign);
+}
+
+// Conversion of an unsigned 64-bit v to the nearest double
+// Both 32-bit halves are converted exactly with the 2^52 / 2^84 exponent trick, so the sum
+// is the only rounding step
+inline auto U64ToF64Lanes(BatchVec v) noexcept -> SimdOps::VecF {
+    constexpr int64_t kExp52 = 0x4330000000000000LL;  // bits of 2^52
+    constexpr int64_t kExp84 = 0x4530000000000000LL;  // bits of 2^84
+    constexpr int64_t kExp84Plus52 = 0x4530000000100000LL;  // bits of 2^84 + 2^52
+
+    const BatchVec lo = SimdOps::Or(SimdOps::And(v, SimdOps::Set1(0xFFFFFFFFLL)),
+                                    SimdOps::Set1(kExp52));
+    const BatchVec hi = SimdOps::Or(SimdOps::ShiftRightLogical<32>(v), SimdOps::Set1(kExp84));
+    const SimdOps::VecF hi_value =
+        SimdOps::SubF64(SimdOps::BitsToF64(hi), SimdOps::BitsToF64(SimdOps::Set1(kExp84Plus52)));
+    return SimdOps::AddF64(hi_value, SimdOps::BitsToF64(lo));
+}
+
+// Conversion of a double 0 <= x < 2^51 to the nearest integer
+inline auto RoundF64ToI64Lanes(SimdOps::VecF x) noexcept -> BatchVec {
+    constexpr int64_t kExp52 = 0x4330000000000000LL;  // bits of 2^52
+    const SimdOps::VecF shifted = SimdOps::AddF64(x, SimdOps::BitsToF64(SimdOps::Set1(kExp52)));
+    return SimdOps::Sub(SimdOps::F64ToBits(shifted), SimdOps::Set1(kExp52));
+}
+
+// == floor(n * 2^K / d) for 0 <= n <= d, 0 < d < 2^63 and 0 <= K <= 32
+// The double estimate has a relative error below 2^-50 on a quotient of at most 2^32, so
+// rounding it to the nearest integer yields q or q + 1. The remainder n * 2^K - q * d then
+// lies in [-d, d) and its low 64 bits are exact. The upward correction only guards against
+// a non-default (directed) rounding mode
+template <int K>
+inline auto DivFractionLanes(BatchVec n, BatchVec d) noexcept -> BatchVec {
+    static_assert(K >= 0 && K <= 32, "Quotient precision out of range");
+    constexpr int64_t kScaleBits = static_cast<int64_t>(1023 + K) << 52;  // bits of 2^K
+
+    const SimdOps::VecF scaled_n =
+        SimdOps::MulF64(U64ToF64Lanes(n), SimdOps::BitsToF64(SimdOps::Set1(kScaleBits)));
+    BatchVec q = RoundF64ToI64Lanes(SimdOps::DivF64(scaled_n, U64ToF64Lanes(d)));
+
+    const BatchVec r = SimdOps::Sub(ShiftLeftLanes<K>(n), MulLo64Lanes(q, d));
+    const BatchVec kZero = SimdOps::Set1(0);
+    q = SimdOps::Select(SimdOps::CmpGt(kZero, r), SimdOps::Sub(q, SimdOps::Set1(1)), q);
+    q = SimdOps::Select(SimdOps::CmpGt(r, SimdOps::Sub(d, SimdOps::Set1(1))),
+                        SimdOps::Add(q, SimdOps::Set1(1)), q);
+    return q;
+}
+
+// All-ones in lanes where v != 0, zero elsewhere
+inline auto NonZeroMaskLanes(BatchVec v) noexcept -> BatchVec {
+    return SimdOps::ShiftRightArith<63>(SimdOps::Or(v, SimdOps::Sub(SimdOps::Set1(0), v)));
+}
+
+// == Primitives::BitWidth(v) - 1 for an unsigned v >= 1
+// The exponent of the nearest double is the index of the top bit, or one more when rounding
+// carried into the next power of two, which the shifted-out test detects
+inline auto FloorLog2Lanes(BatchVec v) noexcept -> BatchVec {
+    const BatchVec biased = SimdOps::ShiftRightLogical<52>(SimdOps::F64ToBits(U64ToF64Lanes(v)));
+    const BatchVec e = SimdOps::Sub(biased, SimdOps::Set1(1023));
+    const BatchVec top = SimdOps::ShiftRightLogicalVar(v, SimdOps::And(e, SimdOps::Set1(63)));
+    const BatchVec top_set = SimdOps::ShiftRightLogical<63>(NonZeroMaskLanes(top));
+    return SimdOps::Add(SimdOps::Sub(e, SimdOps::Set1(1)), top_set);
+}
+
+// == the bits of Primitives::Fixed64ToF64 (kMantBits = 52, kExpBits = 11) or Fixed64ToF32
+// (23, 8) for 0 < P < 64, where the exponent can neither overflow nor go subnormal
+// The magnitude is rounded half up to kMantBits + 1 bits including the implied one; adding
+// it to the biased exponent minus one lets a rounding carry increment the exponent
+template <int P, int kMantBits, int kExpBits>
+inline auto FixedToFloatBitsLanes(BatchVec v) noexcept -> BatchVec {
+    constexpr int64_t kBias = (int64_t(1) << (kExpBits - 1)) - 1;
+    constexpr int64_t kSignBit = static_cast<int64_t>(uint64_t(1) << (kMantBits + kExpBits));
+    const BatchVec kZero = SimdOps::Set1(0);
+    const BatchVec kOne = SimdOps::Set1(1);
+    const BatchVec kCountMask = SimdOps::Set1(63);
+
+    const BatchVec sign = SimdOps::ShiftRightArith<63>(v);
+    const BatchVec mag = ApplySignLanes(v, sign);
+    const BatchVec msb = FloorLog2Lanes(mag);
+    const BatchVec shift = SimdOps::Sub(msb, SimdOps::Set1(kMantBits));
+
+    // Narrow magnitudes move up to the implied bit, wide ones are rounded and moved down
+    const BatchVec up =
+        SimdOps::ShiftLeftVar(mag, SimdOps::And(SimdOps::Sub(kZero, shift), kCountMask));
+    BatchVec round =
+        SimdOps::ShiftLeftVar(kOne, SimdOps::And(SimdOps::Sub(shift, kOne), kCountMask));
+    round = SimdOps::Select(SimdOps::CmpGt(shift, kZero), round, kZero);
+    const BatchVec down =
+        SimdOps::ShiftRightLogicalVar(SimdOps::Add(mag, round), SimdOps::And(shift, kCountMask));
+    const BatchVec significand = SimdOps::Select(SimdOps::CmpGt(kZero, shift), up, down);
+
+    const BatchVec exponent = SimdOps::Add(msb, SimdOps::Set1(kBias - P - 1));
+    BatchVec bits = SimdOps::Add(SimdOps::ShiftLeft<kMantBits>(exponent), significand);
+    bits = SimdOps::Or(bits, SimdOps::And(sign, SimdOps::Set1(kSignBit)));
+    return SimdOps::And(bits, NonZeroMaskLanes(mag));
+}
+
+// == Primitives::F64ToFixed64 (kMantBits = 52, kExpBits = 11) or F32ToFixed64 (23, 8) on the
+// zero-extended IEEE bits, including the saturation of large values, the INT64_MIN/INT64_MAX
+// result of NaN and infinity and the underflow of subnormals to zero
+template <int P, int kMantBits, int kExpBits>
+inline auto FloatBitsToFixedLanes(BatchVec bits) noexcept -> BatchVec {
+    constexpr int64_t kExpMask = (int64_t(1) << kExpBits) - 1;
+    constexpr int64_t kBias = kExpMask >> 1;
+    constexpr int64_t kImplied = int64_t(1) << kMantBits;
+    const BatchVec kZero = SimdOps::Set1(0);
+    const BatchVec kOne = SimdOps::Set1(1);
+    const BatchVec kCountMask = SimdOps::Set1(63);
+    const BatchVec kMaxRaw = SimdOps::Set1(INT64_MAX);
+
+    const BatchVec sign =
+        SimdOps::ShiftRightArith<63>(ShiftLeftLanes<63 - kMantBits - kExpBits>(bits));
+    const BatchVec biased =
+        SimdOps::And(SimdOps::ShiftRightLogical<kMantBits>(bits), SimdOps::Set1(kExpMask));
+    const BatchVec fraction = SimdOps::And(bits, SimdOps::Set1(kImplied - 1));
+
+    // Subnormals have no implied bit and the exponent of the smallest normal
+    const auto normal = SimdOps::CmpGt(biased, kZero);
+    const BatchVec mantissa =
+        SimdOps::Select(normal, SimdOps::Or(fraction, SimdOps::Set1(kImplied)), fraction);
+    const BatchVec scale =
+        SimdOps::Add(SimdOps::Select(normal, biased, kOne), SimdOps::Set1(P - kBias - kMantBits));
+
+    // Left shifts past bit 63 saturate, right shifts round half up and underflow to zero
+    BatchVec left = SimdOps::ShiftLeftVar(mantissa, SimdOps::And(scale, kCountMask));
+    left = SimdOps::Select(SimdOps::CmpGt(scale, kCountMask), kMaxRaw, left);
+    const BatchVec down = SimdOps::Sub(kZero, scale);
+    const BatchVec round =
+        SimdOps::ShiftLeftVar(kOne, SimdOps::And(SimdOps::Sub(down, kOne), kCountMask));
+    BatchVec right = SimdOps::ShiftRightLogicalVar(SimdOps::Add(mantissa, round),
+                                                   SimdOps::And(down, kCountMask));
+    right = SimdOps::Select(SimdOps::CmpGt(down, kCountMask), kZero, right);
+
+    const BatchVec magnitude = SimdOps::Select(SimdOps::CmpGt(kZero, scale), right, left);
+    return SimdOps::Select(SimdOps::CmpGt(biased, SimdOps::Set1(kExpMask - 1)),
+                           SimdOps::Xor(kMaxRaw, sign), ApplySignLanes(magnitude, sign));
+}
+
+template <int P>
+inline auto MulBatch(const int64_t* a, const int64_t* b, int64_t* out, size_t count) noexcept
+    -> size_t {
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        SimdOps::Store(out + i, Fixed64MulLanes<P>(SimdOps::Load(a + i), SimdOps::Load(b + i)));
+    }
+    return i;
+}
+
+template <int P>
+inline auto MulBatch(const int64_t* a, int64_t b, int64_t* out, size_t count) noexcept -> size_t {
+    const BatchVec vb = SimdOps::Set1(b);
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        SimdOps::Store(out + i, Fixed64MulLanes<P>(SimdOps::Load(a + i), vb));
+    }
+    return i;
+}
+
+// codes[i] = zigzag(values[i] - base[i]) with wrapping subtraction, or zigzag(values[i])
+// without a baseline (base == nullptr)
+inline auto ZigZagBatch(const int64_t* values, const int64_t* base, int64_t* codes,
+                        size_t count) noexcept -> size_t {
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        BatchVec x = SimdOps::Load(values + i);
+        if (base != nullptr) {
+            x = SimdOps::Sub(x, SimdOps::Load(base + i));
+        }
+        SimdOps::Store(codes + i,
+                       SimdOps::Xor(SimdOps::ShiftLeft<1>(x), SimdOps::ShiftRightArith<63>(x)));
+    }
+    return i;
+}
+
+// Inverse of ZigZagBatch: values[i] = base[i] + unzigzag(codes[i])
+inline auto UnZigZagBatch(const int64_t* codes, const int64_t* base, int64_t* values,
+                          size_t count) noexcept -> size_t {
+    const BatchVec kOne = SimdOps::Set1(1);
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        const BatchVec c = SimdOps::Load(codes + i);
+        BatchVec x = SimdOps::Xor(SimdOps::ShiftRightLogical<1>(c),
+                                  SimdOps::Sub(SimdOps::Set1(0), SimdOps::And(c, kOne)));
+        if (base != nullptr) {
+            x = SimdOps::Add(x, SimdOps::Load(base + i));
+        }
+        SimdOps::Store(values + i, x);
+    }
+    return i;
+}
+
+// codes[i] = round((clamp(values[i], min, max) - min) * scale / 2^64), or the offset itself
+// when scale == 0 (the range fits the code width and is stored losslessly)
+inline auto QuantizeBatch(const int64_t* values, int64_t min, int64_t max, uint64_t scale,
+                          int64_t* codes, size_t count) noexcept -> size_t {
+    const BatchVec v_min = SimdOps::Set1(min);
+    const BatchVec v_max = SimdOps::Set1(max);
+    const BatchVec v_scale = SimdOps::Set1(static_cast<int64_t>(scale));
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        BatchVec x = SimdOps::Load(values + i);
+        x = SimdOps::Select(SimdOps::CmpGt(x, v_max), v_max, x);
+        x = SimdOps::Select(SimdOps::CmpGt(v_min, x), v_min, x);
+        BatchVec q = SimdOps::Sub(x, v_min);
+        if (scale != 0) {
+            BatchVec lo;
+            MulU64FullLanes(q, v_scale, q, lo);
+            q = SimdOps::Add(q, SimdOps::ShiftRightLogical<63>(lo));  // round half up
+        }
+        SimdOps::Store(codes + i, q);
+    }
+    return i;
+}
+
+// values[i] = min + round(codes[i] * step), the step given in 64.64 fixed point
+inline auto DequantizeBatch(const int64_t* codes, int64_t min, uint64_t step_hi,
+                            uint64_t step_lo, int64_t* values, size_t count) noexcept -> size_t {
+    const BatchVec v_min = SimdOps::Set1(min);
+    const BatchVec v_hi = SimdOps::Set1(static_cast<int64_t>(step_hi));
+    const BatchVec v_lo = SimdOps::Set1(static_cast<int64_t>(step_lo));
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        const BatchVec q = SimdOps::Load(codes + i);
+        BatchVec frac_hi;
+        BatchVec frac_lo;
+        MulU64FullLanes(q, v_lo, frac_hi, frac_lo);
+        const BatchVec offset = SimdOps::Add(
+            MulLo64Lanes(q, v_hi), SimdOps::Add(frac_hi, SimdOps::ShiftRightLogical<63>(frac_lo)));
+        SimdOps::Store(values + i, SimdOps::Add(v_min, offset));
+    }
+    return i;
+}
+
+// bits[i] = bit pattern of Primitives::Fixed64ToF64(values[i], P)
+template <int P>
+inline auto ToF64Batch(const int64_t* values, int64_t* bits, size_t count) noexcept -> size_t {
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        SimdOps::Store(bits + i, FixedToFloatBitsLanes<P, 52, 11>(SimdOps::Load(values + i)));
+    }
+    return i;
+}
+
+// bits[i] = bit pattern of Primitives::Fixed64ToF32(values[i], P)
+template <int P>
+inline auto ToF32Batch(const int64_t* values, uint32_t* bits, size_t count) noexcept -> size_t {
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        SimdOps::StoreU32(bits + i, FixedToFloatBitsLanes<P, 23, 8>(SimdOps::Load(values + i)));
+    }
+    return i;
+}
+
+// values[i] = Primitives::F64ToFixed64 of the double with bit pattern bits[i]
+template <int P>
+inline auto FromF64Batch(const int64_t* bits, int64_t* values, size_t count) noexcept -> size_t {
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        SimdOps::Store(values + i, FloatBitsToFixedLanes<P, 52, 11>(SimdOps::Load(bits + i)));
+    }
+    return i;
+}
+
+// values[i] = Primitives::F32ToFixed64 of the float with bit pattern bits[i]
+template <int P>
+inline auto FromF32Batch(const uint32_t* bits, int64_t* values, size_t count) noexcept -> size_t {
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        SimdOps::Store(values + i, FloatBitsToFixedLanes<P, 23, 8>(SimdOps::LoadU32(bits + i)));
+    }
+    return i;
+}
+
+// Add the sum of values[0, i) to the two's complement 128-bit total (hi, lo), count < 2^32
+// Each value splits into a signed high half and an unsigned low half, x = h * 2^32 + l, which
+// are summed in separate 64-bit lanes; neither lane sum can overflow below 2^32 elements
+inline auto SumBatch(const int64_t* values, size_t count, uint64_t& hi, uint64_t& lo) noexcept
+    -> size_t {
+    const BatchVec kLowMask = SimdOps::Set1(0xFFFFFFFF);
+    BatchVec high_sum = SimdOps::Set1(0);
+    BatchVec low_sum = SimdOps::Set1(0);
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        const BatchVec x = SimdOps::Load(values + i);
+        high_sum = SimdOps::Add(high_sum, SimdOps::ShiftRightArith<32>(x));
+        low_sum = SimdOps::Add(low_sum, SimdOps::And(x, kLowMask));
+    }
+
+    int64_t high_lanes[kBatchLanes];
+    int64_t low_lanes[kBatchLanes];
+    SimdOps::Store(high_lanes, high_sum);
+    SimdOps::Store(low_lanes, low_sum);
+    int64_t high = 0;
+    uint64_t low = 0;
+    for (size_t lane = 0; lane < kBatchLanes; ++lane) {
+        high += high_lanes[lane];
+        low += static_cast<uint64_t>(low_lanes[lane]);
+    }
+
+    // total += high * 2^32 + low
+    const uint64_t shifted = static_cast<uint64_t>(high) << 32;
+    lo += low;
+    hi += static_cast<uint64_t>(high >> 32) + ((lo < low) ? 1 : 0);
+    lo += shifted;
+    hi += (lo < shifted) ? 1 : 0;
+    return i;
+}
+
+// Narrow [min, max] to include values[0, i)
+// Two independent sets of lanes hide the compare-and-select latency
+inline auto MinMaxBatch(const int64_t* values, size_t count, int64_t& min, int64_t& max) noexcept
+    -> size_t {
+    BatchVec vmin = SimdOps::Set1(min);
+    BatchVec vmax = SimdOps::Set1(max);
+    BatchVec vmin2 = vmin;
+    BatchVec vmax2 = vmax;
+    size_t i = 0;
+    for (; i + 2 * kBatchLanes <= count; i += 2 * kBatchLanes) {
+        const BatchVec x = SimdOps::Load(values + i);
+        const BatchVec y = SimdOps::Load(values + i + kBatchLanes);
+        vmin = SimdOps::Select(SimdOps::CmpGt(vmin, x), x, vmin);
+        vmax = SimdOps::Select(SimdOps::CmpGt(x, vmax), x, vmax);
+        vmin2 = SimdOps::Select(SimdOps::CmpGt(vmin2, y), y, vmin2);
+        vmax2 = SimdOps::Select(SimdOps::CmpGt(y, vmax2), y, vmax2);
+    }
+    vmin = SimdOps::Select(SimdOps::CmpGt(vmin, vmin2), vmin2, vmin);
+    vmax = SimdOps::Select(SimdOps::CmpGt(vmax2, vmax), vmax2, vmax);
+
+    int64_t min_lanes[kBatchLanes];
+    int64_t max_lanes[kBatchLanes];
+    SimdOps::Store(min_lanes, vmin);
+    SimdOps::Store(max_lanes, vmax);
+    for (size_t lane = 0; lane < kBatchLanes; ++lane) {
+        min = min_lanes[lane] < min ? min_lanes[lane] : min;
+        max = max_lanes[lane] > max ? max_lanes[lane] : max;
+    }
+    return i;
+}
+
+// Add the number of values[0, i) below key to less. The compare masks select 1 or 0 per lane, so
+// the count needs no branch; on a sorted window it is the offset of the lower bound
+inline auto CountLessBatch(const int64_t* values, size_t count, int64_t key, size_t& less) noexcept
+    -> size_t {
+    const BatchVec vkey = SimdOps::Set1(key);
+    const BatchVec one = SimdOps::Set1(1);
+    const BatchVec zero = SimdOps::Set1(0);
+    BatchVec total = zero;
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        const BatchVec x = SimdOps::Load(values + i);
+        total = SimdOps::Add(total, SimdOps::Select(SimdOps::CmpGt(vkey, x), one, zero));
+    }
+
+    int64_t lanes[kBatchLanes];
+    SimdOps::Store(lanes, total);
+    for (size_t lane = 0; lane < kBatchLanes; ++lane) {
+        less += static_cast<size_t>(lanes[lane]);
+    }
+    return i;
+}
+
+// Accumulate step of Fixed64Hash over stripes of 8 words: acc[j] += w + lo32(w ^ key[j]) *
+// hi32(w ^ key[j]) for word j of every stripe. The 8 accumulators stay in 8 / kBatchLanes
+// vectors for the whole call
+inline auto HashStripesBatch(const int64_t* words, size_t stripes, const uint64_t* key,
+                             uint64_t* acc) noexcept -> size_t {
+    constexpr size_t kVecs = 8 / kBatchLanes;
+    static_assert(kVecs * kBatchLanes == 8, "The lanes must split a stripe evenly");
+    BatchVec sums[kVecs];
+    BatchVec keys[kVecs];
+    for (size_t v = 0; v < kVecs; ++v) {
+        sums[v] = SimdOps::Load(reinterpret_cast<const int64_t*>(acc) + v * kBatchLanes);
+        keys[v] = SimdOps::Load(reinterpret_cast<const int64_t*>(key) + v * kBatchLanes);
+    }
+    for (size_t s = 0; s < stripes; ++s) {
+        for (size_t v = 0; v < kVecs; ++v) {
+            const BatchVec w = SimdOps::Load(words + s * 8 + v * kBatchLanes);
+            const BatchVec k = SimdOps::Xor(w, keys[v]);
+            const BatchVec product = SimdOps::MulU32(k, SimdOps::ShiftRightLogical<32>(k));
+            sums[v] = SimdOps::Add(sums[v], SimdOps::Add(w, product));
+        }
+    }
+    for (size_t v = 0; v < kVecs; ++v) {
+        SimdOps::Store(reinterpret_cast<int64_t*>(acc) + v * kBatchLanes, sums[v]);
+    }
+    return stripes;
+}
+
+// Counter-based generator output: draws[i] = Mix64(key + (first + i) * gamma) >> 32, where
+// Mix64 is the SplitMix64 finalizer of Fixed64Random. The counters advance by an addition, so
+// the two 64-bit multiplies of the finalizer are the only products per lane
+inline auto CounterDrawBatch(uint64_t key, uint64_t first, uint64_t gamma, uint32_t* draws,
+                             size_t count) noexcept -> size_t {
+    int64_t start[kBatchLanes];
+    for (size_t lane = 0; lane < kBatchLanes; ++lane) {
+        start[lane] = static_cast<int64_t>(key + (first + lane) * gamma);
+    }
+    BatchVec counter = SimdOps::Load(start);
+    const BatchVec step = SimdOps::Set1(static_cast<int64_t>(gamma * kBatchLanes));
+    const BatchVec kMul1 = SimdOps::Set1(static_cast<int64_t>(0xBF58476D1CE4E5B9ULL));
+    const BatchVec kMul2 = SimdOps::Set1(static_cast<int64_t>(0x94D049BB133111EBULL));
+
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        BatchVec z = counter;
+        z = MulLo64Lanes(SimdOps::Xor(z, SimdOps::ShiftRightLogical<30>(z)), kMul1);
+        z = MulLo64Lanes(SimdOps::Xor(z, SimdOps::ShiftRightLogical<27>(z)), kMul2);
+        z = SimdOps::Xor(z, SimdOps::ShiftRightLogical<31>(z));
+        SimdOps::StoreU32(draws + i, SimdOps::ShiftRightLogical<32>(z));
+        counter = SimdOps::Add(counter, step);
+    }
+    return i;
+}
+
+// Fraction in [0, 1) with 16 bits that Fixed64Random::random() derives from a draw:
+// (draw & INT32_MAX) / 2^31 == (draw & INT32_MAX) >> 15
+inline auto UnitFractionLanes(const uint32_t* draws) noexcept -> BatchVec {
+    return SimdOps::ShiftRightLogical<15>(
+        SimdOps::And(SimdOps::LoadU32(draws), SimdOps::Set1(INT32_MAX)));
+}
+
+// == Primitives::Fixed64Mul(u, b, P) for 0 <= u < 2^16
+// The product u * |b| = h * 2^32 + l splits into h = u * hi32(|b|) < 2^47 and
+// l = u * lo32(|b|) < 2^48, whose shifted sum is exact:
+//   P <= 32: (h << (32 - P)) + (l >> P)
+//   P > 32:  (h + (l >> 32)) >> (P - 32)
+template <int P>
+inline auto MulFrac16Lanes(BatchVec u, BatchVec b) noexcept -> BatchVec {
+    const BatchVec s_b = SimdOps::ShiftRightArith<63>(b);
+    const BatchVec v = ApplySignLanes(b, s_b);
+    const BatchVec h = SimdOps::MulU32(u, SimdOps::ShiftRightLogical<32>(v));
+    const BatchVec l = SimdOps::MulU32(u, v);
+    BatchVec product;
+    if constexpr (P <= 32) {
+        product = SimdOps::Add(ShiftLeftLanes<32 - P>(h), SimdOps::ShiftRightLogical<P>(l));
+    } else {
+        product = SimdOps::ShiftRightLogical<P - 32>(
+            SimdOps::Add(h, SimdOps::ShiftRightLogical<32>(l)));
+    }
+    return ApplySignLanes(product, s_b);
+}
+
+// out[i] = Fixed64<P>(u_i * range + min), the value of Fixed64Random::random(min, max):
+// the 16-bit fraction u_i times the Fixed64<P> range and min16 (min converted to 16 fraction
+// bits) are summed with 16 fraction bits, then converted to P
+template <int P>
+inline auto UniformFillBatch(const uint32_t* draws, int64_t range, int64_t min16, int64_t* out,
+                             size_t count) noexcept -> size_t {
+    const BatchVec vrange = SimdOps::Set1(range);
+    const BatchVec vmin = SimdOps::Set1(min16);
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        const BatchVec v =
+            SimdOps::Add(MulFrac16Lanes<P>(UnitFractionLanes(draws + i), vrange), vmin);
+        if constexpr (P >= 16) {
+            SimdOps::Store(out + i, ShiftLeftLanes<P - 16>(v));
+        } else {
+            SimdOps::Store(out + i, ShiftRightArithLanes<16 - P>(v));
+        }
+    }
+    return i;
+}
+
+// out[i] = floor((u_i * range + (min << 16)) / 2^16), the value of
+// Fixed64Random::randomInteger(min, max) with range = max - min
+inline auto IntegerFillBatch(const uint32_t* draws, int64_t range, int64_t min16, int32_t* out,
+                             size_t count) noexcept -> size_t {
+    const BatchVec vrange = SimdOps::Set1(range);
+    const BatchVec vmin = SimdOps::Set1(min16);
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        const BatchVec v = SimdOps::Add(MulLo64Lanes(UnitFractionLanes(draws + i), vrange), vmin);
+        SimdOps::StoreU32(reinterpret_cast<uint32_t*>(out + i), ShiftRightArithLanes<16>(v));
+    }
+    return i;
+}
+
+#else
+inline constexpr size_t kBatchLanes = 1;
+
+// No vector unit available: the caller's scalar loop handles every element
+template <int P>
+inline auto MulBatch(const int64_t*, const int64_t*, int64_t*, size_t) noexcept -> size_t {
+    return 0;
+}
+
+template <int P>
+inline auto MulBatch(const int64_t*, int64_t, int64_t*, size_t) noexcept -> size_t {
+    return 0;
+}
+
+inline auto ZigZagBatch(const int64_t*, const int64_t*, int64_t*, size_t) noexcept -> size_t {
+    return 0;
+}
+
+inline auto UnZigZagBatch(const int64_t*, const int64_t*, int64_t*, size_t) noexcept -> size_t {
+    return 0;
+}
+
+inline auto QuantizeBatch(const int64_t*, int64_t, int64_t, uint64_t, int64_t*, size_t) noexcept
+    -> size_t {
+    return 0;
+}
+
+inline auto DequantizeBatch(const int64_t*, int64_t, uint64_t, uint64_t, int64_t*, size_t) noexcept
+    -> size_t {
+    return 0;
+}
+
+template <int P>
+inline auto ToF64Batch(const int64_t*, int64_t*, size_t) noexcept -> size_t {
+    return 0;
+}
+
+template <int P>
+inline auto ToF32Batch(const int64_t*, uint32_t*, size_t) noexcept -> size_t {
+    return 0;
+}
+
+template <int P>
+inline auto FromF64Batch(const int64_t*, int64_t*, size_t) noexcept -> size_t {
+    return 0;
+}
+
+template <int P>
+inline auto FromF32Batch(const uint32_t*, int64_t*, size_t) noexcept -> size_t {
+    return 0;
+}
+
+inline auto SumBatch(const int64_t*, size_t, uint64_t&, uint64_t&) noexcept -> size_t {
+    return 0;
+}
+
+inline auto MinMaxBatch(const int64_t*, size_t, int64_t&, int64_t&) noexcept -> size_t {
+    return 0;
+}
+
+inline auto CountLessBatch(const int64_t*, size_t, int64_t, size_t&) noexcept -> size_t {
+    return 0;
+}
+
+inline auto HashStripesBatch(const int64_t*, size_t, const uint64_t*, uint64_t*) noexcept
+    -> size_t {
+    return 0;
+}
+
+inline auto CounterDrawBatch(uint64_t, uint64_t, uint64_t, uint32_t*, size_t) noexcept -> size_t {
+    return 0;
+}
+
+template <int P>
+inline auto UniformFillBatch(const uint32_t*, int64_t, int64_t, int64_t*, size_t) noexcept
+    -> size_t {
+    return 0;
+}
+
+inline auto IntegerFillBatch(const uint32_t*, int64_t, int64_t, int32_t*, size_t) noexcept
+    -> size_t {
+    return 0;
+}
+#endif
+
+}  // namespace math::fp::detail
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Set to 0 to run chunked work on the calling thread only (no worker threads are created)
+#ifndef FIXED64_USE_THREADS
+#define FIXED64_USE_THREADS 1
+#endif
+
+namespace math::fp::detail {
+
+// Number of elements per chunk of parallel element-wise work: 16384 * 8 bytes = 128 KB per
+// operand, small enough that a chunk of two inputs and an output stays in L2
+inline constexpr size_t kChunkSize = 16384;
+
+/**
+ * Process-wide pool that runs numbered chunks of a job on all cores
+ *
+ * The caller participates in its own job, and workers claim chunk indices from an atomic
+ * counter, so a thread that finishes early takes the next unclaimed chunk instead of idling.
+ * Chunk boundaries are chosen by the caller and never depend on the number of threads, so
+ * element-wise work produces the same bits however the chunks are distributed. A job may cap
+ * the number of participating threads. Jobs are serialized; a job started from inside a chunk
+ * runs inline on the thread that started it.
+ */
+class ChunkPool {
+ public:
+    static auto Instance() noexcept -> ChunkPool& {
+        static ChunkPool pool;
+        return pool;
+    }
+
+    ChunkPool(const ChunkPool&) = delete;
+    auto operator=(const ChunkPool&) -> ChunkPool& = delete;
+
+    ~ChunkPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    // Number of threads that execute chunks, including the caller
+    [[nodiscard]] auto concurrency() const noexcept -> size_t {
+        return workers_.size() + 1;
+    }
+
+    // Call fn(chunk) for every chunk in [0, chunks), in parallel on at most max_threads threads
+    // including the caller (0 for all of them)
+    template <typename Fn>
+    auto Run(size_t chunks, Fn& fn, size_t max_threads = 0) noexcept -> void {
+        if (chunks <= 1 || workers_.empty() || inside_job_ || max_threads == 1) {
+            for (size_t c = 0; c < chunks; ++c) {
+                fn(c);
+            }
+            return;
+        }
+
+        std::lock_guard<std::mutex> run_lock(run_mutex_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            invoke_ = [](void* ctx, size_t c) { (*static_cast<Fn*>(ctx))(c); };
+            ctx_ = &fn;
+            total_ = chunks;
+            worker_limit_ = max_threads == 0 ? workers_.size() : max_threads - 1;
+            next_.store(0, std::memory_order_relaxed);
+            ++generation_;
+        }
+        wake_.notify_all();
+
+        inside_job_ = true;
+        for (size_t c; (c = next_.fetch_add(1, std::memory_order_relaxed)) < chunks;) {
+            fn(c);
+        }
+        inside_job_ = false;
+
+        // Every chunk is claimed; wait for the workers still running one
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return active_ == 0; });
+        invoke_ = nullptr;
+        ctx_ = nullptr;
+    }
+
+ private:
+    ChunkPool() noexcept {
+#if FIXED64_USE_THREADS
+        const unsigned hardware = std::thread::hardware_concurrency();
+        const size_t count = hardware > 1 ? hardware - 1 : 0;
+        try {
+            workers_.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                workers_.emplace_back([this, i] { WorkerLoop(i); });
+            }
+        } catch (...) {
+            // Run with however many workers could be started
+        }
+#endif
+    }
+
+    auto WorkerLoop(size_t index) noexcept -> void {
+        inside_job_ = true;
+        size_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            wake_.wait(lock, [&] { return stop_ || (generation_ != seen && invoke_ != nullptr); });
+            if (stop_) {
+                return;
+            }
+            seen = generation_;
+            if (index >= worker_limit_) {
+                continue;  // Not needed for this job
+            }
+            void (*invoke)(void*, size_t) = invoke_;
+            void* ctx = ctx_;
+            const size_t total = total_;
+            ++active_;
+            lock.unlock();
+
+            for (size_t c; (c = next_.fetch_add(1, std::memory_order_relaxed)) < total;) {
+                invoke(ctx, c);
+            }
+
+            lock.lock();
+            if (--active_ == 0) {
+                done_.notify_one();
+            }
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex run_mutex_;  // Serializes jobs
+    std::mutex mutex_;      // Guards the job description below
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    void (*invoke_)(void*, size_t) = nullptr;
+    void* ctx_ = nullptr;
+    size_t total_ = 0;
+    size_t worker_limit_ = 0;  // Workers with a lower index join the job
+    size_t generation_ = 0;
+    size_t active_ = 0;
+    bool stop_ = false;
+    std::atomic<size_t> next_{0};
+    static inline thread_local bool inside_job_ = false;
+};
+
+// Split [0, count) into kChunkSize pieces and call fn(begin, end) for each, in parallel when
+// there is more than one chunk, on at most max_threads threads (0 for the whole pool)
+template <typename Fn>
+inline auto ForEachChunk(size_t count, Fn&& fn, size_t max_threads = 0) noexcept -> void {
+    const size_t chunks = (count + kChunkSize - 1) / kChunkSize;
+    auto chunk = [&](size_t c) {
+        const size_t begin = c * kChunkSize;
+        fn(begin, std::min(begin + kChunkSize, count));
+    };
+    ChunkPool::Instance().Run(chunks, chunk, max_threads);
+}
+
+// Upper bound on the number of partial results of ForEachPart, so they fit on the stack
+inline constexpr size_t kMaxReduceParts = 256;
+
+// Split [0, count) into at most kMaxReduceParts contiguous runs of whole chunks and call
+// fn(part, begin, end) for each, in parallel. Returns the number of parts. The split depends
+// only on count (never on max_threads); exact (integer) reductions give the same result for
+// any split anyway
+template <typename Fn>
+inline auto ForEachPart(size_t count, Fn&& fn, size_t max_threads = 0) noexcept -> size_t {
+    const size_t chunks = (count + kChunkSize - 1) / kChunkSize;
+    if (chunks == 0) {
+        return 0;
+    }
+    const size_t chunks_per_part = (chunks + kMaxReduceParts - 1) / kMaxReduceParts;
+    const size_t parts = (chunks + chunks_per_part - 1) / chunks_per_part;
+    auto part = [&](size_t p) {
+        const size_t begin = p * chunks_per_part * kChunkSize;
+        fn(p, begin, std::min(begin + chunks_per_part * kChunkSize, count));
+    };
+    ChunkPool::Instance().Run(parts, part, max_threads);
+    return parts;
+}
+
+}  // namespace math::fp::detail
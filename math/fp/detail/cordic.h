@@ -0,0 +1,247 @@
+#pragma once
+
+#include <stdint.h>
+#include <array>
+#include <utility>
+#include "primitives.h"
+
+// CORDIC angle table with 62 entries
+// Contains atan(2^-i) values for i=0...61
+// Values scaled by 2^62
+// Generated with mpmath library at 100 digits precision
+
+namespace math::fp::detail {
+inline constexpr int kCordicFractionBits = 62;
+inline constexpr int kCordicMaxIterations = 62;
+
+// Table contains atan(2^-i) values for CORDIC algorithm
+// Values scaled by 2^62
+inline constexpr std::array<int64_t, 62> kCordicAngles = {
+    0x3243F6A8885A308DLL,  // atan(2^-0) = 0.78539816339744828
+    0x1DAC670561BB4F69LL,  // atan(2^-1) = 0.46364760900080609
+    0x0FADBAFC96406EB1LL,  // atan(2^-2) = 0.24497866312686414
+    0x07F56EA6AB0BDB72LL,  // atan(2^-3) = 0.12435499454676144
+    0x03FEAB76E59FBD39LL,  // atan(2^-4) = 0.06241880999595735
+    0x01FFD55BBA97624BLL,  // atan(2^-5) = 0.031239833430268277
+    0x00FFFAAADDDB94D6LL,  // atan(2^-6) = 0.015623728620476831
+    0x007FFF5556EEEA5DLL,  // atan(2^-7) = 0.0078123410601011111
+    0x003FFFEAAAB7776ELL,  // atan(2^-8) = 0.0039062301319669718
+    0x001FFFFD5555BBBCLL,  // atan(2^-9) = 0.0019531225164788188
+    0x000FFFFFAAAAADDELL,  // atan(2^-10) = 0.00097656218955931946
+    0x0007FFFFF555556FLL,  // atan(2^-11) = 0.00048828121119489829
+    0x0003FFFFFEAAAAABLL,  // atan(2^-12) = 0.00024414062014936177
+    0x0001FFFFFFD55555LL,  // atan(2^-13) = 0.00012207031189367021
+    0x0000FFFFFFFAAAABLL,  // atan(2^-14) = 6.1035156174208773e-05
+    0x00007FFFFFFF5555LL,  // atan(2^-15) = 3.0517578115526096e-05
+    0x00003FFFFFFFEAABLL,  // atan(2^-16) = 1.5258789061315762e-05
+    0x00001FFFFFFFFD55LL,  // atan(2^-17) = 7.62939453110197e-06
+    0x00000FFFFFFFFFABLL,  // atan(2^-18) = 3.8146972656064961e-06
+    0x000007FFFFFFFFF5LL,  // atan(2^-19) = 1.907348632810187e-06
+    0x000003FFFFFFFFFFLL,  // atan(2^-20) = 9.5367431640596084e-07
+    0x0000020000000000LL,  // atan(2^-21) = 4.7683715820308884e-07
+    0x0000010000000000LL,  // atan(2^-22) = 2.3841857910155797e-07
+    0x0000008000000000LL,  // atan(2^-23) = 1.1920928955078068e-07
+    0x0000004000000000LL,  // atan(2^-24) = 5.9604644775390552e-08
+    0x0000002000000000LL,  // atan(2^-25) = 2.9802322387695303e-08
+    0x0000001000000000LL,  // atan(2^-26) = 1.4901161193847655e-08
+    0x0000000800000000LL,  // atan(2^-27) = 7.4505805969238281e-09
+    0x0000000400000000LL,  // atan(2^-28) = 3.7252902984619141e-09
+    0x0000000200000000LL,  // atan(2^-29) = 1.862645149230957e-09
+    0x0000000100000000LL,  // atan(2^-30) = 9.3132257461547852e-10
+    0x0000000080000000LL,  // atan(2^-31) = 4.6566128730773926e-10
+    0x0000000040000000LL,  // atan(2^-32) = 2.3283064365386963e-10
+    0x0000000020000000LL,  // atan(2^-33) = 1.1641532182693481e-10
+    0x0000000010000000LL,  // atan(2^-34) = 5.8207660913467407e-11
+    0x0000000008000000LL,  // atan(2^-35) = 2.9103830456733704e-11
+    0x0000000004000000LL,  // atan(2^-36) = 1.4551915228366852e-11
+    0x0000000002000000LL,  // atan(2^-37) = 7.2759576141834259e-12
+    0x0000000001000000LL,  // atan(2^-38) = 3.637978807091713e-12
+    0x0000000000800000LL,  // atan(2^-39) = 1.8189894035458565e-12
+    0x0000000000400000LL,  // atan(2^-40) = 9.0949470177292824e-13
+    0x0000000000200000LL,  // atan(2^-41) = 4.5474735088646412e-13
+    0x0000000000100000LL,  // atan(2^-42) = 2.2737367544323206e-13
+    0x0000000000080000LL,  // atan(2^-43) = 1.1368683772161603e-13
+    0x0000000000040000LL,  // atan(2^-44) = 5.6843418860808015e-14
+    0x0000000000020000LL,  // atan(2^-45) = 2.8421709430404007e-14
+    0x0000000000010000LL,  // atan(2^-46) = 1.4210854715202004e-14
+    0x0000000000008000LL,  // atan(2^-47) = 7.1054273576010019e-15
+    0x0000000000004000LL,  // atan(2^-48) = 3.5527136788005009e-15
+    0x0000000000002000LL,  // atan(2^-49) = 1.7763568394002505e-15
+    0x0000000000001000LL,  // atan(2^-50) = 8.8817841970012523e-16
+    0x0000000000000800LL,  // atan(2^-51) = 4.4408920985006262e-16
+    0x0000000000000400LL,  // atan(2^-52) = 2.2204460492503131e-16
+    0x0000000000000200LL,  // atan(2^-53) = 1.1102230246251565e-16
+    0x0000000000000100LL,  // atan(2^-54) = 5.5511151231257827e-17
+    0x0000000000000080LL,  // atan(2^-55) = 2.7755575615628914e-17
+    0x0000000000000040LL,  // atan(2^-56) = 1.3877787807814457e-17
+    0x0000000000000020LL,  // atan(2^-57) = 6.9388939039072284e-18
+    0x0000000000000010LL,  // atan(2^-58) = 3.4694469519536142e-18
+    0x0000000000000008LL,  // atan(2^-59) = 1.7347234759768071e-18
+    0x0000000000000004LL,  // atan(2^-60) = 8.6736173798840355e-19
+    0x0000000000000002LL   // atan(2^-61) = 4.3368086899420177e-19
+};
+
+// prod(1/sqrt(1 + 2^-2i)), starting value that cancels the gain of the rotations
+inline constexpr int64_t kCordicGain = 0x26DD3B6A10D7969ALL;  // 0.60725293500888122
+// pi/2 = kCordicHalfPiHi + kCordicHalfPiLo * 2^-62
+inline constexpr int64_t kCordicHalfPiHi = 0x6487ED5110B4611ALL;
+inline constexpr int64_t kCordicHalfPiLo = 0x1898CC51701B839ALL;
+inline constexpr int64_t kCordicTwoOverPi = 0x28BE60DB9391054ALL;
+// pi with 61 fraction bits
+inline constexpr int64_t kCordicPi = 0x6487ED5110B4611ALL;
+
+// Number of iterations for fraction_bits + 2 correct bits, each iteration adds one bit
+inline constexpr auto CordicIterations(int fraction_bits) noexcept -> int {
+    return fraction_bits + 3 < kCordicMaxIterations ? fraction_bits + 3 : kCordicMaxIterations;
+}
+
+// Round a value with kCordicFractionBits fraction bits to fraction_bits (at most as many)
+inline constexpr auto CordicRound(int64_t value, int fraction_bits) noexcept -> int64_t {
+    const int shift = kCordicFractionBits - fraction_bits;
+    return shift == 0 ? value : (value + (int64_t(1) << (shift - 1))) >> shift;
+}
+
+// Split an angle with fraction_bits (3-62) fraction bits into x = q*pi/2 + r
+// Returns the quadrant q and r in Q1.62, |r| stays well inside the convergence range of 1.74;
+// pi/2 is used with 124 bits, so r keeps full precision even for the largest angles
+inline constexpr auto CordicReduce(int64_t x, int fraction_bits) noexcept
+    -> std::pair<int64_t, int64_t> {
+    // q = x * 2/pi rounded, ignoring the low product word only matters next to a tie
+    uint64_t hi = 0;
+    uint64_t lo = 0;
+    Primitives::MulAdd128(x, kCordicTwoOverPi, hi, lo);
+    const int shift = fraction_bits + kCordicFractionBits - 64;
+    const int64_t q = (static_cast<int64_t>(hi) + (int64_t(1) << (shift - 1))) >> shift;
+
+    // r = x - q * pi/2 computed in 128 bits, the remainder fits in the low word
+    hi = 0;
+    lo = 0;
+    Primitives::MulAdd128(x, int64_t(1) << (kCordicFractionBits - fraction_bits), hi, lo);
+    Primitives::MulAdd128(-q, kCordicHalfPiHi, hi, lo);
+    const int64_t r = static_cast<int64_t>(lo)
+                      - Primitives::Fixed64Mul<kCordicFractionBits>(q, kCordicHalfPiLo);
+    return {q, r};
+}
+
+// Rotation mode: rotate (kCordicGain, 0) by z, |z| <= 1.74 in Q1.62
+// Returns (cos(z), sin(z)) in Q1.62 using shifts and adds only
+inline constexpr auto CordicRotate(int64_t z, int iterations) noexcept
+    -> std::pair<int64_t, int64_t> {
+    int64_t x = kCordicGain;
+    int64_t y = 0;
+    for (int i = 0; i < iterations; ++i) {
+        // Rotate towards z = 0: counterclockwise while z >= 0, d = -1 flips the direction
+        const int64_t d = z >> 63;
+        const int64_t dx = y >> i;
+        const int64_t dy = x >> i;
+        x -= (dx ^ d) - d;
+        y += (dy ^ d) - d;
+        z -= (kCordicAngles[i] ^ d) - d;
+    }
+    return {x, y};
+}
+
+// Vectoring mode: rotate (x, y) with x >= 0 onto the positive x axis
+// Returns (sqrt(x^2 + y^2) / kCordicGain, atan(y / x) in Q1.62) using shifts and adds only
+// |x| and |y| must stay below 2^61 so the gain of 1.65 cannot overflow
+inline constexpr auto CordicVector(int64_t x, int64_t y, int iterations) noexcept
+    -> std::pair<int64_t, int64_t> {
+    int64_t z = 0;
+    for (int i = 0; i < iterations; ++i) {
+        // Rotate towards y = 0: clockwise while y >= 0, d = -1 flips the direction
+        const int64_t d = y >> 63;
+        const int64_t dx = y >> i;
+        const int64_t dy = x >> i;
+        x += (dx ^ d) - d;
+        y -= (dy ^ d) - d;
+        z += (kCordicAngles[i] ^ d) - d;
+    }
+    return {x, z};
+}
+
+// Shift that scales max(|x|, |y|) into [2^60, 2^61) for CordicVector, negative for right shifts
+inline constexpr auto CordicNormalizeShift(uint64_t abs_x, uint64_t abs_y) noexcept -> int {
+    return Primitives::CountlZero(abs_x | abs_y) - 3;
+}
+
+inline constexpr auto CordicShift(int64_t value, int shift) noexcept -> int64_t {
+    return shift >= 0 ? value << shift : value >> -shift;
+}
+
+// sin(x) and cos(x) with CORDIC rotations
+// Input and output have fraction_bits fraction bits, range 3-62
+// Precision: within 1 ulp up to 54 fraction bits, about 2^-56 above
+inline constexpr auto CordicSinCos(int64_t x, int fraction_bits) noexcept
+    -> std::pair<int64_t, int64_t> {
+    const auto [q, r] = CordicReduce(x, fraction_bits);
+    const auto [c, s] = CordicRotate(r, CordicIterations(fraction_bits));
+    const int64_t sin_r = CordicRound(s, fraction_bits);
+    const int64_t cos_r = CordicRound(c, fraction_bits);
+
+    // Rotate by q quarter turns
+    switch (q & 3) {
+        case 0:
+            return {sin_r, cos_r};
+        case 1:
+            return {cos_r, -sin_r};
+        case 2:
+            return {-sin_r, -cos_r};
+        default:
+            return {-cos_r, sin_r};
+    }
+}
+
+// atan2(y, x) with CORDIC vectoring, in [-pi, pi]
+// Input and output have fraction_bits fraction bits, range 3-61, NaN inputs are not handled
+// (0, 0) gives 0 and (0, x < 0) gives pi within 1 ulp
+inline constexpr auto CordicAtan2(int64_t y, int64_t x, int fraction_bits) noexcept -> int64_t {
+    // (x, y) and (-x, -y) differ by pi: fold into the right half-plane
+    const int64_t flip = x >> 63;
+    const int64_t y_sign = y >> 63;
+    const int64_t abs_x = (x ^ flip) - flip;
+    const int64_t abs_y = (y ^ y_sign) - y_sign;
+    const int64_t folded_y = (y ^ flip) - flip;
+
+    const int shift = CordicNormalizeShift(static_cast<uint64_t>(abs_x),
+                                           static_cast<uint64_t>(abs_y));
+    const int64_t z = CordicVector(CordicShift(abs_x, shift),
+                                   CordicShift(folded_y, shift),
+                                   CordicIterations(fraction_bits))
+                          .second;
+
+    // Add pi for the left half-plane, on the side of the original y
+    const int64_t offset = ((kCordicPi ^ y_sign) - y_sign) & flip;
+    const int64_t angle = (z >> 1) + offset;
+    const int shift_out = kCordicFractionBits - 1 - fraction_bits;
+    return shift_out == 0 ? angle : (angle + (int64_t(1) << (shift_out - 1))) >> shift_out;
+}
+
+// sqrt(x^2 + y^2) with CORDIC vectoring, in the format of the inputs
+// Returns INT64_MAX if the result does not fit; one multiply removes the gain of the rotations
+// Precision: relative error about 2^-54, raw results below 2^53 are within 1 ulp
+inline constexpr auto CordicHypot(int64_t x, int64_t y) noexcept -> int64_t {
+    // 32 iterations leave a relative error of 2^-64 whatever the format
+    constexpr int kIterations = 32;
+    const uint64_t abs_x = x < 0 ? 0 - static_cast<uint64_t>(x) : static_cast<uint64_t>(x);
+    const uint64_t abs_y = y < 0 ? 0 - static_cast<uint64_t>(y) : static_cast<uint64_t>(y);
+    if ((abs_x | abs_y) == 0) {
+        return 0;
+    }
+
+    const int shift = CordicNormalizeShift(abs_x, abs_y);
+    const int64_t length = CordicVector(CordicShift(static_cast<int64_t>(abs_x), shift),
+                                        CordicShift(static_cast<int64_t>(abs_y), shift),
+                                        kIterations)
+                               .first;
+    uint64_t hi = 0;
+    uint64_t lo = 0;
+    Primitives::MulAdd128(length, kCordicGain, hi, lo);
+
+    // Undo the normalization, the scaled length has at least 60 significant bits
+    const int64_t scaled = Primitives::Round128(hi, lo, kCordicFractionBits);
+    if (shift > 0) {
+        return (scaled + (int64_t(1) << (shift - 1))) >> shift;
+    }
+    return scaled > (INT64_MAX >> -shift) ? INT64_MAX : scaled << -shift;
+}
+}  // namespace math::fp::detail
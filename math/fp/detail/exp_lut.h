@@ -0,0 +1,411 @@
+#pragma once
+
+#include <stdint.h>
+#include <array>
+#include <utility>
+#include "primitives.h"
+
+// Exp2 and log2 lookup tables with 64 entries each and remainder polynomials
+// Values in Q1.62 format (1536 bytes of tables)
+// Generated with mpmath library at 100 digits precision (Remez exchange)
+// kExp2PolyLow: degree 2, max error 1.799e-11
+// kLog2PolyLow: degree 3, max error 2.033e-12
+// kExp2PolyHigh: degree 4, max error 4.399e-18
+// kLog2PolyHigh: degree 5, max error 2.182e-17
+
+namespace math::fp::detail {
+inline constexpr int kExpLutBits = 6;
+inline constexpr int kExpLutFractionBits = 62;
+
+// Table maps i to 2^(i/64)
+alignas(64) inline constexpr std::array<int64_t, 64> kExp2Lut = {
+    0x4000000000000000LL,  // 2^(0/64) = 1.00000000000000
+    0x40B268F9DE0183BALL,  // 2^(1/64) = 1.01088928605170
+    0x4166C34C5615D0ECLL,  // 2^(2/64) = 1.02189714865412
+    0x421D1461D66F2023LL,  // 2^(3/64) = 1.03302487902123
+    0x42D561B3E6243D8ALL,  // 2^(4/64) = 1.04427378242741
+    0x438FB0CB4F468808LL,  // 2^(5/64) = 1.05564517836056
+    0x444C0740496D4294LL,  // 2^(6/64) = 1.06714040067682
+    0x450A6ABAA4B77ECDLL,  // 2^(7/64) = 1.07876079775712
+    0x45CAE0F1F545EB73LL,  // 2^(8/64) = 1.09050773266526
+    0x468D6FADBF2DD4F3LL,  // 2^(9/64) = 1.10238258330784
+    0x47521CC5A2E6A9E0LL,  // 2^(10/64) = 1.11438674259589
+    0x4818EE218A3358EELL,  // 2^(11/64) = 1.12652161860824
+    0x48E1E9B9D588E19BLL,  // 2^(12/64) = 1.13878863475669
+    0x49AD159789F37496LL,  // 2^(13/64) = 1.15118922995298
+    0x4A7A77D47F7B84B1LL,  // 2^(14/64) = 1.16372485877758
+    0x4B4A169B900C2D00LL,  // 2^(15/64) = 1.17639699165028
+    0x4C1BF828C6DC54B8LL,  // 2^(16/64) = 1.18920711500272
+    0x4CF022C9905BFD32LL,  // 2^(17/64) = 1.20215673145270
+    0x4DC69CDCEAA72A9CLL,  // 2^(18/64) = 1.21524735998047
+    0x4E9F6CD3967FDBA8LL,  // 2^(19/64) = 1.22848053610687
+    0x4F7A993048D088D7LL,  // 2^(20/64) = 1.24185781207348
+    0x50582887DCB8A7E1LL,  // 2^(21/64) = 1.25538075702469
+    0x513821818624B40CLL,  // 2^(22/64) = 1.26905095719173
+    0x521A8AD704F3404FLL,  // 2^(23/64) = 1.28287001607878
+    0x52FF6B54D8A89C75LL,  // 2^(24/64) = 1.29683955465101
+    0x53E6C9DA74B29AB5LL,  // 2^(25/64) = 1.31096121152476
+    0x54D0AD5A753E077CLL,  // 2^(26/64) = 1.32523664315974
+    0x55BD1CDAD49F699CLL,  // 2^(27/64) = 1.33966752405330
+    0x56AC1F752150A563LL,  // 2^(28/64) = 1.35425554693689
+    0x579DBC56B48521BALL,  // 2^(29/64) = 1.36900242297459
+    0x5891FAC0E95612C8LL,  // 2^(30/64) = 1.38390988196383
+    0x5988E20954889245LL,  // 2^(31/64) = 1.39897967253831
+    0x5A827999FCEF3242LL,  // 2^(32/64) = 1.41421356237310
+    0x5B7EC8F19468BBC9LL,  // 2^(33/64) = 1.42961333839197
+    0x5C7DD7A3B17DCF75LL,  // 2^(34/64) = 1.44518080697705
+    0x5D7FAD59099F22FELL,  // 2^(35/64) = 1.46091779418065
+    0x5E8451CFAC061B5FLL,  // 2^(36/64) = 1.47682614593950
+    0x5F8BCCDB3D398841LL,  // 2^(37/64) = 1.49290772829126
+    0x6096266533384A2BLL,  // 2^(38/64) = 1.50916442759342
+    0x61A3666D124BB204LL,  // 2^(39/64) = 1.52559815074454
+    0x62B39508AA836D6FLL,  // 2^(40/64) = 1.54221082540794
+    0x63C6BA6455DCD8AELL,  // 2^(41/64) = 1.55900440023784
+    0x64DCDEC3371793D1LL,  // 2^(42/64) = 1.57598084510789
+    0x65F60A7F79393E2ELL,  // 2^(43/64) = 1.59314215134227
+    0x6712460A8FC24072LL,  // 2^(44/64) = 1.61049033194925
+    0x683199ED779592CALL,  // 2^(45/64) = 1.62802742185735
+    0x69540EC8F895722DLL,  // 2^(46/64) = 1.64575547815396
+    0x6A79AD55E7F6FD10LL,  // 2^(47/64) = 1.66367658032674
+    0x6BA27E656B4EB57ALL,  // 2^(48/64) = 1.68179283050743
+    0x6CCE8AE13C57EBDBLL,  // 2^(49/64) = 1.70010635371852
+    0x6DFDDBCBED791BABLL,  // 2^(50/64) = 1.71861929812248
+    0x6F307A412F074892LL,  // 2^(51/64) = 1.73733383527371
+    0x70666F76154A7089LL,  // 2^(52/64) = 1.75625216037330
+    0x719FC4B95F452D29LL,  // 2^(53/64) = 1.77537649252652
+    0x72DC8373BE41A454LL,  // 2^(54/64) = 1.79470907500311
+    0x741CB5281E25EE34LL,  // 2^(55/64) = 1.81425217550040
+    0x75606373EE921C97LL,  // 2^(56/64) = 1.83400808640934
+    0x76A7980F6CCA15C2LL,  // 2^(57/64) = 1.85397912508339
+    0x77F25CCDEE6D7AE6LL,  // 2^(58/64) = 1.87416763411030
+    0x7940BB9E2CFFD89DLL,  // 2^(59/64) = 1.89457598158697
+    0x7A92BE8A92436616LL,  // 2^(60/64) = 1.91520656139715
+    0x7BE86FB985689DDCLL,  // 2^(61/64) = 1.93606179349229
+    0x7D41D96DB915019DLL,  // 2^(62/64) = 1.95714412417540
+    0x7E9F06067A4360BALL  // 2^(63/64) = 1.97845602638795
+};
+
+// Table maps i to 1 / (1 + i/64)
+alignas(64) inline constexpr std::array<int64_t, 64> kLog2InvLut = {
+    0x4000000000000000LL,
+    0x3F03F03F03F03F04LL,
+    0x3E0F83E0F83E0F84LL,
+    0x3D226357E16ECE54LL,
+    0x3C3C3C3C3C3C3C3CLL,
+    0x3B5CC0ED7303B5CCLL,
+    0x3A83A83A83A83A84LL,
+    0x39B0AD12073615A2LL,
+    0x38E38E38E38E38E4LL,
+    0x381C0E070381C0E0LL,
+    0x3759F22983759F23LL,
+    0x369D0369D0369D03LL,
+    0x35E50D79435E50D8LL,
+    0x3531DEC0D4C77B03LL,
+    0x3483483483483483LL,
+    0x33D91D2A2067B23ALL,
+    0x3333333333333333LL,
+    0x329161F9ADD3C0CALL,
+    0x31F3831F3831F383LL,
+    0x3159721ED7E75347LL,
+    0x30C30C30C30C30C3LL,
+    0x3030303030303030LL,
+    0x2FA0BE82FA0BE830LL,
+    0x2F149902F149902FLL,
+    0x2E8BA2E8BA2E8BA3LL,
+    0x2E05C0B81702E05CLL,
+    0x2D82D82D82D82D83LL,
+    0x2D02D02D02D02D03LL,
+    0x2C8590B21642C859LL,
+    0x2C0B02C0B02C0B03LL,
+    0x2B9310572620AE4CLL,
+    0x2B1DA46102B1DA46LL,
+    0x2AAAAAAAAAAAAAABLL,
+    0x2A3A0FD5C5F02A3ALL,
+    0x29CBC14E5E0A72F0LL,
+    0x295FAD40A57EB503LL,
+    0x28F5C28F5C28F5C3LL,
+    0x288DF0CAC5B3F5DDLL,
+    0x2828282828282828LL,
+    0x27C45979C95204F9LL,
+    0x2762762762762762LL,
+    0x2702702702702702LL,
+    0x26A439F656F1826ALL,
+    0x2647C69456217ECELL,
+    0x25ED097B425ED098LL,
+    0x2593F69B02593F6ALL,
+    0x253C8253C8253C82LL,
+    0x24E6A171024E6A17LL,
+    0x2492492492492492LL,
+    0x243F6F0243F6F024LL,
+    0x23EE08FB823EE090LL,
+    0x239E0D5B450239E1LL,
+    0x234F72C234F72C23LL,
+    0x2302302302302302LL,
+    0x22B63CBEEA4E1A09LL,
+    0x226B90226B90226CLL,
+    0x2222222222222222LL,
+    0x21D9EAD7CD391FBCLL,
+    0x2192E29F79B47582LL,
+    0x214D0214D0214D02LL,
+    0x2108421084210842LL,
+    0x20C49BA5E353F7CFLL,
+    0x2082082082082082LL,
+    0x2040810204081020LL
+};
+
+// Table maps i to -log2(kLog2InvLut[i])
+alignas(64) inline constexpr std::array<int64_t, 64> kLog2Lut = {
+    0x0000000000000000LL,  // 0.00000000000000
+    0x016E79685C2D2299LL,  // 0.02236781302845
+    0x02D75A6EB1DFB0E6LL,  // 0.04439411935845
+    0x043ACE27E8A7E6ADLL,  // 0.06608919045777
+    0x0598FDBEB244C5A0LL,  // 0.08746284125034
+    0x06F210902B6AEE99LL,  // 0.10852445677817
+    0x08462C466D3CF1CBLL,  // 0.12928301694497
+    0x099574F13C570D10LL,  // 0.14974711950468
+    0x0AE00D1CFDEB43CFLL,  // 0.16992500144231
+    0x0C2615E81781D980LL,  // 0.18982455888002
+    0x0D67AF16DA7649F7LL,  // 0.20945336562895
+    0x0EA4F726192CB7E5LL,  // 0.22881869049588
+    0x0FDE0B5C81340511LL,  // 0.24792751344359
+    0x111307DAD30B75CCLL,  // 0.26678654069490
+    0x124407AB0E073983LL,  // 0.28540221886225
+    0x137124CEA4CDECDALL,  // 0.30378074817710
+    0x149A784BCD1B8AFFLL,  // 0.32192809488736
+    0x15C01A39FBD687A0LL,  // 0.33985000288462
+    0x16E221CD9D0CDE58LL,  // 0.35755200461808
+    0x1800A563161C5433LL,  // 0.37503943134692
+    0x191BBA891F1708B5LL,  // 0.39231742277876
+    0x1A33760A7F60509ELL,  // 0.40939093613770
+    0x1B47EBF73882A0A3LL,  // 0.42626475470210
+    0x1C592FAD295B567FLL,  // 0.44294349584873
+    0x1D6753E032EA0EFELL,  // 0.45943161863730
+    0x1E726AA1E754D20CLL,  // 0.47573343096640
+    0x1F7A8568CB06CECELL,  // 0.49185309632967
+    0x207FB5172F32FE67LL,  // 0.50779464019870
+    0x21820A01AC754CB1LL,  // 0.52356195605701
+    0x228193F543CA873CLL,  // 0.53915881110803
+    0x237E623D2BA01BC8LL,  // 0.55458885167764
+    0x247883A84E4F9010LL,  // 0.56985560833095
+    0x2570068E7EF5A1E7LL,  // 0.58496250072116
+    0x2664F8D569394D91LL,  // 0.59991284218713
+    0x275767F54042CD9ALL,  // 0.61470984411521
+    0x284760FD30D552CDLL,  // 0.62935662007961
+    0x2934F0979A3715FCLL,  // 0.64385618977472
+    0x2A20230E1151F1BBLL,  // 0.65821148275179
+    0x2B09044D313A6787LL,  // 0.67242534197150
+    0x2BEF9FE83C135D71LL,  // 0.68650052718322
+    0x2CD4011C8F11979BLL,  // 0.70043971814109
+    0x2DB632D4EC3293B4LL,  // 0.71424551766612
+    0x2E963FAC9C0EA78ELL,  // 0.72792045456320
+    0x2F7431F26A05C813LL,  // 0.74146698640115
+    0x305013AB7CE0E5B7LL,  // 0.75488750216347
+    0x3129EE960DDF1680LL,  // 0.76818432477693
+    0x3201CC2C000599FDLL,  // 0.78135971352466
+    0x32D7B5A5596BEBE0LL,  // 0.79441586635011
+    0x33ABB3FAA02166CELL,  // 0.80735492205760
+    0x347DCFE71C303DA2LL,  // 0.82017896241519
+    0x354E11EB0029A6F9LL,  // 0.83289001416474
+    0x361C824D7990D7AFLL,  // 0.84549005094438
+    0x36E9291EAA65B497LL,  // 0.85798099512757
+    0x37B40E398CFCDB6BLL,  // 0.87036471958340
+    0x387D3945C340AA66LL,  // 0.88264304936184
+    0x3944B1B952662C6BLL,  // 0.89481776330794
+    0x3A0A7EDA4C112CE7LL,  // 0.90689059560852
+    0x3ACEA7C065D41DFDLL,  // 0.91886323727459
+    0x3B9133567FEAD8BDLL,  // 0.93073733756289
+    0x3C52285C1C028040LL,  // 0.94251450533924
+    0x3D118D66C4D4E554LL,  // 0.95419631038688
+    0x3DCF68E36752A0FALL,  // 0.96578428466209
+    0x3E8BC1179E0CAA9DLL,  // 0.97727992349992
+    0x3F469C22EF8466C6LL  // 0.98868468677217
+};
+
+// Coefficients c0..cN of (2^t - 1) / t and log2(1 + r) / r on [0, 1/64]
+inline constexpr std::array<int64_t, 3> kExp2PolyLow = {
+    0x2C5C85FF30FCFD78LL,
+    0x0F5FD9705F74F3CFLL,
+    0x03911515CFE1ADB5LL
+};
+inline constexpr std::array<int64_t, 4> kLog2PolyLow = {
+    0x5C551D948A4A22BFLL,
+    -0x2E2A8DAB5ABE7E19LL,
+    0x1EC5A1BB032998B3LL,
+    -0x168444222B5533C2LL
+};
+inline constexpr std::array<int64_t, 5> kExp2PolyHigh = {
+    0x2C5C85FDF473E37DLL,
+    0x0F5FDEFFC123696CLL,
+    0x038D611B5F44A056LL,
+    0x009D9502DA346F69LL,
+    0x0015F1CD636A477ALL
+};
+inline constexpr std::array<int64_t, 6> kLog2PolyHigh = {
+    0x5C551D94AE0BDF36LL,
+    -0x2E2A8ECA55402912LL,
+    0x1EC709D70B18B39ALL,
+    -0x171541D9568A54D2LL,
+    0x1274BC7FE43D1CDALL,
+    -0x0EC94B572F8F66F8LL
+};
+
+inline constexpr int64_t kExpLog2E = 0x5C551D94AE0BF85ELL;  // log2(e)
+inline constexpr int64_t kExpLn2 = 0x2C5C85FDF473DE6BLL;  // ln(2)
+
+// Formats supported by the lookup functions below
+template <int P>
+inline constexpr bool kExpLutSupported = P >= 2 && P <= 56;
+
+// Formats above Q31.32 use the higher-degree polynomials
+template <int P>
+inline constexpr bool kExpLutHighPrecision = P > 32;
+
+// Estrin's scheme: pairs c[2k] + c[2k+1]*t are independent and combined by Horner's method in
+// t^2, which halves the chain of dependent multiplies on the critical path
+template <size_t N>
+inline constexpr auto EvalExpPoly(const std::array<int64_t, N>& c, int64_t t) noexcept
+    -> int64_t {
+    constexpr size_t kPairs = (N + 1) / 2;
+    std::array<int64_t, kPairs> pairs{};
+    for (size_t k = 0; k < kPairs; ++k) {
+        pairs[k] = 2 * k + 1 < N
+                       ? c[2 * k] + Primitives::Fixed64Mul<kExpLutFractionBits>(c[2 * k + 1], t)
+                       : c[2 * k];
+    }
+    const int64_t t2 = Primitives::Fixed64Mul<kExpLutFractionBits>(t, t);
+    int64_t result = pairs[kPairs - 1];
+    for (size_t k = kPairs - 1; k-- > 0;) {
+        result = pairs[k] + Primitives::Fixed64Mul<kExpLutFractionBits>(result, t2);
+    }
+    return result;
+}
+
+// 2^f for a fraction f in [0, 1) with 62 fraction bits
+// Output in Q1.62, an entry of kExp2Lut times a short polynomial in the remaining bits
+template <bool kHighPrecision>
+inline constexpr auto Exp2Mantissa(uint64_t f) noexcept -> int64_t {
+    constexpr int kShift = kExpLutFractionBits - kExpLutBits;
+    const int64_t entry = kExp2Lut[f >> kShift];
+    const int64_t t = static_cast<int64_t>(f & ((uint64_t(1) << kShift) - 1));
+    int64_t q = 0;
+    if constexpr (kHighPrecision) {
+        q = Primitives::Fixed64Mul<kExpLutFractionBits>(t, EvalExpPoly(kExp2PolyHigh, t));
+    } else {
+        q = Primitives::Fixed64Mul<kExpLutFractionBits>(t, EvalExpPoly(kExp2PolyLow, t));
+    }
+
+    // entry * (1 + q), both terms are non-negative; values just below 2 may round up to 2
+    const uint64_t m = static_cast<uint64_t>(entry)
+                       + Primitives::MulU64Shifted<kExpLutFractionBits>(
+                           static_cast<uint64_t>(entry), static_cast<uint64_t>(q));
+    return m > static_cast<uint64_t>(INT64_MAX) ? INT64_MAX : static_cast<int64_t>(m);
+}
+
+// m * 2^n in a format with fraction_bits fraction bits, rounded to nearest
+// m is a Q1.62 mantissa; saturates to INT64_MAX and underflows to 0
+inline constexpr auto ScaleExp2(int64_t m, int64_t n, int fraction_bits) noexcept -> int64_t {
+    const int64_t shift = kExpLutFractionBits - fraction_bits - n;
+    if (shift < 0) {
+        return INT64_MAX;
+    }
+    if (shift > 63) {
+        return 0;
+    }
+    if (shift == 0) {
+        return m;
+    }
+    return static_cast<int64_t>((static_cast<uint64_t>(m) + (uint64_t(1) << (shift - 1)))
+                                >> shift);
+}
+
+// Split the 128-bit value (hi:lo) with fraction_bits fraction bits (2-125) into its floor n and
+// its fraction in [0, 1) with 62 fraction bits; |n| is clamped to 2^42, far outside any format
+inline constexpr auto SplitExp2Argument(uint64_t hi, uint64_t lo, int fraction_bits) noexcept
+    -> std::pair<int64_t, uint64_t> {
+    const int shift = fraction_bits - kExpLutFractionBits;
+    int64_t top = static_cast<int64_t>(hi);
+    uint64_t bottom = lo;
+    if (shift > 0) {
+        bottom = (lo >> shift) | (hi << (64 - shift));
+        top = static_cast<int64_t>(hi) >> shift;
+    } else if (shift < 0) {
+        top = static_cast<int64_t>((hi << -shift) | (lo >> (64 + shift)));
+        bottom = lo << -shift;
+    }
+
+    constexpr int64_t kLimit = int64_t(1) << 40;
+    const uint64_t fraction = bottom & ((uint64_t(1) << kExpLutFractionBits) - 1);
+    if (top >= kLimit || top < -kLimit) {
+        return {top < 0 ? -(kLimit << 2) : kLimit << 2, fraction};
+    }
+    return {static_cast<int64_t>((static_cast<uint64_t>(top) << 2) | (bottom >> 62)), fraction};
+}
+
+// log2(x) for x > 0 with fraction_bits fraction bits, output in Q7.56
+// x is normalized to [1, 2), divided by the nearest table point below it with one multiply
+// by kLog2InvLut and the remaining log2(1 + r), r < 1/64, is a short polynomial
+template <bool kHighPrecision>
+inline constexpr auto Log2Q56(int64_t x, int fraction_bits) noexcept -> int64_t {
+    constexpr int kShift = kExpLutFractionBits - kExpLutBits;
+    const int msb = 63 - Primitives::CountlZero(static_cast<uint64_t>(x));
+    const int64_t m = x << (kExpLutFractionBits - msb);
+    const int i = static_cast<int>((m >> kShift) & ((1 << kExpLutBits) - 1));
+    const int64_t r = Primitives::Fixed64Mul<kExpLutFractionBits>(m, kLog2InvLut[i])
+                      - (int64_t(1) << kExpLutFractionBits);
+    int64_t frac = kLog2Lut[i];
+    if constexpr (kHighPrecision) {
+        frac += Primitives::Fixed64Mul<kExpLutFractionBits>(r, EvalExpPoly(kLog2PolyHigh, r));
+    } else {
+        frac += Primitives::Fixed64Mul<kExpLutFractionBits>(r, EvalExpPoly(kLog2PolyLow, r));
+    }
+    return (int64_t(msb - fraction_bits) << 56) + ((frac + 32) >> 6);
+}
+
+// 2^x, input and output in Q(63-P).P, saturating to INT64_MAX
+template <int P>
+inline constexpr auto LookupPow2(int64_t x) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kExpLookup);
+    const int64_t n = x >> P;
+    const uint64_t f = static_cast<uint64_t>(x & ((int64_t(1) << P) - 1)) << (62 - P);
+    return ScaleExp2(Exp2Mantissa<kExpLutHighPrecision<P>>(f), n, P);
+}
+
+// e^x = 2^(x * log2(e)), input and output in Q(63-P).P, saturating to INT64_MAX
+// The product with log2(e) is kept in 128 bits so large arguments keep their fraction
+template <int P>
+inline constexpr auto LookupExp(int64_t x) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kExpLookup);
+    uint64_t hi = 0;
+    uint64_t lo = 0;
+    Primitives::MulAdd128(x, kExpLog2E, hi, lo);
+    const auto [n, f] = SplitExp2Argument(hi, lo, P + kExpLutFractionBits);
+    return ScaleExp2(Exp2Mantissa<kExpLutHighPrecision<P>>(f), n, P);
+}
+
+// ln(x) = log2(x) * ln(2) for x > 0, input and output in Q(63-P).P
+template <int P>
+inline constexpr auto LookupLog(int64_t x) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kLogLookup);
+    const int64_t result = Primitives::Fixed64Mul<kExpLutFractionBits>(
+        Log2Q56<kExpLutHighPrecision<P>>(x, P), kExpLn2);
+    constexpr int kShift = 56 - P;
+    if constexpr (kShift == 0) {
+        return result;
+    } else {
+        return (result + (int64_t(1) << (kShift - 1))) >> kShift;
+    }
+}
+
+// x^y = 2^(y * log2(x)) for x > 0, input and output in Q(63-P).P, saturating to INT64_MAX
+// log2(x) is kept with 56 fraction bits and multiplied by y in 128 bits, so y * log2(x) is
+// not rounded to P bits as in Exp(y * Log(x))
+template <int P>
+inline constexpr auto LookupPow(int64_t x, int64_t y) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kPowLookup);
+    uint64_t hi = 0;
+    uint64_t lo = 0;
+    Primitives::MulAdd128(y, Log2Q56<kExpLutHighPrecision<P>>(x, P), hi, lo);
+    const auto [n, f] = SplitExp2Argument(hi, lo, P + 56);
+    return ScaleExp2(Exp2Mantissa<kExpLutHighPrecision<P>>(f), n, P);
+}
+}  // namespace math::fp::detail
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include "primitives.h"
+
+namespace math::fp::detail {
+
+// Format conversions between Q(63-P).P and the Q31.32 trigonometric tables
+// The lookups take P as a template parameter, so each conversion is a fixed shift (or nothing
+// at P = 32) instead of a runtime comparison of the fraction bits
+
+// Fraction bits of the trigonometric tables and their interpolation
+inline constexpr int kLutFractionBits = 32;
+
+// Converts a raw value to Q31.32, narrowing truncates toward negative infinity
+// Below 32 fraction bits the value must fit in Q31.32
+template <int P>
+inline constexpr auto ToLutFormat(int64_t x) noexcept -> int64_t {
+    if constexpr (P > kLutFractionBits) {
+        return x >> (P - kLutFractionBits);
+    } else {
+        return x << (kLutFractionBits - P);
+    }
+}
+
+// Converts a raw Q31.32 result back to P fraction bits, narrowing truncates toward negative
+// infinity
+template <int P>
+inline constexpr auto FromLutFormat(int64_t x) noexcept -> int64_t {
+    if constexpr (P > kLutFractionBits) {
+        return x << (P - kLutFractionBits);
+    } else {
+        return x >> (kLutFractionBits - P);
+    }
+}
+
+// Converts a value to Q31.32, clamping magnitudes beyond the Q31.32 range
+// For functions that are flat at large arguments (atan, acos), where the clamped value only
+// affects bits below Q31.32
+template <int P>
+inline constexpr auto ToLutSaturated(int64_t x) noexcept -> int64_t {
+    if constexpr (P < kLutFractionBits) {
+        constexpr int64_t kLimit = INT64_MAX >> (kLutFractionBits - P);
+        x = x > kLimit ? kLimit : x;
+        x = x < -kLimit ? -kLimit : x;
+    }
+    return ToLutFormat<P>(x);
+}
+
+// Converts an angle to Q31.32, congruent modulo kPeriod (given in Q31.32)
+// Angles that would overflow the conversion are first reduced in their own format, which
+// keeps the remainder exact: (x * 2^s) mod T == ((x mod T) * 2^s) mod T. The sign of the
+// angle is preserved, so x % kPeriod of the result equals that of the exact Q31.32 angle
+template <int P, int64_t kPeriod>
+inline constexpr auto ToLutAngle(int64_t x) noexcept -> int64_t {
+    if constexpr (P < kLutFractionBits) {
+        static_assert(kPeriod > 0 && kPeriod < (int64_t(1) << 36), "Period out of range");
+        constexpr int kShift = kLutFractionBits - P;
+        constexpr int kMaxStep = 27;  // |x mod T| < 2^36, shifted by 27 stays below 2^63
+        if (((x << kShift) >> kShift) != x) {
+            for (int shift = kShift; shift > 0; shift -= kMaxStep) {
+                const int step = shift < kMaxStep ? shift : kMaxStep;
+                x = Primitives::RemConstant<kPeriod>(x) << step;
+            }
+            return x;
+        }
+    }
+    return ToLutFormat<P>(x);
+}
+
+}  // namespace math::fp::detail
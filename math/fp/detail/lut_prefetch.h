@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+namespace math::fp::detail {
+
+// Cache line size assumed when walking the lookup tables, which are aligned to it
+inline constexpr size_t kLutCacheLine = 64;
+
+// Hints that the line holding address should be moved into the caches, without waiting for it
+inline auto PrefetchLine(const void* address) noexcept -> void {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+    (void)address;
+#endif
+}
+
+// Hints that every line of the table should be moved into the caches, without waiting for it
+template <typename Table>
+inline auto PrefetchLut(const Table& table) noexcept -> void {
+    const char* bytes = reinterpret_cast<const char*>(table.data());
+    for (size_t offset = 0; offset < sizeof(table); offset += kLutCacheLine) {
+        PrefetchLine(bytes + offset);
+    }
+}
+
+// Loads one word per line of the table, so the lines and their TLB entries are resident when
+// it returns. The loads are volatile: the tables are constexpr and would otherwise fold away
+template <typename Table>
+inline auto TouchLut(const Table& table) noexcept -> void {
+    const volatile int64_t* words = table.data();
+    constexpr size_t kStride = kLutCacheLine / sizeof(int64_t);
+    int64_t folded = 0;
+    for (size_t i = 0; i < table.size(); i += kStride) {
+        folded ^= words[i];
+    }
+    volatile int64_t sink = folded;
+    (void)sink;
+}
+
+}  // namespace math::fp::detail
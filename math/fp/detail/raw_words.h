@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "fixed64.h"
+
+namespace math::fp::detail {
+
+// The batch kernels, serializers and hashes read spans of Fixed64<P> as their raw int64_t
+// words
+template <int P>
+inline constexpr bool kWrapsOneWord =
+    sizeof(Fixed64<P>) == sizeof(int64_t) && std::is_standard_layout_v<Fixed64<P>>;
+
+// Raw words of a span of fixed-point values
+template <int P>
+inline auto RawWords(std::span<const Fixed64<P>> values) noexcept -> const int64_t* {
+    static_assert(kWrapsOneWord<P>, "Fixed64 must wrap one int64_t");
+    return reinterpret_cast<const int64_t*>(values.data());
+}
+
+template <int P>
+inline auto RawWords(std::span<Fixed64<P>> values) noexcept -> int64_t* {
+    static_assert(kWrapsOneWord<P>, "Fixed64 must wrap one int64_t");
+    return reinterpret_cast<int64_t*>(values.data());
+}
+
+}  // namespace math::fp::detail
@@ -0,0 +1,399 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Configuration macro for the SIMD batch kernels
+// When enabled, the widest instruction set available at compile time is used
+// (AVX-512F, AVX2 or AArch64 NEON), otherwise the scalar primitives are used
+#ifndef FIXED64_BATCH_USE_SIMD
+#define FIXED64_BATCH_USE_SIMD 1
+#endif
+
+#if FIXED64_BATCH_USE_SIMD && defined(__AVX512F__)
+#define FIXED64_BATCH_AVX512 1
+#include <immintrin.h>
+#elif FIXED64_BATCH_USE_SIMD && defined(__AVX2__)
+#define FIXED64_BATCH_AVX2 1
+#include <immintrin.h>
+#elif FIXED64_BATCH_USE_SIMD && defined(__ARM_NEON) && defined(__aarch64__)
+#define FIXED64_BATCH_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if defined(FIXED64_BATCH_AVX512) || defined(FIXED64_BATCH_AVX2) || defined(FIXED64_BATCH_NEON)
+#define FIXED64_BATCH_HAS_SIMD 1
+#else
+#define FIXED64_BATCH_HAS_SIMD 0
+#endif
+
+namespace math::fp::detail {
+
+// Thin wrapper over the 64-bit integer lane operations used by the batch kernels
+// All operations wrap modulo 2^64 exactly like the scalar int64_t/uint64_t code they mirror
+//   Vec  - vector of int64_t lanes
+//   Mask - per-lane comparison result, consumed by Select
+//   VecF - vector of double lanes with the same lane count as Vec
+#if defined(FIXED64_BATCH_AVX512)
+struct SimdOps {
+    using Vec = __m512i;
+    using Mask = __mmask8;
+    using VecF = __m512d;
+    static constexpr size_t kLanes = 8;
+
+    static auto Load(const int64_t* p) noexcept -> Vec {
+        return _mm512_loadu_si512(p);
+    }
+
+    static auto Store(int64_t* p, Vec v) noexcept -> void {
+        _mm512_storeu_si512(p, v);
+    }
+
+    // kLanes 32-bit values, zero-extended into the lanes
+    static auto LoadU32(const uint32_t* p) noexcept -> Vec {
+        return _mm512_cvtepu32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+    }
+
+    // Low 32 bits of each lane
+    static auto StoreU32(uint32_t* p, Vec v) noexcept -> void {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm512_cvtepi64_epi32(v));
+    }
+
+    static auto Set1(int64_t x) noexcept -> Vec {
+        return _mm512_set1_epi64(x);
+    }
+
+    static auto Add(Vec a, Vec b) noexcept -> Vec {
+        return _mm512_add_epi64(a, b);
+    }
+
+    static auto Sub(Vec a, Vec b) noexcept -> Vec {
+        return _mm512_sub_epi64(a, b);
+    }
+
+    static auto And(Vec a, Vec b) noexcept -> Vec {
+        return _mm512_and_si512(a, b);
+    }
+
+    static auto Or(Vec a, Vec b) noexcept -> Vec {
+        return _mm512_or_si512(a, b);
+    }
+
+    static auto Xor(Vec a, Vec b) noexcept -> Vec {
+        return _mm512_xor_si512(a, b);
+    }
+
+    template <int N>
+    static auto ShiftLeft(Vec a) noexcept -> Vec {
+        return _mm512_slli_epi64(a, N);
+    }
+
+    template <int N>
+    static auto ShiftRightLogical(Vec a) noexcept -> Vec {
+        return _mm512_srli_epi64(a, N);
+    }
+
+    template <int N>
+    static auto ShiftRightArith(Vec a) noexcept -> Vec {
+        return _mm512_srai_epi64(a, N);
+    }
+
+    // Per-lane shift counts, each in [0, 63]
+    static auto ShiftLeftVar(Vec a, Vec n) noexcept -> Vec {
+        return _mm512_sllv_epi64(a, n);
+    }
+
+    static auto ShiftRightLogicalVar(Vec a, Vec n) noexcept -> Vec {
+        return _mm512_srlv_epi64(a, n);
+    }
+
+    // Full 64-bit product of the low 32 bits of each lane
+    static auto MulU32(Vec a, Vec b) noexcept -> Vec {
+        return _mm512_mul_epu32(a, b);
+    }
+
+    // Signed a > b
+    static auto CmpGt(Vec a, Vec b) noexcept -> Mask {
+        return _mm512_cmpgt_epi64_mask(a, b);
+    }
+
+    // m ? a : b
+    static auto Select(Mask m, Vec a, Vec b) noexcept -> Vec {
+        return _mm512_mask_blend_epi64(m, b, a);
+    }
+
+    static auto Gather(const int64_t* base, Vec idx) noexcept -> Vec {
+        return _mm512_i64gather_epi64(idx, base, 8);
+    }
+
+    // Double precision lanes, used only for estimates that are corrected in integer arithmetic
+    static auto BitsToF64(Vec a) noexcept -> VecF {
+        return _mm512_castsi512_pd(a);
+    }
+
+    static auto F64ToBits(VecF a) noexcept -> Vec {
+        return _mm512_castpd_si512(a);
+    }
+
+    static auto AddF64(VecF a, VecF b) noexcept -> VecF {
+        return _mm512_add_pd(a, b);
+    }
+
+    static auto SubF64(VecF a, VecF b) noexcept -> VecF {
+        return _mm512_sub_pd(a, b);
+    }
+
+    static auto MulF64(VecF a, VecF b) noexcept -> VecF {
+        return _mm512_mul_pd(a, b);
+    }
+
+    static auto DivF64(VecF a, VecF b) noexcept -> VecF {
+        return _mm512_div_pd(a, b);
+    }
+};
+
+#elif defined(FIXED64_BATCH_AVX2)
+struct SimdOps {
+    using Vec = __m256i;
+    using Mask = __m256i;
+    using VecF = __m256d;
+    static constexpr size_t kLanes = 4;
+
+    static auto Load(const int64_t* p) noexcept -> Vec {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+
+    static auto Store(int64_t* p, Vec v) noexcept -> void {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+    }
+
+    // kLanes 32-bit values, zero-extended into the lanes
+    static auto LoadU32(const uint32_t* p) noexcept -> Vec {
+        return _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    }
+
+    // Low 32 bits of each lane
+    static auto StoreU32(uint32_t* p, Vec v) noexcept -> void {
+        const Vec even = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+        const Vec packed = _mm256_permutevar8x32_epi32(v, even);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_castsi256_si128(packed));
+    }
+
+    static auto Set1(int64_t x) noexcept -> Vec {
+        return _mm256_set1_epi64x(x);
+    }
+
+    static auto Add(Vec a, Vec b) noexcept -> Vec {
+        return _mm256_add_epi64(a, b);
+    }
+
+    static auto Sub(Vec a, Vec b) noexcept -> Vec {
+        return _mm256_sub_epi64(a, b);
+    }
+
+    static auto And(Vec a, Vec b) noexcept -> Vec {
+        return _mm256_and_si256(a, b);
+    }
+
+    static auto Or(Vec a, Vec b) noexcept -> Vec {
+        return _mm256_or_si256(a, b);
+    }
+
+    static auto Xor(Vec a, Vec b) noexcept -> Vec {
+        return _mm256_xor_si256(a, b);
+    }
+
+    template <int N>
+    static auto ShiftLeft(Vec a) noexcept -> Vec {
+        return _mm256_slli_epi64(a, N);
+    }
+
+    template <int N>
+    static auto ShiftRightLogical(Vec a) noexcept -> Vec {
+        return _mm256_srli_epi64(a, N);
+    }
+
+    // AVX2 has no 64-bit arithmetic shift: shift the one's complement of negative lanes
+    template <int N>
+    static auto ShiftRightArith(Vec a) noexcept -> Vec {
+        const Vec sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+        return _mm256_xor_si256(_mm256_srli_epi64(_mm256_xor_si256(a, sign), N), sign);
+    }
+
+    // Per-lane shift counts, each in [0, 63]
+    static auto ShiftLeftVar(Vec a, Vec n) noexcept -> Vec {
+        return _mm256_sllv_epi64(a, n);
+    }
+
+    static auto ShiftRightLogicalVar(Vec a, Vec n) noexcept -> Vec {
+        return _mm256_srlv_epi64(a, n);
+    }
+
+    // Full 64-bit product of the low 32 bits of each lane
+    static auto MulU32(Vec a, Vec b) noexcept -> Vec {
+        return _mm256_mul_epu32(a, b);
+    }
+
+    // Signed a > b
+    static auto CmpGt(Vec a, Vec b) noexcept -> Mask {
+        return _mm256_cmpgt_epi64(a, b);
+    }
+
+    // m ? a : b
+    static auto Select(Mask m, Vec a, Vec b) noexcept -> Vec {
+        return _mm256_blendv_epi8(b, a, m);
+    }
+
+    static auto Gather(const int64_t* base, Vec idx) noexcept -> Vec {
+        return _mm256_i64gather_epi64(reinterpret_cast<const long long*>(base), idx, 8);
+    }
+
+    // Double precision lanes, used only for estimates that are corrected in integer arithmetic
+    static auto BitsToF64(Vec a) noexcept -> VecF {
+        return _mm256_castsi256_pd(a);
+    }
+
+    static auto F64ToBits(VecF a) noexcept -> Vec {
+        return _mm256_castpd_si256(a);
+    }
+
+    static auto AddF64(VecF a, VecF b) noexcept -> VecF {
+        return _mm256_add_pd(a, b);
+    }
+
+    static auto SubF64(VecF a, VecF b) noexcept -> VecF {
+        return _mm256_sub_pd(a, b);
+    }
+
+    static auto MulF64(VecF a, VecF b) noexcept -> VecF {
+        return _mm256_mul_pd(a, b);
+    }
+
+    static auto DivF64(VecF a, VecF b) noexcept -> VecF {
+        return _mm256_div_pd(a, b);
+    }
+};
+
+#elif defined(FIXED64_BATCH_NEON)
+struct SimdOps {
+    using Vec = int64x2_t;
+    using Mask = uint64x2_t;
+    using VecF = float64x2_t;
+    static constexpr size_t kLanes = 2;
+
+    static auto Load(const int64_t* p) noexcept -> Vec {
+        return vld1q_s64(p);
+    }
+
+    static auto Store(int64_t* p, Vec v) noexcept -> void {
+        vst1q_s64(p, v);
+    }
+
+    // kLanes 32-bit values, zero-extended into the lanes
+    static auto LoadU32(const uint32_t* p) noexcept -> Vec {
+        return vreinterpretq_s64_u64(vmovl_u32(vld1_u32(p)));
+    }
+
+    // Low 32 bits of each lane
+    static auto StoreU32(uint32_t* p, Vec v) noexcept -> void {
+        vst1_u32(p, vmovn_u64(vreinterpretq_u64_s64(v)));
+    }
+
+    static auto Set1(int64_t x) noexcept -> Vec {
+        return vdupq_n_s64(x);
+    }
+
+    static auto Add(Vec a, Vec b) noexcept -> Vec {
+        return vaddq_s64(a, b);
+    }
+
+    static auto Sub(Vec a, Vec b) noexcept -> Vec {
+        return vsubq_s64(a, b);
+    }
+
+    static auto And(Vec a, Vec b) noexcept -> Vec {
+        return vandq_s64(a, b);
+    }
+
+    static auto Or(Vec a, Vec b) noexcept -> Vec {
+        return vorrq_s64(a, b);
+    }
+
+    static auto Xor(Vec a, Vec b) noexcept -> Vec {
+        return veorq_s64(a, b);
+    }
+
+    template <int N>
+    static auto ShiftLeft(Vec a) noexcept -> Vec {
+        return vshlq_n_s64(a, N);
+    }
+
+    template <int N>
+    static auto ShiftRightLogical(Vec a) noexcept -> Vec {
+        return vreinterpretq_s64_u64(vshrq_n_u64(vreinterpretq_u64_s64(a), N));
+    }
+
+    template <int N>
+    static auto ShiftRightArith(Vec a) noexcept -> Vec {
+        return vshrq_n_s64(a, N);
+    }
+
+    // Per-lane shift counts, each in [0, 63]; NEON shifts right by negative counts
+    static auto ShiftLeftVar(Vec a, Vec n) noexcept -> Vec {
+        return vreinterpretq_s64_u64(vshlq_u64(vreinterpretq_u64_s64(a), n));
+    }
+
+    static auto ShiftRightLogicalVar(Vec a, Vec n) noexcept -> Vec {
+        return vreinterpretq_s64_u64(vshlq_u64(vreinterpretq_u64_s64(a), vnegq_s64(n)));
+    }
+
+    // Full 64-bit product of the low 32 bits of each lane
+    static auto MulU32(Vec a, Vec b) noexcept -> Vec {
+        return vreinterpretq_s64_u64(vmull_u32(vmovn_u64(vreinterpretq_u64_s64(a)),
+                                               vmovn_u64(vreinterpretq_u64_s64(b))));
+    }
+
+    // Signed a > b
+    static auto CmpGt(Vec a, Vec b) noexcept -> Mask {
+        return vcgtq_s64(a, b);
+    }
+
+    // m ? a : b
+    static auto Select(Mask m, Vec a, Vec b) noexcept -> Vec {
+        return vbslq_s64(m, a, b);
+    }
+
+    // NEON has no gather instruction, load each lane individually
+    static auto Gather(const int64_t* base, Vec idx) noexcept -> Vec {
+        const Vec lo = vdupq_n_s64(base[vgetq_lane_s64(idx, 0)]);
+        return vsetq_lane_s64(base[vgetq_lane_s64(idx, 1)], lo, 1);
+    }
+
+    // Double precision lanes, used only for estimates that are corrected in integer arithmetic
+    static auto BitsToF64(Vec a) noexcept -> VecF {
+        return vreinterpretq_f64_s64(a);
+    }
+
+    static auto F64ToBits(VecF a) noexcept -> Vec {
+        return vreinterpretq_s64_f64(a);
+    }
+
+    static auto AddF64(VecF a, VecF b) noexcept -> VecF {
+        return vaddq_f64(a, b);
+    }
+
+    static auto SubF64(VecF a, VecF b) noexcept -> VecF {
+        return vsubq_f64(a, b);
+    }
+
+    static auto MulF64(VecF a, VecF b) noexcept -> VecF {
+        return vmulq_f64(a, b);
+    }
+
+    static auto DivF64(VecF a, VecF b) noexcept -> VecF {
+        return vdivq_f64(a, b);
+    }
+};
+#endif
+
+}  // namespace math::fp::detail
@@ -2,6 +2,8 @@
 
 #include <stdint.h>
 #include <array>
+#include <utility>
+#include "lut_format.h"
 #include "primitives.h"
 
 // Sin lookup table with 512 entries
@@ -11,7 +13,7 @@
 namespace math::fp::detail {
 // Table maps x in [0,pi/2] to sin(x)
 // Values stored in Q31.32 fixed-point format
-inline constexpr std::array<int64_t, 513> kSinLut = {
+alignas(64) inline constexpr std::array<int64_t, 513> kSinLut = {
     0x0000000000000000LL, // sin(0.00000000000000) = 0.00000000000000
     0x0000000000C97480LL, // sin(0.00307396541447) = 0.00307396057336
     0x000000000192E883LL, // sin(0.00614793082894) = 0.00614789210007
@@ -528,10 +530,12 @@ inline constexpr std::array<int64_t, 513> kSinLut = {
 };
 
 // Fast lookup sin(x) with linear interpolation between table entries
-// Input x is in fixed-point format with specified fraction bits representing angle in radians
+// Input x is in fixed-point format with P fraction bits representing angle in radians
 // Output is in Q31.32 fixed-point format representing sin(x)
-// Precision: ~1e-6 when input_fraction_bits=32
-inline constexpr auto LookupSinFast(int64_t x, int input_fraction_bits) noexcept -> int64_t {
+// Precision: ~1e-6 when P=32
+template <int P>
+inline constexpr auto LookupSinFast(int64_t x) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kSinLookup);
     // Constants
     constexpr int64_t kPi = 0x00000003243F6A88LL;  // pi = 3.141592653589793
     constexpr int64_t kPiOver2 = 0x00000001921FB544LL;  // pi/2 = 1.5707963267948966
@@ -539,17 +543,11 @@ inline constexpr auto LookupSinFast(int64_t x, int input_fraction_bits) noexcept
     constexpr int64_t kLutInterval = 0x00000145500D592ELL;  // LUT conversion factor
     constexpr int kOutputFractionBits = 32;  // Output format: Q31.32
 
-    // Convert input to Q{int_bits}.{fraction_bits} format if needed
-    if (input_fraction_bits != kOutputFractionBits) {
-        if (input_fraction_bits < kOutputFractionBits) {
-            x <<= (kOutputFractionBits - input_fraction_bits);
-        } else {
-            x >>= (input_fraction_bits - kOutputFractionBits);
-        }
-    }
+    // Convert input to Q31.32
+    x = ToLutAngle<P, kTwoPi>(x);
 
     // 1. Normalize angle to [0, 2*pi)
-    x = x % kTwoPi;
+    x = Primitives::RemConstant<kTwoPi>(x);
     if (x < 0) {
         x += kTwoPi;
     }
@@ -567,7 +565,7 @@ inline constexpr auto LookupSinFast(int64_t x, int input_fraction_bits) noexcept
     }
 
     // 3. Calculate lookup table index and fractional part
-    int64_t idx_scaled = Primitives::Fixed64Mul(x, kLutInterval, kOutputFractionBits);
+    int64_t idx_scaled = Primitives::Fixed64Mul<kOutputFractionBits>(x, kLutInterval);
     int idx = static_cast<int>(idx_scaled >> kOutputFractionBits);
     int64_t frac = idx_scaled & ((1LL << kOutputFractionBits) - 1);
 
@@ -582,23 +580,19 @@ inline constexpr auto LookupSinFast(int64_t x, int input_fraction_bits) noexcept
         interpolated_value = -interpolated_value;
     }
 
-    // 6. Convert result back to original input format if needed
-    if (input_fraction_bits != kOutputFractionBits) {
-        if (input_fraction_bits < kOutputFractionBits) {
-            interpolated_value >>= (kOutputFractionBits - input_fraction_bits);
-        } else {
-            interpolated_value <<= (input_fraction_bits - kOutputFractionBits);
-        }
-    }
+    // 6. Convert result back to the input format
+    interpolated_value = FromLutFormat<P>(interpolated_value);
 
     return interpolated_value;
 }
 
 // Lookup sin(x) with optimized Hermite cubic interpolation between table entries
-// Input x is in fixed-point format with specified fraction bits representing angle in radians
+// Input x is in fixed-point format with P fraction bits representing angle in radians
 // Output is in Q31.32 fixed-point format representing sin(x)
-// Precision: ~1.0e-9 when input_fraction_bits=32 (about 1500x more accurate than fast version)
-inline constexpr auto LookupSin(int64_t x, int input_fraction_bits) noexcept -> int64_t {
+// Precision: ~1.0e-9 when P=32 (about 1500x more accurate than fast version)
+template <int P>
+inline constexpr auto LookupSin(int64_t x) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kSinLookup);
     // Constants
     constexpr int64_t kPi = 0x00000003243F6A88LL;  // pi = 3.141592653589793
     constexpr int64_t kPiOver2 = 0x00000001921FB544LL;  // pi/2 = 1.5707963267948966
@@ -606,17 +600,11 @@ inline constexpr auto LookupSin(int64_t x, int input_fraction_bits) noexcept ->
     constexpr int64_t kLutInterval = 0x00000145500D592ELL;  // LUT conversion factor
     constexpr int kOutputFractionBits = 32;  // Output format: Q31.32
 
-    // Convert input to Q{int_bits}.{fraction_bits} format if needed
-    if (input_fraction_bits != kOutputFractionBits) {
-        if (input_fraction_bits < kOutputFractionBits) {
-            x <<= (kOutputFractionBits - input_fraction_bits);
-        } else {
-            x >>= (input_fraction_bits - kOutputFractionBits);
-        }
-    }
+    // Convert input to Q31.32
+    x = ToLutAngle<P, kTwoPi>(x);
 
     // 1. Normalize angle to [0, 2*pi)
-    x = x % kTwoPi;
+    x = Primitives::RemConstant<kTwoPi>(x);
     if (x < 0) {
         x += kTwoPi;
     }
@@ -634,7 +622,7 @@ inline constexpr auto LookupSin(int64_t x, int input_fraction_bits) noexcept ->
     }
 
     // 3. Calculate lookup table index and fractional part
-    int64_t idx_scaled = Primitives::Fixed64Mul(x, kLutInterval, kOutputFractionBits);
+    int64_t idx_scaled = Primitives::Fixed64Mul<kOutputFractionBits>(x, kLutInterval);
     int idx = static_cast<int>(idx_scaled >> kOutputFractionBits);
     int64_t t = idx_scaled & ((1LL << kOutputFractionBits) - 1);  // Fractional part [0,1)
 
@@ -670,28 +658,184 @@ inline constexpr auto LookupSin(int64_t x, int input_fraction_bits) noexcept ->
     // 7. Compute interpolation using Horner's method
     int64_t result =
         d
-        + Primitives::Fixed64Mul(
+        + Primitives::Fixed64Mul<kOutputFractionBits>(
             t,
             c
-                + Primitives::Fixed64Mul(
-                    t, b + Primitives::Fixed64Mul(t, a, kOutputFractionBits), kOutputFractionBits),
-            kOutputFractionBits);
+                + Primitives::Fixed64Mul<kOutputFractionBits>(
+                    t, b + Primitives::Fixed64Mul<kOutputFractionBits>(t, a)));
 
     // 8. Apply sign flip if necessary
     if (flip_sign) {
         result = -result;
     }
 
-    // 9. Convert result back to original input format if needed
-    if (input_fraction_bits != kOutputFractionBits) {
-        if (input_fraction_bits < kOutputFractionBits) {
-            result >>= (kOutputFractionBits - input_fraction_bits);
-        } else {
-            result <<= (input_fraction_bits - kOutputFractionBits);
-        }
-    }
+    // 9. Convert result back to the input format
+    result = FromLutFormat<P>(result);
 
     return result;
 }
 
+// Fast lookup of sin(x) and cos(x) sharing one angle reduction and one index calculation
+// cos is read from the mirrored table index, since cos(k*step) = sin((kMirror-k)*step)
+// Output is a pair (sin, cos) in the input fixed-point format
+// The sin value is identical to LookupSinFast; cos has the same precision as LookupSinFast
+template <int P>
+inline constexpr auto LookupSinCosFast(int64_t x) noexcept
+    -> std::pair<int64_t, int64_t> {
+    Fixed64Instrumentation::Record(Fixed64Event::kSinLookup);
+    // Constants
+    constexpr int64_t kPi = 0x00000003243F6A88LL;  // pi = 3.141592653589793
+    constexpr int64_t kPiOver2 = 0x00000001921FB544LL;  // pi/2 = 1.5707963267948966
+    constexpr int64_t kTwoPi = 0x00000006487ED511LL;  // 2*pi = 6.283185307179586
+    constexpr int64_t kLutInterval = 0x00000145500D592ELL;  // LUT conversion factor
+    constexpr int kOutputFractionBits = 32;  // Output format: Q31.32
+    constexpr int kMirror = static_cast<int>(kSinLut.size()) - 2;  // cos(idx) = sin(kMirror-idx)
+
+    // Convert input to Q31.32
+    x = ToLutAngle<P, kTwoPi>(x);
+
+    // 1. Normalize angle to [0, 2*pi)
+    x = Primitives::RemConstant<kTwoPi>(x);
+    if (x < 0) {
+        x += kTwoPi;
+    }
+
+    // 2. Determine quadrant and map to [0, pi/2]
+    // sin(x - pi) = -sin(x), cos(x - pi) = -cos(x)
+    // sin(pi - x) = sin(x),  cos(pi - x) = -cos(x)
+    bool flip_sin = false;
+    bool flip_cos = false;
+    if (x > kPi) {
+        x -= kPi;
+        flip_sin = true;
+        flip_cos = true;
+    }
+    if (x > kPiOver2) {
+        x = kPi - x;
+        flip_cos = !flip_cos;
+    }
+
+    // 3. Calculate lookup table index and fractional part
+    int64_t idx_scaled = Primitives::Fixed64Mul<kOutputFractionBits>(x, kLutInterval);
+    int idx = static_cast<int>(idx_scaled >> kOutputFractionBits);
+    int64_t frac = idx_scaled & ((1LL << kOutputFractionBits) - 1);
+
+    // 4. Linear interpolation between table entries
+    // The right cos endpoint of the last segment lies past pi/2: cos((kMirror+1)*step) = -sin(step)
+    int64_t s0 = kSinLut[idx];
+    int64_t s1 = kSinLut[idx + 1];
+    int64_t c0 = kSinLut[kMirror - idx];
+    int64_t c1 = idx < kMirror ? kSinLut[kMirror - idx - 1] : -kSinLut[1];
+    int64_t sin_value = s0 + (((s1 - s0) * frac) >> kOutputFractionBits);
+    int64_t cos_value = c0 + (((c1 - c0) * frac) >> kOutputFractionBits);
+
+    // 5. Apply sign flips if necessary
+    if (flip_sin) {
+        sin_value = -sin_value;
+    }
+    if (flip_cos) {
+        cos_value = -cos_value;
+    }
+
+    // 6. Convert results back to the input format
+    sin_value = FromLutFormat<P>(sin_value);
+    cos_value = FromLutFormat<P>(cos_value);
+
+    return {sin_value, cos_value};
+}
+
+// Lookup of sin(x) and cos(x) with Hermite cubic interpolation sharing one angle reduction,
+// one index calculation and one set of table reads
+// The four entries LookupSin reads for the sine value and its derivative (cosine) are also
+// the cosine value and its derivative (-sine) on the mirrored segment
+// Output is a pair (sin, cos) in the input fixed-point format
+// The sin value is identical to LookupSin; cos has the same precision as LookupSin
+template <int P>
+inline constexpr auto LookupSinCos(int64_t x) noexcept
+    -> std::pair<int64_t, int64_t> {
+    Fixed64Instrumentation::Record(Fixed64Event::kSinLookup);
+    // Constants
+    constexpr int64_t kPi = 0x00000003243F6A88LL;  // pi = 3.141592653589793
+    constexpr int64_t kPiOver2 = 0x00000001921FB544LL;  // pi/2 = 1.5707963267948966
+    constexpr int64_t kTwoPi = 0x00000006487ED511LL;  // 2*pi = 6.283185307179586
+    constexpr int64_t kLutInterval = 0x00000145500D592ELL;  // LUT conversion factor
+    constexpr int kOutputFractionBits = 32;  // Output format: Q31.32
+    constexpr int kMirror = static_cast<int>(kSinLut.size()) - 2;  // cos(idx) = sin(kMirror-idx)
+
+    // Convert input to Q31.32
+    x = ToLutAngle<P, kTwoPi>(x);
+
+    // 1. Normalize angle to [0, 2*pi)
+    x = Primitives::RemConstant<kTwoPi>(x);
+    if (x < 0) {
+        x += kTwoPi;
+    }
+
+    // 2. Determine quadrant and map to [0, pi/2]
+    // sin(x - pi) = -sin(x), cos(x - pi) = -cos(x)
+    // sin(pi - x) = sin(x),  cos(pi - x) = -cos(x)
+    bool flip_sin = false;
+    bool flip_cos = false;
+    if (x > kPi) {
+        x -= kPi;
+        flip_sin = true;
+        flip_cos = true;
+    }
+    if (x > kPiOver2) {
+        x = kPi - x;
+        flip_cos = !flip_cos;
+    }
+
+    // 3. Calculate lookup table index and fractional part
+    int64_t idx_scaled = Primitives::Fixed64Mul<kOutputFractionBits>(x, kLutInterval);
+    int idx = static_cast<int>(idx_scaled >> kOutputFractionBits);
+    int64_t t = idx_scaled & ((1LL << kOutputFractionBits) - 1);  // Fractional part [0,1)
+
+    // 4. Get points from table
+    // Sine at both endpoints, cosine at both endpoints via the mirrored index
+    // (LookupSin uses zero for the last cosine, which matches its derivative term)
+    int cos_idx = kMirror - idx;
+    int64_t s0 = kSinLut[idx];
+    int64_t s1 = kSinLut[idx + 1];
+    int64_t c0 = kSinLut[cos_idx];
+    int64_t c1 = cos_idx > 0 ? kSinLut[cos_idx - 1] : 0;
+    int64_t c1_value = cos_idx > 0 ? c1 : -kSinLut[1];
+
+    // 5. Scale derivatives by step size: sin' = cos, cos' = -sin
+    constexpr int64_t kStepSize = kPiOver2/(kSinLut.size() - 2);
+    int64_t ms0 = (c0 * kStepSize) >> kOutputFractionBits;
+    int64_t ms1 = (c1 * kStepSize) >> kOutputFractionBits;
+    int64_t mc0 = -((s0 * kStepSize) >> kOutputFractionBits);
+    int64_t mc1 = -((s1 * kStepSize) >> kOutputFractionBits);
+
+    // 6. Hermite interpolation using Horner's method (see LookupSin for the coefficients)
+    auto hermite = [t](int64_t p0, int64_t p1, int64_t m0, int64_t m1) constexpr -> int64_t {
+        int64_t p0_minus_p1 = p0 - p1;
+        int64_t a = p0_minus_p1 * 2 + m0 + m1;
+        int64_t b = -p0_minus_p1 * 3 - m0 * 2 - m1;
+        return p0
+               + Primitives::Fixed64Mul<kOutputFractionBits>(
+                   t,
+                   m0
+                       + Primitives::Fixed64Mul<kOutputFractionBits>(
+                           t, b + Primitives::Fixed64Mul<kOutputFractionBits>(t, a)));
+    };
+    int64_t sin_value = hermite(s0, s1, ms0, ms1);
+    int64_t cos_value = hermite(c0, c1_value, mc0, mc1);
+
+    // 7. Apply sign flips if necessary
+    if (flip_sin) {
+        sin_value = -sin_value;
+    }
+    if (flip_cos) {
+        cos_value = -cos_value;
+    }
+
+    // 8. Convert results back to the input format
+    sin_value = FromLutFormat<P>(sin_value);
+    cos_value = FromLutFormat<P>(cos_value);
+
+    return {sin_value, cos_value};
+}
+
 }  // namespace math::fp::detail
\ No newline at end of file
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <stdint.h>
+#include <array>
+#include <utility>
+#include "lut_format.h"
+#include "primitives.h"
+
+// Segmented minimax polynomial for sin(x) with 8 segments of degree 5
+// Covers the range [0,pi/2] with coefficients in Q1.62 format (384 bytes)
+// Generated with mpmath library at 100 digits precision (Remez exchange)
+// Max approximation error after coefficient rounding: 3.866e-11
+
+namespace math::fp::detail {
+inline constexpr int kSinPolySegments = 8;
+inline constexpr int kSinPolyDegree = 5;
+inline constexpr int kSinPolyFractionBits = 62;
+
+// Segment width in Q31.32, segment k covers [k*w, (k+1)*w)
+inline constexpr int64_t kSinPolySegmentWidth = 0x000000003243F6A9LL;  // 0.1963495409581810
+// floor(2^64 / kSinPolySegmentWidth), Q31.32 factor that maps x to its segment
+inline constexpr int64_t kSinPolyIndexScale = 0x0000000517CC1B66LL;
+
+// Coefficients c0..cN of sin(k*w + t) ~ sum(c_i * t^i) for t in [0,w], per segment
+inline constexpr std::array<int64_t, 48> kSinPolyCoeffs = {
+    // Segment 0: [0.00000000000000, 0.19634954095818)
+    0x00000000010D4C1BLL,
+    0x3FFFFFFE91A33B23LL,
+    0x0000005052C98207LL,
+    -0x0AAAB0FBB9379686LL,
+    0x000036A725871C22LL,
+    0x0087D04699D5AACALL,
+    // Segment 1: [0.19634954095818, 0.39269908191636)
+    0x0C7C5C1E55434E39LL,
+    0x3EC52F9B898A04C7LL,
+    -0x063E2D0FD3B370D8LL,
+    -0x0A7647CBCC0C46ACLL,
+    0x0085F784F83823FELL,
+    0x008298244811673FLL,
+    // Segment 2: [0.39269908191636, 0.58904862287454)
+    0x187DE2A6EAF76149LL,
+    0x3B20D79728790657LL,
+    -0x0C3EEFAEE1F59E8DLL,
+    -0x09DAF1DB54D7270ELL,
+    0x0106926D881F01F9LL,
+    0x00785B3CE4DC15BCLL,
+    // Segment 3: [0.58904862287454, 0.78539816383272)
+    0x238E7673AE34BB28LL,
+    0x3536CC484585994FLL,
+    -0x11C739002E9C1C3BLL,
+    -0x08DEA758F9DB0237LL,
+    0x017D162BA55FC5A5LL,
+    0x00697E467853182ELL,
+    // Segment 4: [0.78539816383272, 0.98174770479091)
+    0x2D413CCD5B535D56LL,
+    0x2D413CC0E2B9A9FDLL,
+    -0x16A09BADD420CC5FLL,
+    -0x078B1A4AA3EE9852LL,
+    0x01E4F4CE9BECA404LL,
+    0x0056937A4A18D1A1LL,
+    // Segment 5: [0.98174770479091, 1.17809724574909)
+    0x3536CC5279C57391LL,
+    0x238E76656BEE4E52LL,
+    -0x1A9B630BF9857952LL,
+    -0x05ED572B832B04DBLL,
+    0x023A30798AACF894LL,
+    0x004054F32F3F5637LL,
+    // Segment 6: [1.17809724574909, 1.37444678670727)
+    0x3B20D79EB400CD9FLL,
+    0x187DE2976B47F16DLL,
+    -0x1D90686C4FD71838LL,
+    -0x0415448C88A2E015LL,
+    0x027982A7F76AA953LL,
+    0x00279D877D73C9EDLL,
+    // Segment 7: [1.37444678670727, 1.57079632766545)
+    0x3EC52FA02233270BLL,
+    0x0C7C5C0E30A2AE9FLL,
+    -0x1F62944891DF99F2LL,
+    -0x021506A66B7443F8LL,
+    0x02A07C6712400BB5LL,
+    0x000D606020891A29LL
+};
+
+
+// Evaluate the polynomial of the segment containing x
+// Input x in [0,pi/2] in Q31.32, output sin(x) in Q31.32 rounded to nearest
+// Horner's method runs in Q1.62, so only the final rounding is visible at 32 fraction bits
+inline constexpr auto EvalSinPoly(int64_t x) noexcept -> int64_t {
+    constexpr int kOutputFractionBits = 32;
+    constexpr int kShift = kSinPolyFractionBits - kOutputFractionBits;
+
+    // Segment index (truncated, never too large) and offset into the segment in Q1.62
+    int64_t idx = Primitives::Fixed64Mul<kOutputFractionBits>(x, kSinPolyIndexScale)
+                  >> kOutputFractionBits;
+    idx = idx < kSinPolySegments - 1 ? idx : kSinPolySegments - 1;
+    const int64_t t = (x - idx * kSinPolySegmentWidth) << kShift;
+
+    const int64_t* c = kSinPolyCoeffs.data() + idx * (kSinPolyDegree + 1);
+    int64_t result = c[kSinPolyDegree];
+    for (int i = kSinPolyDegree - 1; i >= 0; --i) {
+        result = c[i] + Primitives::Fixed64Mul<kSinPolyFractionBits>(result, t);
+    }
+    return (result + (1LL << (kShift - 1))) >> kShift;
+}
+
+// Lookup sin(x) with the segmented polynomial
+// Input x is in fixed-point format with P fraction bits representing angle in radians
+// Output is in the input fixed-point format
+// Precision: within 1 ulp of sin at the reduced Q31.32 angle (the table alone is ~1e-12)
+template <int P>
+inline constexpr auto LookupSinPoly(int64_t x) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kSinLookup);
+    // Constants (see LookupSin)
+    constexpr int64_t kPi = 0x00000003243F6A88LL;  // pi = 3.141592653589793
+    constexpr int64_t kPiOver2 = 0x00000001921FB544LL;  // pi/2 = 1.5707963267948966
+    constexpr int64_t kTwoPi = 0x00000006487ED511LL;  // 2*pi = 6.283185307179586
+
+    // Convert input to Q31.32
+    x = ToLutAngle<P, kTwoPi>(x);
+
+    // 1. Normalize angle to [0, 2*pi)
+    x = Primitives::RemConstant<kTwoPi>(x);
+    if (x < 0) {
+        x += kTwoPi;
+    }
+
+    // 2. Determine quadrant and map to [0, pi/2]
+    bool flip_sign = false;
+    if (x > kPi) {
+        // 3rd and 4th quadrants: sin(x) = -sin(x - pi)
+        x -= kPi;
+        flip_sign = true;
+    }
+    if (x > kPiOver2) {
+        // 2nd and 4th quadrants: sin(x) = sin(pi - x)
+        x = kPi - x;
+    }
+
+    // 3. Evaluate the polynomial and apply sign flip if necessary
+    int64_t result = EvalSinPoly(x);
+    if (flip_sign) {
+        result = -result;
+    }
+
+    // 4. Convert result back to the input format
+    result = FromLutFormat<P>(result);
+
+    return result;
+}
+
+// Lookup of sin(x) and cos(x) with the segmented polynomial sharing one angle reduction
+// cos(x) = sin(pi/2 - x) on the reduced angle, so both values come from EvalSinPoly
+// Output is a pair (sin, cos) in the input fixed-point format
+// The sin value is identical to LookupSinPoly; cos has the same precision
+template <int P>
+inline constexpr auto LookupSinCosPoly(int64_t x) noexcept
+    -> std::pair<int64_t, int64_t> {
+    Fixed64Instrumentation::Record(Fixed64Event::kSinLookup);
+    // Constants (see LookupSin)
+    constexpr int64_t kPi = 0x00000003243F6A88LL;  // pi = 3.141592653589793
+    constexpr int64_t kPiOver2 = 0x00000001921FB544LL;  // pi/2 = 1.5707963267948966
+    constexpr int64_t kTwoPi = 0x00000006487ED511LL;  // 2*pi = 6.283185307179586
+
+    // Convert input to Q31.32
+    x = ToLutAngle<P, kTwoPi>(x);
+
+    // 1. Normalize angle to [0, 2*pi)
+    x = Primitives::RemConstant<kTwoPi>(x);
+    if (x < 0) {
+        x += kTwoPi;
+    }
+
+    // 2. Determine quadrant and map to [0, pi/2]
+    // sin(x - pi) = -sin(x), cos(x - pi) = -cos(x)
+    // sin(pi - x) = sin(x),  cos(pi - x) = -cos(x)
+    bool flip_sin = false;
+    bool flip_cos = false;
+    if (x > kPi) {
+        x -= kPi;
+        flip_sin = true;
+        flip_cos = true;
+    }
+    if (x > kPiOver2) {
+        x = kPi - x;
+        flip_cos = !flip_cos;
+    }
+
+    // 3. Evaluate both polynomials and apply sign flips if necessary
+    int64_t sin_value = EvalSinPoly(x);
+    int64_t cos_value = EvalSinPoly(kPiOver2 - x);
+    if (flip_sin) {
+        sin_value = -sin_value;
+    }
+    if (flip_cos) {
+        cos_value = -cos_value;
+    }
+
+    // 4. Convert results back to the input format
+    sin_value = FromLutFormat<P>(sin_value);
+    cos_value = FromLutFormat<P>(cos_value);
+
+    return {sin_value, cos_value};
+}
+
+}  // namespace math::fp::detail
@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 #include <array>
+#include "lut_format.h"
 #include "primitives.h"
 
 // Tan lookup table with 513 entries
@@ -11,7 +12,7 @@
 namespace math::fp::detail {
 // Table maps x in [0,pi/2] to tan(x)
 // Values stored in Q31.32 fixed-point format
-inline constexpr std::array<int64_t, 513> kTanLut = {
+alignas(64) inline constexpr std::array<int64_t, 513> kTanLut = {
     0x0000000000000000LL, // tan(0.00000000000000) = 0.00000000000000
     0x0000000000C974BELL, // tan(0.00307396541447) = 0.00307397509674
     0x000000000192EA76LL, // tan(0.00614793082894) = 0.00614800828800
@@ -528,26 +529,22 @@ inline constexpr std::array<int64_t, 513> kTanLut = {
 };
 
 // Fast lookup tan(x) with linear interpolation between table entries
-// Input x is in fixed-point format with specified fraction bits representing angle in radians
-// Precision: ~1.5e-5 when input_fraction_bits=32
-inline constexpr auto LookupTanFast(int64_t x, int input_fraction_bits) noexcept -> int64_t {
+// Input x is in fixed-point format with P fraction bits representing angle in radians
+// Precision: ~1.5e-5 when P=32
+template <int P>
+inline constexpr auto LookupTanFast(int64_t x) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kTanLookup);
     // Constants
     constexpr int64_t kPi = 0x00000003243F6A88LL;  // pi = 3.141592653589793
     constexpr int64_t kPiOver2 = 0x00000001921FB544LL;  // pi/2 = 1.5707963267948966
     constexpr int64_t kLutInterval = 0x00000145500D592ELL;  // LUT conversion factor
     constexpr int kOutputFractionBits = 32;  // Output format: Q31.32
 
-    // Convert input to Q{int_bits}.{fraction_bits} format if needed
-    if (input_fraction_bits != kOutputFractionBits) {
-        if (input_fraction_bits < kOutputFractionBits) {
-            x <<= (kOutputFractionBits - input_fraction_bits);
-        } else {
-            x >>= (input_fraction_bits - kOutputFractionBits);
-        }
-    }
+    // Convert input to Q31.32
+    x = ToLutAngle<P, kPi>(x);
 
     // 1. Normalize angle to [-pi, pi]
-    x = x % kPi;
+    x = Primitives::RemConstant<kPi>(x);
 
     // 2. Handle negative angles
     bool flip = false;
@@ -563,7 +560,7 @@ inline constexpr auto LookupTanFast(int64_t x, int input_fraction_bits) noexcept
     }
 
     // 4. Calculate lookup table index and fractional part
-    int64_t idx_scaled = Primitives::Fixed64Mul(x, kLutInterval, kOutputFractionBits);
+    int64_t idx_scaled = Primitives::Fixed64Mul<kOutputFractionBits>(x, kLutInterval);
     int idx = static_cast<int>(idx_scaled >> kOutputFractionBits);
     int64_t frac = idx_scaled & ((1LL << kOutputFractionBits) - 1);
 
@@ -571,27 +568,23 @@ inline constexpr auto LookupTanFast(int64_t x, int input_fraction_bits) noexcept
     int64_t y0 = kTanLut[idx];
     int64_t y1 = kTanLut[idx + 1];
     int64_t diff = y1 - y0;
-    int64_t interpolated_value = y0 + Primitives::Fixed64Mul(diff, frac, kOutputFractionBits);
+    int64_t interpolated_value = y0 + Primitives::Fixed64Mul<kOutputFractionBits>(diff, frac);
 
     // 6. Apply sign flip if necessary
     int64_t result = flip ? -interpolated_value : interpolated_value;
 
-    // 7. Convert result back to original input format if needed
-    if (input_fraction_bits != kOutputFractionBits) {
-        if (input_fraction_bits < kOutputFractionBits) {
-            result >>= (kOutputFractionBits - input_fraction_bits);
-        } else {
-            result <<= (input_fraction_bits - kOutputFractionBits);
-        }
-    }
+    // 7. Convert result back to the input format
+    result = FromLutFormat<P>(result);
 
     return result;
 }
 
 // Lookup tan(x) with optimized Hermite cubic interpolation between table entries
-// Input x is in fixed-point format with specified fraction bits representing angle in radians
-// Precision: ~2.0e-9 when input_fraction_bits=32 (about 1500x more accurate than fast version)
-inline constexpr auto LookupTan(int64_t x, int input_fraction_bits) noexcept -> int64_t {
+// Input x is in fixed-point format with P fraction bits representing angle in radians
+// Precision: ~2.0e-9 when P=32 (about 1500x more accurate than fast version)
+template <int P>
+inline constexpr auto LookupTan(int64_t x) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kTanLookup);
     // Constants
     constexpr int64_t kPi = 0x00000003243F6A88LL;  // pi = 3.141592653589793
     constexpr int64_t kPiOver2 = 0x00000001921FB544LL;  // pi/2 = 1.5707963267948966
@@ -599,17 +592,11 @@ inline constexpr auto LookupTan(int64_t x, int input_fraction_bits) noexcept ->
     constexpr int kOutputFractionBits = 32;  // Output format: Q31.32
     constexpr int64_t kOne = 1LL << kOutputFractionBits;  // 1.0 in fixed-point
 
-    // Convert input to Q{int_bits}.{fraction_bits} format if needed
-    if (input_fraction_bits != kOutputFractionBits) {
-        if (input_fraction_bits < kOutputFractionBits) {
-            x <<= (kOutputFractionBits - input_fraction_bits);
-        } else {
-            x >>= (input_fraction_bits - kOutputFractionBits);
-        }
-    }
+    // Convert input to Q31.32
+    x = ToLutAngle<P, kPi>(x);
 
     // 1. Normalize angle to [-pi, pi]
-    x = x % kPi;
+    x = Primitives::RemConstant<kPi>(x);
 
     // 2. Handle negative angles
     bool flip = false;
@@ -625,7 +612,7 @@ inline constexpr auto LookupTan(int64_t x, int input_fraction_bits) noexcept ->
     }
 
     // 4. Calculate lookup table index and fractional part
-    int64_t idx_scaled = Primitives::Fixed64Mul(x, kLutInterval, kOutputFractionBits);
+    int64_t idx_scaled = Primitives::Fixed64Mul<kOutputFractionBits>(x, kLutInterval);
     int idx = static_cast<int>(idx_scaled >> kOutputFractionBits);
     int64_t t = idx_scaled & ((1LL << kOutputFractionBits) - 1);  // Fractional part [0,1)
 
@@ -634,16 +621,16 @@ inline constexpr auto LookupTan(int64_t x, int input_fraction_bits) noexcept ->
     int64_t p1 = kTanLut[idx + 1];  // Point at right endpoint
 
     // 6. Compute derivatives using the fact that tan'(x) = 1 + tan²(x)
-    int64_t p0_squared = Primitives::Fixed64Mul(p0, p0, kOutputFractionBits);
-    int64_t p1_squared = Primitives::Fixed64Mul(p1, p1, kOutputFractionBits);
+    int64_t p0_squared = Primitives::Fixed64Mul<kOutputFractionBits>(p0, p0);
+    int64_t p1_squared = Primitives::Fixed64Mul<kOutputFractionBits>(p1, p1);
     int64_t m0 = kOne + p0_squared;  // Derivative at left endpoint
     int64_t m1 = kOne + p1_squared;  // Derivative at right endpoint
 
     // Scale derivatives by step size
-    constexpr int64_t kStepSize = Primitives::Fixed64Div(
-        kPiOver2, static_cast<int64_t>(kTanLut.size() - 2) << kOutputFractionBits, kOutputFractionBits);
-    m0 = Primitives::Fixed64Mul(m0, kStepSize, kOutputFractionBits);
-    m1 = Primitives::Fixed64Mul(m1, kStepSize, kOutputFractionBits);
+    constexpr int64_t kStepSize = Primitives::Fixed64Div<kOutputFractionBits>(
+        kPiOver2, static_cast<int64_t>(kTanLut.size() - 2) << kOutputFractionBits);
+    m0 = Primitives::Fixed64Mul<kOutputFractionBits>(m0, kStepSize);
+    m1 = Primitives::Fixed64Mul<kOutputFractionBits>(m1, kStepSize);
 
     // 7. Compute optimized Hermite coefficients
     // p(t) = ((a*t + b)*t + c)*t + d  (Horner's method)
@@ -661,26 +648,19 @@ inline constexpr auto LookupTan(int64_t x, int input_fraction_bits) noexcept ->
     // 8. Compute interpolation using Horner's method
     int64_t result =
         d
-        + Primitives::Fixed64Mul(
+        + Primitives::Fixed64Mul<kOutputFractionBits>(
             t,
             c
-                + Primitives::Fixed64Mul(
-                    t, b + Primitives::Fixed64Mul(t, a, kOutputFractionBits), kOutputFractionBits),
-            kOutputFractionBits);
+                + Primitives::Fixed64Mul<kOutputFractionBits>(
+                    t, b + Primitives::Fixed64Mul<kOutputFractionBits>(t, a)));
 
     // 9. Apply sign flip if necessary
     if (flip) {
         result = -result;
     }
 
-    // 10. Convert result back to original input format if needed
-    if (input_fraction_bits != kOutputFractionBits) {
-        if (input_fraction_bits < kOutputFractionBits) {
-            result >>= (kOutputFractionBits - input_fraction_bits);
-        } else {
-            result <<= (input_fraction_bits - kOutputFractionBits);
-        }
-    }
+    // 10. Convert result back to the input format
+    result = FromLutFormat<P>(result);
 
     return result;
 }
@@ -0,0 +1,354 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "atan2_lut.h"
+#include "batch_kernels.h"
+#include "lut_format.h"
+#include "primitives.h"
+#include "sin_lut.h"
+#include "sin_poly.h"
+#include "tan_lut.h"
+
+namespace math::fp::detail {
+
+// Vectorized LookupSin/LookupSinFast/LookupTan/LookupTanFast and Fixed64Math::Atan2
+// Each lane runs the same integer steps as the scalar lookup, with the data-dependent
+// branches replaced by compares and selects:
+//   - angle reduction x % period via RemLanes (exact Barrett remainder)
+//   - quadrant folding and sign flips via Select and sign masks
+//   - table reads via gather, Horner/linear evaluation via MulFrac32Lanes (Fixed64MulLanes
+//     in Q1.62 for the polynomial backend)
+// The input fraction bits P are a template parameter, so format conversion is a fixed shift
+
+#if FIXED64_BATCH_HAS_SIMD
+// Vectorized ToLutAngle: below 32 fraction bits every lane is reduced modulo kPeriod in its own
+// format before each shift of at most 27 bits, which gives the same remainder as the scalar
+// conversion without testing for overflow
+template <int P, int64_t kPeriod>
+inline auto ToLutAngleLanes(BatchVec x) noexcept -> BatchVec {
+    if constexpr (P >= kLutFractionBits) {
+        return ShiftRightArithLanes<P - kLutFractionBits>(x);
+    } else {
+        constexpr int kStep = kLutFractionBits - P < 27 ? kLutFractionBits - P : 27;
+        return ToLutAngleLanes<P + kStep, kPeriod>(ShiftLeftLanes<kStep>(RemLanes<kPeriod>(x)));
+    }
+}
+
+// Vectorized FromLutFormat
+template <int P>
+inline auto FromLutFormatLanes(BatchVec x) noexcept -> BatchVec {
+    if constexpr (P >= kLutFractionBits) {
+        return ShiftLeftLanes<P - kLutFractionBits>(x);
+    } else {
+        return SimdOps::ShiftRightArith<kLutFractionBits - P>(x);
+    }
+}
+
+template <int P, bool Fast>
+inline auto SinLanes(BatchVec x) noexcept -> BatchVec {
+    static_assert(P > 0 && P < 64, "Vectorized sin requires 0 < P < 64");
+
+    // Constants (see LookupSin)
+    constexpr int64_t kPi = 0x00000003243F6A88LL;
+    constexpr int64_t kPiOver2 = 0x00000001921FB544LL;
+    constexpr int64_t kTwoPi = 0x00000006487ED511LL;
+    constexpr int64_t kLutInterval = 0x00000145500D592ELL;
+    constexpr int64_t kStepSize = kPiOver2 / (kSinLut.size() - 2);
+    constexpr int64_t kLastSegment = static_cast<int64_t>(kSinLut.size()) - 2;
+    const BatchVec kZero = SimdOps::Set1(0);
+    const BatchVec kAllOnes = SimdOps::Set1(-1);
+
+    // Convert to Q31.32 and normalize angle to [0, 2*pi)
+    x = RemLanes<kTwoPi>(ToLutAngleLanes<P, kTwoPi>(x));
+    x = SimdOps::Select(SimdOps::CmpGt(kZero, x), SimdOps::Add(x, SimdOps::Set1(kTwoPi)), x);
+
+    // Map to [0, pi/2], remembering the sign of the 3rd and 4th quadrants
+    const auto lower_half = SimdOps::CmpGt(x, SimdOps::Set1(kPi));
+    const BatchVec sign = SimdOps::Select(lower_half, kAllOnes, kZero);
+    x = SimdOps::Select(lower_half, SimdOps::Sub(x, SimdOps::Set1(kPi)), x);
+    x = SimdOps::Select(SimdOps::CmpGt(x, SimdOps::Set1(kPiOver2)),
+                        SimdOps::Sub(SimdOps::Set1(kPi), x), x);
+
+    // Table index and fractional part (x is non-negative, so Fixed64Mul is MulU64Shifted)
+    const BatchVec idx_scaled = MulU64ShiftedLanes<32>(x, SimdOps::Set1(kLutInterval));
+    const BatchVec idx = SimdOps::ShiftRightLogical<32>(idx_scaled);
+    const BatchVec t = SimdOps::And(idx_scaled, SimdOps::Set1(0xFFFFFFFFLL));
+
+    const BatchVec p0 = SimdOps::Gather(kSinLut.data(), idx);
+    const BatchVec p1 = SimdOps::Gather(kSinLut.data() + 1, idx);
+
+    BatchVec result;
+    if constexpr (Fast) {
+        const BatchVec diff = SimdOps::Sub(p1, p0);
+        result = SimdOps::Add(p0, SimdOps::ShiftRightArith<32>(MulLo64Lanes(diff, t)));
+    } else {
+        // Derivatives from the mirrored index, m1 is zero at the last segment
+        const BatchVec cos_idx = SimdOps::Sub(SimdOps::Set1(kLastSegment), idx);
+        const auto has_next = SimdOps::CmpGt(cos_idx, kZero);
+        BatchVec m0 = SimdOps::Gather(kSinLut.data(), cos_idx);
+        BatchVec m1 = SimdOps::Gather(
+            kSinLut.data(),
+            SimdOps::Select(has_next, SimdOps::Sub(cos_idx, SimdOps::Set1(1)), kZero));
+        m1 = SimdOps::Select(has_next, m1, kZero);
+        m0 = SimdOps::ShiftRightArith<32>(MulLo64Lanes(m0, SimdOps::Set1(kStepSize)));
+        m1 = SimdOps::ShiftRightArith<32>(MulLo64Lanes(m1, SimdOps::Set1(kStepSize)));
+
+        // Hermite coefficients a = 2(p0-p1) + m0 + m1, b = -3(p0-p1) - 2m0 - m1
+        const BatchVec p0_minus_p1 = SimdOps::Sub(p0, p1);
+        const BatchVec a =
+            SimdOps::Add(SimdOps::Add(SimdOps::ShiftLeft<1>(p0_minus_p1), m0), m1);
+        const BatchVec b = SimdOps::Sub(
+            SimdOps::Sub(SimdOps::Sub(kZero, SimdOps::Add(p0_minus_p1,
+                                                          SimdOps::ShiftLeft<1>(p0_minus_p1))),
+                         SimdOps::ShiftLeft<1>(m0)),
+            m1);
+
+        result = MulFrac32Lanes(t, SimdOps::Add(b, MulFrac32Lanes(t, a)));
+        result = MulFrac32Lanes(t, SimdOps::Add(m0, result));
+        result = SimdOps::Add(p0, result);
+    }
+
+    return FromLutFormatLanes<P>(ApplySignLanes(result, sign));
+}
+
+// Vectorized LookupSinPoly
+template <int P>
+inline auto SinPolyLanes(BatchVec x) noexcept -> BatchVec {
+    static_assert(P > 0 && P < 64, "Vectorized sin requires 0 < P < 64");
+
+    // Constants (see LookupSinPoly)
+    constexpr int64_t kPi = 0x00000003243F6A88LL;
+    constexpr int64_t kPiOver2 = 0x00000001921FB544LL;
+    constexpr int64_t kTwoPi = 0x00000006487ED511LL;
+    constexpr int kShift = kSinPolyFractionBits - 32;
+    const BatchVec kZero = SimdOps::Set1(0);
+    const BatchVec kAllOnes = SimdOps::Set1(-1);
+
+    // Convert to Q31.32, normalize angle to [0, 2*pi) and map to [0, pi/2]
+    x = RemLanes<kTwoPi>(ToLutAngleLanes<P, kTwoPi>(x));
+    x = SimdOps::Select(SimdOps::CmpGt(kZero, x), SimdOps::Add(x, SimdOps::Set1(kTwoPi)), x);
+    const auto lower_half = SimdOps::CmpGt(x, SimdOps::Set1(kPi));
+    const BatchVec sign = SimdOps::Select(lower_half, kAllOnes, kZero);
+    x = SimdOps::Select(lower_half, SimdOps::Sub(x, SimdOps::Set1(kPi)), x);
+    x = SimdOps::Select(SimdOps::CmpGt(x, SimdOps::Set1(kPiOver2)),
+                        SimdOps::Sub(SimdOps::Set1(kPi), x), x);
+
+    // Segment index, clamped to the last segment, and offset into the segment in Q1.62
+    const BatchVec kLast = SimdOps::Set1(kSinPolySegments - 1);
+    BatchVec idx = SimdOps::ShiftRightLogical<32>(
+        MulU64ShiftedLanes<32>(x, SimdOps::Set1(kSinPolyIndexScale)));
+    idx = SimdOps::Select(SimdOps::CmpGt(idx, kLast), kLast, idx);
+    const BatchVec t = SimdOps::ShiftLeft<kShift>(
+        SimdOps::Sub(x, SimdOps::MulU32(idx, SimdOps::Set1(kSinPolySegmentWidth))));
+
+    // Horner's method in Q1.62 on the gathered coefficients of each lane's segment
+    const BatchVec base = SimdOps::MulU32(idx, SimdOps::Set1(kSinPolyDegree + 1));
+    BatchVec result = SimdOps::Gather(kSinPolyCoeffs.data() + kSinPolyDegree, base);
+    for (int i = kSinPolyDegree - 1; i >= 0; --i) {
+        result = SimdOps::Add(SimdOps::Gather(kSinPolyCoeffs.data() + i, base),
+                              Fixed64MulLanes<kSinPolyFractionBits>(result, t));
+    }
+    result = SimdOps::ShiftRightArith<kShift>(
+        SimdOps::Add(result, SimdOps::Set1(1LL << (kShift - 1))));
+
+    return FromLutFormatLanes<P>(ApplySignLanes(result, sign));
+}
+
+template <int P, bool Fast>
+inline auto TanLanes(BatchVec x) noexcept -> BatchVec {
+    static_assert(P > 0 && P < 64, "Vectorized tan requires 0 < P < 64");
+
+    // Constants (see LookupTan)
+    constexpr int64_t kPi = 0x00000003243F6A88LL;
+    constexpr int64_t kPiOver2 = 0x00000001921FB544LL;
+    constexpr int64_t kLutInterval = 0x00000145500D592ELL;
+    constexpr int64_t kOne = 1LL << 32;
+    constexpr int64_t kStepSize =
+        Primitives::Fixed64Div<32>(kPiOver2, static_cast<int64_t>(kTanLut.size() - 2) << 32);
+    const BatchVec kZero = SimdOps::Set1(0);
+
+    // Convert to Q31.32 and normalize angle to (-pi, pi), then fold to [0, pi/2]
+    x = RemLanes<kPi>(ToLutAngleLanes<P, kPi>(x));
+    BatchVec sign = SimdOps::ShiftRightArith<63>(x);
+    x = ApplySignLanes(x, sign);
+    const auto upper_half = SimdOps::CmpGt(x, SimdOps::Set1(kPiOver2));
+    x = SimdOps::Select(upper_half, SimdOps::Sub(SimdOps::Set1(kPi), x), x);
+    sign = SimdOps::Xor(sign, SimdOps::Select(upper_half, SimdOps::Set1(-1), kZero));
+
+    // Table index and fractional part (x is non-negative, so Fixed64Mul is MulU64Shifted)
+    const BatchVec idx_scaled = MulU64ShiftedLanes<32>(x, SimdOps::Set1(kLutInterval));
+    const BatchVec idx = SimdOps::ShiftRightLogical<32>(idx_scaled);
+    const BatchVec t = SimdOps::And(idx_scaled, SimdOps::Set1(0xFFFFFFFFLL));
+
+    const BatchVec p0 = SimdOps::Gather(kTanLut.data(), idx);
+    const BatchVec p1 = SimdOps::Gather(kTanLut.data() + 1, idx);
+
+    BatchVec result;
+    if constexpr (Fast) {
+        result = SimdOps::Add(p0, MulFrac32Lanes(t, SimdOps::Sub(p1, p0)));
+    } else {
+        // Derivatives tan'(x) = 1 + tan^2(x), scaled by the step size
+        BatchVec m0 = SimdOps::Add(SimdOps::Set1(kOne), Fixed64MulLanes<32>(p0, p0));
+        BatchVec m1 = SimdOps::Add(SimdOps::Set1(kOne), Fixed64MulLanes<32>(p1, p1));
+        m0 = Fixed64MulLanes<32>(m0, SimdOps::Set1(kStepSize));
+        m1 = Fixed64MulLanes<32>(m1, SimdOps::Set1(kStepSize));
+
+        // Hermite coefficients a = 2(p0-p1) + m0 + m1, b = -3(p0-p1) - 2m0 - m1
+        const BatchVec p0_minus_p1 = SimdOps::Sub(p0, p1);
+        const BatchVec a =
+            SimdOps::Add(SimdOps::Add(SimdOps::ShiftLeft<1>(p0_minus_p1), m0), m1);
+        const BatchVec b = SimdOps::Sub(
+            SimdOps::Sub(SimdOps::Sub(kZero, SimdOps::Add(p0_minus_p1,
+                                                          SimdOps::ShiftLeft<1>(p0_minus_p1))),
+                         SimdOps::ShiftLeft<1>(m0)),
+            m1);
+
+        result = MulFrac32Lanes(t, SimdOps::Add(b, MulFrac32Lanes(t, a)));
+        result = MulFrac32Lanes(t, SimdOps::Add(m0, result));
+        result = SimdOps::Add(p0, result);
+    }
+
+    return FromLutFormatLanes<P>(ApplySignLanes(result, sign));
+}
+
+// == Fixed64Math::Atan2 on raw values, with HalfPi/Pi passed in the input format
+// The ratio min(|x|,|y|) / max(|x|,|y|) is only needed to the 32 fraction bits LookupAtan2
+// keeps, which DivFractionLanes computes exactly. The index and interpolation divisions by
+// kIndexScale are exact multiply-shift sequences:
+//   floor(s / kIndexScale) == (s * 4278190081) >> 56             for s < 2^32
+//   floor(v / kIndexScale) == hi64(v * 1121501860592641) >> 10   for v < 2^49
+template <int P>
+inline auto Atan2Lanes(BatchVec y, BatchVec x, int64_t half_pi, int64_t pi) noexcept -> BatchVec {
+    static_assert(P > 0 && P < 64, "Vectorized atan2 requires 0 < P < 64");
+    constexpr int kTableP = 32;
+    constexpr int K = P < kTableP ? P : kTableP;
+    constexpr int64_t kOne = 1LL << kTableP;
+    constexpr int64_t kIndexScale = (1LL << kTableP) / (kAtan2LUT.size() - 2);
+    constexpr int64_t kIndexMagic = 4278190081LL;
+    constexpr int64_t kInterpMagic = 1121501860592641LL;
+    static_assert(kIndexScale == 16843009, "Magic numbers assume a 256 segment table");
+    const BatchVec kZero = SimdOps::Set1(0);
+    const BatchVec kAllOnes = SimdOps::Set1(-1);
+
+    // Sign masks and magnitudes, NaN (INT64_MIN) lanes have a negative magnitude
+    const BatchVec x_sign = SimdOps::ShiftRightArith<63>(x);
+    const BatchVec y_sign = SimdOps::ShiftRightArith<63>(y);
+    BatchVec ax = ApplySignLanes(x, x_sign);
+    BatchVec ay = ApplySignLanes(y, y_sign);
+    const BatchVec nan = SimdOps::Or(SimdOps::ShiftRightArith<63>(ax),
+                                     SimdOps::ShiftRightArith<63>(ay));
+    ax = SimdOps::And(ax, SimdOps::Xor(nan, kAllOnes));
+    ay = SimdOps::And(ay, SimdOps::Xor(nan, kAllOnes));
+
+    // Octant: ratio in [0, 1]
+    const auto swapped = SimdOps::CmpGt(ay, ax);
+    const BatchVec num = SimdOps::Select(swapped, ax, ay);
+    BatchVec den = SimdOps::Select(swapped, ay, ax);
+    const auto nonzero = SimdOps::CmpGt(den, kZero);
+    den = SimdOps::Select(nonzero, den, SimdOps::Set1(1));
+
+    // LookupAtan2 in Q31.32
+    BatchVec scaled = ShiftLeftLanes<kTableP - K>(DivFractionLanes<K>(num, den));
+    scaled = SimdOps::Select(SimdOps::CmpGt(scaled, SimdOps::Set1(kOne - 1)),
+                             SimdOps::Set1(kOne - 1), scaled);
+    const BatchVec index =
+        SimdOps::ShiftRightLogical<56>(SimdOps::MulU32(scaled, SimdOps::Set1(kIndexMagic)));
+    const BatchVec frac = SimdOps::Sub(scaled, SimdOps::MulU32(index, SimdOps::Set1(kIndexScale)));
+    const BatchVec y0 = SimdOps::Gather(kAtan2LUT.data(), index);
+    const BatchVec y1 = SimdOps::Gather(kAtan2LUT.data() + 1, index);
+    BatchVec interp_hi;
+    BatchVec interp_lo;
+    MulU64FullLanes(SimdOps::MulU32(SimdOps::Sub(y1, y0), frac), SimdOps::Set1(kInterpMagic),
+                    interp_hi, interp_lo);
+    BatchVec angle = SimdOps::Add(y0, SimdOps::ShiftRightLogical<10>(interp_hi));
+    if constexpr (P > kTableP) {
+        angle = SimdOps::ShiftLeft<P - kTableP>(angle);
+    } else if constexpr (P < kTableP) {
+        angle = SimdOps::ShiftRightArith<kTableP - P>(angle);
+    }
+
+    // Octant and quadrant corrections
+    angle = SimdOps::Select(swapped, SimdOps::Sub(SimdOps::Set1(half_pi), angle), angle);
+    angle = SimdOps::Add(ApplySignLanes(angle, x_sign), SimdOps::And(SimdOps::Set1(pi), x_sign));
+    angle = ApplySignLanes(angle, y_sign);
+
+    // atan2(0, 0) = 0, NaN in -> NaN out
+    angle = SimdOps::Select(nonzero, angle, kZero);
+    return SimdOps::Select(SimdOps::CmpGt(kZero, nan), SimdOps::Set1(INT64_MIN), angle);
+}
+
+// out[i] = sin(x[i] + offset), the offset turns sine into cosine exactly like Fixed64Math::Cos
+template <int P, bool Fast>
+inline auto SinBatch(const int64_t* x, int64_t offset, int64_t* out, size_t count) noexcept
+    -> size_t {
+    const BatchVec voffset = SimdOps::Set1(offset);
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        SimdOps::Store(out + i, SinLanes<P, Fast>(SimdOps::Add(SimdOps::Load(x + i), voffset)));
+    }
+    return i;
+}
+
+// out[i] = sin(x[i] + offset) with the polynomial backend
+template <int P>
+inline auto SinPolyBatch(const int64_t* x, int64_t offset, int64_t* out, size_t count) noexcept
+    -> size_t {
+    const BatchVec voffset = SimdOps::Set1(offset);
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        SimdOps::Store(out + i, SinPolyLanes<P>(SimdOps::Add(SimdOps::Load(x + i), voffset)));
+    }
+    return i;
+}
+
+template <int P, bool Fast>
+inline auto TanBatch(const int64_t* x, int64_t* out, size_t count) noexcept -> size_t {
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        SimdOps::Store(out + i, TanLanes<P, Fast>(SimdOps::Load(x + i)));
+    }
+    return i;
+}
+
+template <int P>
+inline auto Atan2Batch(const int64_t* y,
+                       const int64_t* x,
+                       int64_t half_pi,
+                       int64_t pi,
+                       int64_t* out,
+                       size_t count) noexcept -> size_t {
+    size_t i = 0;
+    for (; i + kBatchLanes <= count; i += kBatchLanes) {
+        SimdOps::Store(out + i,
+                       Atan2Lanes<P>(SimdOps::Load(y + i), SimdOps::Load(x + i), half_pi, pi));
+    }
+    return i;
+}
+
+#else
+// No vector unit available: the caller's scalar loop handles every element
+template <int P, bool Fast>
+inline auto SinBatch(const int64_t*, int64_t, int64_t*, size_t) noexcept -> size_t {
+    return 0;
+}
+
+template <int P>
+inline auto SinPolyBatch(const int64_t*, int64_t, int64_t*, size_t) noexcept -> size_t {
+    return 0;
+}
+
+template <int P, bool Fast>
+inline auto TanBatch(const int64_t*, int64_t*, size_t) noexcept -> size_t {
+    return 0;
+}
+
+template <int P>
+inline auto Atan2Batch(const int64_t*, const int64_t*, int64_t, int64_t, int64_t*, size_t) noexcept
+    -> size_t {
+    return 0;
+}
+#endif
+
+}  // namespace math::fp::detail
@@ -3,13 +3,17 @@
 #include <inttypes.h>
 #include <algorithm>  // Include header for std::clamp
 #include <bit>
+#include <charconv>
 #include <cmath>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <type_traits>
 
 #include "fixed64_type_traits.h"
@@ -47,6 +51,88 @@ namespace detail {
 using namespace math::fp::fixed64_traits;  // Import type traits
 
 struct nothing {};
+
+// "00" to "99", two characters per entry
+inline constexpr char kDigitPairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// 10^k for k = 0..19
+inline constexpr uint64_t kPowersOf10[20] = {1ULL,
+                                             10ULL,
+                                             100ULL,
+                                             1000ULL,
+                                             10000ULL,
+                                             100000ULL,
+                                             1000000ULL,
+                                             10000000ULL,
+                                             100000000ULL,
+                                             1000000000ULL,
+                                             10000000000ULL,
+                                             100000000000ULL,
+                                             1000000000000ULL,
+                                             10000000000000ULL,
+                                             100000000000000ULL,
+                                             1000000000000000ULL,
+                                             10000000000000000ULL,
+                                             100000000000000000ULL,
+                                             1000000000000000000ULL,
+                                             10000000000000000000ULL};
+
+// Writes the last `count` decimal digits of v, with leading zeros, so that they end at `end`
+inline auto WriteDigitsBackward(char* end, uint64_t v, int count) noexcept -> void {
+    for (; count >= 2; count -= 2) {
+        const auto pair = static_cast<size_t>(v % 100) * 2;
+        v /= 100;
+        end -= 2;
+        end[0] = kDigitPairs[pair];
+        end[1] = kDigitPairs[pair + 1];
+    }
+    if (count > 0) {
+        *--end = static_cast<char>('0' + v % 10);
+    }
+}
+
+// Parses eight ASCII digits at p into their value, all in one 64-bit word (SWAR)
+// Returns false without reading beyond p[7] if any of the eight characters is not a digit
+inline auto ParseEightDigits(const char* p, uint64_t& value) noexcept -> bool {
+    // Little-endian word regardless of the platform, p[0] in the low byte
+    uint64_t v = 0;
+    if constexpr (std::endian::native == std::endian::little) {
+        std::memcpy(&v, p, sizeof(v));
+    } else {
+        for (int i = 7; i >= 0; --i) {
+            v = (v << 8) | static_cast<unsigned char>(p[i]);
+        }
+    }
+
+    // Every byte in '0'..'9': the high nibble is 3 before and after adding 6
+    constexpr uint64_t kHighNibbles = 0xF0F0F0F0F0F0F0F0ULL;
+    constexpr uint64_t kZeros = 0x3030303030303030ULL;
+    if ((v & kHighNibbles) != kZeros
+        || ((v + 0x0606060606060606ULL) & kHighNibbles) != kZeros) {
+        return false;
+    }
+
+    // Combine digits pairwise: 8 x 1 -> 4 x 2 -> 2 x 4 -> 1 x 8
+    v -= kZeros;
+    v = (v * 10) + (v >> 8);
+    v = (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32)))
+         + (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32))))
+        >> 32;
+    value = v;
+    return true;
+}
+
+// Number of decimal digits of v, at least one
+inline constexpr auto CountDigits(uint64_t v) noexcept -> int {
+    int count = 1;
+    while (count < 20 && v >= kPowersOf10[count]) {
+        ++count;
+    }
+    return count;
+}
 }  // namespace detail
 
 template <int P>
@@ -327,6 +413,35 @@ class Fixed64 {
     // Convert to string (high precision version)
     // NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays,
     // cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    // Longest text written by ToChars: sign, 19 integer digits, point and 20 decimals
+    static constexpr int kMaxChars = 48;
+
+    /**
+     * @brief Writes the decimal representation to a character buffer, in the style of
+     * std::to_chars.
+     *
+     * Produces the same text as ToString without allocating and without a terminating null.
+     * The fractional digits are extracted up to 19 at a time: the fraction is scaled to a
+     * 64-bit binary fraction and one 64x64->128 multiplication by a power of ten yields the
+     * next digits in the high word, with the exact remaining fraction in the low word.
+     *
+     * @param first Start of the output buffer
+     * @param last End of the output buffer
+     * @return {end of the written text, errc()} on success, or {last, errc::value_too_large}
+     * if the text does not fit, in which case the buffer contents are unspecified
+     */
+    auto ToChars(char* first, char* last) const noexcept -> std::to_chars_result {
+        if (last - first >= kMaxChars) {
+            return {Format(first), std::errc()};
+        }
+        char buffer[kMaxChars];
+        const char* end = Format(buffer);
+        if (last - first < end - buffer) {
+            return {last, std::errc::value_too_large};
+        }
+        return {std::copy(static_cast<const char*>(buffer), end, first), std::errc()};
+    }
+
     /**
      * @brief Converts the fixed-point value to a string representation.
      *
@@ -338,92 +453,38 @@ class Fixed64 {
      *   - Removal of trailing zeros
      *
      * @return A string representation of the fixed-point value.
+     * @see ToChars for the allocation-free form
      */
     [[nodiscard]] auto ToString() const noexcept -> std::string {
-        // Initialize the buffer with enough capacity for most cases
-        char buffer[64];
-        char* ptr = buffer;
-
-        // Handle sign
-        if (value_ < 0) {
-            *ptr++ = '-';
-        }
-
-        // Get integer and fractional parts
-        int64_t abs_value = std::abs(value_);
-        int64_t int_part = abs_value >> P;
-        uint64_t frac_part = abs_value & ((1LL << P) - 1);
-
-        // Handle integer part
-        if (int_part == 0) {
-            *ptr++ = '0';
-        } else {
-            char* start = ptr;
-
-            // Convert integer part to string (in reverse)
-            while (int_part > 0) {
-                *ptr++ = '0' + static_cast<char>(int_part % 10);
-                int_part /= 10;
-            }
-
-            // Reverse the digits to get correct order
-            std::reverse(start, ptr);
-        }
-
-        // Handle fractional part if non-zero or if we need decimal places
-        if (P > 0 && frac_part > 0) {
-            *ptr++ = '.';
-
-            // Calculate number of decimal places needed (based on precision)
-            constexpr int kDecimalPlaces =
-                static_cast<int>(static_cast<int64_t>(P) * Log10Of2().value() >> P) + 2;
-
-            // Convert fractional part to decimal representation
-            for (int i = 0; i < kDecimalPlaces && frac_part > 0; ++i) {
-                // Scale by 10 to get next decimal digit
-                frac_part *= 10;
-                uint64_t digit = frac_part >> P;
-                *ptr++ = '0' + static_cast<char>(digit);
-                frac_part &= ((1ULL << P) - 1);  // Keep only fractional part
-            }
-
-            // Remove trailing zeros
-            while (*(ptr - 1) == '0' && *(ptr - 2) != '.') {
-                --ptr;
-            }
-        }
-
-        // Null terminate the string
-        *ptr = '\0';
-        return std::string(buffer);
+        char buffer[kMaxChars];
+        return std::string(buffer, Format(buffer));
     }
 
     /**
-     * Parse a fixed-point number from string, using pure integer operations
-     * to ensure cross-platform consistency
-     * Implementation based on LLVM libc's Simple Decimal Conversion algorithm
+     * @brief Parses a decimal number from a character range, in the style of std::from_chars.
+     *
+     * Accepts an optional sign, digits with an optional decimal point and an optional
+     * exponent ("e" or "E", optional sign, digits). Leading whitespace is not skipped. The
+     * conversion is the one FromString uses, so both give identical values.
+     *
+     * @param first Start of the text
+     * @param last End of the text
+     * @param value Receives the parsed value
+     * @return {end of the number, errc()} on success; {first, errc::invalid_argument} without
+     * modifying value if no digits were found; {end of the number, errc::result_out_of_range}
+     * if the number is too large, with value set to the saturated result
      */
-    [[nodiscard]] static auto FromString(const std::string& str) noexcept -> Fixed64<P> {
-        // Handle empty string
-        if (str.empty()) {
-            return Fixed64<P>();
-        }
-
-        const char* src = str.c_str();
-        size_t index = 0;
-
-        // Skip leading whitespace
-        while (src[index] && isspace(static_cast<unsigned char>(src[index]))) {
-            ++index;
-        }
+    static auto FromChars(const char* first, const char* last, Fixed64<P>& value) noexcept
+        -> std::from_chars_result {
+        const char* src = first;
 
         // Handle sign
         bool is_negative = false;
-        if (src[index] == '-') {
+        if (src != last && *src == '-') {
             is_negative = true;
-            ++index;
-        } else if (src[index] == '+') {
-            ++index;
+            ++src;
+        } else if (src != last && *src == '+') {
+            ++src;
         }
 
         // Parse integer part
@@ -436,14 +497,33 @@ class Fixed64 {
         constexpr int64_t MAX_SAFE_INT = INT64_MAX / 10;
 
         // Define minimum allowed value for decimal_exponent
-        // Use existing Log10Of2 for precise binary-to-decimal conversion
-        constexpr int32_t MIN_SAFE_DECIMAL_EXPONENT =
-            -static_cast<int32_t>((static_cast<int64_t>(P) * Log10Of2().value()) >> P) - 1;
+        constexpr int32_t MIN_SAFE_DECIMAL_EXPONENT = -kDecimalDigits - 1;
+
+        // Mantissa below which eight more digits cannot reach MAX_SAFE_INT
+        constexpr int64_t MAX_EIGHT_DIGIT_MANTISSA = MAX_SAFE_INT / 100000000;
+        bool try_eight = true;  // Cleared when a run has fewer than eight digits left
 
         // Parse numeric part (integer + fractional)
-        while (true) {
-            if (src[index] && isdigit(static_cast<unsigned char>(src[index]))) {
-                int digit = src[index] - '0';
+        while (src != last) {
+            // Fast path: eight digits at once while none of them hits a limit, which gives
+            // the same mantissa and exponent as eight passes of the loop below
+            if (try_eight && last - src >= 8 && mantissa < MAX_EIGHT_DIGIT_MANTISSA
+                && (!after_decimal || decimal_exponent - 7 >= MIN_SAFE_DECIMAL_EXPONENT)) {
+                uint64_t eight;
+                if (detail::ParseEightDigits(src, eight)) {
+                    mantissa = mantissa * 100000000 + static_cast<int64_t>(eight);
+                    seen_digit = true;
+                    if (after_decimal) {
+                        decimal_exponent -= 8;
+                    }
+                    src += 8;
+                    continue;
+                }
+                try_eight = false;
+            }
+
+            if (IsDigit(*src)) {
+                int digit = *src - '0';
                 seen_digit = true;
 
                 // Check if decimal_exponent is already below the minimum allowed value
@@ -461,16 +541,17 @@ class Fixed64 {
                     }
                 }
 
-                ++index;
+                ++src;
                 continue;
             }
 
-            if (src[index] == '.') {
+            if (*src == '.') {
                 if (after_decimal) {
                     break;  // Second decimal point, end parsing
                 }
                 after_decimal = true;
-                ++index;
+                try_eight = true;
+                ++src;
                 continue;
             }
 
@@ -478,34 +559,35 @@ class Fixed64 {
         }
 
         if (!seen_digit) {
-            return Fixed64<P>();  // No valid digits found
+            return {first, std::errc::invalid_argument};  // No valid digits found
         }
 
-        // Handle scientific notation exponent
-        if (src[index] && (tolower(src[index]) == 'e')) {
-            ++index;
+        // Handle scientific notation exponent, only consumed if it has digits
+        if (src != last && (*src == 'e' || *src == 'E')) {
+            const char* exp_src = src + 1;
             int32_t exp_value = 0;
             bool exp_negative = false;
 
-            if (src[index] == '-') {
+            if (exp_src != last && *exp_src == '-') {
                 exp_negative = true;
-                ++index;
-            } else if (src[index] == '+') {
-                ++index;
+                ++exp_src;
+            } else if (exp_src != last && *exp_src == '+') {
+                ++exp_src;
             }
 
             bool valid_exp = false;
-            while (src[index] && isdigit(static_cast<unsigned char>(src[index]))) {
+            while (exp_src != last && IsDigit(*exp_src)) {
                 valid_exp = true;
                 // Only process exponents within reasonable range to prevent overflow
                 if (exp_value < 10000) {
-                    exp_value = exp_value * 10 + (src[index] - '0');
+                    exp_value = exp_value * 10 + (*exp_src - '0');
                 }
-                ++index;
+                ++exp_src;
             }
 
             if (valid_exp) {
                 decimal_exponent += exp_negative ? -exp_value : exp_value;
+                src = exp_src;
             }
         }
 
@@ -530,13 +612,11 @@ class Fixed64 {
 
         // 2. Handle decimal exponent (decimal_exponent)
         if (decimal_exponent != 0) {
-            // Calculate 10^|decimal_exponent|
-            int64_t power_of_10 = 1;
+            // Calculate 10^|decimal_exponent|, capped at 10^18, the first power of ten above
+            // INT64_MAX / 10
             int32_t abs_exp = decimal_exponent < 0 ? -decimal_exponent : decimal_exponent;
-
-            for (int i = 0; i < abs_exp && power_of_10 <= INT64_MAX / 10; ++i) {
-                power_of_10 *= 10;
-            }
+            const auto power_of_10 =
+                static_cast<int64_t>(detail::kPowersOf10[abs_exp < 18 ? abs_exp : 18]);
 
             if (decimal_exponent > 0) {
                 // Positive exponent: multiply by 10^decimal_exponent
@@ -544,8 +624,9 @@ class Fixed64 {
                     result *= power_of_10;
                 } else {
                     // Overflow handling
-                    return is_negative ? Fixed64<P>(INT64_MIN, detail::nothing{})
-                                       : Fixed64<P>(INT64_MAX, detail::nothing{});
+                    value = is_negative ? Fixed64<P>(INT64_MIN, detail::nothing{})
+                                        : Fixed64<P>(INT64_MAX, detail::nothing{});
+                    return {src, std::errc::result_out_of_range};
                 }
             } else {
                 // Negative exponent: divide by 10^|decimal_exponent| with rounding
@@ -564,7 +645,32 @@ class Fixed64 {
             result = -result;
         }
 
-        return Fixed64<P>(result, detail::nothing{});
+        value = Fixed64<P>(result, detail::nothing{});
+        return {src, std::errc()};
+    }
+
+    /**
+     * Parse a fixed-point number from string, using pure integer operations
+     * to ensure cross-platform consistency
+     * Implementation based on LLVM libc's Simple Decimal Conversion algorithm
+     * Leading whitespace is skipped, text without digits gives zero and overflow saturates
+     */
+    [[nodiscard]] static auto FromString(std::string_view str) noexcept -> Fixed64<P> {
+        const char* first = str.data();
+        const char* last = first + str.size();
+
+        // Skip leading whitespace
+        while (first != last && isspace(static_cast<unsigned char>(*first))) {
+            ++first;
+        }
+
+        Fixed64<P> result;
+        const auto [end, ec] = FromChars(first, last, result);
+        Fixed64Instrumentation::Record(Fixed64Event::kFromString);
+        if (ec != std::errc() || end != last) {
+            Fixed64Instrumentation::Record(Fixed64Event::kParseError);
+        }
+        return result;
     }
 
     // NOLINTEND
@@ -587,6 +693,61 @@ class Fixed64 {
  private:
     int64_t value_;
 
+    // floor(P * log10(2)), the decimal digits the fraction bits resolve. 1233 / 4096 is
+    // log10(2) to within 1e-5, the product has the same floor for every precision
+    static constexpr int kDecimalDigits = (P * 1233) >> 12;
+
+    static constexpr auto IsDigit(char c) noexcept -> bool {
+        return c >= '0' && c <= '9';
+    }
+
+    // Writes the text of ToString to out, which must have room for kMaxChars characters
+    auto Format(char* out) const noexcept -> char* {
+        char* ptr = out;
+
+        // Handle sign, the magnitude is taken unsigned so that INT64_MIN is representable
+        uint64_t abs_value = static_cast<uint64_t>(value_);
+        if (value_ < 0) {
+            *ptr++ = '-';
+            abs_value = 0 - abs_value;
+        }
+
+        // Integer part, two digits per step
+        const uint64_t int_part = abs_value >> P;
+        const int int_digits = detail::CountDigits(int_part);
+        ptr += int_digits;
+        detail::WriteDigitsBackward(ptr, int_part, int_digits);
+
+        if constexpr (P > 0) {
+            // Fractional part as a 64-bit binary fraction
+            uint64_t frac = abs_value << (64 - P);
+            if (frac == 0) {
+                return ptr;
+            }
+            *ptr++ = '.';
+
+            // Calculate number of decimal places needed (based on precision)
+            constexpr int kDecimalPlaces = kDecimalDigits + 2;
+
+            // Digits are truncated, not rounded: the high word of frac * 10^k holds the next
+            // k digits and the low word the fraction that remains
+            for (int remaining = kDecimalPlaces; remaining > 0 && frac != 0;) {
+                const int count = remaining < 19 ? remaining : 19;
+                uint64_t digits;
+                umul_ppmm(digits, frac, frac, detail::kPowersOf10[count]);
+                ptr += count;
+                detail::WriteDigitsBackward(ptr, digits, count);
+                remaining -= count;
+            }
+
+            // Remove trailing zeros
+            while (*(ptr - 1) == '0' && *(ptr - 2) != '.') {
+                --ptr;
+            }
+        }
+        return ptr;
+    }
+
     // Declare all operators as friends
     template <int Q, int R>
     friend constexpr auto operator+=(Fixed64<Q>&, const Fixed64<R>&) noexcept -> Fixed64<Q>&;
@@ -737,25 +898,12 @@ constexpr auto operator-(const T& a, const Fixed64<P>& b) noexcept -> Fixed64<P>
 }
 
 // Multiplication operators
+// Mixed precisions keep the left operand's precision; Fixed64Math::Mul<S> and Div<S> return a
+// third precision with a single shift
 template <int Q, int R>
 constexpr auto operator*=(Fixed64<Q>& a, const Fixed64<R>& b) noexcept -> Fixed64<Q>& {
-    // Use leading zero count to determine if 64-bit multiplication is safe
-    if constexpr (Q + R <= 32) {
-        // Fast path: if the sum of leading zeros in both operands is >= Q, no
-        // overflow will occur
-        if ((a.value_ >> 32) == 0 && (b.value_ >> 32) == 0) {
-            // Safe to use 64-bit multiplication, no need for 128-bit integer
-            a.value_ = (a.value_ * b.value_) >> R;
-
-            return a;
-        }
-
-        a.value_ = Primitives::Fixed64MulBitStyle(a.value_, b.value_, R);
-
-        return a;
-    }
-
-    a.value_ = Primitives::Fixed64Mul(a.value_, b.value_, R);
+    // The multiply sequence for R fraction bits is selected at compile time
+    a.value_ = Primitives::Fixed64Mul<R>(a.value_, b.value_);
 
     return a;
 }
@@ -790,27 +938,13 @@ template <int Q, int R>
 constexpr auto operator/=(Fixed64<Q>& a, const Fixed64<R>& b) noexcept -> Fixed64<Q>& {
     // Handle division by zero
     if (b.value_ == 0) {
+        Fixed64Instrumentation::Record(Fixed64Event::kDivByZero);
         a = (a.value_ >= 0) ? Fixed64<Q>::Infinity() : Fixed64<Q>::NegInfinity();
         return a;
     }
 
-    // For low precision fixed-point numbers, use runtime optimization
-    if constexpr (Q + R <= 32) {
-        // Check if left shifting by Q bits is safe (won't lose significant bits)
-        if ((a.value_ << R) >> R == a.value_) {
-            // Safe path: use direct 64-bit integer division, avoiding complex
-            // calculations
-            a.value_ = (a.value_ << R) / b.value_;
-
-            return a;
-        }
-
-        a.value_ = Primitives::Fixed64DivBitStyle(a.value_, b.value_, R);
-
-        return a;
-    }
-
-    a.value_ = Primitives::Fixed64Div(a.value_, b.value_, R);
+    // The division sequence for R fraction bits is selected at compile time
+    a.value_ = Primitives::Fixed64Div<R>(a.value_, b.value_);
 
     return a;
 }
@@ -994,4 +1128,16 @@ template <int P>
 ::math::fp::Fixed64<P> stof64(const string& str) {
     return ::math::fp::Fixed64<P>::FromString(str);
 }
+
+template <int P>
+inline auto to_chars(char* first, char* last, const ::math::fp::Fixed64<P>& num) noexcept
+    -> to_chars_result {
+    return num.ToChars(first, last);
+}
+
+template <int P>
+inline auto from_chars(const char* first, const char* last, ::math::fp::Fixed64<P>& num) noexcept
+    -> from_chars_result {
+    return ::math::fp::Fixed64<P>::FromChars(first, last, num);
+}
 }  // namespace std
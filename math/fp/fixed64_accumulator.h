@@ -0,0 +1,152 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+
+#include "fixed64.h"
+#include "primitives.h"
+
+namespace math::fp {
+
+/**
+ * @brief Running sum of fixed-point products kept in raw 128-bit form
+ *
+ * Each product a * b is added with its full 2P fraction bits (umul_ppmm plus a sign
+ * correction), and the total is shifted and rounded once when Result() is read. Compared with
+ * summing Fixed64 products, this skips the per-product shift and rounding and an intermediate
+ * sum may exceed the Fixed64 range as long as the final total fits.
+ *
+ * Guarantees:
+ * - Integer addition is associative, so the result does not depend on the summation order or
+ *   on how a loop is unrolled, vectorized or split across threads and merged
+ * - Result() rounds to nearest, ties to even, and saturates to Infinity/NegInfinity when the
+ *   total is out of range
+ * - The 128-bit total is exact while it stays within +/-2^127: up to 8 products of any raw
+ *   values below 2^62, or up to 2^32 products of values below 2^15 at P = 32
+ *
+ * Usage:
+ *   Fixed64Accumulator<32> energy;
+ *   for (const auto& body : bodies) {
+ *       energy.MulAdd(body.mass, body.speed_squared);
+ *   }
+ *   const Fixed64_32 total = energy.Result() / 2;
+ */
+template <int P>
+class Fixed64Accumulator {
+    static_assert(P > 0 && P < 63, "Fixed64Accumulator requires 0 < P < 63");
+
+ public:
+    constexpr Fixed64Accumulator() noexcept = default;
+
+    /**
+     * @brief Add the exact product a * b
+     * @param a First factor
+     * @param b Second factor
+     */
+    constexpr auto MulAdd(Fixed64<P> a, Fixed64<P> b) noexcept -> void {
+        Primitives::MulAdd128(a.value(), b.value(), hi_, lo_);
+    }
+
+    /**
+     * @brief Subtract the exact product a * b
+     * @param a First factor
+     * @param b Second factor
+     */
+    constexpr auto MulSub(Fixed64<P> a, Fixed64<P> b) noexcept -> void {
+        const int64_t negated_b = static_cast<int64_t>(0 - static_cast<uint64_t>(b.value()));
+        Primitives::MulAdd128(a.value(), negated_b, hi_, lo_);
+    }
+
+    /**
+     * @brief Add a single value
+     * @param x Value to add
+     */
+    constexpr auto Add(Fixed64<P> x) noexcept -> void {
+        Primitives::MulAdd128(x.value(), int64_t(1) << P, hi_, lo_);
+    }
+
+    /**
+     * @brief Add the total of another accumulator, e.g. a per-thread partial sum
+     * @param other Accumulator to merge into this one
+     */
+    constexpr auto Merge(const Fixed64Accumulator& other) noexcept -> void {
+        lo_ += other.lo_;
+        hi_ += other.hi_ + ((lo_ < other.lo_) ? 1 : 0);
+    }
+
+    /**
+     * @brief Reset the total to zero
+     */
+    constexpr auto Reset() noexcept -> void {
+        hi_ = 0;
+        lo_ = 0;
+    }
+
+    /**
+     * @brief Compare the exact totals, e.g. two squared distances, without rounding either
+     */
+    friend constexpr auto operator<=>(const Fixed64Accumulator& a,
+                                      const Fixed64Accumulator& b) noexcept
+        -> std::strong_ordering {
+        if (a.hi_ != b.hi_) {
+            return static_cast<int64_t>(a.hi_) <=> static_cast<int64_t>(b.hi_);
+        }
+        return a.lo_ <=> b.lo_;
+    }
+
+    friend constexpr auto operator==(const Fixed64Accumulator& a,
+                                     const Fixed64Accumulator& b) noexcept -> bool {
+        return a.hi_ == b.hi_ && a.lo_ == b.lo_;
+    }
+
+    /**
+     * @brief Get the total, rounded once to P fraction bits
+     * @return Rounded sum, Infinity or NegInfinity when it does not fit in Fixed64<P>
+     */
+    [[nodiscard]] constexpr auto Result() const noexcept -> Fixed64<P> {
+        // The shifted total fits in 64 bits only if bits P-1 and up of hi are all sign copies
+        const int64_t top = static_cast<int64_t>(hi_) >> (P - 1);
+        if (top != 0 && top != -1) [[unlikely]] {
+            return top < 0 ? Fixed64<P>::NegInfinity() : Fixed64<P>::Infinity();
+        }
+        const int64_t rounded = Primitives::Round128(hi_, lo_, P);
+        // Rounding away from zero can still reach 2^63 in magnitude
+        if (top == 0 && rounded < 0) [[unlikely]] {
+            return Fixed64<P>::Infinity();
+        }
+        if (rounded == INT64_MIN) [[unlikely]] {
+            return Fixed64<P>::NegInfinity();
+        }
+        return Fixed64<P>(rounded, detail::nothing{});
+    }
+
+    /**
+     * @brief Get the total divided by a value, without rounding the total first
+     * @param divisor Value to divide by
+     * @return total / divisor truncated toward zero like operator/, Infinity or NegInfinity
+     * when the quotient does not fit or divisor is zero (Infinity for a zero total)
+     * @note The total has 2P fraction bits and the divisor P, so one 128/64 division of the raw
+     * values gives the quotient with P fraction bits and no shift
+     */
+    [[nodiscard]] constexpr auto DivideBy(Fixed64<P> divisor) const noexcept -> Fixed64<P> {
+        const uint64_t sign = static_cast<uint64_t>(static_cast<int64_t>(hi_) >> 63);
+        const uint64_t mag_lo = (lo_ ^ sign) - sign;
+        const uint64_t mag_hi = (hi_ ^ sign) + ((sign != 0 && lo_ == 0) ? 1 : 0);
+        const int64_t d = divisor.value();
+        const uint64_t d_abs = d < 0 ? 0 - static_cast<uint64_t>(d) : static_cast<uint64_t>(d);
+        const bool negative = (sign != 0) != (d < 0);
+        // DivU128ToU64 reports overflow, a zero divisor included, as UINT64_MAX
+        const uint64_t q = Primitives::DivU128ToU64(mag_hi, mag_lo, d_abs);
+        if (q > static_cast<uint64_t>(INT64_MAX)) [[unlikely]] {
+            return negative ? Fixed64<P>::NegInfinity() : Fixed64<P>::Infinity();
+        }
+        const int64_t quotient = static_cast<int64_t>(q);
+        return Fixed64<P>(negative ? -quotient : quotient, detail::nothing{});
+    }
+
+ private:
+    uint64_t hi_ = 0;  // High word of the two's complement total
+    uint64_t lo_ = 0;  // Low word of the total
+};
+
+}  // namespace math::fp
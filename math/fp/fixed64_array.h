@@ -0,0 +1,302 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "detail/chunk_pool.h"
+#include "fixed64.h"
+#include "fixed64_batch.h"
+#include "fixed64_math.h"
+
+namespace math::fp {
+
+namespace detail {
+// Allocator returning storage aligned to a 64-byte cache line
+template <typename T>
+struct CacheAlignedAllocator {
+    using value_type = T;
+    static constexpr std::align_val_t kAlignment{64};
+
+    CacheAlignedAllocator() noexcept = default;
+
+    template <typename U>
+    CacheAlignedAllocator(const CacheAlignedAllocator<U>&) noexcept {}
+
+    [[nodiscard]] auto allocate(size_t n) -> T* {
+        return static_cast<T*>(::operator new(n * sizeof(T), kAlignment));
+    }
+
+    auto deallocate(T* p, size_t) noexcept -> void {
+        ::operator delete(p, kAlignment);
+    }
+
+    template <typename U>
+    friend auto operator==(const CacheAlignedAllocator&, const CacheAlignedAllocator<U>&) noexcept
+        -> bool {
+        return true;
+    }
+};
+}  // namespace detail
+
+/**
+ * @brief Contiguous column of fixed-point values for structure-of-arrays data
+ *
+ * Storage starts on a 64-byte cache line and is padded with zeros to a whole number of cache
+ * lines, so SIMD kernels always run on aligned, full-width loads and two columns never share a
+ * line. Element-wise operations work in place on the first min(size(), other.size())
+ * elements, use the Fixed64Batch and Fixed64Math batch kernels, and split arrays longer than
+ * one chunk (16384 elements) across a process-wide thread pool.
+ *
+ * Guarantees:
+ * - Every operation is bit-identical to applying the scalar Fixed64 operator or Fixed64Math
+ *   function to each element
+ * - Chunk boundaries are fixed, so results do not depend on the number of threads
+ *   (define FIXED64_USE_THREADS=0 to never start worker threads)
+ *
+ * Usage:
+ *   Fixed64Array<32> x(count), vx(count);
+ *   vx *= dt;
+ *   x += vx;
+ */
+template <int P>
+class Fixed64Array {
+ public:
+    Fixed64Array() noexcept = default;
+
+    /**
+     * @brief Construct an array of count copies of value
+     * @param count Number of elements
+     * @param value Initial value of every element
+     */
+    explicit Fixed64Array(size_t count, Fixed64<P> value = Fixed64<P>::Zero())
+        : storage_(PaddedSize(count)), size_(count) {
+        std::fill_n(storage_.begin(), count, value);
+    }
+
+    /**
+     * @brief Construct an array holding a copy of values
+     * @param values Initial elements
+     */
+    explicit Fixed64Array(std::span<const Fixed64<P>> values)
+        : storage_(PaddedSize(values.size())), size_(values.size()) {
+        std::copy(values.begin(), values.end(), storage_.begin());
+    }
+
+    [[nodiscard]] auto size() const noexcept -> size_t {
+        return size_;
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] auto data() noexcept -> Fixed64<P>* {
+        return storage_.data();
+    }
+
+    [[nodiscard]] auto data() const noexcept -> const Fixed64<P>* {
+        return storage_.data();
+    }
+
+    [[nodiscard]] auto operator[](size_t i) noexcept -> Fixed64<P>& {
+        return storage_[i];
+    }
+
+    [[nodiscard]] auto operator[](size_t i) const noexcept -> const Fixed64<P>& {
+        return storage_[i];
+    }
+
+    [[nodiscard]] auto begin() noexcept -> Fixed64<P>* {
+        return data();
+    }
+
+    [[nodiscard]] auto end() noexcept -> Fixed64<P>* {
+        return data() + size_;
+    }
+
+    [[nodiscard]] auto begin() const noexcept -> const Fixed64<P>* {
+        return data();
+    }
+
+    [[nodiscard]] auto end() const noexcept -> const Fixed64<P>* {
+        return data() + size_;
+    }
+
+    /**
+     * @brief View of the elements, excluding the padding
+     */
+    [[nodiscard]] auto span() noexcept -> std::span<Fixed64<P>> {
+        return {data(), size_};
+    }
+
+    [[nodiscard]] auto span() const noexcept -> std::span<const Fixed64<P>> {
+        return {data(), size_};
+    }
+
+    /**
+     * @brief Resize the array, new elements are zero
+     * @param count New number of elements
+     */
+    auto Resize(size_t count) -> void {
+        storage_.resize(PaddedSize(count));
+        // Keep the padding and any newly exposed elements zero
+        std::fill(storage_.begin() + std::min(count, size_), storage_.end(), Fixed64<P>::Zero());
+        size_ = count;
+    }
+
+    /**
+     * @brief Element-wise addition: this[i] += other[i]
+     */
+    auto operator+=(const Fixed64Array& other) noexcept -> Fixed64Array& {
+        const Fixed64<P>* src = other.data();
+        Fixed64<P>* dst = data();
+        detail::ForEachChunk(std::min(size_, other.size_), [=](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                dst[i] += src[i];
+            }
+        });
+        return *this;
+    }
+
+    /**
+     * @brief Element-wise subtraction: this[i] -= other[i]
+     */
+    auto operator-=(const Fixed64Array& other) noexcept -> Fixed64Array& {
+        const Fixed64<P>* src = other.data();
+        Fixed64<P>* dst = data();
+        detail::ForEachChunk(std::min(size_, other.size_), [=](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                dst[i] -= src[i];
+            }
+        });
+        return *this;
+    }
+
+    /**
+     * @brief Element-wise multiplication: this[i] *= other[i]
+     */
+    auto operator*=(const Fixed64Array& other) noexcept -> Fixed64Array& {
+        const Fixed64<P>* src = other.data();
+        Fixed64<P>* dst = data();
+        detail::ForEachChunk(std::min(size_, other.size_), [=](size_t begin, size_t end) {
+            const std::span<Fixed64<P>> out(dst + begin, end - begin);
+            Fixed64Batch::Mul<P>(out, std::span<const Fixed64<P>>(src + begin, end - begin), out);
+        });
+        return *this;
+    }
+
+    /**
+     * @brief Multiplication by a common factor: this[i] *= s
+     */
+    auto operator*=(Fixed64<P> s) noexcept -> Fixed64Array& {
+        Fixed64<P>* dst = data();
+        detail::ForEachChunk(size_, [=](size_t begin, size_t end) {
+            const std::span<Fixed64<P>> out(dst + begin, end - begin);
+            Fixed64Batch::Mul<P>(out, s, out);
+        });
+        return *this;
+    }
+
+    /**
+     * @brief Interpolate towards another array: this[i] = Fixed64Math::Lerp(this[i], to[i], t)
+     * @param to Target values
+     * @param t Interpolation factor, clamped to [0, 1]
+     */
+    auto Lerp(const Fixed64Array& to, Fixed64<P> t) noexcept -> Fixed64Array& {
+        const Fixed64<P> factor = Fixed64Math::Clamp01(t);
+        const Fixed64<P>* src = to.data();
+        Fixed64<P>* dst = data();
+        detail::ForEachChunk(std::min(size_, to.size_), [=](size_t begin, size_t end) {
+            // Differences go through a small stack buffer so the multiply runs vectorized
+            constexpr size_t kBlock = 256;
+            alignas(64) Fixed64<P> diff[kBlock];
+            for (size_t i = begin; i < end; i += kBlock) {
+                const size_t n = std::min(kBlock, end - i);
+                for (size_t k = 0; k < n; ++k) {
+                    diff[k] = src[i + k] - dst[i + k];
+                }
+                const std::span<Fixed64<P>> block(diff, n);
+                Fixed64Batch::Mul<P>(block, factor, block);
+                for (size_t k = 0; k < n; ++k) {
+                    dst[i + k] += diff[k];
+                }
+            }
+        });
+        return *this;
+    }
+
+    /**
+     * @brief Clamp every element: this[i] = Fixed64Math::Clamp(this[i], min, max)
+     */
+    auto Clamp(Fixed64<P> min, Fixed64<P> max) noexcept -> Fixed64Array& {
+        int64_t* dst = reinterpret_cast<int64_t*>(data());
+        const int64_t lo = min.value();
+        const int64_t hi = max.value();
+        detail::ForEachChunk(size_, [=](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const int64_t v = dst[i];
+                dst[i] = v < lo ? lo : (v > hi ? hi : v);
+            }
+        });
+        return *this;
+    }
+
+    /**
+     * @brief Square root of every element: this[i] = Fixed64Math::Sqrt(this[i])
+     */
+    auto Sqrt() noexcept -> Fixed64Array& {
+        Fixed64<P>* dst = data();
+        detail::ForEachChunk(size_, [=](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                dst[i] = Fixed64Math::Sqrt(dst[i]);
+            }
+        });
+        return *this;
+    }
+
+    /**
+     * @brief Sine of every element: this[i] = Fixed64Math::Sin(this[i])
+     */
+    auto Sin() noexcept -> Fixed64Array& {
+        Fixed64<P>* dst = data();
+        detail::ForEachChunk(size_, [=](size_t begin, size_t end) {
+            const std::span<Fixed64<P>> out(dst + begin, end - begin);
+            Fixed64Math::SinBatch<P>(out, out);
+        });
+        return *this;
+    }
+
+    [[nodiscard]] friend auto operator+(Fixed64Array a, const Fixed64Array& b) -> Fixed64Array {
+        return std::move(a += b);
+    }
+
+    [[nodiscard]] friend auto operator-(Fixed64Array a, const Fixed64Array& b) -> Fixed64Array {
+        return std::move(a -= b);
+    }
+
+    [[nodiscard]] friend auto operator*(Fixed64Array a, const Fixed64Array& b) -> Fixed64Array {
+        return std::move(a *= b);
+    }
+
+    [[nodiscard]] friend auto operator*(Fixed64Array a, Fixed64<P> s) -> Fixed64Array {
+        return std::move(a *= s);
+    }
+
+ private:
+    // Elements per 64-byte cache line
+    static constexpr size_t kLineElements = 64 / sizeof(Fixed64<P>);
+
+    static constexpr auto PaddedSize(size_t count) noexcept -> size_t {
+        return (count + kLineElements - 1) / kLineElements * kLineElements;
+    }
+
+    std::vector<Fixed64<P>, detail::CacheAlignedAllocator<Fixed64<P>>> storage_;
+    size_t size_ = 0;
+};
+
+}  // namespace math::fp
@@ -0,0 +1,298 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "detail/batch_kernels.h"
+#include "detail/raw_words.h"
+#include "fixed64.h"
+#include "fixed64_execution.h"
+#include "primitives.h"
+
+namespace math::fp {
+
+/**
+ * @brief Batch arithmetic over contiguous spans of fixed-point numbers
+ *
+ * Provides element-wise multiplication and division for arrays of Fixed64<P> values, and
+ * conversion of whole arrays from and to float and double. Multiplication and conversion
+ * use AVX-512F, AVX2 or NEON when the target supports it (see FIXED64_BATCH_USE_SIMD),
+ * emulating the 64x64->128 product and the IEEE bit manipulation in vector lanes.
+ *
+ * Guarantees:
+ * - Mul produces results bit-identical to Primitives::Fixed64Mul(a, b, P)
+ * - Div produces results bit-identical to Fixed64<P>::operator/, including the
+ *   Infinity/NegInfinity result for a zero divisor
+ * - The conversions produce results bit-identical to the scalar Fixed64<P> constructor and
+ *   conversion operators (Primitives::F64ToFixed64, Fixed64ToF64 and their float versions),
+ *   so imported data does not depend on the instruction set or the host FPU
+ * - The scalar primitives are the reference and handle the tail of every span
+ *
+ * All functions process min(a.size(), b.size(), out.size()) elements. The output span may
+ * alias an input span of the same element size exactly (in-place operation), but must not
+ * partially overlap it. Every function also takes an execution policy as its first argument
+ * (see fixed64_execution.h), which splits the spans into fixed chunks on the thread pool with
+ * bit-identical results.
+ *
+ * Usage:
+ *   std::vector<Fixed64_32> a, b, out;
+ *   Fixed64Batch::Mul<32>(a, b, out);
+ */
+class Fixed64Batch {
+ public:
+    /**
+     * @brief Element-wise multiplication: out[i] = a[i] * b[i]
+     * @param a First operand span
+     * @param b Second operand span
+     * @param out Destination span
+     */
+    template <int P>
+    static auto Mul(std::span<const Fixed64<P>> a,
+                    std::span<const Fixed64<P>> b,
+                    std::span<Fixed64<P>> out) noexcept -> void {
+        CheckLayout<P>();
+        const size_t count = std::min({a.size(), b.size(), out.size()});
+        const int64_t* pa = detail::RawWords(a);
+        const int64_t* pb = detail::RawWords(b);
+        int64_t* po = detail::RawWords(out);
+
+        // Tail (or whole span without SIMD) uses the precision-specialized multiply, which
+        // yields the same bits as Fixed64Mul and handles signs without branches
+        size_t i = detail::MulBatch<P>(pa, pb, po, count);
+        for (; i < count; ++i) {
+            po[i] = Primitives::Fixed64Mul<P>(pa[i], pb[i]);
+        }
+    }
+
+    /**
+     * @brief Multiplication by a common factor: out[i] = a[i] * b
+     * @param a Operand span
+     * @param b Common factor
+     * @param out Destination span
+     */
+    template <int P>
+    static auto Mul(std::span<const Fixed64<P>> a, Fixed64<P> b, std::span<Fixed64<P>> out) noexcept
+        -> void {
+        CheckLayout<P>();
+        const size_t count = std::min(a.size(), out.size());
+        const int64_t* pa = detail::RawWords(a);
+        int64_t* po = detail::RawWords(out);
+
+        size_t i = detail::MulBatch<P>(pa, b.value(), po, count);
+        for (; i < count; ++i) {
+            po[i] = Primitives::Fixed64Mul<P>(pa[i], b.value());
+        }
+    }
+
+    /**
+     * @brief Element-wise division: out[i] = a[i] / b[i]
+     * @param a Dividend span
+     * @param b Divisor span
+     * @param out Destination span
+     * @note There is no vector 128/64 divide instruction, so each element runs the scalar
+     * DivU128ToU64 path; the loop is kept free of cross-iteration dependencies
+     */
+    template <int P>
+    static auto Div(std::span<const Fixed64<P>> a,
+                    std::span<const Fixed64<P>> b,
+                    std::span<Fixed64<P>> out) noexcept -> void {
+        CheckLayout<P>();
+        const size_t count = std::min({a.size(), b.size(), out.size()});
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = a[i] / b[i];
+        }
+    }
+
+    /**
+     * @brief Division by a common divisor: out[i] = a[i] / b
+     * @param a Dividend span
+     * @param b Common divisor
+     * @param out Destination span
+     */
+    template <int P>
+    static auto Div(std::span<const Fixed64<P>> a, Fixed64<P> b, std::span<Fixed64<P>> out) noexcept
+        -> void {
+        CheckLayout<P>();
+        const size_t count = std::min(a.size(), out.size());
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = a[i] / b;
+        }
+    }
+
+    /**
+     * @brief Conversion to double: out[i] = static_cast<double>(in[i])
+     * @param in Fixed-point span
+     * @param out Destination span
+     */
+    template <int P>
+    static auto ConvertToDouble(std::span<const Fixed64<P>> in, std::span<double> out) noexcept
+        -> void {
+        CheckLayout<P>();
+        const size_t count = std::min(in.size(), out.size());
+        const int64_t* pi = detail::RawWords(in);
+        double* po = out.data();
+
+        size_t i = detail::ToF64Batch<P>(pi, reinterpret_cast<int64_t*>(po), count);
+        for (; i < count; ++i) {
+            po[i] = Primitives::Fixed64ToF64(pi[i], P);
+        }
+    }
+
+    /**
+     * @brief Conversion to float: out[i] = static_cast<float>(in[i])
+     * @param in Fixed-point span
+     * @param out Destination span
+     */
+    template <int P>
+    static auto ConvertToFloat(std::span<const Fixed64<P>> in, std::span<float> out) noexcept
+        -> void {
+        CheckLayout<P>();
+        const size_t count = std::min(in.size(), out.size());
+        const int64_t* pi = detail::RawWords(in);
+        float* po = out.data();
+
+        size_t i = detail::ToF32Batch<P>(pi, reinterpret_cast<uint32_t*>(po), count);
+        for (; i < count; ++i) {
+            po[i] = Primitives::Fixed64ToF32(pi[i], P);
+        }
+    }
+
+    /**
+     * @brief Conversion from double: out[i] = Fixed64<P>(in[i])
+     * @param in Double span; NaN and infinities map to INT64_MIN/INT64_MAX raw values like
+     * the scalar constructor
+     * @param out Destination span
+     */
+    template <int P>
+    static auto ConvertFromDouble(std::span<const double> in, std::span<Fixed64<P>> out) noexcept
+        -> void {
+        CheckLayout<P>();
+        const size_t count = std::min(in.size(), out.size());
+        const double* pi = in.data();
+        int64_t* po = detail::RawWords(out);
+
+        size_t i = detail::FromF64Batch<P>(reinterpret_cast<const int64_t*>(pi), po, count);
+        for (; i < count; ++i) {
+            po[i] = Primitives::F64ToFixed64(pi[i], P);
+        }
+    }
+
+    /**
+     * @brief Conversion from float: out[i] = Fixed64<P>(in[i])
+     * @param in Float span
+     * @param out Destination span
+     */
+    template <int P>
+    static auto ConvertFromFloat(std::span<const float> in, std::span<Fixed64<P>> out) noexcept
+        -> void {
+        CheckLayout<P>();
+        const size_t count = std::min(in.size(), out.size());
+        const float* pi = in.data();
+        int64_t* po = detail::RawWords(out);
+
+        size_t i = detail::FromF32Batch<P>(reinterpret_cast<const uint32_t*>(pi), po, count);
+        for (; i < count; ++i) {
+            po[i] = Primitives::F32ToFixed64(pi[i], P);
+        }
+    }
+
+    /**
+     * @brief The functions above under an execution policy, over chunks of 16384 elements
+     *
+     * Usage:
+     *   Fixed64Batch::ConvertFromDouble<32>(execution::par, imported, positions);
+     */
+    template <int P, ExecutionPolicy Policy>
+    static auto Mul(const Policy& policy,
+                    std::span<const Fixed64<P>> a,
+                    std::span<const Fixed64<P>> b,
+                    std::span<Fixed64<P>> out) noexcept -> void {
+        const size_t count = std::min({a.size(), b.size(), out.size()});
+        detail::ForEachChunk(policy, count, [&](size_t begin, size_t end) {
+            Mul(a.subspan(begin, end - begin), b.subspan(begin, end - begin),
+                out.subspan(begin, end - begin));
+        });
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    static auto Mul(const Policy& policy,
+                    std::span<const Fixed64<P>> a,
+                    Fixed64<P> b,
+                    std::span<Fixed64<P>> out) noexcept -> void {
+        detail::ForEachChunk(policy, std::min(a.size(), out.size()), [&](size_t begin, size_t end) {
+            Mul(a.subspan(begin, end - begin), b, out.subspan(begin, end - begin));
+        });
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    static auto Div(const Policy& policy,
+                    std::span<const Fixed64<P>> a,
+                    std::span<const Fixed64<P>> b,
+                    std::span<Fixed64<P>> out) noexcept -> void {
+        const size_t count = std::min({a.size(), b.size(), out.size()});
+        detail::ForEachChunk(policy, count, [&](size_t begin, size_t end) {
+            Div(a.subspan(begin, end - begin), b.subspan(begin, end - begin),
+                out.subspan(begin, end - begin));
+        });
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    static auto Div(const Policy& policy,
+                    std::span<const Fixed64<P>> a,
+                    Fixed64<P> b,
+                    std::span<Fixed64<P>> out) noexcept -> void {
+        detail::ForEachChunk(policy, std::min(a.size(), out.size()), [&](size_t begin, size_t end) {
+            Div(a.subspan(begin, end - begin), b, out.subspan(begin, end - begin));
+        });
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    static auto ConvertToDouble(const Policy& policy,
+                                std::span<const Fixed64<P>> in,
+                                std::span<double> out) noexcept -> void {
+        const size_t count = std::min(in.size(), out.size());
+        detail::ForEachChunk(policy, count, [&](size_t begin, size_t end) {
+            ConvertToDouble(in.subspan(begin, end - begin), out.subspan(begin, end - begin));
+        });
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    static auto ConvertToFloat(const Policy& policy,
+                               std::span<const Fixed64<P>> in,
+                               std::span<float> out) noexcept -> void {
+        const size_t count = std::min(in.size(), out.size());
+        detail::ForEachChunk(policy, count, [&](size_t begin, size_t end) {
+            ConvertToFloat(in.subspan(begin, end - begin), out.subspan(begin, end - begin));
+        });
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    static auto ConvertFromDouble(const Policy& policy,
+                                  std::span<const double> in,
+                                  std::span<Fixed64<P>> out) noexcept -> void {
+        const size_t count = std::min(in.size(), out.size());
+        detail::ForEachChunk(policy, count, [&](size_t begin, size_t end) {
+            ConvertFromDouble<P>(in.subspan(begin, end - begin), out.subspan(begin, end - begin));
+        });
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    static auto ConvertFromFloat(const Policy& policy,
+                                 std::span<const float> in,
+                                 std::span<Fixed64<P>> out) noexcept -> void {
+        const size_t count = std::min(in.size(), out.size());
+        detail::ForEachChunk(policy, count, [&](size_t begin, size_t end) {
+            ConvertFromFloat<P>(in.subspan(begin, end - begin), out.subspan(begin, end - begin));
+        });
+    }
+
+ private:
+    template <int P>
+    static constexpr auto CheckLayout() noexcept -> void {
+        static_assert(P > 0 && P < 64, "Batch kernels require 0 < P < 64");
+    }
+};
+
+}  // namespace math::fp
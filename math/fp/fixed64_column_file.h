@@ -0,0 +1,422 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <span>
+#include <utility>
+
+#include "detail/raw_words.h"
+#include "fixed64.h"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace math::fp {
+
+// Result of opening, appending to or closing a column file
+enum class Fixed64FileError {
+    None,
+    OpenFailed,         // The file could not be opened or created
+    MapFailed,          // The file could not be memory-mapped
+    WriteFailed,        // A write or the final header update failed
+    BadHeader,          // Not a column file, or an unknown format version
+    Incomplete,         // The writer was not closed, the count and checksum are missing
+    PrecisionMismatch,  // The file stores a different number of fraction bits
+    Truncated,          // The file is shorter than its header says
+    ChecksumMismatch,   // The data does not match the stored checksum
+    Unsupported,        // Zero-copy access needs a little-endian platform
+};
+
+namespace detail {
+/**
+ * On-disk header of a column file, followed by count little-endian int64_t raw values
+ *
+ * The header is 64 bytes, so the values start on a cache line of the (page-aligned) mapping.
+ */
+struct ColumnFileHeader {
+    char magic[8];
+    uint32_t version;
+    int32_t precision;
+    uint64_t count;
+    uint64_t checksum;
+    uint8_t reserved[32];
+};
+static_assert(sizeof(ColumnFileHeader) == 64, "Column file header must be 64 bytes");
+
+inline constexpr char kColumnFileMagic[8] = {'F', 'X', '6', '4', 'C', 'O', 'L', '\0'};
+inline constexpr uint32_t kColumnFileVersion = 1;
+inline constexpr uint64_t kColumnFileIncomplete = ~uint64_t(0);
+
+/**
+ * Streaming checksum of 64-bit words
+ *
+ * Four lanes take words in turn (word i goes to lane i % 4), each a multiply-rotate chain,
+ * so the four chains run in parallel; Finish folds the lanes and the count. The result
+ * depends only on the words and their order, not on how they are split between Add calls.
+ */
+class ColumnChecksum {
+ public:
+    auto Add(const int64_t* words, size_t count) noexcept -> void {
+        size_t i = 0;
+        // Realign to lane 0 so the main loop can take four words per step
+        for (; i < count && (count_ + i) % 4 != 0; ++i) {
+            Mix(lanes_[(count_ + i) % 4], words[i]);
+        }
+        for (; i + 4 <= count; i += 4) {
+            Mix(lanes_[0], words[i]);
+            Mix(lanes_[1], words[i + 1]);
+            Mix(lanes_[2], words[i + 2]);
+            Mix(lanes_[3], words[i + 3]);
+        }
+        for (; i < count; ++i) {
+            Mix(lanes_[(count_ + i) % 4], words[i]);
+        }
+        count_ += count;
+    }
+
+    [[nodiscard]] auto Finish() const noexcept -> uint64_t {
+        uint64_t h = count_ * kPrime1;
+        for (const uint64_t lane : lanes_) {
+            h = std::rotl(h ^ lane, 27) * kPrime2 + kPrime3;
+        }
+        h ^= h >> 33;
+        h *= kPrime2;
+        h ^= h >> 29;
+        return h;
+    }
+
+ private:
+    static constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+    static constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+    static constexpr uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+
+    static auto Mix(uint64_t& lane, int64_t word) noexcept -> void {
+        lane = std::rotl(lane + static_cast<uint64_t>(word) * kPrime2, 31) * kPrime1;
+    }
+
+    uint64_t lanes_[4] = {kPrime1, kPrime2, kPrime3, kPrime1 ^ kPrime2};
+    uint64_t count_ = 0;
+};
+}  // namespace detail
+
+/**
+ * @brief Read-only, memory-mapped view of a column file of Fixed64<P> values
+ *
+ * Open maps the whole file and exposes the values in place as a span, so loading a recording
+ * costs no parsing and no copy; the operating system pages the data in as it is read. The
+ * stored precision must equal P. The reader is move-only and unmaps the file when destroyed.
+ *
+ * Usage:
+ *   Fixed64ColumnReader<32> positions;
+ *   if (positions.Open("replay/positions.fx64") == Fixed64FileError::None) {
+ *       for (const Fixed64_32 x : positions.values()) { ... }
+ *   }
+ */
+template <int P>
+class Fixed64ColumnReader {
+ public:
+    Fixed64ColumnReader() noexcept = default;
+
+    Fixed64ColumnReader(Fixed64ColumnReader&& other) noexcept
+        : mapping_(std::exchange(other.mapping_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          count_(std::exchange(other.count_, 0)) {}
+
+    auto operator=(Fixed64ColumnReader&& other) noexcept -> Fixed64ColumnReader& {
+        if (this != &other) {
+            Close();
+            mapping_ = std::exchange(other.mapping_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            count_ = std::exchange(other.count_, 0);
+        }
+        return *this;
+    }
+
+    Fixed64ColumnReader(const Fixed64ColumnReader&) = delete;
+    auto operator=(const Fixed64ColumnReader&) -> Fixed64ColumnReader& = delete;
+
+    ~Fixed64ColumnReader() {
+        Close();
+    }
+
+    /**
+     * @brief Map a column file written by Fixed64ColumnWriter<P>
+     * @param path File to open
+     * @param verify_checksum Hash the data once and compare with the header; pass false to
+     * open multi-gigabyte files without touching every page
+     * @return Fixed64FileError::None on success; on failure the reader stays empty
+     */
+    auto Open(const char* path, bool verify_checksum = true) noexcept -> Fixed64FileError {
+        Close();
+        if constexpr (std::endian::native != std::endian::little) {
+            return Fixed64FileError::Unsupported;
+        }
+
+        const Fixed64FileError mapped = Map(path);
+        if (mapped != Fixed64FileError::None) {
+            return mapped;
+        }
+
+        detail::ColumnFileHeader header;
+        const Fixed64FileError error =
+            size_ < sizeof(header) ? Fixed64FileError::BadHeader
+                                   : Validate(ReadHeader(header), verify_checksum);
+        if (error != Fixed64FileError::None) {
+            Close();
+        }
+        return error;
+    }
+
+    // Unmap the file, values() becomes empty
+    auto Close() noexcept -> void {
+        if (mapping_ != nullptr) {
+#if defined(_WIN32)
+            UnmapViewOfFile(mapping_);
+#else
+            munmap(mapping_, size_);
+#endif
+        }
+        mapping_ = nullptr;
+        size_ = 0;
+        count_ = 0;
+    }
+
+    [[nodiscard]] auto is_open() const noexcept -> bool {
+        return mapping_ != nullptr;
+    }
+
+    // The stored values, valid until the reader is closed or destroyed
+    [[nodiscard]] auto values() const noexcept -> std::span<const Fixed64<P>> {
+        if (mapping_ == nullptr) {
+            return {};
+        }
+        const auto* data = static_cast<const unsigned char*>(mapping_)
+                         + sizeof(detail::ColumnFileHeader);
+        return {reinterpret_cast<const Fixed64<P>*>(data), count_};
+    }
+
+ private:
+    auto ReadHeader(detail::ColumnFileHeader& header) const noexcept
+        -> const detail::ColumnFileHeader& {
+        std::memcpy(&header, mapping_, sizeof(header));
+        return header;
+    }
+
+    auto Validate(const detail::ColumnFileHeader& header, bool verify_checksum) noexcept
+        -> Fixed64FileError {
+        if (std::memcmp(header.magic, detail::kColumnFileMagic, sizeof(header.magic)) != 0
+            || header.version != detail::kColumnFileVersion) {
+            return Fixed64FileError::BadHeader;
+        }
+        if (header.count == detail::kColumnFileIncomplete) {
+            return Fixed64FileError::Incomplete;
+        }
+        if (header.precision != P) {
+            return Fixed64FileError::PrecisionMismatch;
+        }
+        if (header.count > (size_ - sizeof(header)) / sizeof(int64_t)) {
+            return Fixed64FileError::Truncated;
+        }
+        count_ = static_cast<size_t>(header.count);
+        if (verify_checksum) {
+            detail::ColumnChecksum checksum;
+            checksum.Add(detail::RawWords(values()), count_);
+            if (checksum.Finish() != header.checksum) {
+                return Fixed64FileError::ChecksumMismatch;
+            }
+        }
+        return Fixed64FileError::None;
+    }
+
+    auto Map(const char* path) noexcept -> Fixed64FileError {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return Fixed64FileError::OpenFailed;
+        }
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size)) {
+            CloseHandle(file);
+            return Fixed64FileError::MapFailed;
+        }
+        if (size.QuadPart == 0) {
+            CloseHandle(file);
+            return Fixed64FileError::BadHeader;
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr) {
+            return Fixed64FileError::MapFailed;
+        }
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (view == nullptr) {
+            return Fixed64FileError::MapFailed;
+        }
+        mapping_ = view;
+        size_ = static_cast<size_t>(size.QuadPart);
+#else
+        const int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            return Fixed64FileError::OpenFailed;
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            return Fixed64FileError::MapFailed;
+        }
+        if (st.st_size == 0) {
+            ::close(fd);
+            return Fixed64FileError::BadHeader;
+        }
+        void* view = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (view == MAP_FAILED) {
+            return Fixed64FileError::MapFailed;
+        }
+        mapping_ = view;
+        size_ = static_cast<size_t>(st.st_size);
+#endif
+        return Fixed64FileError::None;
+    }
+
+    void* mapping_ = nullptr;
+    size_t size_ = 0;
+    size_t count_ = 0;
+};
+
+/**
+ * @brief Streaming writer of a column file of Fixed64<P> values
+ *
+ * Open writes a header marked incomplete, Append writes raw values as they are produced
+ * (nothing is buffered beyond the C stream), and Close rewrites the header with the final
+ * count and checksum. A file whose writer never closed is rejected by the reader as
+ * Incomplete. The destructor closes an open writer.
+ *
+ * Usage:
+ *   Fixed64ColumnWriter<32> out;
+ *   out.Open("replay/positions.fx64");
+ *   for (const auto& tick : ticks) { out.Append(tick.positions); }
+ *   out.Close();
+ */
+template <int P>
+class Fixed64ColumnWriter {
+ public:
+    Fixed64ColumnWriter() noexcept = default;
+
+    Fixed64ColumnWriter(Fixed64ColumnWriter&& other) noexcept
+        : file_(std::exchange(other.file_, nullptr)),
+          checksum_(other.checksum_),
+          count_(std::exchange(other.count_, 0)),
+          failed_(std::exchange(other.failed_, false)) {}
+
+    auto operator=(Fixed64ColumnWriter&& other) noexcept -> Fixed64ColumnWriter& {
+        if (this != &other) {
+            Close();
+            file_ = std::exchange(other.file_, nullptr);
+            checksum_ = other.checksum_;
+            count_ = std::exchange(other.count_, 0);
+            failed_ = std::exchange(other.failed_, false);
+        }
+        return *this;
+    }
+
+    Fixed64ColumnWriter(const Fixed64ColumnWriter&) = delete;
+    auto operator=(const Fixed64ColumnWriter&) -> Fixed64ColumnWriter& = delete;
+
+    ~Fixed64ColumnWriter() {
+        Close();
+    }
+
+    /**
+     * @brief Create (or truncate) a column file and write its provisional header
+     * @param path File to write
+     * @return Fixed64FileError::None on success
+     */
+    auto Open(const char* path) noexcept -> Fixed64FileError {
+        Close();
+        if constexpr (std::endian::native != std::endian::little) {
+            return Fixed64FileError::Unsupported;
+        }
+        file_ = std::fopen(path, "wb");
+        if (file_ == nullptr) {
+            return Fixed64FileError::OpenFailed;
+        }
+        checksum_ = detail::ColumnChecksum();
+        count_ = 0;
+        failed_ = !WriteHeader(detail::kColumnFileIncomplete, 0);
+        return failed_ ? Fixed64FileError::WriteFailed : Fixed64FileError::None;
+    }
+
+    /**
+     * @brief Append values to the end of the file
+     * @return Fixed64FileError::None on success, WriteFailed if the file is not open or a
+     * write failed (the file is then left incomplete)
+     */
+    auto Append(std::span<const Fixed64<P>> values) noexcept -> Fixed64FileError {
+        if (file_ == nullptr || failed_) {
+            return Fixed64FileError::WriteFailed;
+        }
+        const auto* raw = detail::RawWords(values);
+        if (std::fwrite(raw, sizeof(int64_t), values.size(), file_) != values.size()) {
+            failed_ = true;
+            return Fixed64FileError::WriteFailed;
+        }
+        checksum_.Add(raw, values.size());
+        count_ += values.size();
+        return Fixed64FileError::None;
+    }
+
+    // Number of values appended so far
+    [[nodiscard]] auto count() const noexcept -> uint64_t {
+        return count_;
+    }
+
+    /**
+     * @brief Write the final header and close the file
+     * @return Fixed64FileError::None on success (or if nothing was open), WriteFailed if any
+     * write failed, in which case the file stays marked incomplete
+     */
+    auto Close() noexcept -> Fixed64FileError {
+        if (file_ == nullptr) {
+            return Fixed64FileError::None;
+        }
+        bool ok = !failed_ && std::fflush(file_) == 0 && std::fseek(file_, 0, SEEK_SET) == 0
+               && WriteHeader(count_, checksum_.Finish());
+        ok = std::fclose(file_) == 0 && ok;
+        file_ = nullptr;
+        failed_ = false;
+        return ok ? Fixed64FileError::None : Fixed64FileError::WriteFailed;
+    }
+
+ private:
+    auto WriteHeader(uint64_t count, uint64_t checksum) noexcept -> bool {
+        detail::ColumnFileHeader header{};
+        std::memcpy(header.magic, detail::kColumnFileMagic, sizeof(header.magic));
+        header.version = detail::kColumnFileVersion;
+        header.precision = P;
+        header.count = count;
+        header.checksum = checksum;
+        return std::fwrite(&header, sizeof(header), 1, file_) == 1;
+    }
+
+    std::FILE* file_ = nullptr;
+    detail::ColumnChecksum checksum_;
+    uint64_t count_ = 0;
+    bool failed_ = false;
+};
+
+}  // namespace math::fp
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "fixed64.h"
+#include "primitives.h"
+
+namespace math::fp {
+
+/**
+ * @brief Division by a fixed-point value that is reused many times
+ *
+ * Precomputes the normalization shift and the 64-bit reciprocal of the divisor
+ * (Moller-Granlund, the approach libdivide uses for 128/64 division), so each Divide
+ * costs one 64x64->128 multiplication plus a few corrections instead of a full
+ * DivU128ToU64.
+ *
+ * Guarantees:
+ * - Divide(n) is bit-identical to n / divisor for every n, including the
+ *   Infinity/NegInfinity result for a zero divisor
+ * - The reciprocal is computed with integer operations only, so results are identical
+ *   on every platform
+ *
+ * Usage:
+ *   const Fixed64Divider<32> inv_mass(mass);
+ *   for (auto& f : forces) {
+ *       f = inv_mass.Divide(f);
+ *   }
+ */
+template <int P>
+class Fixed64Divider {
+ public:
+    /**
+     * @brief Construct a divider for the given divisor
+     * @param divisor Value to divide by
+     */
+    constexpr explicit Fixed64Divider(Fixed64<P> divisor) noexcept : divisor_(divisor) {
+        const int64_t d = divisor.value();
+        sign_ = d >> 63;
+        d_abs_ = (static_cast<uint64_t>(d ^ sign_)) - sign_;
+        if (d_abs_ != 0) {
+            shift_ = Primitives::CountlZero(d_abs_);
+            inverse_ = Primitives::ReciprocalWord(d_abs_ << shift_);
+        }
+    }
+
+    /**
+     * @brief Get the divisor
+     * @return Divisor this object was constructed with
+     */
+    [[nodiscard]] constexpr auto divisor() const noexcept -> Fixed64<P> {
+        return divisor_;
+    }
+
+    /**
+     * @brief Divide by the precomputed divisor
+     * @param n Dividend
+     * @return n / divisor()
+     */
+    [[nodiscard]] constexpr auto Divide(Fixed64<P> n) const noexcept -> Fixed64<P> {
+        // Handle division by zero
+        if (d_abs_ == 0) [[unlikely]] {
+            return (n.value() >= 0) ? Fixed64<P>::Infinity() : Fixed64<P>::NegInfinity();
+        }
+
+        // Extract sign and magnitude of the dividend
+        const int64_t s_n = n.value() >> 63;
+        const uint64_t n_abs = (static_cast<uint64_t>(n.value() ^ s_n)) - s_n;
+
+        // Prepare 128-bit dividend: n_abs << P
+        const uint64_t n_lo = n_abs << P;
+        const uint64_t n_hi = n_abs >> (64 - P);
+
+        const uint64_t result_abs =
+            Primitives::DivU128ToU64Preinv(n_hi, n_lo, d_abs_, shift_, inverse_);
+
+        // Apply sign: If s_result is -1, invert and add 1
+        const int64_t s_result = s_n ^ sign_;
+        return Fixed64<P>((static_cast<int64_t>(result_abs ^ s_result)) - s_result,
+                          detail::nothing{});
+    }
+
+    /**
+     * @brief Division operator, equivalent to d.Divide(n)
+     */
+    [[nodiscard]] friend constexpr auto operator/(Fixed64<P> n, const Fixed64Divider& d) noexcept
+        -> Fixed64<P> {
+        return d.Divide(n);
+    }
+
+ private:
+    Fixed64<P> divisor_;
+    int64_t sign_ = 0;      // -1 for a negative divisor, 0 otherwise
+    uint64_t d_abs_ = 0;    // |divisor|
+    int shift_ = 0;         // CountlZero(d_abs_)
+    uint64_t inverse_ = 0;  // ReciprocalWord(d_abs_ << shift_)
+};
+
+/**
+ * @brief Remainder by a fixed-point modulus that is reused many times
+ *
+ * Precomputes the Barrett reciprocal floor((2^64 - 1) / |modulus|), so each remainder costs
+ * one 64x64->128 multiplication and a conditional subtraction (Primitives::RemPreinv) instead
+ * of a hardware 64-bit division. Suited to moduli known only at runtime, such as a world-wrap
+ * size or a tile grid; compile-time constants like 2π use Primitives::RemConstant directly.
+ *
+ * Guarantees:
+ * - Remainder(x) is bit-identical to x % modulus, including NaN for a zero modulus
+ * - Wrap(x) is bit-identical to Fixed64Math::Repeat(x, modulus)
+ * - Constant time: no loops and no data-dependent branches
+ *
+ * Usage:
+ *   const Fixed64Remainder<16> world(world_size);
+ *   for (auto& entity : entities) {
+ *       entity.x = world.Wrap(entity.x + entity.vx * dt);
+ *   }
+ */
+template <int P>
+class Fixed64Remainder {
+ public:
+    /**
+     * @brief Construct a remainder engine for the given modulus
+     * @param modulus Value to reduce by
+     */
+    constexpr explicit Fixed64Remainder(Fixed64<P> modulus) noexcept : modulus_(modulus) {
+        const int64_t m = modulus.value();
+        d_abs_ = m < 0 ? 0 - static_cast<uint64_t>(m) : static_cast<uint64_t>(m);
+        if (d_abs_ != 0) {
+            reciprocal_ = ~uint64_t(0) / d_abs_;
+        }
+    }
+
+    /**
+     * @brief Get the modulus
+     * @return Modulus this object was constructed with
+     */
+    [[nodiscard]] constexpr auto modulus() const noexcept -> Fixed64<P> {
+        return modulus_;
+    }
+
+    /**
+     * @brief Remainder truncated toward zero
+     * @param x Dividend
+     * @return x % modulus(), with the sign of x; NaN if the modulus is zero
+     */
+    [[nodiscard]] constexpr auto Remainder(Fixed64<P> x) const noexcept -> Fixed64<P> {
+        if (d_abs_ == 0) [[unlikely]] {
+            return Fixed64<P>::NaN();
+        }
+        return Fixed64<P>(Primitives::RemPreinv(x.value(), d_abs_, reciprocal_),
+                          detail::nothing{});
+    }
+
+    /**
+     * @brief Wrap a value into [0, modulus), e.g. a coordinate on a toroidal world
+     * @param x Input value
+     * @return x - k * modulus() for the integer k that puts it in range, Zero if the modulus
+     * is not positive
+     */
+    [[nodiscard]] constexpr auto Wrap(Fixed64<P> x) const noexcept -> Fixed64<P> {
+        if (modulus_.value() <= 0) [[unlikely]] {
+            return Fixed64<P>::Zero();
+        }
+        const int64_t r = Primitives::RemPreinv(x.value(), d_abs_, reciprocal_);
+        return Fixed64<P>(r + (static_cast<int64_t>(d_abs_) & (r >> 63)), detail::nothing{});
+    }
+
+    /**
+     * @brief Wrap every value in place, see Wrap(Fixed64<P>)
+     * @param values Values to wrap into [0, modulus)
+     */
+    constexpr auto Wrap(std::span<Fixed64<P>> values) const noexcept -> void {
+        if (modulus_.value() <= 0) {
+            for (auto& value : values) {
+                value = Fixed64<P>::Zero();
+            }
+            return;
+        }
+        for (auto& value : values) {
+            const int64_t r = Primitives::RemPreinv(value.value(), d_abs_, reciprocal_);
+            value = Fixed64<P>(r + (static_cast<int64_t>(d_abs_) & (r >> 63)), detail::nothing{});
+        }
+    }
+
+    /**
+     * @brief Modulo operator, equivalent to m.Remainder(x)
+     */
+    [[nodiscard]] friend constexpr auto operator%(Fixed64<P> x, const Fixed64Remainder& m) noexcept
+        -> Fixed64<P> {
+        return m.Remainder(x);
+    }
+
+ private:
+    Fixed64<P> modulus_;
+    uint64_t d_abs_ = 0;       // |modulus|
+    uint64_t reciprocal_ = 0;  // floor((2^64 - 1) / d_abs_)
+};
+
+}  // namespace math::fp
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "detail/chunk_pool.h"
+
+namespace math::fp {
+
+/**
+ * @brief Execution policies for the batch, conversion, random-fill and reduction functions
+ *
+ * Passed as the first argument, like the std::execution policies:
+ *   Fixed64Math::SinBatch<32>(execution::par, angles, out);
+ *   const Fixed64_32 total = Fixed64Math::Sum<32>(execution::par.WithThreads(4), values);
+ *
+ * Under par, a span is split into fixed chunks of 16384 elements (a reduction into at most 256
+ * runs of whole chunks). The split depends only on the span length. The chunks run on the
+ * process-wide pool, where idle threads claim the next unclaimed chunk, and partial results are
+ * combined in chunk order with exact integer arithmetic.
+ *
+ * Guarantees:
+ * - Every policy and thread count produces the same bits as the overload without a policy
+ * - seq runs on the calling thread; par never starts more threads than the pool has, and with
+ *   FIXED64_USE_THREADS=0 it runs on the calling thread too
+ * - A policy call made from inside a chunk of another one runs inline
+ * - The kernels use SIMD lanes under every policy, so par_unseq is the same policy as par
+ */
+namespace execution {
+
+// Run on the calling thread only
+struct SequencedPolicy {};
+
+// Run the chunks on the thread pool, on at most max_threads threads including the caller
+// (0 for the whole pool)
+struct ParallelPolicy {
+    size_t max_threads = 0;
+
+    // Same policy with a cap on the number of threads, e.g. to leave cores to other work
+    [[nodiscard]] constexpr auto WithThreads(size_t threads) const noexcept -> ParallelPolicy {
+        return ParallelPolicy{threads};
+    }
+};
+
+inline constexpr SequencedPolicy seq{};
+inline constexpr ParallelPolicy par{};
+inline constexpr ParallelPolicy par_unseq{};
+
+}  // namespace execution
+
+template <typename T>
+concept ExecutionPolicy = std::is_same_v<std::remove_cvref_t<T>, execution::SequencedPolicy> ||
+                          std::is_same_v<std::remove_cvref_t<T>, execution::ParallelPolicy>;
+
+namespace detail {
+
+// Thread cap of a policy in the convention of ChunkPool::Run
+constexpr auto MaxThreads(execution::SequencedPolicy) noexcept -> size_t {
+    return 1;
+}
+
+constexpr auto MaxThreads(execution::ParallelPolicy policy) noexcept -> size_t {
+    return policy.max_threads;
+}
+
+// Call fn(begin, end) for the fixed chunks of [0, count) as the policy directs
+template <ExecutionPolicy Policy, typename Fn>
+inline auto ForEachChunk(const Policy& policy, size_t count, Fn&& fn) noexcept -> void {
+    ForEachChunk(count, fn, MaxThreads(policy));
+}
+
+}  // namespace detail
+
+}  // namespace math::fp
@@ -0,0 +1,557 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "detail/sin_lut.h"
+#include "fixed64.h"
+#include "primitives.h"
+
+namespace math::fp {
+
+/**
+ * @brief Complex fixed-point value, the element type of Fixed64Fft
+ *
+ * 16-byte aligned so that an array of complex values is an array of interleaved (re, im) raw
+ * pairs, which the transforms work on in place.
+ */
+template <int P>
+struct alignas(16) Fixed64Complex {
+    Fixed64<P> re;
+    Fixed64<P> im;
+};
+
+/**
+ * @brief Deterministic fast Fourier transforms and convolution on fixed-point data
+ *
+ * A plan for one power-of-two length. Transforms run in place, in integer arithmetic only, so
+ * every platform produces the same bits:
+ * - Mixed radix: radix-4 passes, plus one radix-2 pass for odd powers of two.
+ * - Scaling: every pass divides by its radix (rounding to nearest), so values never grow and
+ *   the forward transform is scaled by 1/size().
+ * - Block floating point: the input is first shifted to fill the 64-bit range and shifted back
+ *   at the end, so the per-pass rounding happens far below the output ulp.
+ * - Cache blocking: the passes over short butterflies run on one cache-sized block at a time,
+ *   and each pass reads its twiddle factors sequentially.
+ * - Twiddles: Q31.32 values interpolated from kSinLut, accurate to about 5e-10, which bounds
+ *   relative accuracy of the results.
+ *
+ * Usage:
+ *   Fixed64Fft<32> fft(8192);
+ *   fft.Convolve(signal, taps, filtered);  // signal.size() + taps.size() - 1 <= 8192
+ */
+template <int P>
+class Fixed64Fft {
+ public:
+    using Complex = Fixed64Complex<P>;
+
+    // Supported lengths: powers of two in [kMinSize, kMaxSize]
+    static constexpr size_t kMinSize = 4;
+    static constexpr size_t kMaxSize = size_t(1) << 20;
+
+    Fixed64Fft() = default;
+
+    /**
+     * @brief Build the twiddle tables for one length
+     * @param size Transform length, a power of two in [kMinSize, kMaxSize]
+     * @note The plan is empty (every transform returns false) for any other size
+     */
+    explicit Fixed64Fft(size_t size) {
+        if (size < kMinSize || size > kMaxSize || !std::has_single_bit(size)) {
+            return;
+        }
+        size_ = size;
+        log2_size_ = std::countr_zero(size);
+        BuildTwiddles();
+        scratch_.resize(2 * (size + 2));
+    }
+
+    // Transform length, 0 for an empty plan
+    [[nodiscard]] auto size() const noexcept -> size_t {
+        return size_;
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return size_ == 0;
+    }
+
+    /**
+     * @brief Forward transform, scaled by 1/size()
+     * @param data size() values, replaced by X[k] = sum(x[n] * exp(-2 pi i n k / N)) / N
+     * @return false (and no change) if data.size() != size()
+     */
+    auto Forward(std::span<Complex> data) const noexcept -> bool {
+        if (size_ == 0 || data.size() != size_) {
+            return false;
+        }
+        int64_t* z = reinterpret_cast<int64_t*>(data.data());
+        const int shift = Normalize(z, 2 * size_);
+        Transform<false>(z, log2_size_);
+        ScaleRaw(z, 2 * size_, -shift);
+        return true;
+    }
+
+    /**
+     * @brief Inverse transform without scaling, so that Inverse(Forward(x)) == x
+     * @param data size() values, replaced by x[n] = sum(X[k] * exp(2 pi i n k / N))
+     * @return false (and no change) if data.size() != size()
+     * @note Results beyond the Fixed64 range saturate to Infinity or NegInfinity
+     */
+    auto Inverse(std::span<Complex> data) const noexcept -> bool {
+        if (size_ == 0 || data.size() != size_) {
+            return false;
+        }
+        int64_t* z = reinterpret_cast<int64_t*>(data.data());
+        const int shift = Normalize(z, 2 * size_);
+        Transform<true>(z, log2_size_);
+        ScaleRaw(z, 2 * size_, log2_size_ - shift);
+        return true;
+    }
+
+    /**
+     * @brief Forward transform of real data, scaled by 1/size()
+     *
+     * Computed as one complex transform of half the length, which costs about half of Forward.
+     *
+     * @param input size() real values
+     * @param output size() / 2 + 1 bins X[0..N/2]; the others follow from X[N-k] = conj(X[k])
+     * @return false if the sizes do not match
+     */
+    auto ForwardReal(std::span<const Fixed64<P>> input, std::span<Complex> output) const noexcept
+        -> bool {
+        if (size_ == 0 || input.size() != size_ || output.size() != size_ / 2 + 1) {
+            return false;
+        }
+        int64_t* z = reinterpret_cast<int64_t*>(output.data());
+        const auto* x = reinterpret_cast<const int64_t*>(input.data());
+        std::copy(x, x + size_, z);
+        const int shift = ForwardRealRaw(z);
+        ScaleRaw(z, 2 * output.size(), -shift);
+        return true;
+    }
+
+    /**
+     * @brief Inverse of ForwardReal, without scaling
+     * @param input size() / 2 + 1 bins of a Hermitian spectrum; the imaginary parts of X[0]
+     * and X[N/2] are ignored
+     * @param output size() real values x[n] = sum(X[k] * exp(2 pi i n k / N)) over all N bins
+     * @return false if the sizes do not match
+     * @note Results beyond the Fixed64 range saturate to Infinity or NegInfinity
+     */
+    auto InverseReal(std::span<const Complex> input, std::span<Fixed64<P>> output) const noexcept
+        -> bool {
+        if (size_ == 0 || input.size() != size_ / 2 + 1 || output.size() != size_) {
+            return false;
+        }
+        int64_t* x = reinterpret_cast<int64_t*>(output.data());
+        const int shift = InverseRealRaw(reinterpret_cast<const int64_t*>(input.data()), x);
+        ScaleRaw(x, size_, -shift);
+        return true;
+    }
+
+    /**
+     * @brief Linear convolution out[n] = sum(a[i] * b[n - i])
+     *
+     * Two real forward transforms, a pointwise product and one inverse transform, all in
+     * block floating point: each spectrum and the product are renormalized to the full 64-bit
+     * range, so the result carries a few ulps of rounding plus the twiddle error (a few 1e-9
+     * of the largest output) however the inputs are scaled.
+     *
+     * @param a First sequence
+     * @param b Second sequence
+     * @param out Receives min(out.size(), a.size() + b.size() - 1) values
+     * @return false (and no change) if a or b is empty or a.size() + b.size() - 1 > size()
+     * @note Reuses the plan's scratch buffers, so one plan must not convolve on two threads
+     * at once; results beyond the Fixed64 range saturate to Infinity or NegInfinity
+     */
+    auto Convolve(std::span<const Fixed64<P>> a,
+                  std::span<const Fixed64<P>> b,
+                  std::span<Fixed64<P>> out) noexcept -> bool {
+        if (size_ == 0 || a.empty() || b.empty() || a.size() + b.size() - 1 > size_) {
+            return false;
+        }
+        int64_t* fa = scratch_.data();
+        int64_t* fb = fa + size_ + 2;
+        const auto* ra = reinterpret_cast<const int64_t*>(a.data());
+        const auto* rb = reinterpret_cast<const int64_t*>(b.data());
+        std::fill(std::copy(ra, ra + a.size(), fa), fa + size_, 0);
+        std::fill(std::copy(rb, rb + b.size(), fb), fb + size_, 0);
+        const int shift_a = ForwardRealRaw(fa);
+        const int shift_b = ForwardRealRaw(fb);
+
+        // Exact 128-bit products, shifted so the largest fits in kHeadroomBits
+        const size_t bins = size_ / 2 + 1;
+        int width = 0;
+        for (size_t k = 0; k < bins; ++k) {
+            uint64_t re_hi, re_lo, im_hi, im_lo;
+            MulComplex128(fa + 2 * k, fb + 2 * k, re_hi, re_lo, im_hi, im_lo);
+            width = std::max({width, BitWidth128(re_hi, re_lo), BitWidth128(im_hi, im_lo)});
+        }
+        // Normalized spectra stay below 2^60, so the products need at most 121 bits
+        const int product_shift = std::clamp(width - (kHeadroomBits - 1), 0, 63);
+        for (size_t k = 0; k < bins; ++k) {
+            uint64_t re_hi, re_lo, im_hi, im_lo;
+            MulComplex128(fa + 2 * k, fb + 2 * k, re_hi, re_lo, im_hi, im_lo);
+            fa[2 * k] = product_shift == 0 ? static_cast<int64_t>(re_lo)
+                                           : Primitives::Round128(re_hi, re_lo, product_shift);
+            fa[2 * k + 1] = product_shift == 0
+                                ? static_cast<int64_t>(im_lo)
+                                : Primitives::Round128(im_hi, im_lo, product_shift);
+        }
+
+        // fa holds DFT(a) * DFT(b) * 2^(shift_a + shift_b - product_shift) / N^2, and the
+        // inverse returns its unscaled inverse transform times 2^inverse_shift; the raw
+        // convolution has 2P fraction bits
+        const int inverse_shift = InverseRealRaw(fa, fb);
+        const int scale = log2_size_ + product_shift - shift_a - shift_b - inverse_shift - P;
+        const size_t count = std::min(out.size(), a.size() + b.size() - 1);
+        ScaleRaw(fb, count, scale);
+        std::copy(fb, fb + count, reinterpret_cast<int64_t*>(out.data()));
+        return true;
+    }
+
+ private:
+    // Normalized data stays below 2^kHeadroomBits per component, so a radix-4 butterfly
+    // (4 * sqrt(2) growth before its shift) and the real-transform split stay below 2^62
+    static constexpr int kHeadroomBits = 59;
+
+    // Complex values per cache block: passes whose butterflies fit run block by block
+    static constexpr size_t kBlockSize = 2048;
+
+    // Q31.32 twiddle factors
+    static constexpr int kTwiddleBits = 32;
+
+    /**
+     * Twiddle tables
+     * sine_[k] = sin(2 pi k / N) for k in [0, N/4]; every other twiddle follows by symmetry.
+     * stages_ holds, for every radix-4 butterfly span 4m = 4, 8, ..., N, the factors w^j, w^2j
+     * and w^3j (w = exp(-2 pi i / 4m), j < m) interleaved, so each pass reads sequentially.
+     */
+    auto BuildTwiddles() -> void {
+        // 2 pi in Q3.60, divided exactly by N in 128 bits
+        constexpr uint64_t kTwoPiQ60 = 0x6487ED5110B4611AULL;
+        const size_t quarter = size_ / 4;
+        sine_.resize(quarter + 1);
+        for (size_t k = 0; k <= quarter; ++k) {
+            uint64_t hi, lo;
+            umul_ppmm(hi, lo, kTwoPiQ60, static_cast<uint64_t>(k));
+            const int64_t angle = Primitives::Round128(hi, lo, 60 - kTwiddleBits + log2_size_);
+            sine_[k] = detail::LookupSin<kTwiddleBits>(angle);
+        }
+        sine_[0] = 0;
+        sine_[quarter] = int64_t(1) << kTwiddleBits;
+
+        stage_offset_.assign(log2_size_ + 1, 0);
+        size_t total = 0;
+        for (int log2_span = 2; log2_span <= log2_size_; ++log2_span) {
+            stage_offset_[log2_span] = total;
+            total += 6 * (size_t(1) << (log2_span - 2));
+        }
+        stages_.resize(total);
+        for (int log2_span = 2; log2_span <= log2_size_; ++log2_span) {
+            int64_t* w = stages_.data() + stage_offset_[log2_span];
+            const size_t m = size_t(1) << (log2_span - 2);
+            const size_t stride = size_ >> log2_span;
+            for (size_t j = 0; j < m; ++j) {
+                for (size_t q = 1; q <= 3; ++q) {
+                    Twiddle(q * j * stride, w[0], w[1]);
+                    w += 2;
+                }
+            }
+        }
+    }
+
+    // exp(-2 pi i k / N) for k in [0, N)
+    auto Twiddle(size_t k, int64_t& re, int64_t& im) const noexcept -> void {
+        const size_t quarter = size_ / 4;
+        const size_t r = k % quarter;
+        const int64_t s = sine_[r];
+        const int64_t c = sine_[quarter - r];
+        switch (k / quarter) {
+            case 0:
+                re = c;
+                im = -s;
+                break;
+            case 1:
+                re = -s;
+                im = -c;
+                break;
+            case 2:
+                re = -c;
+                im = s;
+                break;
+            default:
+                re = s;
+                im = c;
+                break;
+        }
+    }
+
+    // Shift for block floating point: returns s such that every value * 2^s is below
+    // 2^kHeadroomBits, and applies it
+    static auto Normalize(int64_t* z, size_t count) noexcept -> int {
+        uint64_t magnitude = 0;
+        for (size_t i = 0; i < count; ++i) {
+            magnitude |= static_cast<uint64_t>(z[i] ^ (z[i] >> 63));
+        }
+        const int shift = kHeadroomBits - 1 - std::bit_width(magnitude);
+        ScaleRaw(z, count, shift);
+        return shift;
+    }
+
+    // value * 2^shift, rounding to nearest (ties up) when shift < 0 and saturating to
+    // [-INT64_MAX, INT64_MAX] when shift > 0
+    static auto ScaleRaw(int64_t value, int shift) noexcept -> int64_t {
+        if (shift > 0) {
+            if (shift >= 63) {
+                return value == 0 ? 0 : (value < 0 ? -INT64_MAX : INT64_MAX);
+            }
+            const int64_t limit = INT64_MAX >> shift;
+            if (value > limit || value < -limit) {
+                return value < 0 ? -INT64_MAX : INT64_MAX;
+            }
+            return value * (int64_t(1) << shift);
+        }
+        if (shift < 0) {
+            if (shift <= -64) {
+                return 0;
+            }
+            return (value >> -shift) + ((value >> (-shift - 1)) & 1);
+        }
+        return value;
+    }
+
+    static auto ScaleRaw(int64_t* z, size_t count, int shift) noexcept -> void {
+        if (shift != 0) {
+            for (size_t i = 0; i < count; ++i) {
+                z[i] = ScaleRaw(z[i], shift);
+            }
+        }
+    }
+
+    // Bits of the magnitude of a two's complement 128-bit value
+    static auto BitWidth128(uint64_t hi, uint64_t lo) noexcept -> int {
+        const uint64_t sign = static_cast<uint64_t>(static_cast<int64_t>(hi) >> 63);
+        return (hi ^ sign) != 0 ? 64 + std::bit_width(hi ^ sign) : std::bit_width(lo ^ sign);
+    }
+
+    // Exact product of two complex raw values in 128 bits
+    static auto MulComplex128(const int64_t* a,
+                              const int64_t* b,
+                              uint64_t& re_hi,
+                              uint64_t& re_lo,
+                              uint64_t& im_hi,
+                              uint64_t& im_lo) noexcept -> void {
+        re_hi = re_lo = im_hi = im_lo = 0;
+        Primitives::MulAdd128(a[0], b[0], re_hi, re_lo);
+        Primitives::MulAdd128(-a[1], b[1], re_hi, re_lo);
+        Primitives::MulAdd128(a[0], b[1], im_hi, im_lo);
+        Primitives::MulAdd128(a[1], b[0], im_hi, im_lo);
+    }
+
+    // (re, im) * (c, d) for a Q31.32 twiddle, computed exactly and rounded once
+    static auto MulTwiddle(int64_t& re, int64_t& im, int64_t c, int64_t d) noexcept -> void {
+        uint64_t re_hi = 0, re_lo = 0, im_hi = 0, im_lo = 0;
+        Primitives::MulAdd128(re, c, re_hi, re_lo);
+        Primitives::MulAdd128(im, -d, re_hi, re_lo);
+        Primitives::MulAdd128(re, d, im_hi, im_lo);
+        Primitives::MulAdd128(im, c, im_hi, im_lo);
+        re = Primitives::Round128(re_hi, re_lo, kTwiddleBits);
+        im = Primitives::Round128(im_hi, im_lo, kTwiddleBits);
+    }
+
+    static auto RoundShift(int64_t value, int shift) noexcept -> int64_t {
+        return (value + (int64_t(1) << (shift - 1))) >> shift;
+    }
+
+    // In-place transform of 2^log2n normalized complex values, scaled by 2^-log2n
+    template <bool kInverse>
+    auto Transform(int64_t* z, int log2n) const noexcept -> void {
+        const size_t n = size_t(1) << log2n;
+        BitReverse(z, n);
+
+        // Radix-2 pass first for odd powers of two, then radix-4 passes of span 4m
+        size_t m = 1;
+        if (log2n % 2 != 0) {
+            for (size_t i = 0; i < 2 * n; i += 4) {
+                const int64_t a_re = z[i], a_im = z[i + 1], b_re = z[i + 2], b_im = z[i + 3];
+                z[i] = RoundShift(a_re + b_re, 1);
+                z[i + 1] = RoundShift(a_im + b_im, 1);
+                z[i + 2] = RoundShift(a_re - b_re, 1);
+                z[i + 3] = RoundShift(a_im - b_im, 1);
+            }
+            m = 2;
+        }
+
+        // Passes whose span fits in a block finish one block before moving on to the next
+        const size_t block = n < kBlockSize ? n : kBlockSize;
+        const size_t first = m;
+        size_t local_end = m;
+        while (4 * local_end <= block) {
+            local_end *= 4;
+        }
+        for (size_t base = 0; base < n; base += block) {
+            for (size_t lm = first; lm < local_end; lm *= 4) {
+                Radix4Pass<kInverse>(z + 2 * base, block, lm);
+            }
+        }
+        for (m = local_end; m < n; m *= 4) {
+            Radix4Pass<kInverse>(z, n, m);
+        }
+    }
+
+    // Radix-4 butterflies of span 4m over count values
+    template <bool kInverse>
+    auto Radix4Pass(int64_t* z, size_t count, size_t m) const noexcept -> void {
+        const int64_t* twiddles = stages_.data() + stage_offset_[std::countr_zero(4 * m)];
+        for (size_t base = 0; base < count; base += 4 * m) {
+            const int64_t* w = twiddles;
+            for (size_t j = 0; j < m; ++j, w += 6) {
+                int64_t* x0 = z + 2 * (base + j);
+                int64_t* x1 = x0 + 2 * m;
+                int64_t* x2 = x1 + 2 * m;
+                int64_t* x3 = x2 + 2 * m;
+
+                // After bit reversal the sub-transforms of span m are ordered 0, 2, 1, 3
+                int64_t a0_re = x0[0], a0_im = x0[1];
+                int64_t a2_re = x1[0], a2_im = x1[1];
+                int64_t a1_re = x2[0], a1_im = x2[1];
+                int64_t a3_re = x3[0], a3_im = x3[1];
+                if (j != 0) {
+                    MulTwiddle(a1_re, a1_im, w[0], kInverse ? -w[1] : w[1]);
+                    MulTwiddle(a2_re, a2_im, w[2], kInverse ? -w[3] : w[3]);
+                    MulTwiddle(a3_re, a3_im, w[4], kInverse ? -w[5] : w[5]);
+                }
+
+                const int64_t p_re = a0_re + a2_re, p_im = a0_im + a2_im;
+                const int64_t q_re = a0_re - a2_re, q_im = a0_im - a2_im;
+                const int64_t r_re = a1_re + a3_re, r_im = a1_im + a3_im;
+                int64_t u_re = a1_re - a3_re, u_im = a1_im - a3_im;
+                if constexpr (kInverse) {
+                    u_re = -u_re;
+                    u_im = -u_im;
+                }
+
+                // X[j + m] = q - i u and X[j + 3m] = q + i u (signs swap for the inverse)
+                x0[0] = RoundShift(p_re + r_re, 2);
+                x0[1] = RoundShift(p_im + r_im, 2);
+                x1[0] = RoundShift(q_re + u_im, 2);
+                x1[1] = RoundShift(q_im - u_re, 2);
+                x2[0] = RoundShift(p_re - r_re, 2);
+                x2[1] = RoundShift(p_im - r_im, 2);
+                x3[0] = RoundShift(q_re - u_im, 2);
+                x3[1] = RoundShift(q_im + u_re, 2);
+            }
+        }
+    }
+
+    static auto BitReverse(int64_t* z, size_t n) noexcept -> void {
+        for (size_t i = 1, j = 0; i < n; ++i) {
+            size_t bit = n >> 1;
+            for (; (j & bit) != 0; bit >>= 1) {
+                j ^= bit;
+            }
+            j |= bit;
+            if (i < j) {
+                std::swap(z[2 * i], z[2 * j]);
+                std::swap(z[2 * i + 1], z[2 * j + 1]);
+            }
+        }
+    }
+
+    /**
+     * Real forward transform in place: z holds size() reals and receives size() / 2 + 1 bins
+     * (size() + 2 values) of DFT(x) * 2^shift / N; returns shift
+     * The reals, read as N/2 complex values x[2n] + i x[2n + 1], go through a half-length
+     * transform Z, then X[k] = (S + w^k (-i D)) / 4 and X[M - k] = conj(S - w^k (-i D)) / 4
+     * with S = Z[k] + conj(Z[M - k]), D = Z[k] - conj(Z[M - k]) and M = N/2.
+     */
+    auto ForwardRealRaw(int64_t* z) const noexcept -> int {
+        const size_t half = size_ / 2;
+        const int shift = Normalize(z, size_);
+        Transform<false>(z, log2_size_ - 1);
+        for (size_t k = 0; k <= half / 2; ++k) {
+            const size_t mirror = (half - k) % half;
+            const int64_t s_re = z[2 * k] + z[2 * mirror];
+            const int64_t s_im = z[2 * k + 1] - z[2 * mirror + 1];
+            const int64_t d_re = z[2 * k] - z[2 * mirror];
+            const int64_t d_im = z[2 * k + 1] + z[2 * mirror + 1];
+            int64_t t_re = d_im;
+            int64_t t_im = -d_re;
+            int64_t w_re, w_im;
+            Twiddle(k, w_re, w_im);
+            MulTwiddle(t_re, t_im, w_re, w_im);
+
+            z[2 * k] = RoundShift(s_re + t_re, 2);
+            z[2 * k + 1] = RoundShift(s_im + t_im, 2);
+            if (k != half / 2) {
+                z[2 * (half - k)] = RoundShift(s_re - t_re, 2);
+                z[2 * (half - k) + 1] = RoundShift(t_im - s_im, 2);
+            }
+        }
+        return shift;
+    }
+
+    /**
+     * Real inverse transform: X holds size() / 2 + 1 bins and x receives size() reals equal
+     * to the unscaled inverse transform of X times 2^-shift; returns shift
+     * Inverts the split of ForwardRealRaw: Z[k] = (S + i T) / 2 and
+     * Z[M - k] = (conj(S) + i conj(T)) / 2 with S = X[k] + conj(X[M - k]) and
+     * T = (X[k] - conj(X[M - k])) conj(w^k); the values are stored halved once more for headroom.
+     */
+    auto InverseRealRaw(const int64_t* spectrum, int64_t* x) const noexcept -> int {
+        const size_t half = size_ / 2;
+        uint64_t magnitude = 0;
+        for (size_t k = 0; k <= half; ++k) {
+            // The imaginary parts of X[0] and X[M] are ignored
+            const int64_t re = spectrum[2 * k];
+            const int64_t im = k == 0 || k == half ? 0 : spectrum[2 * k + 1];
+            magnitude |= static_cast<uint64_t>((re ^ (re >> 63)) | (im ^ (im >> 63)));
+        }
+        const int shift = kHeadroomBits - 1 - std::bit_width(magnitude);
+        const auto load = [&](size_t k, int64_t& re, int64_t& im) {
+            re = ScaleRaw(spectrum[2 * k], shift);
+            im = k == 0 || k == half ? 0 : ScaleRaw(spectrum[2 * k + 1], shift);
+        };
+
+        for (size_t k = 0; k <= half / 2; ++k) {
+            int64_t a_re, a_im, b_re, b_im;
+            load(k, a_re, a_im);
+            load(half - k, b_re, b_im);
+            b_im = -b_im;
+            const int64_t s_re = a_re + b_re;
+            const int64_t s_im = a_im + b_im;
+            int64_t t_re = a_re - b_re;
+            int64_t t_im = a_im - b_im;
+            int64_t w_re, w_im;
+            Twiddle(k, w_re, w_im);
+            MulTwiddle(t_re, t_im, w_re, -w_im);
+
+            // Z[k] / 2 = (S + i T) / 4 and Z[M - k] / 2 = (conj(S) + i conj(T)) / 4
+            x[2 * k] = RoundShift(s_re - t_im, 2);
+            x[2 * k + 1] = RoundShift(s_im + t_re, 2);
+            if (k != 0 && k != half / 2) {
+                x[2 * (half - k)] = RoundShift(s_re + t_im, 2);
+                x[2 * (half - k) + 1] = RoundShift(t_re - s_im, 2);
+            }
+        }
+        Transform<true>(x, log2_size_ - 1);
+
+        // x = IDFT_N(X * 2^shift) / 2 = unscaled inverse * 2^(shift - log2 N - 1)
+        return shift - log2_size_ - 1;
+    }
+
+    size_t size_ = 0;
+    int log2_size_ = 0;
+    std::vector<int64_t> sine_;
+    std::vector<int64_t> stages_;
+    std::vector<size_t> stage_offset_;
+    std::vector<int64_t> scratch_;
+};
+
+}  // namespace math::fp
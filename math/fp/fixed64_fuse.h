@@ -0,0 +1,205 @@
+#pragma once
+
+#include <concepts>
+
+#include "fixed64.h"
+#include "fixed64_accumulator.h"
+
+namespace math::fp {
+
+namespace detail {
+
+// A node that can add its exact value, or its negation, to a 128-bit accumulator
+template <typename E>
+concept FusedSummand = requires(const E& e, Fixed64Accumulator<E::kFractionBits>& acc) {
+    { E::kFractionBits } -> std::convertible_to<int>;
+    e.AddTo(acc, false);
+};
+
+template <typename L, typename R>
+concept FusedCompatible = FusedSummand<L> && FusedSummand<R>
+                       && L::kFractionBits == R::kFractionBits;
+
+// A value taking part in a fused expression, see lazy()
+template <int P>
+struct FusedTerm {
+    static constexpr int kFractionBits = P;
+    Fixed64<P> x;
+
+    constexpr auto AddTo(Fixed64Accumulator<P>& acc, bool negate) const noexcept -> void {
+        if (negate) {
+            acc.MulSub(x, Fixed64<P>::One());
+        } else {
+            acc.Add(x);
+        }
+    }
+};
+
+// a * b, added with all 2P fraction bits
+template <int P>
+struct FusedProduct {
+    static constexpr int kFractionBits = P;
+    Fixed64<P> a;
+    Fixed64<P> b;
+
+    constexpr auto AddTo(Fixed64Accumulator<P>& acc, bool negate) const noexcept -> void {
+        if (negate) {
+            acc.MulSub(a, b);
+        } else {
+            acc.MulAdd(a, b);
+        }
+    }
+};
+
+template <typename L, typename R, bool kSubtract>
+struct FusedSum {
+    static constexpr int kFractionBits = L::kFractionBits;
+    L left;
+    R right;
+
+    constexpr auto AddTo(Fixed64Accumulator<kFractionBits>& acc, bool negate) const noexcept
+        -> void {
+        left.AddTo(acc, negate);
+        right.AddTo(acc, negate != kSubtract);
+    }
+};
+
+template <typename E>
+struct FusedNegate {
+    static constexpr int kFractionBits = E::kFractionBits;
+    E operand;
+
+    constexpr auto AddTo(Fixed64Accumulator<kFractionBits>& acc, bool negate) const noexcept
+        -> void {
+        operand.AddTo(acc, !negate);
+    }
+};
+
+// A fused sum divided by a value; only valid as the outermost node of fuse()
+template <typename N>
+struct FusedQuotient {
+    N numerator;
+    Fixed64<N::kFractionBits> divisor;
+};
+
+// Products of single values; a product of sums or products would need more than 128 bits
+template <int P>
+constexpr auto operator*(FusedTerm<P> a, FusedTerm<P> b) noexcept -> FusedProduct<P> {
+    return {a.x, b.x};
+}
+
+template <int P>
+constexpr auto operator*(FusedTerm<P> a, Fixed64<P> b) noexcept -> FusedProduct<P> {
+    return {a.x, b};
+}
+
+template <int P>
+constexpr auto operator*(Fixed64<P> a, FusedTerm<P> b) noexcept -> FusedProduct<P> {
+    return {a, b.x};
+}
+
+template <typename L, typename R>
+    requires FusedCompatible<L, R>
+constexpr auto operator+(L left, R right) noexcept -> FusedSum<L, R, false> {
+    return {left, right};
+}
+
+template <typename L, typename R>
+    requires FusedCompatible<L, R>
+constexpr auto operator-(L left, R right) noexcept -> FusedSum<L, R, true> {
+    return {left, right};
+}
+
+template <FusedSummand L, int P>
+    requires(L::kFractionBits == P)
+constexpr auto operator+(L left, Fixed64<P> right) noexcept -> FusedSum<L, FusedTerm<P>, false> {
+    return {left, {right}};
+}
+
+template <FusedSummand L, int P>
+    requires(L::kFractionBits == P)
+constexpr auto operator-(L left, Fixed64<P> right) noexcept -> FusedSum<L, FusedTerm<P>, true> {
+    return {left, {right}};
+}
+
+// Same parameter order as the Fixed64 operators so the constraint selects these overloads
+template <int P, FusedSummand R>
+    requires(R::kFractionBits == P)
+constexpr auto operator+(Fixed64<P> left, const R& right) noexcept
+    -> FusedSum<FusedTerm<P>, R, false> {
+    return {{left}, right};
+}
+
+template <int P, FusedSummand R>
+    requires(R::kFractionBits == P)
+constexpr auto operator-(Fixed64<P> left, const R& right) noexcept
+    -> FusedSum<FusedTerm<P>, R, true> {
+    return {{left}, right};
+}
+
+template <FusedSummand E>
+constexpr auto operator-(E operand) noexcept -> FusedNegate<E> {
+    return {operand};
+}
+
+template <FusedSummand N>
+constexpr auto operator/(N numerator, Fixed64<N::kFractionBits> divisor) noexcept
+    -> FusedQuotient<N> {
+    return {numerator, divisor};
+}
+
+template <FusedSummand N>
+constexpr auto operator/(N numerator, FusedTerm<N::kFractionBits> divisor) noexcept
+    -> FusedQuotient<N> {
+    return {numerator, divisor.x};
+}
+
+}  // namespace detail
+
+/**
+ * @brief Mark a value for a fused expression
+ *
+ * Arithmetic on the result builds an expression instead of computing it; fuse() then
+ * evaluates the whole expression with a single rounding step:
+ *   const Fixed64_32 torque = fuse(lazy(rx) * fy - lazy(ry) * fx);
+ *   const Fixed64_32 t = fuse((lazy(a) * b + lazy(c) * d) / e);
+ *
+ * Supported: products of two values, sums and differences of values and products, negation,
+ * and one final division. Every operand must have the same precision P.
+ */
+template <int P>
+[[nodiscard]] constexpr auto lazy(Fixed64<P> x) noexcept -> detail::FusedTerm<P> {
+    return {x};
+}
+
+/**
+ * @brief Evaluate a fused sum of values and products
+ * @param expression Expression built from lazy() values
+ * @return Exact sum rounded once to nearest (ties to even), Infinity or NegInfinity when it
+ * does not fit
+ * @note The products are kept with all 2P fraction bits in a Fixed64Accumulator, so
+ * intermediate results may exceed the Fixed64 range as long as the total fits
+ */
+template <detail::FusedSummand E>
+[[nodiscard]] constexpr auto fuse(const E& expression) noexcept -> Fixed64<E::kFractionBits> {
+    Fixed64Accumulator<E::kFractionBits> acc;
+    expression.AddTo(acc, false);
+    return acc.Result();
+}
+
+/**
+ * @brief Evaluate a fused sum divided by a value
+ * @param expression Expression of the form (sum) / divisor
+ * @return Exact sum divided by the divisor in one 128/64 division of the unrounded sum,
+ * truncated toward zero like operator/; Infinity or NegInfinity when the quotient does not fit
+ * or the divisor is zero
+ */
+template <typename N>
+[[nodiscard]] constexpr auto fuse(const detail::FusedQuotient<N>& expression) noexcept
+    -> Fixed64<N::kFractionBits> {
+    Fixed64Accumulator<N::kFractionBits> acc;
+    expression.numerator.AddTo(acc, false);
+    return acc.DivideBy(expression.divisor);
+}
+
+}  // namespace math::fp
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "detail/batch_kernels.h"
+#include "detail/raw_words.h"
+#include "fixed64.h"
+#include "primitives.h"
+
+namespace math::fp {
+
+/**
+ * @brief Deterministic hashes of fixed-point spans for desync detection
+ *
+ * Lockstep peers compare the hash of their whole state every tick. The hash is defined on the
+ * raw value() words as integers, not on their bytes, so it is the same on every platform,
+ * compiler, standard library and instruction set:
+ * - Eight lanes accumulate stripes of 8 words, lane j adding w + lo32(w ^ k) * hi32(w ^ k)
+ *   for its word w and key k (the accumulate step of xxHash3), on the batch kernels
+ *   (AVX-512/AVX2/NEON), bit-identical to the scalar loop
+ * - Every 32 stripes the lanes are scrambled (xorshift, key, multiply by a 32-bit prime)
+ * - The lanes are folded pairwise with 64x64->128 multiplies and the length, then avalanched
+ *
+ * The sentinels have a single raw word each (NaN is INT64_MIN, Infinity INT64_MAX and
+ * NegInfinity -INT64_MAX), so equal states always hash equal and a NaN never matches a finite
+ * value. The spans' precision is not part of the hash. Not a cryptographic hash: it detects
+ * accidental divergence, not tampering.
+ *
+ * Usage:
+ *   uint64_t tick_hash = Fixed64Hash::Span<32>(state);
+ *   Fixed64Hash::Hash128 strong = Fixed64Hash::Span128<32>(state, match_seed);
+ */
+class Fixed64Hash {
+ public:
+    struct Hash128 {
+        uint64_t low;
+        uint64_t high;
+
+        friend constexpr auto operator==(const Hash128&, const Hash128&) noexcept -> bool =
+            default;
+    };
+
+    // 64-bit hash of the raw words of values
+    template <int P>
+    [[nodiscard]] static auto Span(std::span<const Fixed64<P>> values, uint64_t seed = 0) noexcept
+        -> uint64_t {
+        return Words(RawWords(values), seed);
+    }
+
+    // 128-bit hash of the raw words of values; low differs from Span with the same seed
+    template <int P>
+    [[nodiscard]] static auto Span128(std::span<const Fixed64<P>> values,
+                                      uint64_t seed = 0) noexcept -> Hash128 {
+        return Words128(RawWords(values), seed);
+    }
+
+    // 64-bit hash of integer words, e.g. other state stored next to the fixed-point values
+    [[nodiscard]] static auto Words(std::span<const int64_t> words, uint64_t seed = 0) noexcept
+        -> uint64_t {
+        Lanes acc = Accumulate(words, seed);
+        return Merge(acc, words.size() * kPrime64A ^ seed, 16);
+    }
+
+    [[nodiscard]] static auto Words128(std::span<const int64_t> words, uint64_t seed = 0) noexcept
+        -> Hash128 {
+        Lanes acc = Accumulate(words, seed);
+        return {Merge(acc, words.size() * kPrime64B ^ seed, 8),
+                Merge(acc, ~(words.size() * kPrime64C) - seed, 24)};
+    }
+
+ private:
+    using Lanes = std::array<uint64_t, 8>;
+
+    static constexpr size_t kStripeWords = 8;
+    static constexpr size_t kBlockStripes = 32;
+    static constexpr uint64_t kPrime32 = 0x9E3779B1;
+    static constexpr uint64_t kPrime64A = 0x9E3779B185EBCA87;
+    static constexpr uint64_t kPrime64B = 0xC2B2AE3D27D4EB4F;
+    static constexpr uint64_t kPrime64C = 0x165667B19E3779F9;
+
+    // Keys: accumulate [0, 8), scramble [8, 16), Merge 8 words from offset 16 (64-bit hash) or
+    // 8 and 24 (128-bit hash), never the initial lanes; SplitMix64 outputs of a fixed state,
+    // part of the hash definition
+    static constexpr std::array<uint64_t, 32> kSecret = [] {
+        std::array<uint64_t, 32> secret{};
+        uint64_t state = 0x5EC2E75EED5A17ULL;
+        for (auto& word : secret) {
+            state += 0x9E3779B97F4A7C15ULL;
+            uint64_t z = state;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            word = z ^ (z >> 31);
+        }
+        return secret;
+    }();
+
+    template <int P>
+    static auto RawWords(std::span<const Fixed64<P>> values) noexcept -> std::span<const int64_t> {
+        return {detail::RawWords(values), values.size()};
+    }
+
+    static constexpr auto AccumulateStripe(const int64_t* words, Lanes& acc) noexcept -> void {
+        for (size_t j = 0; j < kStripeWords; ++j) {
+            const uint64_t w = static_cast<uint64_t>(words[j]);
+            const uint64_t key = w ^ kSecret[j];
+            acc[j] += w + (key & 0xFFFFFFFF) * (key >> 32);
+        }
+    }
+
+    static constexpr auto Scramble(Lanes& acc) noexcept -> void {
+        for (size_t j = 0; j < kStripeWords; ++j) {
+            uint64_t a = acc[j];
+            a ^= a >> 47;
+            a ^= kSecret[kStripeWords + j];
+            acc[j] = a * kPrime32;
+        }
+    }
+
+    static auto Accumulate(std::span<const int64_t> words, uint64_t seed) noexcept -> Lanes {
+        Lanes acc;
+        for (size_t j = 0; j < kStripeWords; ++j) {
+            acc[j] = kSecret[j] + seed;
+        }
+
+        const int64_t* data = words.data();
+        const size_t stripes = words.size() / kStripeWords;
+        for (size_t first = 0; first < stripes; first += kBlockStripes) {
+            const size_t count = std::min(kBlockStripes, stripes - first);
+            const int64_t* block = data + first * kStripeWords;
+            size_t s = detail::HashStripesBatch(block, count, kSecret.data(), acc.data());
+            for (; s < count; ++s) {
+                AccumulateStripe(block + s * kStripeWords, acc);
+            }
+            if (count == kBlockStripes) {
+                Scramble(acc);
+            }
+        }
+
+        // The last partial stripe is padded with zeros; the length in Merge tells them apart
+        const size_t tail = words.size() % kStripeWords;
+        if (tail != 0) {
+            int64_t last[kStripeWords] = {};
+            std::copy_n(data + stripes * kStripeWords, tail, last);
+            AccumulateStripe(last, acc);
+        }
+        return acc;
+    }
+
+    // Folded 64x64->128 product
+    static constexpr auto Mum(uint64_t a, uint64_t b) noexcept -> uint64_t {
+        uint64_t hi, lo;
+        umul_ppmm(hi, lo, a, b);
+        return hi ^ lo;
+    }
+
+    static constexpr auto Merge(const Lanes& acc, uint64_t start, size_t key) noexcept
+        -> uint64_t {
+        uint64_t h = start;
+        for (size_t j = 0; j < kStripeWords; j += 2) {
+            h += Mum(acc[j] ^ kSecret[key + j], acc[j + 1] ^ kSecret[key + j + 1]);
+        }
+        h ^= h >> 37;
+        h *= kPrime64C;
+        return h ^ (h >> 32);
+    }
+};
+
+/**
+ * @brief Per-chunk hashes of a state span, rehashing only the chunks that changed
+ *
+ * The state is split into chunks of chunkSize values, each hashed with Fixed64Hash::Span
+ * (seeded with its index, so swapped chunks differ); Digest hashes the chunk hashes and the
+ * length. After a tick, Update rehashes only the chunks overlapping the modified range, and
+ * Chunks lets peers whose digests differ compare chunk hashes to find where they diverged.
+ * Digest is not equal to Fixed64Hash::Span of the whole state.
+ *
+ * Usage:
+ *   Fixed64ChunkedHash hash;
+ *   hash.Assign<32>(state);
+ *   ... state[i .. i + n) changes ...
+ *   uint64_t tick_hash = hash.Update<32>(state, i, n);
+ */
+class Fixed64ChunkedHash {
+ public:
+    // 8 KB of state per chunk
+    static constexpr size_t kDefaultChunkSize = 1024;
+
+    explicit Fixed64ChunkedHash(size_t chunkSize = kDefaultChunkSize, uint64_t seed = 0)
+        : chunk_size_(std::max<size_t>(chunkSize, 1)), seed_(seed) {}
+
+    // Hash every chunk of values, returns Digest()
+    template <int P>
+    auto Assign(std::span<const Fixed64<P>> values) -> uint64_t {
+        count_ = values.size();
+        chunks_.resize((count_ + chunk_size_ - 1) / chunk_size_);
+        RehashChunks(values, 0, chunks_.size());
+        return Digest();
+    }
+
+    /**
+     * @brief Rehash the chunks overlapping values[first, first + count), returns Digest()
+     *
+     * values is the whole state. If its length changed since the last call, every chunk from
+     * the one holding the old end onward is rehashed as well.
+     */
+    template <int P>
+    auto Update(std::span<const Fixed64<P>> values, size_t first, size_t count) -> uint64_t {
+        if (values.size() != count_) {
+            const size_t old_count = count_;
+            count_ = values.size();
+            chunks_.resize((count_ + chunk_size_ - 1) / chunk_size_);
+            const size_t from = std::min(old_count, count_) / chunk_size_;
+            RehashChunks(values, from, chunks_.size());
+        }
+        if (count != 0 && first < count_) {
+            const size_t last = std::min(count_, first + std::min(count, count_ - first));
+            RehashChunks(values, first / chunk_size_, (last - 1) / chunk_size_ + 1);
+        }
+        return Digest();
+    }
+
+    // Hash of the chunk hashes and the number of values
+    [[nodiscard]] auto Digest() const noexcept -> uint64_t {
+        const std::span<const int64_t> words(reinterpret_cast<const int64_t*>(chunks_.data()),
+                                             chunks_.size());
+        return Fixed64Hash::Words(words, seed_ ^ (count_ * 0x9E3779B97F4A7C15ULL));
+    }
+
+    [[nodiscard]] auto Chunks() const noexcept -> std::span<const uint64_t> {
+        return chunks_;
+    }
+
+    [[nodiscard]] auto chunk_size() const noexcept -> size_t {
+        return chunk_size_;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> size_t {
+        return count_;
+    }
+
+ private:
+    template <int P>
+    auto RehashChunks(std::span<const Fixed64<P>> values, size_t begin, size_t end) noexcept
+        -> void {
+        for (size_t c = begin; c < end; ++c) {
+            const size_t offset = c * chunk_size_;
+            const size_t length = std::min(chunk_size_, values.size() - offset);
+            chunks_[c] = Fixed64Hash::Span<P>(values.subspan(offset, length), seed_ + c);
+        }
+    }
+
+    size_t chunk_size_;
+    uint64_t seed_;
+    size_t count_ = 0;
+    std::vector<uint64_t> chunks_;
+};
+
+}  // namespace math::fp
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+// Configuration macro for the hot-path counters
+// When enabled, the primitives, the lookup kernels and a few range checks count their calls and
+// edge cases in thread-local counters (see Fixed64Instrumentation). When disabled (the default)
+// every hook is an empty if constexpr branch and no thread-local storage is created.
+#ifndef FIXED64_INSTRUMENT
+#define FIXED64_INSTRUMENT 0
+#endif
+
+namespace math::fp {
+
+// Events counted by the instrumentation, indices into Fixed64Counters
+enum class Fixed64Event : unsigned {
+    kMul,            // Primitives::Fixed64Mul
+    kMulOverflow,    // Product whose high 128-bit word does not fit the result
+    kDiv,            // Primitives::Fixed64Div
+    kDivOverflow,    // Quotient that saturated, including division by zero
+    kDivByZero,      // Zero divisor, also those operator/ handles without dividing
+    kDivNearZero,    // Nonzero divisor below 2^-(P/2), where the quotient keeps half the bits
+    kSqrt,           // Primitives::Fixed64Sqrt and Fixed64SqrtFast
+    kSinLookup,      // Sin, SinFast, SinPoly and the SinCos kernels
+    kTanLookup,      // Tan and TanFast kernels
+    kAtanLookup,     // Atan and AtanFast kernels
+    kAtan2Lookup,    // Atan2 ratio kernel
+    kAcosLookup,     // Acos kernel, also used by Asin
+    kExpLookup,      // Pow2 and Exp table kernels
+    kLogLookup,      // Log table kernel
+    kPowLookup,      // Pow table kernel
+    kFromString,     // Fixed64<P>::FromString
+    kParseError,     // FromString input that was not a complete number or out of range
+    kRangeClamp,     // Acos or Asin argument outside [-1, 1]
+    kAngleWrap,      // NormalizeAngle argument outside [0, 2pi)
+    kCount,
+};
+
+inline constexpr size_t kFixed64EventCount = static_cast<size_t>(Fixed64Event::kCount);
+
+/**
+ * @brief Event counts of one thread, as returned by Fixed64Instrumentation::Snapshot
+ *
+ * Snapshots of several threads add up with +=; Name gives a stable identifier per event for
+ * exporting the counts to a metrics system.
+ */
+struct Fixed64Counters {
+    std::array<uint64_t, kFixed64EventCount> counts{};
+
+    [[nodiscard]] constexpr auto operator[](Fixed64Event event) const noexcept -> uint64_t {
+        return counts[static_cast<size_t>(event)];
+    }
+
+    constexpr auto operator+=(const Fixed64Counters& other) noexcept -> Fixed64Counters& {
+        for (size_t i = 0; i < kFixed64EventCount; ++i) {
+            counts[i] += other.counts[i];
+        }
+        return *this;
+    }
+
+    [[nodiscard]] static constexpr auto Name(Fixed64Event event) noexcept -> std::string_view {
+        constexpr std::array<std::string_view, kFixed64EventCount> kNames = {
+            "mul", "mul_overflow", "div", "div_overflow", "div_by_zero", "div_near_zero", "sqrt",
+            "sin_lookup", "tan_lookup", "atan_lookup", "atan2_lookup", "acos_lookup", "exp_lookup",
+            "log_lookup", "pow_lookup", "from_string", "parse_error", "range_clamp", "angle_wrap",
+        };
+        const auto index = static_cast<size_t>(event);
+        return index < kFixed64EventCount ? kNames[index] : std::string_view();
+    }
+};
+
+/**
+ * @brief Opt-in counters of the hot paths, enabled with FIXED64_INSTRUMENT=1
+ *
+ * Every thread counts into its own counters, so the hooks need no synchronization; Snapshot and
+ * Reset act on the calling thread. The counts include the calls the library makes internally,
+ * e.g. the multiplies inside Atan, which is what a frame actually executes. Evaluation in
+ * constant expressions is never counted, and the batch kernels are not instrumented.
+ *
+ * Usage:
+ *   auto counters = Fixed64Instrumentation::Snapshot();
+ *   Fixed64Instrumentation::Reset();
+ *   for (size_t i = 0; i < kFixed64EventCount; ++i) {
+ *       auto event = static_cast<Fixed64Event>(i);
+ *       metrics.Set(Fixed64Counters::Name(event), counters[event]);
+ *   }
+ */
+class Fixed64Instrumentation {
+ public:
+    static constexpr bool kEnabled = FIXED64_INSTRUMENT != 0;
+
+    // Counts of the calling thread since it started or since its last Reset
+    [[nodiscard]] static auto Snapshot() noexcept -> Fixed64Counters {
+        if constexpr (kEnabled) {
+            return ThreadCounters();
+        } else {
+            return {};
+        }
+    }
+
+    // Zeroes the counts of the calling thread
+    static auto Reset() noexcept -> void {
+        if constexpr (kEnabled) {
+            ThreadCounters() = {};
+        }
+    }
+
+    // Adds count to event; compiles to nothing unless FIXED64_INSTRUMENT is enabled
+    static constexpr auto Record(Fixed64Event event, uint64_t count = 1) noexcept -> void {
+        if constexpr (kEnabled) {
+            if (!std::is_constant_evaluated()) {
+                ThreadCounters().counts[static_cast<size_t>(event)] += count;
+            }
+        }
+        (void)event;
+        (void)count;
+    }
+
+ private:
+    static auto ThreadCounters() noexcept -> Fixed64Counters& {
+        static thread_local Fixed64Counters counters;
+        return counters;
+    }
+};
+
+}  // namespace math::fp
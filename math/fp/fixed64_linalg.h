@@ -0,0 +1,599 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "fixed64.h"
+#include "fixed64_math.h"
+#include "primitives.h"
+
+namespace math::fp {
+
+namespace detail {
+// Linear algebra kernels operate on raw int64_t fixed-point values
+// Every dot product accumulates its exact 2P-fraction-bit products in 128 bits and rounds once
+// to P fraction bits (nearest, ties to even), so an N-term dot product carries 0.5 ulp of
+// error instead of the N truncations a chain of Fixed64 multiplications would accumulate
+
+template <int P, size_t N>
+constexpr auto DotRounded(const std::array<int64_t, N>& a, const std::array<int64_t, N>& b) noexcept
+    -> int64_t {
+    static_assert(P > 0 && P < 64, "Linear algebra requires 0 < P < 64");
+    uint64_t hi = 0;
+    uint64_t lo = 0;
+    for (size_t i = 0; i < N; ++i) {
+        Primitives::MulAdd128(a[i], b[i], hi, lo);
+    }
+    return Primitives::Round128(hi, lo, P);
+}
+
+// Scale v to unit length: the reciprocal length is computed with as many fraction bits as fit
+// (at least 30, up to 62) and each component is multiplied by it in 128 bits and rounded once,
+// so the result is accurate to about 1 ulp at P fraction bits however long v was. A vector
+// whose squared length rounds to zero is returned unchanged
+template <int P, size_t N>
+constexpr auto NormalizedRaw(std::array<int64_t, N> v) noexcept -> std::array<int64_t, N> {
+    const int64_t length_squared = DotRounded<P, N>(v, v);
+    if (length_squared <= 0) {
+        return v;
+    }
+    // Largest result format in which 1 / sqrt(length_squared) still fits below 2^63
+    const int odd_bits = P & 1;
+    const int k = (63 - Primitives::CountlZero(static_cast<uint64_t>(length_squared) << odd_bits))
+                  >> 1;
+    const int scale_bits = std::min(62, 62 + k - ((P + odd_bits) >> 1));
+    const int64_t scale = Primitives::Fixed64RSqrt(length_squared, P, scale_bits);
+    for (size_t i = 0; i < N; ++i) {
+        uint64_t hi = 0;
+        uint64_t lo = 0;
+        Primitives::MulAdd128(v[i], scale, hi, lo);
+        v[i] = Primitives::Round128(hi, lo, scale_bits);
+    }
+    return v;
+}
+
+// Two's complement negation that wraps instead of overflowing
+constexpr auto NegateRaw(int64_t v) noexcept -> int64_t {
+    return static_cast<int64_t>(0 - static_cast<uint64_t>(v));
+}
+
+template <int P>
+constexpr auto FromRaw(int64_t raw) noexcept -> Fixed64<P> {
+    return Fixed64<P>(raw, nothing{});
+}
+}  // namespace detail
+
+/**
+ * @brief Two-component fixed-point vector
+ *
+ * 16-byte aligned so a vector occupies exactly one 128-bit register.
+ */
+template <int P>
+struct alignas(16) Vec2 {
+    Fixed64<P> x;
+    Fixed64<P> y;
+
+    [[nodiscard]] static constexpr auto Zero() noexcept -> Vec2 {
+        return {};
+    }
+
+    /**
+     * @brief Dot product, accumulated in 128 bits and rounded once
+     */
+    [[nodiscard]] static constexpr auto Dot(const Vec2& a, const Vec2& b) noexcept -> Fixed64<P> {
+        return detail::FromRaw<P>(detail::DotRounded<P, 2>({a.x.value(), a.y.value()},
+                                                            {b.x.value(), b.y.value()}));
+    }
+
+    /**
+     * @brief Z component of the 3D cross product, a.x * b.y - a.y * b.x
+     */
+    [[nodiscard]] static constexpr auto Cross(const Vec2& a, const Vec2& b) noexcept
+        -> Fixed64<P> {
+        return detail::FromRaw<P>(detail::DotRounded<P, 2>(
+            {a.x.value(), a.y.value()}, {b.y.value(), detail::NegateRaw(b.x.value())}));
+    }
+
+    [[nodiscard]] constexpr auto LengthSquared() const noexcept -> Fixed64<P> {
+        return Dot(*this, *this);
+    }
+
+    /**
+     * @brief Correctly rounded length, from the exact 128-bit sum of squares
+     * @note Does not overflow like Sqrt(LengthSquared()) for lengths beyond sqrt(Max())
+     */
+    [[nodiscard]] constexpr auto Length() const noexcept -> Fixed64<P> {
+        return Fixed64Math::Hypot(x, y);
+    }
+
+    /**
+     * @brief Unit vector in the same direction
+     * @note Scales by a reciprocal length carrying up to 62 fraction bits and rounds each
+     * component once, a vector whose squared length rounds to zero is returned unchanged
+     */
+    [[nodiscard]] constexpr auto Normalized() const noexcept -> Vec2 {
+        const auto n = detail::NormalizedRaw<P, 2>({x.value(), y.value()});
+        return {detail::FromRaw<P>(n[0]), detail::FromRaw<P>(n[1])};
+    }
+
+    constexpr auto operator+=(const Vec2& o) noexcept -> Vec2& {
+        x += o.x;
+        y += o.y;
+        return *this;
+    }
+
+    constexpr auto operator-=(const Vec2& o) noexcept -> Vec2& {
+        x -= o.x;
+        y -= o.y;
+        return *this;
+    }
+
+    constexpr auto operator*=(Fixed64<P> s) noexcept -> Vec2& {
+        x *= s;
+        y *= s;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto operator-() const noexcept -> Vec2 {
+        return {-x, -y};
+    }
+
+    [[nodiscard]] friend constexpr auto operator+(Vec2 a, const Vec2& b) noexcept -> Vec2 {
+        return a += b;
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(Vec2 a, const Vec2& b) noexcept -> Vec2 {
+        return a -= b;
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(Vec2 a, Fixed64<P> s) noexcept -> Vec2 {
+        return a *= s;
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(Fixed64<P> s, Vec2 a) noexcept -> Vec2 {
+        return a *= s;
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const Vec2& a, const Vec2& b) noexcept
+        -> bool = default;
+};
+
+/**
+ * @brief Three-component fixed-point vector
+ *
+ * 32-byte aligned (one padding lane) so a vector occupies exactly one 256-bit register and
+ * arrays of vectors never straddle a register boundary.
+ */
+template <int P>
+struct alignas(32) Vec3 {
+    Fixed64<P> x;
+    Fixed64<P> y;
+    Fixed64<P> z;
+
+    [[nodiscard]] static constexpr auto Zero() noexcept -> Vec3 {
+        return {};
+    }
+
+    /**
+     * @brief Dot product, accumulated in 128 bits and rounded once
+     */
+    [[nodiscard]] static constexpr auto Dot(const Vec3& a, const Vec3& b) noexcept -> Fixed64<P> {
+        return detail::FromRaw<P>(detail::DotRounded<P, 3>(
+            {a.x.value(), a.y.value(), a.z.value()}, {b.x.value(), b.y.value(), b.z.value()}));
+    }
+
+    /**
+     * @brief Cross product, each component is a two-term difference rounded once
+     */
+    [[nodiscard]] static constexpr auto Cross(const Vec3& a, const Vec3& b) noexcept -> Vec3 {
+        using detail::DotRounded;
+        using detail::NegateRaw;
+        return {detail::FromRaw<P>(DotRounded<P, 2>({a.y.value(), a.z.value()},
+                                                    {b.z.value(), NegateRaw(b.y.value())})),
+                detail::FromRaw<P>(DotRounded<P, 2>({a.z.value(), a.x.value()},
+                                                    {b.x.value(), NegateRaw(b.z.value())})),
+                detail::FromRaw<P>(DotRounded<P, 2>({a.x.value(), a.y.value()},
+                                                    {b.y.value(), NegateRaw(b.x.value())}))};
+    }
+
+    [[nodiscard]] constexpr auto LengthSquared() const noexcept -> Fixed64<P> {
+        return Dot(*this, *this);
+    }
+
+    /**
+     * @brief Correctly rounded length, from the exact 128-bit sum of squares
+     */
+    [[nodiscard]] constexpr auto Length() const noexcept -> Fixed64<P> {
+        return Fixed64Math::Hypot3(x, y, z);
+    }
+
+    /**
+     * @brief Unit vector in the same direction
+     * @note Scales by a reciprocal length carrying up to 62 fraction bits and rounds each
+     * component once, a vector whose squared length rounds to zero is returned unchanged
+     */
+    [[nodiscard]] constexpr auto Normalized() const noexcept -> Vec3 {
+        const auto n = detail::NormalizedRaw<P, 3>({x.value(), y.value(), z.value()});
+        return {detail::FromRaw<P>(n[0]), detail::FromRaw<P>(n[1]), detail::FromRaw<P>(n[2])};
+    }
+
+    constexpr auto operator+=(const Vec3& o) noexcept -> Vec3& {
+        x += o.x;
+        y += o.y;
+        z += o.z;
+        return *this;
+    }
+
+    constexpr auto operator-=(const Vec3& o) noexcept -> Vec3& {
+        x -= o.x;
+        y -= o.y;
+        z -= o.z;
+        return *this;
+    }
+
+    constexpr auto operator*=(Fixed64<P> s) noexcept -> Vec3& {
+        x *= s;
+        y *= s;
+        z *= s;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto operator-() const noexcept -> Vec3 {
+        return {-x, -y, -z};
+    }
+
+    [[nodiscard]] friend constexpr auto operator+(Vec3 a, const Vec3& b) noexcept -> Vec3 {
+        return a += b;
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(Vec3 a, const Vec3& b) noexcept -> Vec3 {
+        return a -= b;
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(Vec3 a, Fixed64<P> s) noexcept -> Vec3 {
+        return a *= s;
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(Fixed64<P> s, Vec3 a) noexcept -> Vec3 {
+        return a *= s;
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const Vec3& a, const Vec3& b) noexcept
+        -> bool = default;
+};
+
+/**
+ * @brief Four-component fixed-point vector
+ *
+ * 32-byte aligned so a vector occupies exactly one 256-bit register.
+ */
+template <int P>
+struct alignas(32) Vec4 {
+    Fixed64<P> x;
+    Fixed64<P> y;
+    Fixed64<P> z;
+    Fixed64<P> w;
+
+    [[nodiscard]] static constexpr auto Zero() noexcept -> Vec4 {
+        return {};
+    }
+
+    /**
+     * @brief Dot product, accumulated in 128 bits and rounded once
+     */
+    [[nodiscard]] static constexpr auto Dot(const Vec4& a, const Vec4& b) noexcept -> Fixed64<P> {
+        return detail::FromRaw<P>(
+            detail::DotRounded<P, 4>({a.x.value(), a.y.value(), a.z.value(), a.w.value()},
+                                     {b.x.value(), b.y.value(), b.z.value(), b.w.value()}));
+    }
+
+    [[nodiscard]] constexpr auto LengthSquared() const noexcept -> Fixed64<P> {
+        return Dot(*this, *this);
+    }
+
+    /**
+     * @brief Correctly rounded length, from the exact 128-bit sum of squares
+     */
+    [[nodiscard]] constexpr auto Length() const noexcept -> Fixed64<P> {
+        if (x == Fixed64<P>::NaN() || y == Fixed64<P>::NaN() || z == Fixed64<P>::NaN() ||
+            w == Fixed64<P>::NaN()) {
+            return Fixed64<P>::NaN();
+        }
+        return detail::FromRaw<P>(detail::HypotRaw<4>({detail::AbsRaw(x.value()),
+                                                       detail::AbsRaw(y.value()),
+                                                       detail::AbsRaw(z.value()),
+                                                       detail::AbsRaw(w.value())}));
+    }
+
+    /**
+     * @brief Unit vector in the same direction
+     * @note Scales by a reciprocal length carrying up to 62 fraction bits and rounds each
+     * component once, a vector whose squared length rounds to zero is returned unchanged
+     */
+    [[nodiscard]] constexpr auto Normalized() const noexcept -> Vec4 {
+        const auto n = detail::NormalizedRaw<P, 4>({x.value(), y.value(), z.value(), w.value()});
+        return {detail::FromRaw<P>(n[0]), detail::FromRaw<P>(n[1]), detail::FromRaw<P>(n[2]),
+                detail::FromRaw<P>(n[3])};
+    }
+
+    constexpr auto operator+=(const Vec4& o) noexcept -> Vec4& {
+        x += o.x;
+        y += o.y;
+        z += o.z;
+        w += o.w;
+        return *this;
+    }
+
+    constexpr auto operator-=(const Vec4& o) noexcept -> Vec4& {
+        x -= o.x;
+        y -= o.y;
+        z -= o.z;
+        w -= o.w;
+        return *this;
+    }
+
+    constexpr auto operator*=(Fixed64<P> s) noexcept -> Vec4& {
+        x *= s;
+        y *= s;
+        z *= s;
+        w *= s;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto operator-() const noexcept -> Vec4 {
+        return {-x, -y, -z, -w};
+    }
+
+    [[nodiscard]] friend constexpr auto operator+(Vec4 a, const Vec4& b) noexcept -> Vec4 {
+        return a += b;
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(Vec4 a, const Vec4& b) noexcept -> Vec4 {
+        return a -= b;
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(Vec4 a, Fixed64<P> s) noexcept -> Vec4 {
+        return a *= s;
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(Fixed64<P> s, Vec4 a) noexcept -> Vec4 {
+        return a *= s;
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const Vec4& a, const Vec4& b) noexcept
+        -> bool = default;
+};
+
+/**
+ * @brief Row-major 3x3 fixed-point matrix
+ *
+ * Each row is an aligned Vec3, so a matrix-vector product is three 128-bit-accumulated dot
+ * products.
+ */
+template <int P>
+struct Mat3 {
+    std::array<Vec3<P>, 3> rows;
+
+    [[nodiscard]] static constexpr auto Zero() noexcept -> Mat3 {
+        return {};
+    }
+
+    [[nodiscard]] static constexpr auto Identity() noexcept -> Mat3 {
+        const Fixed64<P> one = Fixed64<P>::One();
+        const Fixed64<P> zero = Fixed64<P>::Zero();
+        return {{{{one, zero, zero}, {zero, one, zero}, {zero, zero, one}}}};
+    }
+
+    [[nodiscard]] constexpr auto Column(size_t j) const noexcept -> Vec3<P> {
+        return {Get(rows[0], j), Get(rows[1], j), Get(rows[2], j)};
+    }
+
+    [[nodiscard]] constexpr auto Transposed() const noexcept -> Mat3 {
+        return {{{Column(0), Column(1), Column(2)}}};
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(const Mat3& m, const Vec3<P>& v) noexcept
+        -> Vec3<P> {
+        return {Vec3<P>::Dot(m.rows[0], v), Vec3<P>::Dot(m.rows[1], v),
+                Vec3<P>::Dot(m.rows[2], v)};
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(const Mat3& a, const Mat3& b) noexcept -> Mat3 {
+        const Mat3 bt = b.Transposed();
+        Mat3 result;
+        for (size_t i = 0; i < 3; ++i) {
+            result.rows[i] = bt * a.rows[i];
+        }
+        return result;
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const Mat3& a, const Mat3& b) noexcept
+        -> bool = default;
+
+ private:
+    static constexpr auto Get(const Vec3<P>& v, size_t j) noexcept -> Fixed64<P> {
+        return j == 0 ? v.x : (j == 1 ? v.y : v.z);
+    }
+};
+
+/**
+ * @brief Row-major 4x4 fixed-point matrix
+ *
+ * Each row is an aligned Vec4, so a matrix-vector product is four 128-bit-accumulated dot
+ * products.
+ */
+template <int P>
+struct Mat4 {
+    std::array<Vec4<P>, 4> rows;
+
+    [[nodiscard]] static constexpr auto Zero() noexcept -> Mat4 {
+        return {};
+    }
+
+    [[nodiscard]] static constexpr auto Identity() noexcept -> Mat4 {
+        const Fixed64<P> one = Fixed64<P>::One();
+        const Fixed64<P> zero = Fixed64<P>::Zero();
+        return {{{{one, zero, zero, zero},
+                  {zero, one, zero, zero},
+                  {zero, zero, one, zero},
+                  {zero, zero, zero, one}}}};
+    }
+
+    [[nodiscard]] constexpr auto Column(size_t j) const noexcept -> Vec4<P> {
+        return {Get(rows[0], j), Get(rows[1], j), Get(rows[2], j), Get(rows[3], j)};
+    }
+
+    [[nodiscard]] constexpr auto Transposed() const noexcept -> Mat4 {
+        return {{{Column(0), Column(1), Column(2), Column(3)}}};
+    }
+
+    /**
+     * @brief Transform a point (w = 1) by an affine matrix, ignoring the projective row
+     */
+    [[nodiscard]] constexpr auto TransformPoint(const Vec3<P>& p) const noexcept -> Vec3<P> {
+        const Vec4<P> r = *this * Vec4<P>{p.x, p.y, p.z, Fixed64<P>::One()};
+        return {r.x, r.y, r.z};
+    }
+
+    /**
+     * @brief Transform a direction (w = 0), the translation column does not apply
+     */
+    [[nodiscard]] constexpr auto TransformVector(const Vec3<P>& v) const noexcept -> Vec3<P> {
+        const Vec4<P> r = *this * Vec4<P>{v.x, v.y, v.z, Fixed64<P>::Zero()};
+        return {r.x, r.y, r.z};
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(const Mat4& m, const Vec4<P>& v) noexcept
+        -> Vec4<P> {
+        return {Vec4<P>::Dot(m.rows[0], v), Vec4<P>::Dot(m.rows[1], v),
+                Vec4<P>::Dot(m.rows[2], v), Vec4<P>::Dot(m.rows[3], v)};
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(const Mat4& a, const Mat4& b) noexcept -> Mat4 {
+        const Mat4 bt = b.Transposed();
+        Mat4 result;
+        for (size_t i = 0; i < 4; ++i) {
+            result.rows[i] = bt * a.rows[i];
+        }
+        return result;
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const Mat4& a, const Mat4& b) noexcept
+        -> bool = default;
+
+ private:
+    static constexpr auto Get(const Vec4<P>& v, size_t j) noexcept -> Fixed64<P> {
+        return j == 0 ? v.x : (j == 1 ? v.y : (j == 2 ? v.z : v.w));
+    }
+};
+
+/**
+ * @brief Fixed-point quaternion x*i + y*j + z*k + w
+ *
+ * Same layout as Vec4, 32-byte aligned. Every component of a product is a four-term dot
+ * product rounded once.
+ */
+template <int P>
+struct alignas(32) Quat {
+    Fixed64<P> x;
+    Fixed64<P> y;
+    Fixed64<P> z;
+    Fixed64<P> w;
+
+    [[nodiscard]] static constexpr auto Identity() noexcept -> Quat {
+        return {Fixed64<P>::Zero(), Fixed64<P>::Zero(), Fixed64<P>::Zero(), Fixed64<P>::One()};
+    }
+
+    /**
+     * @brief Rotation of angle radians around a unit axis
+     */
+    [[nodiscard]] static constexpr auto FromAxisAngle(const Vec3<P>& axis,
+                                                      Fixed64<P> angle) noexcept -> Quat {
+        const auto [s, c] = Fixed64Math::SinCos(angle / 2);
+        return {axis.x * s, axis.y * s, axis.z * s, c};
+    }
+
+    [[nodiscard]] static constexpr auto Dot(const Quat& a, const Quat& b) noexcept
+        -> Fixed64<P> {
+        return detail::FromRaw<P>(
+            detail::DotRounded<P, 4>({a.x.value(), a.y.value(), a.z.value(), a.w.value()},
+                                     {b.x.value(), b.y.value(), b.z.value(), b.w.value()}));
+    }
+
+    [[nodiscard]] constexpr auto Conjugate() const noexcept -> Quat {
+        return {-x, -y, -z, w};
+    }
+
+    /**
+     * @brief Unit quaternion, normalized like Vec4::Normalized
+     * @note A quaternion whose squared norm rounds to zero is returned unchanged
+     */
+    [[nodiscard]] constexpr auto Normalized() const noexcept -> Quat {
+        const auto n = detail::NormalizedRaw<P, 4>({x.value(), y.value(), z.value(), w.value()});
+        return {detail::FromRaw<P>(n[0]), detail::FromRaw<P>(n[1]), detail::FromRaw<P>(n[2]),
+                detail::FromRaw<P>(n[3])};
+    }
+
+    /**
+     * @brief Rotate a vector by a unit quaternion, v + w * t + u x t with t = 2 * (u x v)
+     */
+    [[nodiscard]] constexpr auto Rotate(const Vec3<P>& v) const noexcept -> Vec3<P> {
+        const Vec3<P> u{x, y, z};
+        const Vec3<P> uv = Vec3<P>::Cross(u, v);
+        const Vec3<P> t = uv + uv;
+        return v + t * w + Vec3<P>::Cross(u, t);
+    }
+
+    /**
+     * @brief Equivalent rotation matrix of a unit quaternion
+     */
+    [[nodiscard]] constexpr auto ToMat3() const noexcept -> Mat3<P> {
+        using detail::DotRounded;
+        using detail::FromRaw;
+        using detail::NegateRaw;
+        const int64_t qx = x.value();
+        const int64_t qy = y.value();
+        const int64_t qz = z.value();
+        const int64_t qw = w.value();
+        const Fixed64<P> one = Fixed64<P>::One();
+        const Fixed64<P> xx_yy = FromRaw<P>(DotRounded<P, 2>({qx, qy}, {qx, qy}));
+        const Fixed64<P> xx_zz = FromRaw<P>(DotRounded<P, 2>({qx, qz}, {qx, qz}));
+        const Fixed64<P> yy_zz = FromRaw<P>(DotRounded<P, 2>({qy, qz}, {qy, qz}));
+        const Fixed64<P> xy_mwz = FromRaw<P>(DotRounded<P, 2>({qx, qw}, {qy, NegateRaw(qz)}));
+        const Fixed64<P> xy_pwz = FromRaw<P>(DotRounded<P, 2>({qx, qw}, {qy, qz}));
+        const Fixed64<P> xz_mwy = FromRaw<P>(DotRounded<P, 2>({qx, qw}, {qz, NegateRaw(qy)}));
+        const Fixed64<P> xz_pwy = FromRaw<P>(DotRounded<P, 2>({qx, qw}, {qz, qy}));
+        const Fixed64<P> yz_mwx = FromRaw<P>(DotRounded<P, 2>({qy, qw}, {qz, NegateRaw(qx)}));
+        const Fixed64<P> yz_pwx = FromRaw<P>(DotRounded<P, 2>({qy, qw}, {qz, qx}));
+        return {{{{one - 2 * yy_zz, 2 * xy_mwz, 2 * xz_pwy},
+                  {2 * xy_pwz, one - 2 * xx_zz, 2 * yz_mwx},
+                  {2 * xz_mwy, 2 * yz_pwx, one - 2 * xx_yy}}}};
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(const Quat& a, const Quat& b) noexcept
+        -> Quat {
+        using detail::DotRounded;
+        using detail::FromRaw;
+        using detail::NegateRaw;
+        const int64_t ax = a.x.value();
+        const int64_t ay = a.y.value();
+        const int64_t az = a.z.value();
+        const int64_t aw = a.w.value();
+        const int64_t bx = b.x.value();
+        const int64_t by = b.y.value();
+        const int64_t bz = b.z.value();
+        const int64_t bw = b.w.value();
+        return {FromRaw<P>(DotRounded<P, 4>({aw, ax, ay, az}, {bx, bw, bz, NegateRaw(by)})),
+                FromRaw<P>(DotRounded<P, 4>({aw, ax, ay, az}, {by, NegateRaw(bz), bw, bx})),
+                FromRaw<P>(DotRounded<P, 4>({aw, ax, ay, az}, {bz, by, NegateRaw(bx), bw})),
+                FromRaw<P>(DotRounded<P, 4>(
+                    {aw, ax, ay, az}, {bw, NegateRaw(bx), NegateRaw(by), NegateRaw(bz)}))};
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const Quat& a, const Quat& b) noexcept
+        -> bool = default;
+};
+
+}  // namespace math::fp
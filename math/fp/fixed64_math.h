@@ -2,16 +2,29 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <array>
 #include <concepts>
+#include <span>
 #include <type_traits>
+#include <utility>
 
 #include "detail/acos_lut.h"
 #include "detail/atan2_lut.h"
 #include "detail/atan_lut.h"
+#include "detail/batch_kernels.h"
+#include "detail/chunk_pool.h"
+#include "detail/cordic.h"
+#include "detail/exp_lut.h"
+#include "detail/lut_prefetch.h"
+#include "detail/raw_words.h"
 #include "detail/sin_lut.h"
+#include "detail/sin_poly.h"
 #include "detail/tan_lut.h"
+#include "detail/trig_batch.h"
 #include "fixed64.h"
+#include "fixed64_accumulator.h"
+#include "fixed64_execution.h"
 #include "primitives.h"
 
 // Configuration macros for trigonometric function precision
@@ -19,19 +32,77 @@
 #define FIXED64_MATH_USE_FAST_TRIG 1  // Default to fast implementation
 #endif
 
+// Segmented polynomial backend for Sin, Cos, SinCos and their batch versions: a 384-byte
+// coefficient table instead of the 4 KB sine table, nearly correctly rounded at Q31.32.
+// Takes precedence over FIXED64_MATH_USE_FAST_TRIG for these functions
+#ifndef FIXED64_MATH_USE_POLY_SIN
+#define FIXED64_MATH_USE_POLY_SIN 0
+#endif
+
+// CORDIC backend (see Fixed64Math::Cordic) for Sin, Cos, SinCos, Atan2 and their batch
+// versions: shift-and-add iterations instead of table interpolation, accurate to the last bit
+// of Fixed64<40> and above. Takes precedence over the other trigonometry macros
+#ifndef FIXED64_MATH_USE_CORDIC
+#define FIXED64_MATH_USE_CORDIC 0
+#endif
+
+// Table-driven backend for Pow2, Exp, Log and Pow (Q61.2 to Q7.56): 64-entry 2^(i/64) and log2
+// tables with short remainder polynomials instead of series and Pade approximations, about a
+// third of the wide multiplies and no divisions, and more precise
+#ifndef FIXED64_MATH_USE_LUT_EXP
+#define FIXED64_MATH_USE_LUT_EXP 0
+#endif
+
 namespace math::fp {
 
-constexpr int kTrigFractionBits =
-    32;  // Minimum precision required for trigonometric lookup table implementation
+// Precision of the trigonometric lookup tables: finer formats are truncated to it, coarser
+// formats convert without loss, so the trigonometric functions support any precision
+constexpr int kTrigFractionBits = detail::kLutFractionBits;
+
+namespace detail {
+
+// |a - b| of two raw values, exact for any pair
+constexpr auto AbsDiffRaw(int64_t a, int64_t b) noexcept -> uint64_t {
+    return a >= b ? static_cast<uint64_t>(a) - static_cast<uint64_t>(b)
+                  : static_cast<uint64_t>(b) - static_cast<uint64_t>(a);
+}
+
+constexpr auto AbsRaw(int64_t a) noexcept -> uint64_t {
+    return a >= 0 ? static_cast<uint64_t>(a) : 0 - static_cast<uint64_t>(a);
+}
+
+// sqrt(m[0]^2 + ... + m[N-1]^2) rounded to nearest, from the exact 128-bit sum of squares:
+// up to four magnitudes below 2^63 sum below 2^128. INT64_MAX (Infinity) when out of range
+template <size_t N>
+constexpr auto HypotRaw(const std::array<uint64_t, N>& m) noexcept -> int64_t {
+    static_assert(N >= 1 && N <= 4, "The sum of squares must fit in 128 bits");
+    uint64_t hi = 0;
+    uint64_t lo = 0;
+    for (size_t i = 0; i < N; ++i) {
+        if (m[i] > static_cast<uint64_t>(INT64_MAX)) {
+            return INT64_MAX;
+        }
+        uint64_t square_hi, square_lo;
+        umul_ppmm(square_hi, square_lo, m[i], m[i]);
+        lo += square_lo;
+        hi += square_hi + ((lo < square_lo) ? 1 : 0);
+    }
+    const uint64_t root = Primitives::SqrtU128(hi, lo);
+    return root > static_cast<uint64_t>(INT64_MAX) ? INT64_MAX : static_cast<int64_t>(root);
+}
+
+}  // namespace detail
 
 /**
  * @brief Fixed-point number mathematical operations library
  *
  * Provides the following features:
- * - Basic trigonometric functions (only supports Q31.32 format)
+ * - Basic trigonometric functions (any precision, through Q31.32 lookup tables)
  * - General mathematical operations (supports arbitrary precision)
  * - Interpolation functions (linear interpolation, angle interpolation, spherical interpolation)
+ * - Polynomial (Estrin and Horner) and cubic spline (Hermite, Catmull-Rom) evaluation
  * - Numerical conversion utilities
+ * - Lookup table prefetch and warm-up
  */
 class Fixed64Math {
  public:
@@ -49,7 +120,11 @@ class Fixed64Math {
      * provides overflow protection
      */
     template <int P>
-    [[nodiscard]] static auto Pow2(Fixed64<P> x) noexcept -> Fixed64<P> {
+    [[nodiscard]] static constexpr auto Pow2(Fixed64<P> x) noexcept -> Fixed64<P> {
+        if constexpr (FIXED64_MATH_USE_LUT_EXP && detail::kExpLutSupported<P>) {
+            return Fixed64<P>(detail::LookupPow2<P>(x.value()), detail::nothing{});
+        }
+
         // Overflow protection
         constexpr int MaxExponent = 63 - P;
         constexpr int MinExponent = -63 + P;
@@ -140,7 +215,7 @@ class Fixed64Math {
      * @return Natural logarithm value
      */
     template <int P>
-    [[nodiscard]] static auto Log(Fixed64<P> x) noexcept -> Fixed64<P> {
+    [[nodiscard]] static constexpr auto Log(Fixed64<P> x) noexcept -> Fixed64<P> {
         // Handle special cases
         if (x <= Fixed64<P>::Zero()) {
             return Fixed64<P>::Min();  // Return minimum value to indicate error
@@ -150,6 +225,10 @@ class Fixed64Math {
             return Fixed64<P>::Zero();
         }
 
+        if constexpr (FIXED64_MATH_USE_LUT_EXP && detail::kExpLutSupported<P>) {
+            return Fixed64<P>(detail::LookupLog<P>(x.value()), detail::nothing{});
+        }
+
         // 1. Find the position of the most significant bit
         const uint64_t u_x = static_cast<uint64_t>(x.value());
         const int msb = 63 - Primitives::CountlZero(u_x);
@@ -202,7 +281,7 @@ class Fixed64Math {
      * @return x raised to the power of y
      */
     template <int P>
-    [[nodiscard]] static auto Pow(Fixed64<P> x, Fixed64<P> y) noexcept -> Fixed64<P> {
+    [[nodiscard]] static constexpr auto Pow(Fixed64<P> x, Fixed64<P> y) noexcept -> Fixed64<P> {
         // Handle special cases
         if (x <= Fixed64<P>::Zero()) {
             // Only calculate when y is an integer and x is negative
@@ -211,7 +290,7 @@ class Fixed64Math {
                 // If y is odd, result is -|x|^y
                 bool isYEven = (static_cast<int>(y) % 2 == 0);
                 auto absX = Abs(x);
-                auto result = Exp(y * Log(absX));
+                auto result = ExpLog(absX, y);
                 return isYEven ? result : -result;
             }
             return Fixed64<P>::Zero();  // Undefined for negative base with non-integer exponent
@@ -230,7 +309,7 @@ class Fixed64Math {
         }
 
         // Use logarithm: x^y = e^(y*ln(x))
-        return Exp(y * Log(x));
+        return ExpLog(x, y);
     }
 
     /**
@@ -242,7 +321,8 @@ class Fixed64Math {
      */
     template <int P, typename UnsignedIntegralType>
         requires std::unsigned_integral<UnsignedIntegralType>
-    [[nodiscard]] static auto Pow(Fixed64<P> x, UnsignedIntegralType u) noexcept -> Fixed64<P> {
+    [[nodiscard]] static constexpr auto Pow(Fixed64<P> x, UnsignedIntegralType u) noexcept
+        -> Fixed64<P> {
         // Handle special cases
         if (u == static_cast<UnsignedIntegralType>(0)) {
             return Fixed64<P>::One();
@@ -278,7 +358,8 @@ class Fixed64Math {
      */
     template <int P, typename SignedIntegralType>
         requires std::signed_integral<SignedIntegralType>
-    [[nodiscard]] static auto Pow(Fixed64<P> x, SignedIntegralType n) noexcept -> Fixed64<P> {
+    [[nodiscard]] static constexpr auto Pow(Fixed64<P> x, SignedIntegralType n) noexcept
+        -> Fixed64<P> {
         // Handle special cases
         if (n < static_cast<SignedIntegralType>(0)) {
             return Fixed64<P>::One()
@@ -314,7 +395,11 @@ class Fixed64Math {
      * @return e^x
      */
     template <int P>
-    [[nodiscard]] static auto Exp(Fixed64<P> x) noexcept -> Fixed64<P> {
+    [[nodiscard]] static constexpr auto Exp(Fixed64<P> x) noexcept -> Fixed64<P> {
+        if constexpr (FIXED64_MATH_USE_LUT_EXP && detail::kExpLutSupported<P>) {
+            return Fixed64<P>(detail::LookupExp<P>(x.value()), detail::nothing{});
+        }
+
         // Handle overflow cases
         if (x > Fixed64<P>(30)) {
             return Fixed64<P>::Max();
@@ -409,7 +494,7 @@ class Fixed64Math {
         }
     }
 
-    // === Basic trigonometric functions (supports Q31.32 format and above) ===
+    // === Basic trigonometric functions (Q31.32 lookup tables, any precision) ===
 
     /**
      * @brief Calculate sine value
@@ -417,12 +502,15 @@ class Fixed64Math {
      * @return Sine value [-1,1]
      */
     template <int P>
-        requires(P >= kTrigFractionBits)
-    [[nodiscard]] static auto Sin(Fixed64<P> x) noexcept -> Fixed64<P> {
-        if constexpr (FIXED64_MATH_USE_FAST_TRIG) {
-            return Fixed64<P>(detail::LookupSinFast(x.value(), P), detail::nothing{});
+    [[nodiscard]] static constexpr auto Sin(Fixed64<P> x) noexcept -> Fixed64<P> {
+        if constexpr (FIXED64_MATH_USE_CORDIC && P >= 3 && P <= 62) {
+            return Cordic::Sin(x);
+        } else if constexpr (FIXED64_MATH_USE_POLY_SIN) {
+            return Fixed64<P>(detail::LookupSinPoly<P>(x.value()), detail::nothing{});
+        } else if constexpr (FIXED64_MATH_USE_FAST_TRIG) {
+            return Fixed64<P>(detail::LookupSinFast<P>(x.value()), detail::nothing{});
         } else {
-            return Fixed64<P>(detail::LookupSin(x.value(), P), detail::nothing{});
+            return Fixed64<P>(detail::LookupSin<P>(x.value()), detail::nothing{});
         }
     }
 
@@ -432,9 +520,37 @@ class Fixed64Math {
      * @return Cosine value [-1,1]
      */
     template <int P>
-        requires(P >= kTrigFractionBits)
-    [[nodiscard]] static auto Cos(Fixed64<P> x) noexcept -> Fixed64<P> {
-        return Sin(x + Fixed64<P>::HalfPi());
+    [[nodiscard]] static constexpr auto Cos(Fixed64<P> x) noexcept -> Fixed64<P> {
+        if constexpr (FIXED64_MATH_USE_CORDIC && P >= 3 && P <= 62) {
+            return Cordic::Cos(x);
+        } else {
+            return Sin(x + Fixed64<P>::HalfPi());
+        }
+    }
+
+    /**
+     * @brief Calculate sine and cosine values together
+     * @param x Angle (in radians)
+     * @return Pair of (sine, cosine) values [-1,1]
+     * @note Reduces the angle once and reads cosine from the mirrored table index, which is
+     * cheaper than calling Sin and Cos separately. The sine value is identical to Sin(x); the
+     * cosine value has the same precision as Cos(x) but may differ from it in the last bits.
+     */
+    template <int P>
+    [[nodiscard]] static constexpr auto SinCos(Fixed64<P> x) noexcept
+        -> std::pair<Fixed64<P>, Fixed64<P>> {
+        if constexpr (FIXED64_MATH_USE_CORDIC && P >= 3 && P <= 62) {
+            return Cordic::SinCos(x);
+        } else if constexpr (FIXED64_MATH_USE_POLY_SIN) {
+            const auto [s, c] = detail::LookupSinCosPoly<P>(x.value());
+            return {Fixed64<P>(s, detail::nothing{}), Fixed64<P>(c, detail::nothing{})};
+        } else if constexpr (FIXED64_MATH_USE_FAST_TRIG) {
+            const auto [s, c] = detail::LookupSinCosFast<P>(x.value());
+            return {Fixed64<P>(s, detail::nothing{}), Fixed64<P>(c, detail::nothing{})};
+        } else {
+            const auto [s, c] = detail::LookupSinCos<P>(x.value());
+            return {Fixed64<P>(s, detail::nothing{}), Fixed64<P>(c, detail::nothing{})};
+        }
     }
 
     /**
@@ -443,12 +559,80 @@ class Fixed64Math {
      * @return Tangent value
      */
     template <int P>
-        requires(P >= kTrigFractionBits)
-    [[nodiscard]] static auto Tan(Fixed64<P> x) noexcept -> Fixed64<P> {
+    [[nodiscard]] static constexpr auto Tan(Fixed64<P> x) noexcept -> Fixed64<P> {
         if constexpr (FIXED64_MATH_USE_FAST_TRIG) {
-            return Fixed64<P>(detail::LookupTanFast(x.value(), P), detail::nothing{});
+            return Fixed64<P>(detail::LookupTanFast<P>(x.value()), detail::nothing{});
+        } else {
+            return Fixed64<P>(detail::LookupTan<P>(x.value()), detail::nothing{});
+        }
+    }
+
+    /**
+     * @brief Calculate sine values of an array of angles: out[i] = Sin(x[i])
+     * @param x Angles (in radians)
+     * @param out Destination span, may alias x exactly
+     * @note Results are bit-identical to Sin. Without SIMD support (see FIXED64_BATCH_USE_SIMD)
+     * this is a plain loop over Sin. Processes min(x.size(), out.size()) elements
+     */
+    template <int P>
+    static auto SinBatch(std::span<const Fixed64<P>> x, std::span<Fixed64<P>> out) noexcept
+        -> void {
+        const size_t count = std::min(x.size(), out.size());
+        const int64_t* px = detail::RawWords(x);
+        int64_t* po = detail::RawWords(out);
+        size_t i = 0;
+        if constexpr (FIXED64_MATH_USE_CORDIC && P >= 3 && P <= 62) {
+            // Scalar CORDIC iterations on every element
+        } else if constexpr (FIXED64_MATH_USE_POLY_SIN) {
+            i = detail::SinPolyBatch<P>(px, 0, po, count);
         } else {
-            return Fixed64<P>(detail::LookupTan(x.value(), P), detail::nothing{});
+            i = detail::SinBatch<P, FIXED64_MATH_USE_FAST_TRIG != 0>(px, 0, po, count);
+        }
+        for (; i < count; ++i) {
+            out[i] = Sin(x[i]);
+        }
+    }
+
+    /**
+     * @brief Calculate cosine values of an array of angles: out[i] = Cos(x[i])
+     * @param x Angles (in radians)
+     * @param out Destination span, may alias x exactly
+     * @note Results are bit-identical to Cos. Processes min(x.size(), out.size()) elements
+     */
+    template <int P>
+    static auto CosBatch(std::span<const Fixed64<P>> x, std::span<Fixed64<P>> out) noexcept
+        -> void {
+        const size_t count = std::min(x.size(), out.size());
+        const int64_t* px = detail::RawWords(x);
+        int64_t* po = detail::RawWords(out);
+        const int64_t offset = Fixed64<P>::HalfPi().value();
+        size_t i = 0;
+        if constexpr (FIXED64_MATH_USE_CORDIC && P >= 3 && P <= 62) {
+            // Scalar CORDIC iterations on every element
+        } else if constexpr (FIXED64_MATH_USE_POLY_SIN) {
+            i = detail::SinPolyBatch<P>(px, offset, po, count);
+        } else {
+            i = detail::SinBatch<P, FIXED64_MATH_USE_FAST_TRIG != 0>(px, offset, po, count);
+        }
+        for (; i < count; ++i) {
+            out[i] = Cos(x[i]);
+        }
+    }
+
+    /**
+     * @brief Calculate tangent values of an array of angles: out[i] = Tan(x[i])
+     * @param x Angles (in radians)
+     * @param out Destination span, may alias x exactly
+     * @note Results are bit-identical to Tan. Processes min(x.size(), out.size()) elements
+     */
+    template <int P>
+    static auto TanBatch(std::span<const Fixed64<P>> x, std::span<Fixed64<P>> out) noexcept
+        -> void {
+        const size_t count = std::min(x.size(), out.size());
+        size_t i = detail::TanBatch<P, FIXED64_MATH_USE_FAST_TRIG != 0>(
+            detail::RawWords(x), detail::RawWords(out), count);
+        for (; i < count; ++i) {
+            out[i] = Tan(x[i]);
         }
     }
 
@@ -459,16 +643,17 @@ class Fixed64Math {
      * @note For values outside [-1,1]: returns 0 if x>1, returns π if x<-1
      */
     template <int P>
-        requires(P >= kTrigFractionBits)
-    [[nodiscard]] static auto Acos(Fixed64<P> x) noexcept -> Fixed64<P> {
+    [[nodiscard]] static constexpr auto Acos(Fixed64<P> x) noexcept -> Fixed64<P> {
         if (x > Fixed64<P>::One()) {
+            Fixed64Instrumentation::Record(Fixed64Event::kRangeClamp);
             return Fixed64<P>::Zero();
         }
         if (x < -Fixed64<P>::One()) {
+            Fixed64Instrumentation::Record(Fixed64Event::kRangeClamp);
             return Fixed64<P>::Pi();
         }
 
-        return Fixed64<P>(detail::LookupAcos(x.value(), P), detail::nothing{});
+        return Fixed64<P>(detail::LookupAcos<P>(x.value()), detail::nothing{});
     }
 
     /**
@@ -478,12 +663,13 @@ class Fixed64Math {
      * @note For values outside [-1,1]: returns π/2 if x>1, returns -π/2 if x<-1
      */
     template <int P>
-        requires(P >= kTrigFractionBits)
-    [[nodiscard]] static auto Asin(Fixed64<P> x) noexcept -> Fixed64<P> {
+    [[nodiscard]] static constexpr auto Asin(Fixed64<P> x) noexcept -> Fixed64<P> {
         if (x > Fixed64<P>::One()) {
+            Fixed64Instrumentation::Record(Fixed64Event::kRangeClamp);
             return Fixed64<P>::HalfPi();
         }
         if (x < -Fixed64<P>::One()) {
+            Fixed64Instrumentation::Record(Fixed64Event::kRangeClamp);
             return -Fixed64<P>::HalfPi();
         }
 
@@ -499,11 +685,11 @@ class Fixed64Math {
      * @return Fixed64<P> Arctangent result in radians
      */
     template <int P>
-    static auto Atan(Fixed64<P> x) noexcept -> Fixed64<P> {
+    static constexpr auto Atan(Fixed64<P> x) noexcept -> Fixed64<P> {
         if constexpr (FIXED64_MATH_USE_FAST_TRIG) {
-            return Fixed64<P>(detail::LookupAtanFast(x.value(), P), detail::nothing{});
+            return Fixed64<P>(detail::LookupAtanFast<P>(x.value()), detail::nothing{});
         } else {
-            return Fixed64<P>(detail::LookupAtan(x.value(), P), detail::nothing{});
+            return Fixed64<P>(detail::LookupAtan<P>(x.value()), detail::nothing{});
         }
     }
 
@@ -514,12 +700,21 @@ class Fixed64Math {
      * @param x X-coordinate component
      * @return Angle in radians in range [-π,π]
      *
-     * @note Special cases: atan2(0,0)=0, atan2(±y,0)=±π/2, atan2(0,±x)=0 or ±π.
+     * @note Special cases: atan2(0,0)=0, atan2(±y,0)=±π/2, atan2(0,±x)=0 or ±π, NaN if either
+     * input is NaN. Octant and quadrant selection are branch-free.
      * Precision limited by 256-entry LUT with linear interpolation.
      */
     template <int P>
-    [[nodiscard]] static auto Atan2(Fixed64<P> y, Fixed64<P> x) noexcept -> Fixed64<P> {
+    [[nodiscard]] static constexpr auto Atan2(Fixed64<P> y, Fixed64<P> x) noexcept -> Fixed64<P> {
+        if constexpr (FIXED64_MATH_USE_CORDIC && P >= 3 && P <= 61) {
+            return Cordic::Atan2(y, x);
+        }
+
         // Handle special cases
+        if (x == Fixed64<P>::NaN() || y == Fixed64<P>::NaN()) {
+            return Fixed64<P>::NaN();
+        }
+
         if (x == Fixed64<P>::Zero() && y == Fixed64<P>::Zero()) {
             return Fixed64<P>::Zero();  // Undefined case, return 0 by convention
         }
@@ -528,39 +723,152 @@ class Fixed64Math {
             return y > Fixed64<P>::Zero() ? Fixed64<P>::HalfPi() : -Fixed64<P>::HalfPi();
         }
 
-        // Determine octant and compute ratio in first octant [0, π/4]
-        bool x_neg = x < Fixed64<P>::Zero();
-        bool y_neg = y < Fixed64<P>::Zero();
-        bool swapped = Abs(y) > Abs(x);
+        // Determine octant without branches: sign masks (-1 if negative) and magnitudes
+        const int64_t x_sign = x.value() >> 63;
+        const int64_t y_sign = y.value() >> 63;
+        const int64_t abs_x = (x.value() ^ x_sign) - x_sign;
+        const int64_t abs_y = (y.value() ^ y_sign) - y_sign;
+        const int64_t swapped = -static_cast<int64_t>(abs_y > abs_x);  // -1 if |y| > |x|
 
-        // Calculate ratio (always in [0,1] range)
-        Fixed64<P> ratio;
-        if (swapped) {
-            ratio = Abs(x) / Abs(y);
-        } else {
-            ratio = Abs(y) / Abs(x);
-        }
+        // Calculate ratio (always in [0,1] range): min(|x|,|y|) / max(|x|,|y|)
+        const int64_t select = (abs_x ^ abs_y) & swapped;
+        const Fixed64<P> num(abs_y ^ select, detail::nothing{});
+        const Fixed64<P> den(abs_x ^ select, detail::nothing{});
+        const Fixed64<P> ratio = num / den;
 
         // Use lookup table with linear interpolation
-        Fixed64<P> angle = Fixed64<P>(detail::LookupAtan2(ratio.value(), P), detail::nothing{});
+        int64_t angle = detail::LookupAtan2<P>(ratio.value());
 
-        // Apply octant correction
-        if (swapped) {
-            angle = Fixed64<P>::HalfPi() - angle;
-        }
+        // Apply octant correction: swapped ? HalfPi - angle : angle
+        angle = ((angle ^ swapped) - swapped) + (Fixed64<P>::HalfPi().value() & swapped);
 
-        // Apply quadrant correction
-        if (x_neg && y_neg) {
-            return -Fixed64<P>::Pi() + angle;  // Third quadrant
-        } else if (x_neg) {
-            return Fixed64<P>::Pi() - angle;  // Second quadrant
-        } else if (y_neg) {
-            return -angle;  // Fourth quadrant
-        } else {
-            return angle;  // First quadrant
+        // Apply quadrant correction: x < 0 ? Pi - angle : angle, then negate if y < 0
+        angle = ((angle ^ x_sign) - x_sign) + (Fixed64<P>::Pi().value() & x_sign);
+        angle = (angle ^ y_sign) - y_sign;
+
+        return Fixed64<P>(angle, detail::nothing{});
+    }
+
+    /**
+     * @brief Computes atan2 over arrays of coordinates: out[i] = Atan2(y[i], x[i])
+     * @param y Y-coordinate components
+     * @param x X-coordinate components (structure-of-arrays layout)
+     * @param out Destination span, may alias y or x exactly
+     * @note Results are bit-identical to Atan2. With SIMD support (see FIXED64_BATCH_USE_SIMD)
+     * the ratio division is a vector double-precision estimate corrected to the exact integer
+     * quotient, which relies on the default round-to-nearest floating-point mode.
+     * Processes min(y.size(), x.size(), out.size()) elements
+     */
+    template <int P>
+    static auto Atan2Batch(std::span<const Fixed64<P>> y,
+                           std::span<const Fixed64<P>> x,
+                           std::span<Fixed64<P>> out) noexcept -> void {
+        const size_t count = std::min({y.size(), x.size(), out.size()});
+        size_t i = 0;
+        if constexpr (!(FIXED64_MATH_USE_CORDIC && P >= 3 && P <= 61)) {
+            i = detail::Atan2Batch<P>(detail::RawWords(y),
+                                      detail::RawWords(x),
+                                      Fixed64<P>::HalfPi().value(),
+                                      Fixed64<P>::Pi().value(),
+                                      detail::RawWords(out),
+                                      count);
+        }
+        for (; i < count; ++i) {
+            out[i] = Atan2(y[i], x[i]);
         }
     }
 
+    /**
+     * @brief CORDIC trigonometry, selectable per call or globally with FIXED64_MATH_USE_CORDIC
+     *
+     * Rotates a vector through the angles atan(2^-i) with one shift and one add per coordinate
+     * and iteration, running P + 3 iterations in Q1.62. No table interpolation multiplies are
+     * needed, which suits targets without a fast 64x64 multiplier, and results are accurate to
+     * the format rather than to the Q31.32 tables. Range reduction uses three multiplies by
+     * pi/2 held to 124 bits, so large angles keep their precision.
+     *
+     * Guarantees:
+     * - Sin, Cos and SinCos within 1 ulp up to P = 54, and within about 2^-56 above
+     * - Atan2 within 1 ulp up to P = 54 with the special cases of Fixed64Math::Atan2
+     * - Hypot with a relative error of about 2^-54, saturating to Infinity
+     * - Supports any P from 3 (Atan2 up to 61, the others up to 62), including Fixed64_16
+     *
+     * Usage:
+     *   auto [s, c] = Fixed64Math::Cordic::SinCos(angle);
+     *   auto length = Fixed64Math::Cordic::Hypot(dx, dy);
+     */
+    struct Cordic {
+        /**
+         * @brief Calculate sine and cosine values together
+         * @param x Angle (in radians)
+         * @return Pair of (sine, cosine) values [-1,1]
+         */
+        template <int P>
+            requires(P >= 3 && P <= 62)
+        [[nodiscard]] static constexpr auto SinCos(Fixed64<P> x) noexcept
+            -> std::pair<Fixed64<P>, Fixed64<P>> {
+            const auto [s, c] = detail::CordicSinCos(x.value(), P);
+            return {Fixed64<P>(s, detail::nothing{}), Fixed64<P>(c, detail::nothing{})};
+        }
+
+        /**
+         * @brief Calculate sine value
+         * @param x Angle (in radians)
+         * @return Sine value [-1,1], identical to SinCos(x).first
+         */
+        template <int P>
+            requires(P >= 3 && P <= 62)
+        [[nodiscard]] static constexpr auto Sin(Fixed64<P> x) noexcept -> Fixed64<P> {
+            return SinCos(x).first;
+        }
+
+        /**
+         * @brief Calculate cosine value
+         * @param x Angle (in radians)
+         * @return Cosine value [-1,1], identical to SinCos(x).second
+         */
+        template <int P>
+            requires(P >= 3 && P <= 62)
+        [[nodiscard]] static constexpr auto Cos(Fixed64<P> x) noexcept -> Fixed64<P> {
+            return SinCos(x).second;
+        }
+
+        /**
+         * @brief Computes two-argument arctangent with quadrant determination
+         * @param y Y-coordinate component
+         * @param x X-coordinate component
+         * @return Angle in radians in range [-π,π]
+         * @note Special cases: atan2(0,0)=0, atan2(0,-x)=π, NaN if either input is NaN
+         */
+        template <int P>
+            requires(P >= 3 && P <= 61)
+        [[nodiscard]] static constexpr auto Atan2(Fixed64<P> y, Fixed64<P> x) noexcept
+            -> Fixed64<P> {
+            if (x == Fixed64<P>::NaN() || y == Fixed64<P>::NaN()) {
+                return Fixed64<P>::NaN();
+            }
+            if (y == Fixed64<P>::Zero()) {
+                return x < Fixed64<P>::Zero() ? Fixed64<P>::Pi() : Fixed64<P>::Zero();
+            }
+            return Fixed64<P>(detail::CordicAtan2(y.value(), x.value(), P), detail::nothing{});
+        }
+
+        /**
+         * @brief Computes the length of the vector (x, y) without intermediate overflow
+         * @param x X-coordinate component
+         * @param y Y-coordinate component
+         * @return sqrt(x² + y²), Infinity if it exceeds the range, NaN if either input is NaN
+         */
+        template <int P>
+        [[nodiscard]] static constexpr auto Hypot(Fixed64<P> x, Fixed64<P> y) noexcept
+            -> Fixed64<P> {
+            if (x == Fixed64<P>::NaN() || y == Fixed64<P>::NaN()) {
+                return Fixed64<P>::NaN();
+            }
+            return Fixed64<P>(detail::CordicHypot(x.value(), y.value()), detail::nothing{});
+        }
+    };
+
     /**
      * @brief Computes square root using optimized algorithm
      *
@@ -575,6 +883,517 @@ class Fixed64Math {
         return Fixed64<P>(Primitives::Fixed64SqrtFast(x.value(), P), detail::nothing{});
     }
 
+    /**
+     * @brief Computes reciprocal square root, 1 / sqrt(x)
+     *
+     * @param x Input value (must be positive)
+     * @return Reciprocal square root of x
+     *
+     * @note Seeded by the same SoftFloat approximation as Sqrt and refined by one Newton step.
+     * Relative error is below 2^-58 before rounding, so the result is within 1 ulp whenever it
+     * has fewer than 58 significant bits. Returns Infinity for zero or when the result exceeds
+     * the range, NaN for negative inputs.
+     */
+    template <int P>
+    [[nodiscard]] constexpr static auto RSqrt(Fixed64<P> x) noexcept -> Fixed64<P> {
+        return Fixed64<P>(Primitives::Fixed64RSqrt(x.value(), P), detail::nothing{});
+    }
+
+    /**
+     * @brief Computes reciprocal, 1 / x
+     *
+     * @param x Input value
+     * @return Reciprocal of x, bit-identical to Fixed64<P>::One() / x
+     *
+     * @note Returns Infinity for zero like operator/. The dividend is a power of two, so
+     * precisions below 32 bits need a single 64-bit division instead of a 128/64 one.
+     */
+    template <int P>
+    [[nodiscard]] constexpr static auto Reciprocal(Fixed64<P> x) noexcept -> Fixed64<P> {
+        if (x == Fixed64<P>::Zero()) [[unlikely]] {
+            return Fixed64<P>::Infinity();
+        }
+        return Fixed64<P>(Primitives::Fixed64Reciprocal(x.value(), P), detail::nothing{});
+    }
+
+    /**
+     * @brief Length of the vector (x, y), sqrt(x² + y²), without intermediate overflow
+     *
+     * @param x X component
+     * @param y Y component
+     * @return Correctly rounded length, Infinity if it exceeds the range, NaN if either input
+     * is NaN
+     *
+     * @note The squares are summed exactly in 128 bits and the integer square root of
+     * that sum is the raw result, so there is no range limit on the inputs and no shift or
+     * rounding before the root. Unlike Sqrt(x * x + y * y), which overflows once the length
+     * passes sqrt(Max()) (46341 at P = 32), this covers the full range.
+     */
+    template <int P>
+    [[nodiscard]] constexpr static auto Hypot(Fixed64<P> x, Fixed64<P> y) noexcept -> Fixed64<P> {
+        if (x == Fixed64<P>::NaN() || y == Fixed64<P>::NaN()) {
+            return Fixed64<P>::NaN();
+        }
+        return Fixed64<P>(
+            detail::HypotRaw<2>({detail::AbsRaw(x.value()), detail::AbsRaw(y.value())}),
+            detail::nothing{});
+    }
+
+    /**
+     * @brief Length of the vector (x, y, z), sqrt(x² + y² + z²), without intermediate overflow
+     * @return Correctly rounded length, Infinity if it exceeds the range, NaN if any input is
+     * NaN
+     */
+    template <int P>
+    [[nodiscard]] constexpr static auto Hypot3(Fixed64<P> x, Fixed64<P> y, Fixed64<P> z) noexcept
+        -> Fixed64<P> {
+        if (x == Fixed64<P>::NaN() || y == Fixed64<P>::NaN() || z == Fixed64<P>::NaN()) {
+            return Fixed64<P>::NaN();
+        }
+        return Fixed64<P>(detail::HypotRaw<3>({detail::AbsRaw(x.value()),
+                                               detail::AbsRaw(y.value()),
+                                               detail::AbsRaw(z.value())}),
+                          detail::nothing{});
+    }
+
+    /**
+     * @brief Distance between the points (ax, ay) and (bx, by)
+     * @return Correctly rounded distance, Infinity if it exceeds the range, NaN if any input is
+     * NaN
+     * @note The differences are taken exactly as 64-bit magnitudes, so points on opposite ends
+     * of the range give Infinity instead of a wrapped difference
+     */
+    template <int P>
+    [[nodiscard]] constexpr static auto Distance(Fixed64<P> ax, Fixed64<P> ay, Fixed64<P> bx,
+                                                 Fixed64<P> by) noexcept -> Fixed64<P> {
+        if (ax == Fixed64<P>::NaN() || ay == Fixed64<P>::NaN() || bx == Fixed64<P>::NaN() ||
+            by == Fixed64<P>::NaN()) {
+            return Fixed64<P>::NaN();
+        }
+        return Fixed64<P>(detail::HypotRaw<2>({detail::AbsDiffRaw(bx.value(), ax.value()),
+                                               detail::AbsDiffRaw(by.value(), ay.value())}),
+                          detail::nothing{});
+    }
+
+    /**
+     * @brief Distance between the points (ax, ay, az) and (bx, by, bz)
+     * @return Correctly rounded distance, Infinity if it exceeds the range, NaN if any input is
+     * NaN
+     */
+    template <int P>
+    [[nodiscard]] constexpr static auto Distance(Fixed64<P> ax, Fixed64<P> ay, Fixed64<P> az,
+                                                 Fixed64<P> bx, Fixed64<P> by,
+                                                 Fixed64<P> bz) noexcept -> Fixed64<P> {
+        if (ax == Fixed64<P>::NaN() || ay == Fixed64<P>::NaN() || az == Fixed64<P>::NaN() ||
+            bx == Fixed64<P>::NaN() || by == Fixed64<P>::NaN() || bz == Fixed64<P>::NaN()) {
+            return Fixed64<P>::NaN();
+        }
+        return Fixed64<P>(detail::HypotRaw<3>({detail::AbsDiffRaw(bx.value(), ax.value()),
+                                               detail::AbsDiffRaw(by.value(), ay.value()),
+                                               detail::AbsDiffRaw(bz.value(), az.value())}),
+                          detail::nothing{});
+    }
+
+    /**
+     * @brief Exact squared distance between the points (ax, ay) and (bx, by)
+     *
+     * @return (bx - ax)² + (by - ay)² with all 2P fraction bits, in a Fixed64Accumulator
+     *
+     * @note Nothing is rounded, so squared distances can be compared or ranked exactly
+     * (nearest-neighbour queries) far beyond the range of Fixed64<P>. Result() rounds and
+     * saturates. The differences are exact 64-bit magnitudes, so the sum is exact whenever
+     * each difference stays below 2^63 raw, e.g. for all coordinates within half the range
+     */
+    template <int P>
+    [[nodiscard]] constexpr static auto DistanceSquared128(Fixed64<P> ax, Fixed64<P> ay,
+                                                           Fixed64<P> bx, Fixed64<P> by) noexcept
+        -> Fixed64Accumulator<P> {
+        Fixed64Accumulator<P> sum;
+        for (const uint64_t d : {detail::AbsDiffRaw(bx.value(), ax.value()),
+                                 detail::AbsDiffRaw(by.value(), ay.value())}) {
+            const Fixed64<P> delta(static_cast<int64_t>(d), detail::nothing{});
+            sum.MulAdd(delta, delta);
+        }
+        return sum;
+    }
+
+    /**
+     * @brief Exact squared distance between the points (ax, ay, az) and (bx, by, bz)
+     * @return Sum of the squared differences with all 2P fraction bits
+     * @note Exact while the squares sum below 2^127, which holds for coordinates within ±2^61
+     * raw (about ±5.4e8 at P = 32)
+     */
+    template <int P>
+    [[nodiscard]] constexpr static auto DistanceSquared128(Fixed64<P> ax, Fixed64<P> ay,
+                                                           Fixed64<P> az, Fixed64<P> bx,
+                                                           Fixed64<P> by, Fixed64<P> bz) noexcept
+        -> Fixed64Accumulator<P> {
+        Fixed64Accumulator<P> sum;
+        for (const uint64_t d : {detail::AbsDiffRaw(bx.value(), ax.value()),
+                                 detail::AbsDiffRaw(by.value(), ay.value()),
+                                 detail::AbsDiffRaw(bz.value(), az.value())}) {
+            const Fixed64<P> delta(static_cast<int64_t>(d), detail::nothing{});
+            sum.MulAdd(delta, delta);
+        }
+        return sum;
+    }
+
+    /**
+     * @brief Lengths of arrays of vectors: out[i] = Hypot(x[i], y[i])
+     * @param x X components
+     * @param y Y components (structure-of-arrays layout)
+     * @param out Destination span, may alias x or y exactly
+     * @note Results are bit-identical to Hypot. Processes min(x.size(), y.size(), out.size())
+     * elements
+     */
+    template <int P>
+    static auto HypotBatch(std::span<const Fixed64<P>> x,
+                           std::span<const Fixed64<P>> y,
+                           std::span<Fixed64<P>> out) noexcept -> void {
+        const size_t count = std::min({x.size(), y.size(), out.size()});
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = Hypot(x[i], y[i]);
+        }
+    }
+
+    /**
+     * @brief Lengths of arrays of 3D vectors: out[i] = Hypot3(x[i], y[i], z[i])
+     * @note Results are bit-identical to Hypot3. Processes the shortest span's count of elements
+     */
+    template <int P>
+    static auto Hypot3Batch(std::span<const Fixed64<P>> x,
+                            std::span<const Fixed64<P>> y,
+                            std::span<const Fixed64<P>> z,
+                            std::span<Fixed64<P>> out) noexcept -> void {
+        const size_t count = std::min({x.size(), y.size(), z.size(), out.size()});
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = Hypot3(x[i], y[i], z[i]);
+        }
+    }
+
+    /**
+     * @brief Distances between arrays of point pairs: out[i] = Distance(ax[i], ay[i], bx[i],
+     * by[i])
+     * @note Results are bit-identical to Distance. Processes the shortest span's count of
+     * elements
+     */
+    template <int P>
+    static auto DistanceBatch(std::span<const Fixed64<P>> ax,
+                              std::span<const Fixed64<P>> ay,
+                              std::span<const Fixed64<P>> bx,
+                              std::span<const Fixed64<P>> by,
+                              std::span<Fixed64<P>> out) noexcept -> void {
+        const size_t count = std::min({ax.size(), ay.size(), bx.size(), by.size(), out.size()});
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = Distance(ax[i], ay[i], bx[i], by[i]);
+        }
+    }
+
+    /**
+     * @brief Batch functions under an execution policy (see fixed64_execution.h)
+     *
+     * With execution::par the spans are cut into fixed 16384-element chunks that run on the
+     * thread pool, each through the overload without a policy, so the results are bit-identical
+     * to it for any policy and thread count.
+     *
+     * Usage:
+     *   Fixed64Math::SinBatch<32>(execution::par, angles, out);
+     */
+    template <int P, ExecutionPolicy Policy>
+    static auto SinBatch(const Policy& policy,
+                         std::span<const Fixed64<P>> x,
+                         std::span<Fixed64<P>> out) noexcept -> void {
+        detail::ForEachChunk(policy, std::min(x.size(), out.size()), [&](size_t b, size_t e) {
+            SinBatch(x.subspan(b, e - b), out.subspan(b, e - b));
+        });
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    static auto CosBatch(const Policy& policy,
+                         std::span<const Fixed64<P>> x,
+                         std::span<Fixed64<P>> out) noexcept -> void {
+        detail::ForEachChunk(policy, std::min(x.size(), out.size()), [&](size_t b, size_t e) {
+            CosBatch(x.subspan(b, e - b), out.subspan(b, e - b));
+        });
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    static auto TanBatch(const Policy& policy,
+                         std::span<const Fixed64<P>> x,
+                         std::span<Fixed64<P>> out) noexcept -> void {
+        detail::ForEachChunk(policy, std::min(x.size(), out.size()), [&](size_t b, size_t e) {
+            TanBatch(x.subspan(b, e - b), out.subspan(b, e - b));
+        });
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    static auto Atan2Batch(const Policy& policy,
+                           std::span<const Fixed64<P>> y,
+                           std::span<const Fixed64<P>> x,
+                           std::span<Fixed64<P>> out) noexcept -> void {
+        const size_t count = std::min({y.size(), x.size(), out.size()});
+        detail::ForEachChunk(policy, count, [&](size_t b, size_t e) {
+            Atan2Batch(y.subspan(b, e - b), x.subspan(b, e - b), out.subspan(b, e - b));
+        });
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    static auto HypotBatch(const Policy& policy,
+                           std::span<const Fixed64<P>> x,
+                           std::span<const Fixed64<P>> y,
+                           std::span<Fixed64<P>> out) noexcept -> void {
+        const size_t count = std::min({x.size(), y.size(), out.size()});
+        detail::ForEachChunk(policy, count, [&](size_t b, size_t e) {
+            HypotBatch(x.subspan(b, e - b), y.subspan(b, e - b), out.subspan(b, e - b));
+        });
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    static auto Hypot3Batch(const Policy& policy,
+                            std::span<const Fixed64<P>> x,
+                            std::span<const Fixed64<P>> y,
+                            std::span<const Fixed64<P>> z,
+                            std::span<Fixed64<P>> out) noexcept -> void {
+        const size_t count = std::min({x.size(), y.size(), z.size(), out.size()});
+        detail::ForEachChunk(policy, count, [&](size_t b, size_t e) {
+            Hypot3Batch(x.subspan(b, e - b), y.subspan(b, e - b), z.subspan(b, e - b),
+                        out.subspan(b, e - b));
+        });
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    static auto DistanceBatch(const Policy& policy,
+                              std::span<const Fixed64<P>> ax,
+                              std::span<const Fixed64<P>> ay,
+                              std::span<const Fixed64<P>> bx,
+                              std::span<const Fixed64<P>> by,
+                              std::span<Fixed64<P>> out) noexcept -> void {
+        const size_t count = std::min({ax.size(), ay.size(), bx.size(), by.size(), out.size()});
+        detail::ForEachChunk(policy, count, [&](size_t b, size_t e) {
+            DistanceBatch(ax.subspan(b, e - b), ay.subspan(b, e - b), bx.subspan(b, e - b),
+                          by.subspan(b, e - b), out.subspan(b, e - b));
+        });
+    }
+
+    /**
+     * @brief Dot product of two arrays, sum of a[i] * b[i]
+     *
+     * @param a First operand span
+     * @param b Second operand span
+     * @return Sum over min(a.size(), b.size()) elements
+     *
+     * @note The products are summed exactly in a Fixed64Accumulator and rounded once (to
+     * nearest, ties to even), so the result is the same on every platform and intermediate sums
+     * may exceed the range. Saturates to Infinity/NegInfinity when the total does not fit.
+     */
+    template <int P>
+    [[nodiscard]] constexpr static auto Dot(std::span<const Fixed64<P>> a,
+                                            std::span<const Fixed64<P>> b) noexcept
+        -> Fixed64<P> {
+        const size_t count = std::min(a.size(), b.size());
+        Fixed64Accumulator<P> sum;
+        for (size_t i = 0; i < count; ++i) {
+            sum.MulAdd(a[i], b[i]);
+        }
+        return sum.Result();
+    }
+
+    /**
+     * @brief Dot product under an execution policy
+     * @note Each part of the split is summed in its own accumulator and the parts are merged in
+     * order; the 128-bit total is exact, so the result is bit-identical to Dot without a policy
+     */
+    template <int P, ExecutionPolicy Policy>
+    [[nodiscard]] static auto Dot(const Policy& policy,
+                                  std::span<const Fixed64<P>> a,
+                                  std::span<const Fixed64<P>> b) noexcept -> Fixed64<P> {
+        Fixed64Accumulator<P> parts[detail::kMaxReduceParts];
+        auto part = [&](size_t p, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                parts[p].MulAdd(a[i], b[i]);
+            }
+        };
+        const size_t count =
+            detail::ForEachPart(std::min(a.size(), b.size()), part, detail::MaxThreads(policy));
+        Fixed64Accumulator<P> sum;
+        for (size_t p = 0; p < count; ++p) {
+            sum.Merge(parts[p]);
+        }
+        return sum.Result();
+    }
+
+    /**
+     * @brief Sum of all elements
+     *
+     * @param x Input span
+     * @return Exact sum, Infinity or NegInfinity when it does not fit in Fixed64<P>
+     *
+     * @note The raw values are summed in 128 bits, which cannot overflow, with SIMD lanes
+     * inside each part and large spans split across the thread pool. Integer addition is
+     * associative, so the result is bit-identical for any split, thread count or instruction
+     * set. NaN and infinities are summed as ordinary raw values. The reductions accept an
+     * execution policy as their first argument; without one they run under execution::par.
+     */
+    template <int P>
+    [[nodiscard]] static auto Sum(std::span<const Fixed64<P>> x) noexcept -> Fixed64<P> {
+        return Sum<P>(execution::par, x);
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    [[nodiscard]] static auto Sum(const Policy& policy, std::span<const Fixed64<P>> x) noexcept
+        -> Fixed64<P> {
+        uint64_t hi;
+        uint64_t lo;
+        SumRaw128(x, hi, lo, detail::MaxThreads(policy));
+        return Fixed64<P>(Primitives::Saturate128(hi, lo), detail::nothing{});
+    }
+
+    /**
+     * @brief Arithmetic mean of all elements
+     * @param x Input span
+     * @return Exact sum divided by x.size(), rounded to nearest (ties away from zero); Zero for
+     * an empty span
+     * @note Deterministic like Sum; the mean never leaves the range of the inputs
+     */
+    template <int P>
+    [[nodiscard]] static auto Mean(std::span<const Fixed64<P>> x) noexcept -> Fixed64<P> {
+        return Mean<P>(execution::par, x);
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    [[nodiscard]] static auto Mean(const Policy& policy, std::span<const Fixed64<P>> x) noexcept
+        -> Fixed64<P> {
+        if (x.empty()) {
+            return Fixed64<P>::Zero();
+        }
+        uint64_t hi;
+        uint64_t lo;
+        SumRaw128(x, hi, lo, detail::MaxThreads(policy));
+        return Fixed64<P>(DivRound128(hi, lo, x.size()), detail::nothing{});
+    }
+
+    /**
+     * @brief Smallest and largest element
+     * @param x Input span
+     * @return {min, max} by raw value (NaN is the smallest); {Max(), Min()} for an empty span
+     */
+    template <int P>
+    [[nodiscard]] static auto MinMax(std::span<const Fixed64<P>> x) noexcept
+        -> std::pair<Fixed64<P>, Fixed64<P>> {
+        return MinMax<P>(execution::par, x);
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    [[nodiscard]] static auto MinMax(const Policy& policy, std::span<const Fixed64<P>> x) noexcept
+        -> std::pair<Fixed64<P>, Fixed64<P>> {
+        struct Part {
+            int64_t min;
+            int64_t max;
+        };
+        Part parts[detail::kMaxReduceParts];
+        const int64_t* raw = detail::RawWords(x);
+        auto part = [&](size_t p, size_t begin, size_t end) {
+            int64_t min = INT64_MAX;
+            int64_t max = INT64_MIN;
+            size_t i = begin + detail::MinMaxBatch(raw + begin, end - begin, min, max);
+            for (; i < end; ++i) {
+                min = raw[i] < min ? raw[i] : min;
+                max = raw[i] > max ? raw[i] : max;
+            }
+            parts[p] = {min, max};
+        };
+        const size_t count = detail::ForEachPart(x.size(), part, detail::MaxThreads(policy));
+
+        int64_t min = INT64_MAX;
+        int64_t max = INT64_MIN;
+        for (size_t p = 0; p < count; ++p) {
+            min = std::min(min, parts[p].min);
+            max = std::max(max, parts[p].max);
+        }
+        return {Fixed64<P>(min, detail::nothing{}), Fixed64<P>(max, detail::nothing{})};
+    }
+
+    /**
+     * @brief Population variance, mean of (x[i] - Mean(x))^2
+     *
+     * @param x Input span
+     * @return Variance rounded to P fraction bits, Infinity when it does not fit; Zero for an
+     * empty span
+     *
+     * @note Two passes: Mean, then the squared deviations from it summed exactly in 192 bits.
+     * The rounding of the mean changes the result by less than a quarter of the last place
+     * before the final rounding, and the result is bit-identical for any split or thread count.
+     */
+    template <int P>
+    [[nodiscard]] static auto Variance(std::span<const Fixed64<P>> x) noexcept -> Fixed64<P> {
+        return Variance<P>(execution::par, x);
+    }
+
+    template <int P, ExecutionPolicy Policy>
+    [[nodiscard]] static auto Variance(const Policy& policy, std::span<const Fixed64<P>> x) noexcept
+        -> Fixed64<P> {
+        static_assert(P > 0 && P < 63, "Variance requires 0 < P < 63");
+        if (x.empty()) {
+            return Fixed64<P>::Zero();
+        }
+        const int64_t mean = Mean<P>(policy, x).value();
+
+        // Sum of squared deviations, three words per part
+        struct Part {
+            uint64_t w2;
+            uint64_t w1;
+            uint64_t w0;
+        };
+        Part parts[detail::kMaxReduceParts];
+        const int64_t* raw = detail::RawWords(x);
+        auto part = [&](size_t p, size_t begin, size_t end) {
+            Part sum{0, 0, 0};
+            for (size_t i = begin; i < end; ++i) {
+                // |x - mean| < 2^64, and its square has a high word of at most 2^64 - 2
+                const uint64_t up = static_cast<uint64_t>(raw[i]) - static_cast<uint64_t>(mean);
+                const uint64_t deviation = raw[i] >= mean ? up : 0 - up;
+                uint64_t sq_hi, sq_lo;
+                umul_ppmm(sq_hi, sq_lo, deviation, deviation);
+                sum.w0 += sq_lo;
+                sq_hi += (sum.w0 < sq_lo) ? 1 : 0;
+                sum.w1 += sq_hi;
+                sum.w2 += (sum.w1 < sq_hi) ? 1 : 0;
+            }
+            parts[p] = sum;
+        };
+        const size_t count = detail::ForEachPart(x.size(), part, detail::MaxThreads(policy));
+
+        Part total{0, 0, 0};
+        for (size_t p = 0; p < count; ++p) {
+            total.w0 += parts[p].w0;
+            const uint64_t carry = (total.w0 < parts[p].w0) ? 1 : 0;
+            total.w1 += parts[p].w1;
+            total.w2 += parts[p].w2 + ((total.w1 < parts[p].w1) ? 1 : 0);
+            total.w1 += carry;
+            total.w2 += (total.w1 < carry) ? 1 : 0;
+        }
+
+        // q = floor(total / (n * 2^(P - 1))) must fit in 64 bits; the result is (q + 1) / 2
+        uint64_t u0 = total.w0;
+        uint64_t u1 = total.w1;
+        uint64_t u2 = total.w2;
+        if constexpr (P > 1) {
+            u0 = (u0 >> (P - 1)) | (u1 << (65 - P));
+            u1 = (u1 >> (P - 1)) | (u2 << (65 - P));
+            u2 >>= P - 1;
+        }
+        const uint64_t n = x.size();
+        if (u2 != 0 || u1 >= n) [[unlikely]] {
+            return Fixed64<P>::Infinity();
+        }
+        const uint64_t q = Primitives::DivU128ToU64(u1, u0, n);
+        const uint64_t rounded = (q >> 1) + (q & 1);
+        if (rounded > static_cast<uint64_t>(INT64_MAX)) [[unlikely]] {
+            return Fixed64<P>::Infinity();
+        }
+        return Fixed64<P>(static_cast<int64_t>(rounded), detail::nothing{});
+    }
+
     /**
      * @brief Floor function
      * @param x Input value
@@ -711,6 +1530,160 @@ class Fixed64Math {
         return x;
     }
 
+    /**
+     * @brief Addition that saturates instead of wrapping
+     * @return a + b clamped to [NegInfinity, Infinity]; never the NaN pattern
+     * @note The Saturating and Checked functions are branch-free apart from the divisor test
+     * of division; they treat NaN and infinities as ordinary raw values like the operators
+     */
+    template <int P>
+    [[nodiscard]] static constexpr auto SaturatingAdd(Fixed64<P> a, Fixed64<P> b) noexcept
+        -> Fixed64<P> {
+        int64_t result;
+        static_cast<void>(Primitives::Fixed64AddChecked(a.value(), b.value(), result));
+        return Fixed64<P>(result, detail::nothing{});
+    }
+
+    /**
+     * @brief Subtraction that saturates instead of wrapping
+     * @return a - b clamped to [NegInfinity, Infinity]
+     */
+    template <int P>
+    [[nodiscard]] static constexpr auto SaturatingSub(Fixed64<P> a, Fixed64<P> b) noexcept
+        -> Fixed64<P> {
+        int64_t result;
+        static_cast<void>(Primitives::Fixed64SubChecked(a.value(), b.value(), result));
+        return Fixed64<P>(result, detail::nothing{});
+    }
+
+    /**
+     * @brief Multiplication that saturates instead of dropping the high product bits
+     * @return a * b (truncated like operator*) clamped to [NegInfinity, Infinity]
+     */
+    template <int P>
+    [[nodiscard]] static constexpr auto SaturatingMul(Fixed64<P> a, Fixed64<P> b) noexcept
+        -> Fixed64<P> {
+        int64_t result;
+        static_cast<void>(Primitives::Fixed64MulChecked<P>(a.value(), b.value(), result));
+        return Fixed64<P>(result, detail::nothing{});
+    }
+
+    /**
+     * @brief Division that saturates when the quotient does not fit
+     * @return a / b clamped to [NegInfinity, Infinity]; a zero divisor gives Infinity or
+     * NegInfinity like operator/
+     */
+    template <int P>
+    [[nodiscard]] static constexpr auto SaturatingDiv(Fixed64<P> a, Fixed64<P> b) noexcept
+        -> Fixed64<P> {
+        int64_t result;
+        static_cast<void>(Primitives::Fixed64DivChecked<P>(a.value(), b.value(), result));
+        return Fixed64<P>(result, detail::nothing{});
+    }
+
+    /**
+     * @brief Addition with an overflow flag
+     * @param result Receives SaturatingAdd(a, b), which equals a + b when there is no overflow
+     * @return true if the exact sum is outside [NegInfinity, Infinity]
+     */
+    template <int P>
+    [[nodiscard]] static constexpr auto CheckedAdd(Fixed64<P> a,
+                                                   Fixed64<P> b,
+                                                   Fixed64<P>& result) noexcept -> bool {
+        int64_t raw;
+        const bool overflow = Primitives::Fixed64AddChecked(a.value(), b.value(), raw);
+        result = Fixed64<P>(raw, detail::nothing{});
+        return overflow;
+    }
+
+    /**
+     * @brief Subtraction with an overflow flag
+     * @param result Receives SaturatingSub(a, b), which equals a - b when there is no overflow
+     * @return true if the exact difference is outside [NegInfinity, Infinity]
+     */
+    template <int P>
+    [[nodiscard]] static constexpr auto CheckedSub(Fixed64<P> a,
+                                                   Fixed64<P> b,
+                                                   Fixed64<P>& result) noexcept -> bool {
+        int64_t raw;
+        const bool overflow = Primitives::Fixed64SubChecked(a.value(), b.value(), raw);
+        result = Fixed64<P>(raw, detail::nothing{});
+        return overflow;
+    }
+
+    /**
+     * @brief Multiplication with an overflow flag
+     * @param result Receives SaturatingMul(a, b), which equals a * b when there is no overflow
+     * @return true if the truncated product is outside [NegInfinity, Infinity]
+     */
+    template <int P>
+    [[nodiscard]] static constexpr auto CheckedMul(Fixed64<P> a,
+                                                   Fixed64<P> b,
+                                                   Fixed64<P>& result) noexcept -> bool {
+        int64_t raw;
+        const bool overflow = Primitives::Fixed64MulChecked<P>(a.value(), b.value(), raw);
+        result = Fixed64<P>(raw, detail::nothing{});
+        return overflow;
+    }
+
+    /**
+     * @brief Division with an overflow flag
+     * @param result Receives SaturatingDiv(a, b), which equals a / b when there is no overflow
+     * @return true if the quotient is outside [NegInfinity, Infinity] or b is zero
+     */
+    template <int P>
+    [[nodiscard]] static constexpr auto CheckedDiv(Fixed64<P> a,
+                                                   Fixed64<P> b,
+                                                   Fixed64<P>& result) noexcept -> bool {
+        int64_t raw;
+        const bool overflow = Primitives::Fixed64DivChecked<P>(a.value(), b.value(), raw);
+        result = Fixed64<P>(raw, detail::nothing{});
+        return overflow;
+    }
+
+    /**
+     * @brief Mixed-precision multiplication with the result in a chosen precision
+     *
+     * @tparam S Fraction bits of the result
+     * @param a Operand with Q fraction bits
+     * @param b Operand with R fraction bits
+     * @return a * b as Fixed64<S>: one 128-bit product shifted right by Q + R - S, truncated
+     * toward zero like operator*
+     *
+     * @note The shift is resolved at compile time, so there is no conversion of either operand
+     * and only one truncation, where Fixed64<S>(a * b) truncates to Q bits first and then
+     * converts. With S equal to Q the result is bit-identical to a * b. Out-of-range results
+     * wrap like operator*.
+     */
+    template <int S, int Q, int R>
+    [[nodiscard]] static constexpr auto Mul(Fixed64<Q> a, Fixed64<R> b) noexcept -> Fixed64<S> {
+        static_assert(Q + R - S >= 0 && Q + R - S < 64, "Mul requires 0 <= Q + R - S < 64");
+        return Fixed64<S>(Primitives::Fixed64Mul<Q + R - S>(a.value(), b.value()),
+                          detail::nothing{});
+    }
+
+    /**
+     * @brief Mixed-precision division with the result in a chosen precision
+     *
+     * @tparam S Fraction bits of the result
+     * @param a Dividend with Q fraction bits
+     * @param b Divisor with R fraction bits
+     * @return a / b as Fixed64<S>: the dividend shifted left by S + R - Q in 128 bits and
+     * divided once, truncated toward zero like operator/
+     *
+     * @note With S equal to Q the result is bit-identical to a / b. A zero divisor gives
+     * Infinity or NegInfinity like operator/, and quotients that do not fit wrap like it.
+     */
+    template <int S, int Q, int R>
+    [[nodiscard]] static constexpr auto Div(Fixed64<Q> a, Fixed64<R> b) noexcept -> Fixed64<S> {
+        static_assert(S + R - Q >= 0 && S + R - Q < 64, "Div requires 0 <= S + R - Q < 64");
+        if (b.value() == 0) [[unlikely]] {
+            return a.value() >= 0 ? Fixed64<S>::Infinity() : Fixed64<S>::NegInfinity();
+        }
+        return Fixed64<S>(Primitives::Fixed64Div<S + R - Q>(a.value(), b.value()),
+                          detail::nothing{});
+    }
+
     /**
      * @brief Convert floating-point number to fixed-point, with range checking
      * @param x Input floating-point number
@@ -816,11 +1789,18 @@ class Fixed64Math {
      * @brief Repeat a value within specified range
      * @param x Input value
      * @param length Range length
-     * @return Mapped value [0,length)
+     * @return Mapped value [0,length), zero if length is not positive
+     * @note Uses the exact integer remainder of the raw values, so the result is x - k * length
+     * for an integer k without the rounding of a division and multiplication
      */
     template <int P>
-    [[nodiscard]] static auto Repeat(Fixed64<P> x, Fixed64<P> length) noexcept -> Fixed64<P> {
-        return Clamp(x - Floor(x / length) * length, Fixed64<P>::Zero(), length);
+    [[nodiscard]] static constexpr auto Repeat(Fixed64<P> x, Fixed64<P> length) noexcept
+        -> Fixed64<P> {
+        if (length.value() <= 0) {
+            return Fixed64<P>::Zero();
+        }
+        const int64_t r = x.value() % length.value();
+        return Fixed64<P>(r < 0 ? r + length.value() : r, detail::nothing{});
     }
 
     /**
@@ -835,15 +1815,168 @@ class Fixed64Math {
         -> Fixed64<P> {
         auto diff = end - start;
 
-        if (diff > Fixed64<P>::Pi()) {
-            diff -= Fixed64<P>::TwoPi();
-        } else if (diff < -Fixed64<P>::Pi()) {
-            diff += Fixed64<P>::TwoPi();
+        // Wrap the difference to [-π, π], differences of several turns included
+        if (diff > Fixed64<P>::Pi() || diff < -Fixed64<P>::Pi()) {
+            diff = NormalizeAngle(diff);
+            if (diff > Fixed64<P>::Pi()) {
+                diff -= Fixed64<P>::TwoPi();
+            }
         }
 
         return start + diff * Clamp01(t);
     }
 
+    /**
+     * @brief Evaluate the polynomial c[0] + c[1] * x + ... + c[N-1] * x^(N-1)
+     *
+     * @param c Coefficients, constant term first
+     * @param x Argument
+     * @return Polynomial value
+     *
+     * @note Estrin's scheme: the pairs c[2i] + c[2i+1] * x are independent and are combined
+     * with x^2, x^4, ..., so the dependency chain is about log2(N) multiply-adds long instead
+     * of the N - 1 of Horner's scheme. Every multiply-add is computed exactly in 128 bits and
+     * rounded once (to nearest, ties to even); intermediate values are not saturated.
+     */
+    template <int P, size_t N>
+    [[nodiscard]] constexpr static auto EvalPoly(const std::array<Fixed64<P>, N>& c,
+                                                 Fixed64<P> x) noexcept -> Fixed64<P> {
+        std::array<int64_t, N> raw{};
+        for (size_t i = 0; i < N; ++i) {
+            raw[i] = c[i].value();
+        }
+        return Fixed64<P>(EstrinRaw<P, 0>(raw, x.value()), detail::nothing{});
+    }
+
+    /**
+     * @brief Evaluate the same polynomial at many arguments
+     * @param c Coefficients, constant term first
+     * @param x Arguments
+     * @param out Receives EvalPoly(c, x[i]) for the first min(x.size(), out.size()) elements
+     * @note The evaluations are independent, so their multiply-adds overlap in the pipeline
+     */
+    template <int P, size_t N>
+    static auto EvalPoly(const std::array<Fixed64<P>, N>& c,
+                         std::span<const Fixed64<P>> x,
+                         std::span<Fixed64<P>> out) noexcept -> void {
+        std::array<int64_t, N> raw{};
+        for (size_t i = 0; i < N; ++i) {
+            raw[i] = c[i].value();
+        }
+        const size_t count = std::min(x.size(), out.size());
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = Fixed64<P>(EstrinRaw<P, 0>(raw, x[i].value()), detail::nothing{});
+        }
+    }
+
+    /**
+     * @brief Evaluate a polynomial with Horner's scheme
+     * @param c Coefficients, constant term first
+     * @param x Argument
+     * @return Polynomial value
+     * @note N - 1 multiply-adds, each computed exactly in 128 bits and rounded once: fewer
+     * multiplies than EvalPoly but a serial chain; the results agree to within a few ulps
+     */
+    template <int P, size_t N>
+    [[nodiscard]] constexpr static auto EvalPolyHorner(const std::array<Fixed64<P>, N>& c,
+                                                       Fixed64<P> x) noexcept -> Fixed64<P> {
+        static_assert(P > 0 && P < 64, "EvalPolyHorner requires 0 < P < 64");
+        static_assert(N > 0, "EvalPolyHorner requires at least one coefficient");
+        int64_t result = c[N - 1].value();
+        for (size_t i = N - 1; i-- > 0;) {
+            result = MulAddRaw<P, P>(c[i].value(), result, x.value());
+        }
+        return Fixed64<P>(result, detail::nothing{});
+    }
+
+    /**
+     * @brief Cubic Hermite interpolation
+     * @param p0 Value at t = 0
+     * @param m0 Tangent at t = 0 (change per unit of t)
+     * @param p1 Value at t = 1
+     * @param m1 Tangent at t = 1
+     * @param t Interpolation factor, not clamped
+     * @return The cubic through p0 and p1 with the given tangents, exactly p0 and p1 at the ends
+     * @note Evaluated with EvalPoly on the power-basis coefficients, which must fit in Fixed64
+     */
+    template <int P>
+    [[nodiscard]] constexpr static auto Hermite(Fixed64<P> p0,
+                                                Fixed64<P> m0,
+                                                Fixed64<P> p1,
+                                                Fixed64<P> m1,
+                                                Fixed64<P> t) noexcept -> Fixed64<P> {
+        const int64_t d = p1.value() - p0.value();
+        const std::array<int64_t, 4> c = {p0.value(), m0.value(),
+                                          3 * d - 2 * m0.value() - m1.value(),
+                                          m0.value() + m1.value() - 2 * d};
+        return Fixed64<P>(EstrinRaw<P, 0>(c, t.value()), detail::nothing{});
+    }
+
+    /**
+     * @brief Uniform Catmull-Rom interpolation between p1 and p2
+     * @param p0 Point before p1
+     * @param p1 Value at t = 0
+     * @param p2 Value at t = 1
+     * @param p3 Point after p2
+     * @param t Interpolation factor, not clamped
+     * @return Hermite interpolation with tangents (p2 - p0) / 2 and (p3 - p1) / 2
+     * @note The halved tangents are kept exact: the doubled polynomial is evaluated and the
+     * final multiply-add rounds one extra bit, so the ends are exact and collinear points give
+     * the line rounded once
+     */
+    template <int P>
+    [[nodiscard]] constexpr static auto CatmullRom(Fixed64<P> p0,
+                                                   Fixed64<P> p1,
+                                                   Fixed64<P> p2,
+                                                   Fixed64<P> p3,
+                                                   Fixed64<P> t) noexcept -> Fixed64<P> {
+        return Fixed64<P>(EstrinRaw<P, 1>(CatmullRomRaw(p0.value(), p1.value(), p2.value(),
+                                                        p3.value()),
+                                          t.value()),
+                          detail::nothing{});
+    }
+
+    /**
+     * @brief Sample a uniform Catmull-Rom spline through points at many parameters
+     * @param points Control points, passed through at u = 0, 1, ..., points.size() - 1
+     * @param u Spline parameters, clamped to [0, points.size() - 1]
+     * @param out Receives the first min(u.size(), out.size()) samples; Zero if points is empty
+     * @note The end points are repeated as outer neighbours. Coefficients are recomputed only
+     * when the segment changes, so sorted parameters cost one polynomial evaluation each.
+     */
+    template <int P>
+    static auto CatmullRom(std::span<const Fixed64<P>> points,
+                           std::span<const Fixed64<P>> u,
+                           std::span<Fixed64<P>> out) noexcept -> void {
+        const size_t count = std::min(u.size(), out.size());
+        if (points.size() < 2) {
+            const Fixed64<P> value = points.empty() ? Fixed64<P>::Zero() : points[0];
+            std::fill(out.begin(), out.begin() + static_cast<ptrdiff_t>(count), value);
+            return;
+        }
+
+        const int64_t last = static_cast<int64_t>(points.size() - 1);
+        const auto* p = detail::RawWords(points);
+        int64_t segment = -1;
+        std::array<int64_t, 4> c{};
+        for (size_t i = 0; i < count; ++i) {
+            const int64_t v = u[i].value();
+            // Integer segment and local t; the last point is t = 1 on the last segment
+            int64_t index = v < 0 ? 0 : v >> P;
+            int64_t t = v < 0 ? 0 : v & ((int64_t(1) << P) - 1);
+            if (index >= last) {
+                index = last - 1;
+                t = int64_t(1) << P;
+            }
+            if (index != segment) {
+                segment = index;
+                c = CatmullRomRaw(p[index == 0 ? 0 : index - 1], p[index], p[index + 1],
+                                  p[index + 1 == last ? last : index + 2]);
+            }
+            out[i] = Fixed64<P>(EstrinRaw<P, 1>(c, t), detail::nothing{});
+        }
+    }
+
     /**
      * @brief Returns the sign of a value
      * @param x Input value
@@ -863,85 +1996,215 @@ class Fixed64Math {
      * @param angle Input angle (radians)
      * @return Normalized angle in [0, 2π) range
      *
-     * Implementation follows game industry best practices for efficient and accurate angle
-     * normalization.
+     * Reduces the raw value with Primitives::RemConstant, a Barrett remainder by the constant
+     * 2π, so every angle takes the same branch-free sequence with no loops or divisions. The
+     * remainder is exact: the result equals angle - k * 2π for the integer k that puts it in
+     * range, computed with the 2π of this precision.
      */
     template <int P>
-    static auto NormalizeAngle(Fixed64<P> angle) noexcept -> Fixed64<P> {
-        constexpr auto kTwoPi = Fixed64<P>::TwoPi();
+    static constexpr auto NormalizeAngle(Fixed64<P> angle) noexcept -> Fixed64<P> {
+        constexpr int64_t kTwoPi = Fixed64<P>::TwoPi().value();
+        if (angle.value() < 0 || angle.value() >= kTwoPi) {
+            Fixed64Instrumentation::Record(Fixed64Event::kAngleWrap);
+        }
+        const int64_t r = Primitives::RemConstant<kTwoPi>(angle.value());
+        return Fixed64<P>(r + (kTwoPi & (r >> 63)), detail::nothing{});
+    }
+
+    // Lookup tables for PrefetchTables and WarmTables, combined with |
+    enum LookupTable : unsigned {
+        kSinTable = 1u << 0,    // Sin, Cos, SinCos and their batch versions (4 KB)
+        kTanTable = 1u << 1,    // Tan, TanBatch (4 KB)
+        kAtanTable = 1u << 2,   // Atan (4 KB)
+        kAtan2Table = 1u << 3,  // Atan2, Atan2Batch (2 KB)
+        kAcosTable = 1u << 4,   // Acos, Asin (11 KB)
+        kExpTable = 1u << 5,    // Pow2, Exp, Log, Pow with FIXED64_MATH_USE_LUT_EXP (1.5 KB)
+        kAllTables = (1u << 6) - 1,
+    };
+
+    /**
+     * @brief Start loading lookup tables into the caches, e.g. at the start of a frame
+     * @param tables LookupTable mask of the tables to prefetch
+     * @note Issues one prefetch hint per 64-byte line and returns without waiting, so the
+     * loads overlap with other work; all tables together are about 430 lines
+     */
+    static auto PrefetchTables(unsigned tables = kAllTables) noexcept -> void {
+        ForEachTable(tables, [](const auto& table) { detail::PrefetchLut(table); });
+    }
 
-        // Fast path for common case - already in range
-        if (angle >= Fixed64<P>::Zero() && angle < kTwoPi) {
-            return angle;
+    /**
+     * @brief Load lookup tables into the caches and the TLB before returning
+     * @param tables LookupTable mask of the tables to load
+     * @note Reads one word per line; unlike a prefetch hint this cannot be dropped, so the
+     * next lookup is a cache hit, at the cost of waiting for the loads
+     */
+    static auto WarmTables(unsigned tables = kAllTables) noexcept -> void {
+        ForEachTable(tables, [](const auto& table) { detail::TouchLut(table); });
+    }
+
+ private:
+    template <typename Visit>
+    static auto ForEachTable(unsigned tables, Visit visit) noexcept -> void {
+        if (tables & kSinTable) {
+            visit(detail::kSinLut);
+        }
+        if (tables & kTanTable) {
+            visit(detail::kTanLut);
+        }
+        if (tables & kAtanTable) {
+            visit(detail::kAtanLut);
         }
+        if (tables & kAtan2Table) {
+            visit(detail::kAtan2LUT);
+        }
+        if (tables & kAcosTable) {
+            visit(detail::AcosLut);
+            visit(detail::AcosDyDxLut);
+        }
+        if (tables & kExpTable) {
+            visit(detail::kExp2Lut);
+            visit(detail::kLog2InvLut);
+            visit(detail::kLog2Lut);
+        }
+    }
 
-        // Optimized implementation to handle both positive and negative angles
-        // Avoid division when possible, use incremental adjustment for small values
-        if (angle >= -kTwoPi && angle < kTwoPi) {
-            // For angles close to range, simple addition is more precise
-            if (angle < Fixed64<P>::Zero()) {
-                return angle + kTwoPi;
+    // Exact two's complement 128-bit sum of the raw values of x, on at most max_threads threads
+    template <int P>
+    static auto SumRaw128(std::span<const Fixed64<P>> x, uint64_t& hi, uint64_t& lo,
+                          size_t max_threads) noexcept -> void {
+        struct Part {
+            uint64_t hi;
+            uint64_t lo;
+        };
+        Part parts[detail::kMaxReduceParts];
+        const int64_t* raw = detail::RawWords(x);
+        auto part = [&](size_t p, size_t begin, size_t end) {
+            Part sum{0, 0};
+            // One chunk at a time keeps the lane sums of SumBatch below 2^32 elements
+            for (size_t block = begin; block < end; block += detail::kChunkSize) {
+                const size_t block_end = std::min(block + detail::kChunkSize, end);
+                size_t i = block + detail::SumBatch(raw + block, block_end - block, sum.hi, sum.lo);
+                for (; i < block_end; ++i) {
+                    const uint64_t v = static_cast<uint64_t>(raw[i]);
+                    sum.lo += v;
+                    sum.hi += static_cast<uint64_t>(raw[i] >> 63) + ((sum.lo < v) ? 1 : 0);
+                }
             }
-            return angle;  // Already in range
+            parts[p] = sum;
+        };
+        const size_t count = detail::ForEachPart(x.size(), part, max_threads);
+
+        hi = 0;
+        lo = 0;
+        for (size_t p = 0; p < count; ++p) {
+            lo += parts[p].lo;
+            hi += parts[p].hi + ((lo < parts[p].lo) ? 1 : 0);
         }
+    }
 
-        // For larger out-of-range values, use modulo approach
-        // But implement it in a more numerically stable way
-
-        // Get the fractional part (this is more precise than division+multiplication)
-        // Use repeated subtraction or addition for better precision
-        auto result = angle;
+    // round((a * 2^P + b * x) / 2^kShift), computed exactly in 128 bits and rounded to
+    // nearest, ties to even, without branches: adding 2^(kShift-1) - 1 plus the lowest kept bit
+    // turns the arithmetic shift into the rounding
+    template <int P, int kShift>
+    static constexpr auto MulAddRaw(int64_t a, int64_t b, int64_t x) noexcept -> int64_t {
+        static_assert(kShift > 0 && kShift < 64, "Shift out of range");
+        uint64_t hi = static_cast<uint64_t>(a >> (64 - P));
+        uint64_t lo = static_cast<uint64_t>(a) << P;
+        Primitives::MulAdd128(b, x, hi, lo);
+        const uint64_t bias = ((uint64_t(1) << (kShift - 1)) - 1)
+                            + (((lo >> kShift) | (hi << (64 - kShift))) & 1);
+        lo += bias;
+        hi += lo < bias ? 1 : 0;
+        return static_cast<int64_t>((lo >> kShift) | (hi << (64 - kShift)));
+    }
 
-        if (result >= kTwoPi) {
-            // Optimize for common case of small multiples of 2π
-            while (result >= kTwoPi) {
-                result -= kTwoPi;
+    /**
+     * Estrin's scheme on raw coefficients with kExtraBits more fraction bits than x: each level
+     * folds neighbouring pairs with one rounded multiply-add by the current power of x and
+     * squares the power, and the final multiply-add rounds the extra bits away
+     */
+    template <int P, int kExtraBits, size_t N>
+    static constexpr auto EstrinRaw(const std::array<int64_t, N>& c, int64_t x) noexcept
+        -> int64_t {
+        static_assert(P > 0 && P + kExtraBits < 64, "EvalPoly requires 0 < P < 64");
+        static_assert(N > 0, "EvalPoly requires at least one coefficient");
+        if constexpr (N == 1) {
+            return MulAddRaw<P, P + kExtraBits>(c[0], 0, 0);
+        } else if constexpr (N == 2) {
+            return MulAddRaw<P, P + kExtraBits>(c[0], c[1], x);
+        } else {
+            std::array<int64_t, (N + 1) / 2> folded{};
+            for (size_t i = 0; i < N / 2; ++i) {
+                folded[i] = MulAddRaw<P, P>(c[2 * i], c[2 * i + 1], x);
             }
-        } else if (result < Fixed64<P>::Zero()) {
-            // Optimize for common case of small negative angles
-            while (result < Fixed64<P>::Zero()) {
-                result += kTwoPi;
+            if constexpr (N % 2 != 0) {
+                folded[N / 2] = c[N - 1];
             }
+            return EstrinRaw<P, kExtraBits>(folded, MulAddRaw<P, P>(0, x, x));
         }
+    }
 
-        // Final range check to guarantee [0, 2π) range due to potential precision issues
-        if (result >= kTwoPi) {
-            result = Fixed64<P>::Zero();  // Handle precision edge case
-        }
+    // Doubled power-basis coefficients of the uniform Catmull-Rom segment from p1 to p2
+    static constexpr auto CatmullRomRaw(int64_t p0, int64_t p1, int64_t p2, int64_t p3) noexcept
+        -> std::array<int64_t, 4> {
+        return {2 * p1, p2 - p0, 2 * p0 - 5 * p1 + 4 * p2 - p3, 3 * (p1 - p2) + p3 - p0};
+    }
 
-        return result;
+    // (hi:lo) / n rounded to nearest, ties away from zero, for a quotient within int64_t
+    static auto DivRound128(uint64_t hi, uint64_t lo, uint64_t n) noexcept -> int64_t {
+        const uint64_t sign = static_cast<uint64_t>(static_cast<int64_t>(hi) >> 63);
+        // Magnitude: two's complement negation of a negative total
+        uint64_t mag_lo = (lo ^ sign) - sign;
+        uint64_t mag_hi = (hi ^ sign) + ((sign != 0 && lo == 0) ? 1 : 0);
+        const uint64_t half = n / 2;
+        mag_lo += half;
+        mag_hi += (mag_lo < half) ? 1 : 0;
+        const uint64_t q = Primitives::DivU128ToU64(mag_hi, mag_lo, n);
+        return static_cast<int64_t>((q ^ sign) - sign);
+    }
+
+    /**
+     * @brief Calculate e^(y*ln(x)) for x > 0, the general case of Pow
+     * @note With FIXED64_MATH_USE_LUT_EXP the product is formed from log2(x) with 56 fraction
+     * bits, so it is not rounded to P bits before the exponential
+     */
+    template <int P>
+    [[nodiscard]] static constexpr auto ExpLog(Fixed64<P> x, Fixed64<P> y) noexcept -> Fixed64<P> {
+        if constexpr (FIXED64_MATH_USE_LUT_EXP && detail::kExpLutSupported<P>) {
+            if (x == Fixed64<P>::Zero()) {
+                return Fixed64<P>::Zero();
+            }
+            return Fixed64<P>(detail::LookupPow<P>(x.value(), y.value()), detail::nothing{});
+        } else {
+            return Exp(y * Log(x));
+        }
     }
 };
 }  // namespace math::fp
 
 namespace std {
-// Trigonometric function support (requires P >= kTrigFractionBits)
+// Trigonometric function support
 template <int P>
-    requires(P >= ::math::fp::kTrigFractionBits)
 inline auto sin(const ::math::fp::Fixed64<P>& x) noexcept -> ::math::fp::Fixed64<P> {
     return ::math::fp::Fixed64Math::Sin(x);
 }
 
 template <int P>
-    requires(P >= ::math::fp::kTrigFractionBits)
 inline auto cos(const ::math::fp::Fixed64<P>& x) noexcept -> ::math::fp::Fixed64<P> {
     return ::math::fp::Fixed64Math::Cos(x);
 }
 
 template <int P>
-    requires(P >= ::math::fp::kTrigFractionBits)
 inline auto tan(const ::math::fp::Fixed64<P>& x) noexcept -> ::math::fp::Fixed64<P> {
     return ::math::fp::Fixed64Math::Tan(x);
 }
 
 template <int P>
-    requires(P >= ::math::fp::kTrigFractionBits)
 inline auto asin(const ::math::fp::Fixed64<P>& x) noexcept -> ::math::fp::Fixed64<P> {
     return ::math::fp::Fixed64Math::Asin(x);
 }
 
 template <int P>
-    requires(P >= ::math::fp::kTrigFractionBits)
 inline auto acos(const ::math::fp::Fixed64<P>& x) noexcept -> ::math::fp::Fixed64<P> {
     return ::math::fp::Fixed64Math::Acos(x);
 }
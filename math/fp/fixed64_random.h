@@ -1,11 +1,16 @@
 #pragma once
 
 #include <stdlib.h>
+#include <algorithm>
 #include <cstdint>
 #include <random>
+#include <span>
 #include <vector>
 
+#include "detail/batch_kernels.h"
+#include "detail/raw_words.h"
 #include "fixed64.h"
+#include "fixed64_execution.h"
 #include "fixed64_math.h"
 
 namespace math::fp {
@@ -14,12 +19,20 @@ namespace math::fp {
  * @brief A deterministic random number generator for fixed-point numbers
  *
  * This class provides a deterministic random number generator that produces
- * fixed-point numbers with guaranteed cross-platform consistency. It uses
- * a combination of Mersenne Twister for high-quality random numbers and
- * custom algorithms for fixed-point number generation.
+ * fixed-point numbers with guaranteed cross-platform consistency, using integer
+ * generators and custom algorithms for fixed-point number generation.
+ *
+ * Two generators are available:
+ * - Sequential (the default): a 32-bit xorshift over the seed, one step per value
+ * - Counter-based (CounterBased): value i of a stream is a SplitMix64 hash of
+ *   (seed, stream, i), so skip(n) and fork(stream) are O(1) and every entity or
+ *   worker thread can draw from its own stream and still replay deterministically
  *
  * Features:
  * - Deterministic random number generation
+ * - Jumping ahead (skip) and independent sub-streams (fork)
+ * - Bulk generation into spans (fill, fillIntegers, fillBernoulli), optionally split across
+ *   threads by an execution policy with the same values
  * - Support for various fixed-point number types
  * - Weighted random selection
  * - Probability-based decision making
@@ -29,8 +42,76 @@ class Fixed64Random {
  private:
     int32_t seed = 0;
     int32_t randomCount = 0;
-    std::mt19937 rng;
-    constexpr static Fixed64_16 INT32_MAX_PLUS_ONE = Fixed64_16(INT32_MAX) + Fixed64_16(1);
+    bool counterBased = false;
+    uint64_t counterKey = 0;
+    uint64_t counterIndex = 0;
+    constexpr static uint64_t kGoldenGamma = 0x9E3779B97F4A7C15ULL;
+    constexpr static size_t kFillBlock = 256;
+
+    // SplitMix64 finalizer: a bijective mix of all 64 bits
+    [[nodiscard]] static constexpr auto mix64(uint64_t z) noexcept -> uint64_t {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // Key of stream `stream` under `parentKey`; distinct streams get unrelated keys
+    [[nodiscard]] static constexpr auto streamKey(uint64_t parentKey, uint64_t stream) noexcept
+        -> uint64_t {
+        return mix64(parentKey ^ mix64((stream + 1) * kGoldenGamma));
+    }
+
+    // One xorshift32 step, linear over GF(2)
+    [[nodiscard]] static constexpr auto xorshiftStep(int32_t x) noexcept -> int32_t {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        return x;
+    }
+
+    // Fraction in [0, 1) of a draw: (draw & INT32_MAX) / 2^31, as a shift since the divisor is a
+    // power of two
+    [[nodiscard]] static constexpr auto unitFraction(int32_t draw) noexcept -> Fixed64_16 {
+        return Fixed64_16((static_cast<int64_t>(draw) & INT32_MAX) >> 15, detail::nothing{});
+    }
+
+    // The next count values of next(), with the same effect on the generator state
+    auto nextBlock(uint32_t* draws, size_t count) noexcept -> void {
+        randomCount = static_cast<int32_t>(static_cast<uint32_t>(randomCount)
+                                           + static_cast<uint32_t>(count));
+        if (counterBased) {
+            const uint64_t first = counterIndex + 1;
+            size_t i = detail::CounterDrawBatch(counterKey, first, kGoldenGamma, draws, count);
+            for (; i < count; ++i) {
+                const uint64_t counter = counterKey + (first + i) * kGoldenGamma;
+                draws[i] = static_cast<uint32_t>(mix64(counter) >> 32);
+            }
+            counterIndex += count;
+            return;
+        }
+
+        // Each xorshift state depends on the previous one, so this loop stays scalar
+        int32_t state = seed;
+        for (size_t i = 0; i < count; ++i) {
+            state = xorshiftStep(state);
+            draws[i] = static_cast<uint32_t>(state);
+        }
+        seed = state;
+    }
+
+    // Call fillChunk(generator, begin, end) for the fixed chunks of [0, count) as the policy
+    // directs, each with a copy of this generator skipped to the chunk start, then advance this
+    // generator past all count values
+    template <typename Policy, typename FillChunk>
+    auto fillChunks(const Policy& policy, size_t count, FillChunk fillChunk) noexcept -> void {
+        const Fixed64Random start = *this;
+        detail::ForEachChunk(policy, count, [&](size_t begin, size_t end) {
+            Fixed64Random generator = start;
+            generator.skip(begin);
+            fillChunk(generator, begin, end);
+        });
+        skip(count);
+    }
 
  public:
     /**
@@ -42,18 +123,50 @@ class Fixed64Random {
     }
 
     /**
-     * @brief Set the random number generator seed
+     * @brief Create a counter-based generator
+     * @param seed Seed shared by all streams of a simulation (any value, including 0)
+     * @param stream Stream identifier, e.g. an entity or worker index
+     * @return Generator at index 0 of the stream
+     */
+    [[nodiscard]] static auto CounterBased(uint64_t seed, uint64_t stream = 0) noexcept
+        -> Fixed64Random {
+        Fixed64Random generator(1);
+        generator.seed = static_cast<int32_t>(seed);
+        generator.counterBased = true;
+        generator.counterKey = streamKey(mix64(seed), stream);
+        return generator;
+    }
+
+    /**
+     * @brief Set the random number generator seed, switching to the sequential generator
      * @param seed New seed value (0 for random seed)
      */
     auto setSeed(int32_t seed = 0) noexcept -> void {
         randomCount = 0;
+        counterBased = false;
+        counterKey = 0;
+        counterIndex = 0;
         if (seed == 0) {
             std::random_device rd;
             this->seed = rd() % (INT32_MAX);
         } else {
             this->seed = seed;
         }
-        rng.seed(this->seed);
+    }
+
+    /**
+     * @brief Whether values are a function of (seed, stream, index)
+     */
+    [[nodiscard]] auto isCounterBased() const noexcept -> bool {
+        return counterBased;
+    }
+
+    /**
+     * @brief Index of the next value in a counter-based stream
+     * @return Values drawn or skipped since creation (0 for the sequential generator)
+     */
+    [[nodiscard]] auto getIndex() const noexcept -> uint64_t {
+        return counterIndex;
     }
 
     /**
@@ -77,8 +190,7 @@ class Fixed64Random {
      * @return Random number in range [0, 1)
      */
     [[nodiscard]] auto random() noexcept -> Fixed64_16 {
-        int32_t nextRandom = next();
-        return Fixed64_16(nextRandom & INT32_MAX) / INT32_MAX_PLUS_ONE;
+        return unitFraction(next());
     }
 
     /**
@@ -113,13 +225,103 @@ class Fixed64Random {
      * @return Next random integer
      */
     [[nodiscard]] auto next() noexcept -> int32_t {
-        int32_t x = seed;
-        x ^= x << 13;
-        x ^= x >> 17;
-        x ^= x << 5;
-        seed = x;
         randomCount++;
-        return x;
+        if (counterBased) {
+            return static_cast<int32_t>(mix64(counterKey + ++counterIndex * kGoldenGamma) >> 32);
+        }
+        seed = xorshiftStep(seed);
+        return seed;
+    }
+
+    /**
+     * @brief Generate a random 64-bit word from two consecutive values
+     * @return Uniform random integer in [0, 2^64)
+     */
+    [[nodiscard]] auto nextUInt64() noexcept -> uint64_t {
+        const uint64_t hi = static_cast<uint32_t>(next());
+        return (hi << 32) | static_cast<uint32_t>(next());
+    }
+
+    /**
+     * @brief Generate an exactly uniform integer in [0, bound)
+     *
+     * Lemire's multiply-and-reject method: the high word of a 64x64 product picks the value
+     * and the rare low words that would bias it are redrawn, so no division is needed except
+     * on the (unlikely) rejection path.
+     *
+     * @param bound Exclusive upper bound
+     * @return Uniform random integer in [0, bound), or 0 if bound is 0
+     */
+    [[nodiscard]] auto nextBounded(uint64_t bound) noexcept -> uint64_t {
+        uint64_t hi, lo;
+        umul_ppmm(hi, lo, nextUInt64(), bound);
+        if (lo < bound) {
+            const uint64_t threshold = (0 - bound) % bound;
+            while (lo < threshold) {
+                umul_ppmm(hi, lo, nextUInt64(), bound);
+            }
+        }
+        return hi;
+    }
+
+    /**
+     * @brief Advance the generator as if next() had been called n times
+     * @param n Number of values to skip
+     * @note O(1) for counter-based generators; the sequential xorshift is jumped with
+     * O(log n) squarings of its 32x32 bit matrix
+     */
+    auto skip(uint64_t n) noexcept -> void {
+        randomCount =
+            static_cast<int32_t>(static_cast<uint32_t>(randomCount) + static_cast<uint32_t>(n));
+        if (counterBased) {
+            counterIndex += n;
+            return;
+        }
+
+        // Columns of the step matrix: column j is the step applied to bit j
+        uint32_t matrix[32];
+        for (int j = 0; j < 32; ++j) {
+            matrix[j] = static_cast<uint32_t>(xorshiftStep(static_cast<int32_t>(1u << j)));
+        }
+        auto apply = [](const uint32_t* m, uint32_t v) {
+            uint32_t r = 0;
+            for (int j = 0; j < 32; ++j) {
+                r ^= m[j] & (0u - ((v >> j) & 1u));
+            }
+            return r;
+        };
+
+        uint32_t state = static_cast<uint32_t>(seed);
+        for (; n != 0; n >>= 1) {
+            if (n & 1) {
+                state = apply(matrix, state);
+            }
+            uint32_t squared[32];
+            for (int j = 0; j < 32; ++j) {
+                squared[j] = apply(matrix, matrix[j]);
+            }
+            std::copy(squared, squared + 32, matrix);
+        }
+        seed = static_cast<int32_t>(state);
+    }
+
+    /**
+     * @brief Derive an independent counter-based generator for a sub-stream
+     *
+     * The child depends only on this generator's seed and stream (not on how many values
+     * were drawn) and on streamId, so forking the same id always yields the same sequence.
+     * Forking a sequential generator keys the child from the current seed.
+     *
+     * @param streamId Identifier of the sub-stream
+     * @return Generator at index 0 of the sub-stream
+     */
+    [[nodiscard]] auto fork(uint64_t streamId) const noexcept -> Fixed64Random {
+        Fixed64Random child(1);
+        child.seed = seed;
+        child.counterBased = true;
+        child.counterKey = streamKey(counterBased ? counterKey : mix64(static_cast<uint32_t>(seed)),
+                                     streamId);
+        return child;
     }
 
     /**
@@ -157,10 +359,129 @@ class Fixed64Random {
         return static_cast<int32_t>(random(min, max));
     }
 
+    /**
+     * @brief Fill a span with random fixed-point numbers in range [min, max)
+     *
+     * The generator output is produced a block at a time (vectorized for counter-based
+     * generators) and converted with batch kernels, without a divide per value.
+     *
+     * @param out Destination span
+     * @param min Lower bound (inclusive)
+     * @param max Upper bound (exclusive)
+     * @note Writes the same values, and leaves the generator in the same state, as calling
+     * random(min, max) once per element
+     */
+    template <int P>
+    auto fill(std::span<Fixed64<P>> out, Fixed64<P> min, Fixed64<P> max) noexcept -> void {
+        const Fixed64<P> range = max - min;
+        const int64_t min16 = static_cast<Fixed64_16>(min).value();
+        int64_t* raw = detail::RawWords(out);
+        uint32_t draws[kFillBlock];
+        for (size_t offset = 0; offset < out.size(); offset += kFillBlock) {
+            const size_t count = std::min(kFillBlock, out.size() - offset);
+            nextBlock(draws, count);
+            size_t i =
+                detail::UniformFillBatch<P>(draws, range.value(), min16, raw + offset, count);
+            for (; i < count; ++i) {
+                out[offset + i] = static_cast<Fixed64<P>>(
+                    unitFraction(static_cast<int32_t>(draws[i])) * range + min);
+            }
+        }
+    }
+
+    /**
+     * @brief Fill a span with random integers in range [min, max)
+     * @param out Destination span
+     * @param min Lower bound (inclusive)
+     * @param max Upper bound (exclusive)
+     * @note Writes the same values, and leaves the generator in the same state, as calling
+     * randomInteger(min, max) once per element
+     */
+    auto fillIntegers(std::span<int32_t> out, int32_t min, int32_t max) noexcept -> void {
+        const int64_t range = static_cast<int64_t>(max) - min;
+        const int64_t min16 = static_cast<int64_t>(min) << 16;
+        uint32_t draws[kFillBlock];
+        for (size_t offset = 0; offset < out.size(); offset += kFillBlock) {
+            const size_t count = std::min(kFillBlock, out.size() - offset);
+            nextBlock(draws, count);
+            size_t i = detail::IntegerFillBatch(draws, range, min16, out.data() + offset, count);
+            for (; i < count; ++i) {
+                const int64_t u = unitFraction(static_cast<int32_t>(draws[i])).value();
+                out[offset + i] = static_cast<int32_t>((u * range + min16) >> 16);
+            }
+        }
+    }
+
+    /**
+     * @brief Fill a span with random decisions that are true with the given probability
+     * @param out Destination span
+     * @param probability Probability of true [0, 1]
+     * @note Writes the same values, and leaves the generator in the same state, as calling
+     * result01(probability) once per element; no values are drawn for a probability outside
+     * (0, 1)
+     */
+    auto fillBernoulli(std::span<bool> out, const Fixed64_16& probability) noexcept -> void {
+        if (probability <= Fixed64_16::Zero() || probability >= Fixed64_16::One()) {
+            std::fill(out.begin(), out.end(), probability >= Fixed64_16::One());
+            return;
+        }
+        const int64_t threshold = probability.value();
+        uint32_t draws[kFillBlock];
+        for (size_t offset = 0; offset < out.size(); offset += kFillBlock) {
+            const size_t count = std::min(kFillBlock, out.size() - offset);
+            nextBlock(draws, count);
+            for (size_t i = 0; i < count; ++i) {
+                out[offset + i] = unitFraction(static_cast<int32_t>(draws[i])).value() < threshold;
+            }
+        }
+    }
+
+    /**
+     * @brief fill, fillIntegers and fillBernoulli under an execution policy
+     *
+     * Each 16384-value chunk is filled by a copy of the generator skipped to the chunk's first
+     * index (O(1) for counter-based generators, an O(log n) jump of the sequential xorshift),
+     * so the values and the final generator state are the same as without a policy for any
+     * thread count.
+     *
+     * Usage:
+     *   auto rng = Fixed64Random::CounterBased(seed);
+     *   rng.fill<32>(execution::par, noise, Fixed64_32(-1), Fixed64_32(1));
+     */
+    template <int P, ExecutionPolicy Policy>
+    auto fill(const Policy& policy, std::span<Fixed64<P>> out, Fixed64<P> min,
+              Fixed64<P> max) noexcept -> void {
+        fillChunks(policy, out.size(), [&](Fixed64Random& generator, size_t begin, size_t end) {
+            generator.fill(out.subspan(begin, end - begin), min, max);
+        });
+    }
+
+    template <ExecutionPolicy Policy>
+    auto fillIntegers(const Policy& policy, std::span<int32_t> out, int32_t min,
+                      int32_t max) noexcept -> void {
+        fillChunks(policy, out.size(), [&](Fixed64Random& generator, size_t begin, size_t end) {
+            generator.fillIntegers(out.subspan(begin, end - begin), min, max);
+        });
+    }
+
+    template <ExecutionPolicy Policy>
+    auto fillBernoulli(const Policy& policy, std::span<bool> out,
+                       const Fixed64_16& probability) noexcept -> void {
+        if (probability <= Fixed64_16::Zero() || probability >= Fixed64_16::One()) {
+            fillBernoulli(out, probability);  // Draws nothing
+            return;
+        }
+        fillChunks(policy, out.size(), [&](Fixed64Random& generator, size_t begin, size_t end) {
+            generator.fillBernoulli(out.subspan(begin, end - begin), probability);
+        });
+    }
+
     /**
      * @brief Select a random index based on weights
      * @param weights Vector of weights for each index
      * @return Selected index, or -1 if weights are empty or invalid
+     * @note Linear in the number of weights; tables that are sampled repeatedly should build a
+     * Fixed64AliasTable or Fixed64CumulativeTable (fixed64_sampling.h) once instead
      */
     [[nodiscard]] auto randomWeights(const std::vector<Fixed64_16>& weights) noexcept -> int {
         if (weights.empty()) {
@@ -0,0 +1,292 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "detail/raw_words.h"
+#include "fixed64.h"
+#include "fixed64_random.h"
+
+namespace math::fp {
+
+/**
+ * @brief Weighted sampling in constant time with Walker/Vose alias tables
+ *
+ * The table is built once from non-negative fixed-point weights; every Sample then costs two
+ * bounded random integers and one table lookup, independent of the number of entries. Item i
+ * is drawn with probability weights[i] / sum(weights), computed entirely in 64-bit integer
+ * arithmetic, so every platform builds the same table and picks the same item for the same
+ * generator state.
+ *
+ * The probabilities are exact when sum(raw weights) * size() < 2^62. Larger tables or weights
+ * are first divided by a common power of two, rounding up so that no positive weight drops to
+ * zero.
+ *
+ * Usage:
+ *   const Fixed64AliasTable loot(std::span<const Fixed64_16>(weights));
+ *   const int item = loot.Sample(random);
+ */
+class Fixed64AliasTable {
+ public:
+    Fixed64AliasTable() = default;
+
+    /**
+     * @brief Build the table
+     * @param weights Non-negative weights, at most 2^30 of them
+     * @note The table is empty (Sample returns -1) if the weights are empty, contain a
+     * negative value or sum to zero
+     */
+    template <int P>
+    explicit Fixed64AliasTable(std::span<const Fixed64<P>> weights) {
+        Build(detail::RawWords(weights), weights.size());
+    }
+
+    template <int P>
+    explicit Fixed64AliasTable(const std::vector<Fixed64<P>>& weights)
+        : Fixed64AliasTable(std::span<const Fixed64<P>>(weights)) {}
+
+    // Number of entries, 0 for an empty or invalid table
+    [[nodiscard]] auto size() const noexcept -> size_t {
+        return buckets_.size();
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return buckets_.empty();
+    }
+
+    /**
+     * @brief Draw an index with probability proportional to its weight
+     * @param random Generator to draw from
+     * @return Selected index, or -1 if the table is empty
+     */
+    [[nodiscard]] auto Sample(Fixed64Random& random) const noexcept -> int {
+        if (buckets_.empty()) {
+            return -1;
+        }
+        const uint64_t j = random.nextBounded(buckets_.size());
+        const uint64_t u = random.nextBounded(total_);
+        const Bucket& bucket = buckets_[j];
+        return static_cast<int>(u < bucket.threshold ? j : bucket.alias);
+    }
+
+    /**
+     * @brief Share of the table that selects an index
+     * @return Mass(index) / (size() * Total()) is the exact probability that Sample returns
+     * index; O(size()), intended for validation
+     */
+    [[nodiscard]] auto Mass(size_t index) const noexcept -> uint64_t {
+        uint64_t mass = 0;
+        for (size_t j = 0; j < buckets_.size(); ++j) {
+            mass += (j == index ? buckets_[j].threshold : 0)
+                  + (buckets_[j].alias == index ? total_ - buckets_[j].threshold : 0);
+        }
+        return mass;
+    }
+
+    // Sum of the (possibly rescaled) integer weights
+    [[nodiscard]] auto Total() const noexcept -> uint64_t {
+        return total_;
+    }
+
+ private:
+    // Bucket j keeps itself for u < threshold and hands the rest of [0, total) to alias
+    struct Bucket {
+        uint64_t threshold;
+        uint32_t alias;
+    };
+
+    static constexpr uint64_t kMaxScaledTotal = uint64_t(1) << 62;
+    static constexpr size_t kMaxEntries = size_t(1) << 30;
+
+    auto Build(const int64_t* raw, size_t n) -> void {
+        if (n == 0 || n > kMaxEntries) {
+            return;
+        }
+
+        // Exact 128-bit total, to pick the smallest power-of-two unit that keeps
+        // total * n within 62 bits
+        uint64_t sum_hi = 0;
+        uint64_t sum_lo = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (raw[i] < 0) {
+                return;
+            }
+            sum_lo += static_cast<uint64_t>(raw[i]);
+            sum_hi += sum_lo < static_cast<uint64_t>(raw[i]) ? 1 : 0;
+        }
+        if ((sum_hi | sum_lo) == 0) {
+            return;
+        }
+        int shift = 0;
+        if (sum_hi != 0 || sum_lo > kMaxScaledTotal / n) {
+            // Rounding up adds less than one unit per entry
+            shift = 1;
+            while (((sum_lo >> shift) | (sum_hi << (64 - shift))) + n > kMaxScaledTotal / n) {
+                ++shift;
+            }
+        }
+
+        std::vector<uint64_t> scaled(n);
+        total_ = 0;
+        for (size_t i = 0; i < n; ++i) {
+            const uint64_t w = static_cast<uint64_t>(raw[i]);
+            const uint64_t unit = shift == 0 || w == 0 ? w : ((w - 1) >> shift) + 1;
+            total_ += unit;
+            scaled[i] = unit * n;
+        }
+
+        // Vose: pair each under-full bucket with an over-full entry; integer arithmetic keeps
+        // the invariant sum(scaled) == n * total exact, so no bucket is left over
+        buckets_.resize(n);
+        std::vector<uint32_t> small;
+        std::vector<uint32_t> large;
+        for (size_t i = 0; i < n; ++i) {
+            (scaled[i] < total_ ? small : large).push_back(static_cast<uint32_t>(i));
+        }
+        while (!small.empty() && !large.empty()) {
+            const uint32_t s = small.back();
+            const uint32_t l = large.back();
+            small.pop_back();
+            buckets_[s] = {scaled[s], l};
+            scaled[l] -= total_ - scaled[s];
+            if (scaled[l] < total_) {
+                large.pop_back();
+                small.push_back(l);
+            }
+        }
+        for (const uint32_t i : large) {
+            buckets_[i] = {total_, i};
+        }
+        for (const uint32_t i : small) {
+            buckets_[i] = {total_, i};
+        }
+    }
+
+    std::vector<Bucket> buckets_;
+    uint64_t total_ = 0;
+};
+
+/**
+ * @brief Weighted sampling over cumulative sums, for weights that change often
+ *
+ * A Fenwick tree of the raw weights: Update changes one weight and Sample finds the drawn
+ * cumulative position by binary descent, both in O(log n). Item i is drawn with probability
+ * weights[i] / Total() exactly, using integer arithmetic only.
+ *
+ * Usage:
+ *   Fixed64CumulativeTable spawns(std::span<const Fixed64_16>(weights));
+ *   spawns.Update(3, Fixed64_16::Zero());  // the entry is exhausted
+ *   const int entry = spawns.Sample(random);
+ */
+class Fixed64CumulativeTable {
+ public:
+    Fixed64CumulativeTable() = default;
+
+    /**
+     * @brief Build the table
+     * @param weights Non-negative weights whose raw sum fits in 63 bits
+     * @note The table is empty (Sample returns -1) if a weight is negative or the sum
+     * overflows
+     */
+    template <int P>
+    explicit Fixed64CumulativeTable(std::span<const Fixed64<P>> weights) {
+        const auto* raw = detail::RawWords(weights);
+        uint64_t total = 0;
+        for (size_t i = 0; i < weights.size(); ++i) {
+            if (raw[i] < 0 || static_cast<uint64_t>(raw[i]) > uint64_t(INT64_MAX) - total) {
+                return;
+            }
+            total += static_cast<uint64_t>(raw[i]);
+        }
+
+        weights_.assign(raw, raw + weights.size());
+        tree_.assign(weights.size() + 1, 0);
+        for (size_t i = 1; i <= weights.size(); ++i) {
+            // Linear-time build: each node passes its sum on to its parent
+            tree_[i] += static_cast<uint64_t>(weights_[i - 1]);
+            const size_t parent = i + (i & (0 - i));
+            if (parent < tree_.size()) {
+                tree_[parent] += tree_[i];
+            }
+        }
+        total_ = total;
+    }
+
+    template <int P>
+    explicit Fixed64CumulativeTable(const std::vector<Fixed64<P>>& weights)
+        : Fixed64CumulativeTable(std::span<const Fixed64<P>>(weights)) {}
+
+    [[nodiscard]] auto size() const noexcept -> size_t {
+        return weights_.size();
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return weights_.empty();
+    }
+
+    // Raw sum of all weights
+    [[nodiscard]] auto Total() const noexcept -> uint64_t {
+        return total_;
+    }
+
+    /**
+     * @brief Replace one weight
+     * @param index Entry to change
+     * @param weight New non-negative weight
+     * @return false (and no change) if index is out of range, weight is negative or the total
+     * would overflow
+     */
+    template <int P>
+    auto Update(size_t index, Fixed64<P> weight) noexcept -> bool {
+        const int64_t w = weight.value();
+        if (index >= weights_.size() || w < 0) {
+            return false;
+        }
+        const uint64_t rest = total_ - static_cast<uint64_t>(weights_[index]);
+        if (static_cast<uint64_t>(w) > uint64_t(INT64_MAX) - rest) {
+            return false;
+        }
+
+        // Deltas wrap modulo 2^64, which the tree sums undo exactly
+        const uint64_t delta = static_cast<uint64_t>(w) - static_cast<uint64_t>(weights_[index]);
+        for (size_t i = index + 1; i < tree_.size(); i += i & (0 - i)) {
+            tree_[i] += delta;
+        }
+        weights_[index] = w;
+        total_ = rest + static_cast<uint64_t>(w);
+        return true;
+    }
+
+    /**
+     * @brief Draw an index with probability proportional to its weight
+     * @param random Generator to draw from
+     * @return Selected index, or -1 if the table is empty or all weights are zero
+     */
+    [[nodiscard]] auto Sample(Fixed64Random& random) const noexcept -> int {
+        if (total_ == 0) {
+            return -1;
+        }
+
+        // Smallest index whose inclusive prefix sum exceeds u
+        uint64_t u = random.nextBounded(total_);
+        size_t position = 0;
+        for (size_t step = std::bit_floor(weights_.size()); step != 0; step >>= 1) {
+            const size_t next = position + step;
+            if (next < tree_.size() && tree_[next] <= u) {
+                position = next;
+                u -= tree_[next];
+            }
+        }
+        return static_cast<int>(position);
+    }
+
+ private:
+    std::vector<int64_t> weights_;
+    std::vector<uint64_t> tree_;  // 1-based Fenwick tree of the weights
+    uint64_t total_ = 0;
+};
+
+}  // namespace math::fp
@@ -0,0 +1,416 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "detail/batch_kernels.h"
+#include "detail/raw_words.h"
+#include "fixed64.h"
+#include "primitives.h"
+
+namespace math::fp {
+
+/**
+ * @brief Byte encodings of fixed-point spans for snapshots and network messages
+ *
+ * - Raw: 8 bytes per value, little-endian on every platform
+ * - Varint: zigzag-mapped raw value in LEB128 groups of 7 bits, 1 byte for |raw| < 64 and at
+ *   most 10 bytes
+ * - Delta: the varint encoding of value - baseline (wrapping), for values that change little
+ *   between a snapshot and the one the receiver already has
+ *
+ * Guarantees:
+ * - Every encoding is lossless and produces the same bytes on every platform
+ * - The zigzag and delta passes run on the batch kernels (AVX-512/AVX2/NEON), bit-identical
+ *   to the scalar tail
+ * - Decoders never read past the input span and reject truncated varints and varints of
+ *   more than 64 bits
+ *
+ * Encoders write into a caller buffer and return the number of bytes written, or 0 if the
+ * buffer is too small (MaxVarintSize gives a bound). Decoders return the number of bytes
+ * consumed, or 0 on malformed input; the output is then unspecified.
+ *
+ * Usage:
+ *   std::vector<uint8_t> buffer(Fixed64Serialize::MaxVarintSize(state.size()));
+ *   buffer.resize(Fixed64Serialize::EncodeDelta<32>(state, last_acked, buffer));
+ */
+class Fixed64Serialize {
+ public:
+    // Longest varint of a 64-bit value
+    static constexpr size_t kMaxVarintBytes = 10;
+
+    [[nodiscard]] static constexpr auto MaxVarintSize(size_t count) noexcept -> size_t {
+        return count * kMaxVarintBytes;
+    }
+
+    [[nodiscard]] static constexpr auto ZigZag(int64_t x) noexcept -> uint64_t {
+        return (static_cast<uint64_t>(x) << 1) ^ static_cast<uint64_t>(x >> 63);
+    }
+
+    [[nodiscard]] static constexpr auto UnZigZag(uint64_t code) noexcept -> int64_t {
+        return static_cast<int64_t>((code >> 1) ^ (0 - (code & 1)));
+    }
+
+    /**
+     * @brief Write every raw value as 8 little-endian bytes
+     * @return 8 * values.size(), or 0 if out is too small
+     */
+    template <int P>
+    static auto EncodeRaw(std::span<const Fixed64<P>> values, std::span<uint8_t> out) noexcept
+        -> size_t {
+        if (out.size() < values.size() * 8) {
+            return 0;
+        }
+        uint8_t* dst = out.data();
+        for (const auto& value : values) {
+            StoreLittleEndian(dst, static_cast<uint64_t>(value.value()));
+            dst += 8;
+        }
+        return values.size() * 8;
+    }
+
+    /**
+     * @brief Read values.size() raw values written by EncodeRaw
+     * @return 8 * values.size(), or 0 if in is too short
+     */
+    template <int P>
+    static auto DecodeRaw(std::span<const uint8_t> in, std::span<Fixed64<P>> values) noexcept
+        -> size_t {
+        if (in.size() < values.size() * 8) {
+            return 0;
+        }
+        const uint8_t* src = in.data();
+        for (auto& value : values) {
+            value = Fixed64<P>(static_cast<int64_t>(LoadLittleEndian(src)), detail::nothing{});
+            src += 8;
+        }
+        return values.size() * 8;
+    }
+
+    /**
+     * @brief Write every value as a zigzag varint
+     * @return Bytes written, or 0 if out is too small
+     */
+    template <int P>
+    static auto EncodeVarint(std::span<const Fixed64<P>> values, std::span<uint8_t> out) noexcept
+        -> size_t {
+        return EncodeCodes(detail::RawWords(values), nullptr, values.size(), out);
+    }
+
+    /**
+     * @brief Read values.size() values written by EncodeVarint
+     * @return Bytes consumed, or 0 if in is truncated or malformed
+     */
+    template <int P>
+    static auto DecodeVarint(std::span<const uint8_t> in, std::span<Fixed64<P>> values) noexcept
+        -> size_t {
+        return DecodeCodes(in, nullptr, detail::RawWords(values), values.size());
+    }
+
+    /**
+     * @brief Write every value as the zigzag varint of its difference to baseline
+     * @param values Values to encode
+     * @param baseline Reference values known to the decoder, at least values.size() of them
+     * @param out Destination buffer
+     * @return Bytes written, or 0 if out is too small or baseline too short
+     */
+    template <int P>
+    static auto EncodeDelta(std::span<const Fixed64<P>> values,
+                            std::span<const Fixed64<P>> baseline,
+                            std::span<uint8_t> out) noexcept -> size_t {
+        if (baseline.size() < values.size()) {
+            return 0;
+        }
+        return EncodeCodes(
+            detail::RawWords(values), detail::RawWords(baseline), values.size(), out);
+    }
+
+    /**
+     * @brief Read values.size() values written by EncodeDelta against the same baseline
+     * @return Bytes consumed, or 0 if in is malformed or baseline too short
+     */
+    template <int P>
+    static auto DecodeDelta(std::span<const uint8_t> in,
+                            std::span<const Fixed64<P>> baseline,
+                            std::span<Fixed64<P>> values) noexcept -> size_t {
+        if (baseline.size() < values.size()) {
+            return 0;
+        }
+        return DecodeCodes(in, detail::RawWords(baseline), detail::RawWords(values), values.size());
+    }
+
+ private:
+    // Values per pass of the batch kernels, kept on the stack
+    static constexpr size_t kBlock = 256;
+
+    static auto StoreLittleEndian(uint8_t* dst, uint64_t v) noexcept -> void {
+        for (int i = 0; i < 8; ++i) {
+            dst[i] = static_cast<uint8_t>(v >> (8 * i));
+        }
+    }
+
+    static auto LoadLittleEndian(const uint8_t* src) noexcept -> uint64_t {
+        uint64_t v = 0;
+        for (int i = 7; i >= 0; --i) {
+            v = (v << 8) | src[i];
+        }
+        return v;
+    }
+
+    // Zigzag (of the delta) in blocks on the batch kernels, then the varint bytes
+    static auto EncodeCodes(const int64_t* values,
+                            const int64_t* base,
+                            size_t count,
+                            std::span<uint8_t> out) noexcept -> size_t {
+        int64_t codes[kBlock];
+        uint8_t* dst = out.data();
+        uint8_t* const end = dst + out.size();
+        for (size_t begin = 0; begin < count; begin += kBlock) {
+            const size_t n = std::min(kBlock, count - begin);
+            const int64_t* block_base = base != nullptr ? base + begin : nullptr;
+            size_t i = detail::ZigZagBatch(values + begin, block_base, codes, n);
+            for (; i < n; ++i) {
+                const int64_t x = block_base != nullptr
+                                      ? static_cast<int64_t>(
+                                            static_cast<uint64_t>(values[begin + i])
+                                            - static_cast<uint64_t>(block_base[i]))
+                                      : values[begin + i];
+                codes[i] = static_cast<int64_t>(ZigZag(x));
+            }
+
+            for (i = 0; i < n; ++i) {
+                auto code = static_cast<uint64_t>(codes[i]);
+                if (end - dst < static_cast<ptrdiff_t>(kMaxVarintBytes)
+                    && end - dst < VarintSize(code)) {
+                    return 0;
+                }
+                while (code >= 0x80) {
+                    *dst++ = static_cast<uint8_t>(code | 0x80);
+                    code >>= 7;
+                }
+                *dst++ = static_cast<uint8_t>(code);
+            }
+        }
+        return static_cast<size_t>(dst - out.data());
+    }
+
+    // Varint bytes of every code, then un-zigzag (and add the baseline) on the batch kernels
+    static auto DecodeCodes(std::span<const uint8_t> in,
+                            const int64_t* base,
+                            int64_t* values,
+                            size_t count) noexcept -> size_t {
+        int64_t codes[kBlock];
+        const uint8_t* src = in.data();
+        const uint8_t* const end = src + in.size();
+        for (size_t begin = 0; begin < count; begin += kBlock) {
+            const size_t n = std::min(kBlock, count - begin);
+            for (size_t i = 0; i < n; ++i) {
+                uint64_t code = 0;
+                for (int shift = 0;; shift += 7) {
+                    if (src == end) {
+                        return 0;  // Truncated
+                    }
+                    const uint8_t byte = *src++;
+                    if (shift == 63 && byte > 1) {
+                        return 0;  // More than 64 bits
+                    }
+                    code |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                    if (byte < 0x80) {
+                        break;
+                    }
+                }
+                codes[i] = static_cast<int64_t>(code);
+            }
+
+            const int64_t* block_base = base != nullptr ? base + begin : nullptr;
+            size_t i = detail::UnZigZagBatch(codes, block_base, values + begin, n);
+            for (; i < n; ++i) {
+                const int64_t x = UnZigZag(static_cast<uint64_t>(codes[i]));
+                values[begin + i] = block_base != nullptr
+                                        ? static_cast<int64_t>(static_cast<uint64_t>(x)
+                                                               + static_cast<uint64_t>(block_base[i]))
+                                        : x;
+            }
+        }
+        return static_cast<size_t>(src - in.data());
+    }
+
+    static constexpr auto VarintSize(uint64_t code) noexcept -> ptrdiff_t {
+        ptrdiff_t size = 1;
+        for (; code >= 0x80; code >>= 7) {
+            ++size;
+        }
+        return size;
+    }
+};
+
+/**
+ * @brief Lossy packing of values from a known range into a fixed number of bits
+ *
+ * Values are clamped to [min, max] and mapped to codes 0 .. 2^bits - 1 spread evenly over the
+ * range, then packed little-endian, least significant bit first, into (count * bits + 7) / 8
+ * bytes. The scale and step are precomputed 64-bit reciprocals, so encoding and decoding take
+ * one or two 64x64->128 multiplications per value and no division; both run on the batch
+ * kernels.
+ *
+ * Guarantees:
+ * - Integer arithmetic only, so every platform produces the same codes and values
+ * - Decoded values are within half a quantization step (plus one raw unit) of the clamped
+ *   input, and decoding a decoded value's code again gives the same value
+ * - Lossless when max - min (in raw units) is at most 2^bits - 1
+ *
+ * Usage:
+ *   const Fixed64Quantizer<32> heading(-Fixed64_32::Pi(), Fixed64_32::Pi(), 12);
+ *   std::array<uint8_t, 12> packed;  // 8 headings of 12 bits
+ *   heading.Encode(headings, packed);
+ */
+template <int P>
+class Fixed64Quantizer {
+ public:
+    /**
+     * @brief Prepare the mapping of [min, max] onto bits-bit codes
+     * @param min Smallest representable value
+     * @param max Largest representable value, at least min
+     * @param bits Code width, range 1-64
+     */
+    constexpr Fixed64Quantizer(Fixed64<P> min, Fixed64<P> max, int bits) noexcept
+        : min_(min.value()), max_(std::max(min.value(), max.value())), bits_(bits) {
+        const uint64_t levels = bits >= 64 ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+        const uint64_t span = static_cast<uint64_t>(max_) - static_cast<uint64_t>(min_);
+        if (span <= levels) {
+            // Every raw offset fits in a code
+            scale_ = 0;
+            step_hi_ = 1;
+            step_lo_ = 0;
+        } else {
+            // scale = floor(levels * 2^64 / span) < 2^64 and step = span / levels in 64.64
+            scale_ = Primitives::DivU128ToU64(levels, 0, span);
+            step_hi_ = span / levels;
+            step_lo_ = Primitives::DivU128ToU64(span % levels, 0, levels);
+        }
+    }
+
+    [[nodiscard]] constexpr auto bits() const noexcept -> int {
+        return bits_;
+    }
+
+    // Bytes taken by count packed codes
+    [[nodiscard]] constexpr auto PackedSize(size_t count) const noexcept -> size_t {
+        return (count * static_cast<size_t>(bits_) + 7) / 8;
+    }
+
+    // Code of one value
+    [[nodiscard]] constexpr auto Quantize(Fixed64<P> value) const noexcept -> uint64_t {
+        const int64_t x = std::clamp(value.value(), min_, max_);
+        uint64_t q = static_cast<uint64_t>(x) - static_cast<uint64_t>(min_);
+        if (scale_ != 0) {
+            uint64_t lo;
+            umul_ppmm(q, lo, q, scale_);
+            q += lo >> 63;  // round half up
+        }
+        return q;
+    }
+
+    // Value of one code
+    [[nodiscard]] constexpr auto Dequantize(uint64_t code) const noexcept -> Fixed64<P> {
+        uint64_t frac_hi, frac_lo;
+        umul_ppmm(frac_hi, frac_lo, code, step_lo_);
+        const uint64_t offset = code * step_hi_ + frac_hi + (frac_lo >> 63);
+        return Fixed64<P>(static_cast<int64_t>(static_cast<uint64_t>(min_) + offset),
+                          detail::nothing{});
+    }
+
+    /**
+     * @brief Quantize and pack every value
+     * @return PackedSize(values.size()), or 0 if out is too small
+     */
+    auto Encode(std::span<const Fixed64<P>> values, std::span<uint8_t> out) const noexcept
+        -> size_t {
+        const size_t size = PackedSize(values.size());
+        if (out.size() < size) {
+            return 0;
+        }
+        std::fill_n(out.data(), size, uint8_t(0));
+
+        int64_t codes[kBlock];
+        const auto* raw = detail::RawWords(values);
+        size_t bit = 0;
+        for (size_t begin = 0; begin < values.size(); begin += kBlock) {
+            const size_t n = std::min(kBlock, values.size() - begin);
+            size_t i = detail::QuantizeBatch(raw + begin, min_, max_, scale_, codes, n);
+            for (; i < n; ++i) {
+                codes[i] = static_cast<int64_t>(Quantize(values[begin + i]));
+            }
+            for (i = 0; i < n; ++i, bit += static_cast<size_t>(bits_)) {
+                WriteBits(out.data(), bit, static_cast<uint64_t>(codes[i]));
+            }
+        }
+        return size;
+    }
+
+    /**
+     * @brief Unpack and dequantize values.size() codes written by Encode
+     * @return PackedSize(values.size()), or 0 if in is too short
+     */
+    auto Decode(std::span<const uint8_t> in, std::span<Fixed64<P>> values) const noexcept
+        -> size_t {
+        const size_t size = PackedSize(values.size());
+        if (in.size() < size) {
+            return 0;
+        }
+
+        int64_t codes[kBlock];
+        auto* raw = detail::RawWords(values);
+        size_t bit = 0;
+        for (size_t begin = 0; begin < values.size(); begin += kBlock) {
+            const size_t n = std::min(kBlock, values.size() - begin);
+            for (size_t i = 0; i < n; ++i, bit += static_cast<size_t>(bits_)) {
+                codes[i] = static_cast<int64_t>(ReadBits(in.data(), size, bit));
+            }
+            size_t i = detail::DequantizeBatch(codes, min_, step_hi_, step_lo_, raw + begin, n);
+            for (; i < n; ++i) {
+                values[begin + i] = Dequantize(static_cast<uint64_t>(codes[i]));
+            }
+        }
+        return size;
+    }
+
+ private:
+    static constexpr size_t kBlock = 256;
+
+    // ORs the low bits_ bits of code into the zeroed stream at bit offset bit
+    auto WriteBits(uint8_t* stream, size_t bit, uint64_t code) const noexcept -> void {
+        uint8_t* dst = stream + bit / 8;
+        int offset = static_cast<int>(bit % 8);
+        for (int remaining = bits_; remaining > 0;) {
+            *dst++ |= static_cast<uint8_t>(code << offset);
+            const int taken = 8 - offset;
+            code = taken < 64 ? code >> taken : 0;
+            remaining -= taken;
+            offset = 0;
+        }
+    }
+
+    auto ReadBits(const uint8_t* stream, size_t size, size_t bit) const noexcept -> uint64_t {
+        const uint8_t* src = stream + bit / 8;
+        const uint8_t* end = stream + size;
+        const int offset = static_cast<int>(bit % 8);
+        uint64_t code = 0;
+        for (int shift = -offset; shift < bits_ && src != end; shift += 8, ++src) {
+            code |= shift < 0 ? static_cast<uint64_t>(*src) >> -shift
+                              : static_cast<uint64_t>(*src) << shift;
+        }
+        return bits_ >= 64 ? code : code & ((uint64_t(1) << bits_) - 1);
+    }
+
+    int64_t min_;
+    int64_t max_;
+    int bits_;
+    uint64_t scale_ = 0;
+    uint64_t step_hi_ = 1;
+    uint64_t step_lo_ = 0;
+};
+
+}  // namespace math::fp
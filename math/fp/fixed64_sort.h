@@ -0,0 +1,298 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "detail/batch_kernels.h"
+#include "detail/chunk_pool.h"
+#include "detail/lut_prefetch.h"
+#include "detail/raw_words.h"
+#include "fixed64.h"
+
+namespace math::fp {
+
+namespace detail {
+
+// LSD radix sort on the raw words: 8 passes of 8-bit digits of raw ^ 2^63, which orders the
+// unsigned keys exactly as operator< orders the signed values (NaN first, Infinity last)
+inline constexpr int kRadixBits = 8;
+inline constexpr int kRadixPasses = 64 / kRadixBits;
+inline constexpr size_t kRadixBuckets = size_t(1) << kRadixBits;
+inline constexpr uint64_t kRadixSignFlip = uint64_t(1) << 63;
+
+// Shorter ranges are insertion sorted, cheaper than clearing the histograms
+inline constexpr size_t kRadixInsertionSize = 64;
+
+// LowerBound narrows the range by halving until it fits this many values, then counts them
+inline constexpr size_t kSearchWindow = 16;
+
+using RadixCounts = std::array<size_t, kRadixBuckets>;
+
+// Payload type of a keys-only sort
+struct NoPayload {};
+
+inline auto RadixDigit(int64_t raw, int pass) noexcept -> size_t {
+    return static_cast<size_t>(((static_cast<uint64_t>(raw) ^ kRadixSignFlip) >>
+                                (pass * kRadixBits)) &
+                               (kRadixBuckets - 1));
+}
+
+template <typename V>
+inline auto InsertionSortRaw(int64_t* keys, V* values, size_t count) noexcept -> void {
+    for (size_t i = 1; i < count; ++i) {
+        const int64_t key = keys[i];
+        [[maybe_unused]] V value{};
+        if constexpr (!std::is_same_v<V, NoPayload>) {
+            value = values[i];
+        }
+        size_t j = i;
+        for (; j > 0 && keys[j - 1] > key; --j) {
+            keys[j] = keys[j - 1];
+            if constexpr (!std::is_same_v<V, NoPayload>) {
+                values[j] = values[j - 1];
+            }
+        }
+        keys[j] = key;
+        if constexpr (!std::is_same_v<V, NoPayload>) {
+            values[j] = value;
+        }
+    }
+}
+
+// Move src[begin, end) to dst by one digit, advancing the bucket offsets; stable
+template <typename V>
+inline auto ScatterDigit(const int64_t* src, const V* src_values, int64_t* dst, V* dst_values,
+                         size_t begin, size_t end, int pass, RadixCounts& offsets) noexcept
+    -> void {
+    for (size_t i = begin; i < end; ++i) {
+        const size_t position = offsets[RadixDigit(src[i], pass)]++;
+        dst[position] = src[i];
+        if constexpr (!std::is_same_v<V, NoPayload>) {
+            dst_values[position] = src_values[i];
+        }
+    }
+}
+
+/**
+ * @brief Stable ascending sort of raw words, permuting values alongside (unless NoPayload)
+ *
+ * Up to one chunk (kChunkSize values), the histograms of all passes are counted in a single
+ * read. Longer arrays are split into the parts of ForEachPart: every pass counts each part's
+ * digits in parallel, prefix sums the counts in (digit, part) order and scatters the parts in
+ * parallel, each into its own ranges. Passes in which every key has the same digit are
+ * skipped (found from the histograms, or from one OR of key ^ keys[0] for the parts), so keys
+ * of a narrow range (typical of distances) need fewer than 8. The order is unique, so the
+ * result does not depend on the number of threads.
+ */
+template <typename V>
+inline auto RadixSortRaw(int64_t* keys, V* values, size_t count) -> void {
+    constexpr bool kHasValues = !std::is_same_v<V, NoPayload>;
+    if (count <= kRadixInsertionSize) {
+        InsertionSortRaw(keys, values, count);
+        return;
+    }
+
+    std::vector<int64_t> key_buffer(count);
+    std::vector<V> value_buffer(kHasValues ? count : 0);
+    int64_t* src = keys;
+    int64_t* dst = key_buffer.data();
+    V* src_values = values;
+    V* dst_values = value_buffer.data();
+    auto swap_buffers = [&] {
+        std::swap(src, dst);
+        if constexpr (kHasValues) {
+            std::swap(src_values, dst_values);
+        }
+    };
+
+    if (count <= kChunkSize) {
+        std::array<RadixCounts, kRadixPasses> counts{};
+        for (size_t i = 0; i < count; ++i) {
+            for (int pass = 0; pass < kRadixPasses; ++pass) {
+                ++counts[pass][RadixDigit(src[i], pass)];
+            }
+        }
+        for (int pass = 0; pass < kRadixPasses; ++pass) {
+            RadixCounts& offsets = counts[pass];
+            if (offsets[RadixDigit(src[0], pass)] == count) {
+                continue;
+            }
+            size_t total = 0;
+            for (size_t& bucket : offsets) {
+                const size_t n = bucket;
+                bucket = total;
+                total += n;
+            }
+            ScatterDigit(src, src_values, dst, dst_values, 0, count, pass, offsets);
+            swap_buffers();
+        }
+    } else {
+        // Bits in which some key differs from the first; digits without any are skipped
+        std::array<uint64_t, kMaxReduceParts> part_varying{};
+        const size_t parts = ForEachPart(count, [&](size_t p, size_t begin, size_t end) {
+            uint64_t bits = 0;
+            for (size_t i = begin; i < end; ++i) {
+                bits |= static_cast<uint64_t>(src[i] ^ src[0]);
+            }
+            part_varying[p] = bits;
+        });
+        uint64_t varying = 0;
+        for (size_t p = 0; p < parts; ++p) {
+            varying |= part_varying[p];
+        }
+
+        std::vector<RadixCounts> offsets(parts);
+        for (int pass = 0; pass < kRadixPasses; ++pass) {
+            if (((varying >> (pass * kRadixBits)) & (kRadixBuckets - 1)) == 0) {
+                continue;
+            }
+            ForEachPart(count, [&](size_t p, size_t begin, size_t end) {
+                offsets[p].fill(0);
+                for (size_t i = begin; i < end; ++i) {
+                    ++offsets[p][RadixDigit(src[i], pass)];
+                }
+            });
+
+            size_t total = 0;
+            for (size_t digit = 0; digit < kRadixBuckets; ++digit) {
+                for (size_t p = 0; p < parts; ++p) {
+                    const size_t n = offsets[p][digit];
+                    offsets[p][digit] = total;
+                    total += n;
+                }
+            }
+            ForEachPart(count, [&](size_t p, size_t begin, size_t end) {
+                ScatterDigit(src, src_values, dst, dst_values, begin, end, pass, offsets[p]);
+            });
+            swap_buffers();
+        }
+    }
+
+    // An odd number of passes leaves the result in the buffers
+    if (src != keys) {
+        std::copy_n(src, count, keys);
+        if constexpr (kHasValues) {
+            std::copy_n(src_values, count, values);
+        }
+    }
+}
+
+// Index of the first raw word not below key in sorted data[0, count)
+// Branch-free halving keeps the invariant base <= result <= base + length. The last
+// kSearchWindow words up to base + length are then counted with vector compares instead of
+// searched: every word before the result is below key, so the count locates it
+inline auto LowerBoundRaw(const int64_t* data, size_t count, int64_t key) noexcept -> size_t {
+    size_t less = 0;
+    if (count < kSearchWindow) {
+        for (size_t i = 0; i < count; ++i) {
+            less += static_cast<size_t>(data[i] < key);
+        }
+        return less;
+    }
+
+    size_t base = 0;
+    size_t length = count;
+    while (length > kSearchWindow) {
+        const size_t half = length / 2;
+        // Both possible next probes, so the cache misses of large arrays overlap
+        PrefetchLine(data + base + (length - half) / 2);
+        PrefetchLine(data + base + half + (length - half) / 2);
+        base += static_cast<size_t>(data[base + half] < key) * half;
+        length -= half;
+    }
+    const size_t first = std::min(base, count - kSearchWindow);
+    const int64_t* window = data + first;
+    static_assert(kSearchWindow % kBatchLanes == 0, "The window must be whole vectors");
+    if (CountLessBatch(window, kSearchWindow, key, less) == 0) {
+        for (size_t i = 0; i < kSearchWindow; ++i) {
+            less += static_cast<size_t>(window[i] < key);
+        }
+    }
+    return first + less;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Sort values in ascending order with an LSD radix sort of the raw words
+ *
+ * Produces the same order as std::sort with operator< (NaN first, Infinity last) in linear
+ * time; arrays longer than one 16384-value chunk are sorted on the thread pool (define
+ * FIXED64_USE_THREADS=0 to stay on the calling thread). Allocates a buffer of values.size().
+ *
+ * Usage:
+ *   fp::RadixSort<32>(distances);
+ */
+template <int P>
+inline auto RadixSort(std::span<Fixed64<P>> values) -> void {
+    detail::RadixSortRaw<detail::NoPayload>(detail::RawWords(values), nullptr, values.size());
+}
+
+template <int P>
+inline auto RadixSort(std::vector<Fixed64<P>>& values) -> void {
+    RadixSort(std::span<Fixed64<P>>(values));
+}
+
+/**
+ * @brief Sort keys in ascending order and apply the same permutation to values
+ *
+ * Stable: values of equal keys keep their relative order, so sorting entity indices by
+ * distance is deterministic. Only the first min(keys.size(), values.size()) pairs are sorted.
+ * V must be trivially copyable, such as an index or a handle.
+ *
+ * Usage:
+ *   fp::RadixSort<32, uint32_t>(distances, entity_ids);
+ */
+template <int P, typename V>
+inline auto RadixSort(std::span<Fixed64<P>> keys, std::span<V> values) -> void {
+    static_assert(std::is_trivially_copyable_v<V>, "RadixSort payloads must be trivially copyable");
+    detail::RadixSortRaw<V>(detail::RawWords(keys), values.data(),
+                            std::min(keys.size(), values.size()));
+}
+
+template <int P, typename V>
+inline auto RadixSort(std::vector<Fixed64<P>>& keys, std::vector<V>& values) -> void {
+    RadixSort(std::span<Fixed64<P>>(keys), std::span<V>(values));
+}
+
+/**
+ * @brief Index of the first value of a sorted span that is not less than key
+ * @return Same as std::lower_bound; sorted.size() if every value is less than key
+ */
+template <int P>
+[[nodiscard]] inline auto LowerBound(std::span<const Fixed64<P>> sorted, Fixed64<P> key) noexcept
+    -> size_t {
+    return detail::LowerBoundRaw(detail::RawWords(sorted), sorted.size(), key.value());
+}
+
+/**
+ * @brief Index of the value of a sorted span closest to target
+ * @return Index of the nearest value, the smaller one when two are equally close;
+ * sorted.size() (0) if sorted is empty
+ * @note The distances are compared as exact 64-bit unsigned differences, so they cannot
+ * overflow for any pair of values
+ */
+template <int P>
+[[nodiscard]] inline auto FindNearest(std::span<const Fixed64<P>> sorted,
+                                      Fixed64<P> target) noexcept -> size_t {
+    const size_t count = sorted.size();
+    const size_t i = LowerBound(sorted, target);
+    if (i == 0 || count == 0) {
+        return 0;
+    }
+    if (i == count) {
+        return count - 1;
+    }
+    const uint64_t below =
+        static_cast<uint64_t>(target.value()) - static_cast<uint64_t>(sorted[i - 1].value());
+    const uint64_t above =
+        static_cast<uint64_t>(sorted[i].value()) - static_cast<uint64_t>(target.value());
+    return above < below ? i : i - 1;
+}
+
+}  // namespace math::fp
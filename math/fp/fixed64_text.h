@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "detail/chunk_pool.h"
+#include "fixed64.h"
+
+namespace math::fp {
+
+/**
+ * @brief Outcome of Fixed64Text::ParseList
+ *
+ * count is the number of values appended. On success ptr is the end of the text and ec is
+ * errc(); if a number was out of range ec is errc::result_out_of_range and ptr points to the
+ * first such number (its saturated value is still appended); if a field is not a number ec is
+ * errc::invalid_argument, ptr points to that field and parsing stopped there.
+ */
+struct Fixed64ParseResult {
+    size_t count = 0;
+    const char* ptr = nullptr;
+    std::errc ec = std::errc();
+};
+
+/**
+ * @brief Bulk conversion between text and lists of fixed-point numbers
+ *
+ * ParseList reads a whole buffer of numbers (a CSV or config table, a memory-mapped file)
+ * separated by commas, semicolons or whitespace; runs of separators count as one. Each field
+ * goes through Fixed64<P>::FromChars, whose digit loop consumes eight digits at a time with
+ * a SWAR check and conversion, so long fixed-width digit runs cost one step per eight digits.
+ * Texts longer than one chunk (256 KB) are split at the first field boundary after each
+ * multiple of the chunk size and parsed on the process-wide thread pool.
+ *
+ * Guarantees:
+ * - Every value is bit-identical to Fixed64<P>::FromString of its field
+ * - Chunk boundaries depend on the text only, so the result does not depend on the number of
+ *   threads (define FIXED64_USE_THREADS=0 to never start worker threads)
+ * - FormatList writes exactly the text of ToString for each value
+ *
+ * Usage:
+ *   std::vector<Fixed64_32> values;
+ *   const auto result = Fixed64Text::ParseList<32>(file_contents, values);
+ *   if (result.ec == std::errc::invalid_argument) { report(result.ptr); }
+ */
+class Fixed64Text {
+ public:
+    // Bytes of text per parallel chunk
+    static constexpr size_t kParseChunkBytes = size_t(1) << 18;
+
+    [[nodiscard]] static constexpr auto IsSeparator(char c) noexcept -> bool {
+        return c == ',' || c == ';' || c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    /**
+     * @brief Parse every number of a text and append them to out
+     * @param text Numbers separated by ',', ';', ' ', '\t', '\n' or '\r'
+     * @param out Receives the values in text order
+     * @param parallel Split texts longer than one chunk across the thread pool
+     * @return Count of appended values, error code and error position, see Fixed64ParseResult
+     * @note ec is errc::not_enough_memory if out could not grow; the values parsed before the
+     * failing chunk are kept
+     */
+    template <int P>
+    static auto ParseList(std::string_view text,
+                          std::vector<Fixed64<P>>& out,
+                          bool parallel = true) noexcept -> Fixed64ParseResult {
+        const char* first = text.data();
+        const char* last = first + text.size();
+        const size_t chunks = (text.size() + kParseChunkBytes - 1) / kParseChunkBytes;
+        if (!parallel || chunks <= 1) {
+            return ParseRange(first, last, out);
+        }
+
+        struct Chunk {
+            const char* first;
+            const char* last;
+            std::vector<Fixed64<P>> values;
+            Fixed64ParseResult result;
+        };
+        std::vector<Chunk> parts;
+        try {
+            parts.resize(chunks);
+        } catch (...) {
+            return {0, first, std::errc::not_enough_memory};
+        }
+
+        // A chunk starts at the first field that begins at or after its nominal offset
+        for (size_t c = 0; c < chunks; ++c) {
+            const char* begin = first + c * kParseChunkBytes;
+            while (c > 0 && begin != last && !IsSeparator(begin[-1])) {
+                ++begin;
+            }
+            parts[c].first = begin;
+            if (c > 0) {
+                parts[c - 1].last = begin;
+            }
+        }
+        parts[chunks - 1].last = last;
+
+        auto parse = [&](size_t c) {
+            parts[c].result = ParseRange(parts[c].first, parts[c].last, parts[c].values);
+        };
+        detail::ChunkPool::Instance().Run(chunks, parse);
+
+        // Concatenate in text order up to the first chunk that stopped early
+        Fixed64ParseResult total{0, last, std::errc()};
+        for (auto& part : parts) {
+            try {
+                out.insert(out.end(), part.values.begin(), part.values.end());
+            } catch (...) {
+                return {total.count, part.first, std::errc::not_enough_memory};
+            }
+            total.count += part.result.count;
+            if (part.result.ec == std::errc::result_out_of_range && total.ec == std::errc()) {
+                total.ec = std::errc::result_out_of_range;
+                total.ptr = part.result.ptr;
+            } else if (part.result.ec != std::errc()
+                       && part.result.ec != std::errc::result_out_of_range) {
+                total.ec = part.result.ec;
+                total.ptr = part.result.ptr;
+                break;
+            }
+        }
+        return total;
+    }
+
+    /**
+     * @brief Append the text of every value to out, separated by separator
+     * @param values Values to format
+     * @param out Receives the text, without a trailing separator
+     * @param separator Character written between two values
+     */
+    template <int P>
+    static auto FormatList(std::span<const Fixed64<P>> values,
+                           std::string& out,
+                           char separator = ',') -> void {
+        char buffer[Fixed64<P>::kMaxChars + 1];
+        for (size_t i = 0; i < values.size(); ++i) {
+            char* begin = buffer;
+            if (i > 0) {
+                *begin++ = separator;
+            }
+            const auto result = values[i].ToChars(begin, buffer + sizeof(buffer));
+            out.append(buffer, result.ptr);
+        }
+    }
+
+ private:
+    // Serial parse of [first, last) appended to out
+    template <int P>
+    static auto ParseRange(const char* first,
+                           const char* last,
+                           std::vector<Fixed64<P>>& out) noexcept -> Fixed64ParseResult {
+        Fixed64ParseResult total{0, last, std::errc()};
+        const char* src = first;
+        while (true) {
+            while (src != last && IsSeparator(*src)) {
+                ++src;
+            }
+            if (src == last) {
+                return total;
+            }
+
+            // Separators are not part of a number, so the number ends exactly at the end of a
+            // valid field
+            Fixed64<P> value;
+            const auto [end, ec] = Fixed64<P>::FromChars(src, last, value);
+            if (ec == std::errc::invalid_argument || (end != last && !IsSeparator(*end))) {
+                return {total.count, src, std::errc::invalid_argument};
+            }
+            if (ec == std::errc::result_out_of_range && total.ec == std::errc()) {
+                total.ec = ec;
+                total.ptr = src;
+            }
+
+            try {
+                out.push_back(value);
+            } catch (...) {
+                return {total.count, src, std::errc::not_enough_memory};
+            }
+            ++total.count;
+            src = end;
+        }
+    }
+};
+
+}  // namespace math::fp
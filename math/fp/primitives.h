@@ -5,6 +5,22 @@
 #include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <limits>
+#include <type_traits>
+
+#include "fixed64_instrument.h"
+
+// Configuration macro for compiler-specific 128-bit arithmetic
+// When enabled, 64x64->128 products use the native double-word type (GCC/Clang) or the
+// _umul128 intrinsic (MSVC x64) and 128/64 divisions use the hardware divide instruction.
+// All paths produce identical results, the portable C sequences are the reference.
+#ifndef FIXED64_PRIMITIVES_USE_INTRINSICS
+#define FIXED64_PRIMITIVES_USE_INTRINSICS 1
+#endif
+
+#if FIXED64_PRIMITIVES_USE_INTRINSICS && defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
 
 /* The following macros are derived from GCC's longlong.h and are used for high-precision integer
  * operations */
@@ -12,6 +28,9 @@
 #define W_TYPE_SIZE 64
 typedef uint64_t UWtype;   // Single-word unsigned type
 typedef uint32_t UHWtype;  // Half-word unsigned type
+#if FIXED64_PRIMITIVES_USE_INTRINSICS && defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 UDWtype;  // Double-word unsigned type
+#endif
 
 #define __BITS4 (W_TYPE_SIZE / 4)
 #define __ll_B ((UWtype)1 << (W_TYPE_SIZE / 2))
@@ -66,6 +85,17 @@ typedef uint32_t UHWtype;  // Half-word unsigned type
 
 /* umul_ppmm: Calculates the double-word product of two single-word operands
    (w1, w0) = u * v */
+/* Use the native double-word type when the compiler provides one, it compiles to a single
+   multiply instruction and remains usable in constant expressions.  */
+#if !defined(umul_ppmm) && FIXED64_PRIMITIVES_USE_INTRINSICS && defined(__SIZEOF_INT128__)
+#define umul_ppmm(w1, w0, u, v)                               \
+    do {                                                      \
+        UDWtype __p = (UDWtype)(UWtype)(u) * (UWtype)(v);     \
+        (w1) = (UWtype)(__p >> W_TYPE_SIZE);                  \
+        (w0) = (UWtype)__p;                                   \
+    } while (0)
+#endif
+
 /* If we still don't have umul_ppmm, define it using plain C.  */
 #if !defined(umul_ppmm)
 #define umul_ppmm(w1, w0, u, v)                                            \
@@ -100,6 +130,43 @@ namespace math::fp {
  */
 class Primitives {
  public:
+    // Initial approximation lookup table for 1/sqrt(x), used in 64-bit fixed-point square root
+    // Format: Q3.60, generated based on ARM CMSIS-DSP table generation logic
+    static constexpr std::array<int64_t, 32> kSqrtInitialLutQ63 = {
+        0x2000000000000000LL,  // 1/sqrt(0.250000) = 0.250000
+        0x1E2B7DDDFEFA6700LL,  // 1/sqrt(0.281250) = 0.235702
+        0x1C9F25C5BFEDD900LL,  // 1/sqrt(0.312500) = 0.223607
+        0x1B4A293C1D954F00LL,  // 1/sqrt(0.343750) = 0.213201
+        0x1A20BD700C2C3F00LL,  // 1/sqrt(0.375000) = 0.204124
+        0x191A556151761C00LL,  // 1/sqrt(0.406250) = 0.196116
+        0x183091E6A7F7E600LL,  // 1/sqrt(0.437500) = 0.188982
+        0x175E9746A0B09800LL,  // 1/sqrt(0.468750) = 0.182574
+        0x16A09E667F3BCC00LL,  // 1/sqrt(0.500000) = 0.176777
+        0x15F3AA673FA91000LL,  // 1/sqrt(0.531250) = 0.171499
+        0x1555555555555500LL,  // 1/sqrt(0.562500) = 0.166667
+        0x14C3ABE93BCF7400LL,  // 1/sqrt(0.593750) = 0.162221
+        0x143D136248490F00LL,  // 1/sqrt(0.625000) = 0.158114
+        0x13C03650E00E0300LL,  // 1/sqrt(0.656250) = 0.154303
+        0x134BF63D15682600LL,  // 1/sqrt(0.687500) = 0.150756
+        0x12DF60C5DF2C9E00LL,  // 1/sqrt(0.718750) = 0.147442
+        0x1279A74590331D00LL,  // 1/sqrt(0.750000) = 0.144338
+        0x121A1851FF630A00LL,  // 1/sqrt(0.781250) = 0.141421
+        0x11C01AA03BE89600LL,  // 1/sqrt(0.812500) = 0.138675
+        0x116B28F55D72D400LL,  // 1/sqrt(0.843750) = 0.136083
+        0x111ACEE560242A00LL,  // 1/sqrt(0.875000) = 0.133631
+        0x10CEA6317186DC00LL,  // 1/sqrt(0.906250) = 0.131306
+        0x108654A2D4F6DA00LL,  // 1/sqrt(0.937500) = 0.129099
+        0x10418A4806DE7D00LL,  // 1/sqrt(0.968750) = 0.127000
+        0x1000000000000000LL,  // 1/sqrt(1.000000) = 0.125000
+        0x0FC176441607CD00LL,  // 1/sqrt(1.031250) = 0.123091
+        0x0F85B42469578E00LL,  // 1/sqrt(1.062500) = 0.121268
+        0x0F4C866D6AAF6900LL,  // 1/sqrt(1.093750) = 0.119523
+        0x0F15BEEEFF7D3380LL,  // 1/sqrt(1.125000) = 0.117851
+        0x0EE133DF522AA480LL,  // 1/sqrt(1.156250) = 0.116248
+        0x0EAEBF548A5C9B00LL,  // 1/sqrt(1.187500) = 0.114708
+        0x0E7E3ED195490900LL   // 1/sqrt(1.218750) = 0.113228
+    };
+
     /**
      * @brief 64-bit fixed-point square root implementation, based on ARM CMSIS-DSP(arm_sqrt_q31.c)
      *
@@ -107,46 +174,12 @@ class Primitives {
      * @param fractionBits Number of fractional bits in the fixed-point format
      * @return Square root result as a raw fixed-point value
      */
-    [[nodiscard]] static auto Fixed64Sqrt(int64_t in, int fractionBits) noexcept -> int64_t {
+    [[nodiscard]] static constexpr auto Fixed64Sqrt(int64_t in, int fractionBits) noexcept
+        -> int64_t {
+        Fixed64Instrumentation::Record(Fixed64Event::kSqrt);
         // Define Q60QUARTER (corresponds to ARM's Q28QUARTER)
         constexpr int64_t Q60QUARTER = 0x2000000000000000LL;  // 0.25 in Q0.63 format
 
-        // Initial approximation lookup table for 1/sqrt(x), used in 64-bit fixed-point square root
-        // Format: Q3.60, generated based on ARM CMSIS-DSP table generation logic
-        static constexpr std::array<int64_t, 32> sqrt_initial_lut_q63 = {
-            0x2000000000000000LL,  // 1/sqrt(0.250000) = 0.250000
-            0x1E2B7DDDFEFA6700LL,  // 1/sqrt(0.281250) = 0.235702
-            0x1C9F25C5BFEDD900LL,  // 1/sqrt(0.312500) = 0.223607
-            0x1B4A293C1D954F00LL,  // 1/sqrt(0.343750) = 0.213201
-            0x1A20BD700C2C3F00LL,  // 1/sqrt(0.375000) = 0.204124
-            0x191A556151761C00LL,  // 1/sqrt(0.406250) = 0.196116
-            0x183091E6A7F7E600LL,  // 1/sqrt(0.437500) = 0.188982
-            0x175E9746A0B09800LL,  // 1/sqrt(0.468750) = 0.182574
-            0x16A09E667F3BCC00LL,  // 1/sqrt(0.500000) = 0.176777
-            0x15F3AA673FA91000LL,  // 1/sqrt(0.531250) = 0.171499
-            0x1555555555555500LL,  // 1/sqrt(0.562500) = 0.166667
-            0x14C3ABE93BCF7400LL,  // 1/sqrt(0.593750) = 0.162221
-            0x143D136248490F00LL,  // 1/sqrt(0.625000) = 0.158114
-            0x13C03650E00E0300LL,  // 1/sqrt(0.656250) = 0.154303
-            0x134BF63D15682600LL,  // 1/sqrt(0.687500) = 0.150756
-            0x12DF60C5DF2C9E00LL,  // 1/sqrt(0.718750) = 0.147442
-            0x1279A74590331D00LL,  // 1/sqrt(0.750000) = 0.144338
-            0x121A1851FF630A00LL,  // 1/sqrt(0.781250) = 0.141421
-            0x11C01AA03BE89600LL,  // 1/sqrt(0.812500) = 0.138675
-            0x116B28F55D72D400LL,  // 1/sqrt(0.843750) = 0.136083
-            0x111ACEE560242A00LL,  // 1/sqrt(0.875000) = 0.133631
-            0x10CEA6317186DC00LL,  // 1/sqrt(0.906250) = 0.131306
-            0x108654A2D4F6DA00LL,  // 1/sqrt(0.937500) = 0.129099
-            0x10418A4806DE7D00LL,  // 1/sqrt(0.968750) = 0.127000
-            0x1000000000000000LL,  // 1/sqrt(1.000000) = 0.125000
-            0x0FC176441607CD00LL,  // 1/sqrt(1.031250) = 0.123091
-            0x0F85B42469578E00LL,  // 1/sqrt(1.062500) = 0.121268
-            0x0F4C866D6AAF6900LL,  // 1/sqrt(1.093750) = 0.119523
-            0x0F15BEEEFF7D3380LL,  // 1/sqrt(1.125000) = 0.117851
-            0x0EE133DF522AA480LL,  // 1/sqrt(1.156250) = 0.116248
-            0x0EAEBF548A5C9B00LL,  // 1/sqrt(1.187500) = 0.114708
-            0x0E7E3ED195490900LL   // 1/sqrt(1.218750) = 0.113228
-        };
 
         int64_t number, var1, signBits1, temp;
 
@@ -172,7 +205,7 @@ class Primitives {
 
             /* Start value for 1/sqrt(x) for the Newton iteration */
             // Use ARM-style index calculation - note this is (q+1-6)
-            var1 = sqrt_initial_lut_q63[(number >> 58) - (Q60QUARTER >> 58)];
+            var1 = kSqrtInitialLutQ63[(number >> 58) - (Q60QUARTER >> 58)];
 
             /* 0.5 var1 * (3 - number * var1 * var1) */
 
@@ -319,7 +352,9 @@ class Primitives {
      * @param fraction_bits Number of fractional bits [0,63]
      * @return Square root result, maintaining the original Q format
      */
-    [[nodiscard]] static auto Fixed64SqrtFast(int64_t a, int fraction_bits) noexcept -> int64_t {
+    [[nodiscard]] static constexpr auto Fixed64SqrtFast(int64_t a, int fraction_bits) noexcept
+        -> int64_t {
+        Fixed64Instrumentation::Record(Fixed64Event::kSqrt);
         // Handle zero and negative inputs
         if (a <= 0) [[unlikely]]
             return 0;  // Return 0 for negative inputs
@@ -421,6 +456,89 @@ class Primitives {
         return static_cast<int64_t>(result);
     }
 
+    /**
+     * @brief Integer square root of a 128-bit value, rounded to nearest
+     *
+     * @param hi High word of the radicand
+     * @param lo Low word of the radicand
+     * @return round(sqrt(hi * 2^64 + lo)), UINT64_MAX when that rounds to 2^64
+     *
+     * @note Exact for every input, so the square root of a sum of squares with 2P fraction bits
+     * is the correctly rounded length with P fraction bits. The radicand is shifted by an even
+     * amount until its high word has at least 62 bits. The root of the high word starts from
+     * the SoftFloat reciprocal square root seed also used by Fixed64SqrtFast and is corrected
+     * to the exact integer root; one step of Zimmermann's square root recurrence, with a single
+     * 128/64 division, then extends it to the 64-bit root of the whole radicand.
+     */
+    [[nodiscard]] static constexpr auto SqrtU128(uint64_t hi, uint64_t lo) noexcept -> uint64_t {
+        Fixed64Instrumentation::Record(Fixed64Event::kSqrt);
+        if ((hi | lo) == 0) {
+            return 0;
+        }
+
+        // 1. Normalize: n = radicand * 2^shift with shift even and n >= 2^126
+        const int shift = (hi != 0 ? CountlZero(hi) : 64 + CountlZero(lo)) & ~1;
+        uint64_t n_hi = hi;
+        uint64_t n_lo = lo;
+        if (shift >= 64) {
+            n_hi = lo << (shift - 64);
+            n_lo = 0;
+        } else if (shift > 0) {
+            n_hi = (hi << shift) | (lo >> (64 - shift));
+            n_lo = lo << shift;
+        }
+
+        // 2. Seed the 32-bit root of the high word: with a = n_hi >> 32 in [2^30, 2^32) read as
+        // a / 2^30 in [1, 4), the table gives 2^32 / sqrt(a / 2^30), so sqrt(n_hi) ~ a * r / 2^31
+        const uint32_t a = static_cast<uint32_t>(n_hi >> 32);
+        const uint32_t odd_exp = a < 0x80000000u ? 1 : 0;
+        const uint32_t r = softfloat_approxRecipSqrt32_1(odd_exp, odd_exp != 0 ? a << 1 : a);
+        uint64_t s = (static_cast<uint64_t>(a) * r) >> 31;
+
+        // 3. The seed is a few units low; one Newton step with 1 / (2 sqrt(n_hi)) ~ r / 2^64
+        // brings it within one of the exact integer root of the high word, fixed up below
+        if (s <= 0xFFFFFFFF && s * s <= n_hi) {
+            uint64_t step, discarded;
+            umul_ppmm(step, discarded, n_hi - s * s, static_cast<uint64_t>(r));
+            (void)discarded;
+            s += step;
+        }
+        s = s < 0xFFFFFFFF ? s : 0xFFFFFFFF;
+        while (s * s > n_hi) {
+            --s;
+        }
+        while (s < 0xFFFFFFFF && (s + 1) * (s + 1) <= n_hi) {
+            ++s;
+        }
+        const uint64_t rem = n_hi - s * s;  // At most 2s < 2^33
+
+        // 4. Zimmermann step in base 2^32: (q, u) = divmod(rem * 2^32 + n_lo / 2^32, 2s), then
+        // root = s * 2^32 + q, one too large when u * 2^32 + n_lo mod 2^32 < q^2
+        const uint64_t divisor = s << 1;
+        const uint64_t numerator_lo = (rem << 32) | (n_lo >> 32);
+        const uint64_t q = DivU128ToU64(rem >> 32, numerator_lo, divisor);
+        const uint64_t u = numerator_lo - q * divisor;
+        uint64_t q2_hi, q2_lo;
+        umul_ppmm(q2_hi, q2_lo, q, q);
+        const uint64_t left_hi = u >> 32;
+        const uint64_t left_lo = (u << 32) | (n_lo & 0xFFFFFFFF);
+        // Wraps to 0 only when the true value is 2^64, which the correction then undoes
+        uint64_t root = (s << 32) + q;
+        if (left_hi < q2_hi || (left_hi == q2_hi && left_lo < q2_lo)) {
+            --root;
+        }
+
+        // 5. Undo the normalization: floor(sqrt(radicand)) = floor(root / 2^(shift / 2)), then
+        // round up when radicand > floor^2 + floor, i.e. radicand >= (floor + 1/2)^2
+        const uint64_t floor_root = root >> (shift >> 1);
+        uint64_t f2_hi, f2_lo;
+        umul_ppmm(f2_hi, f2_lo, floor_root, floor_root);
+        f2_lo += floor_root;
+        f2_hi += (f2_lo < floor_root) ? 1 : 0;
+        const bool round_up = hi > f2_hi || (hi == f2_hi && lo > f2_lo);
+        return (round_up && floor_root != UINT64_MAX) ? floor_root + 1 : floor_root;
+    }
+
     /**
      * @brief Calculate the binary width of an integer (position of the highest bit + 1)
      * @param x Input value
@@ -684,6 +802,150 @@ class Primitives {
         return (low >> shift) | (high << (64 - shift));
     }
 
+    /**
+     * @brief Compile-time shift variant of MulU64Shifted
+     *
+     * Selects the multiply sequence when the template is instantiated: the native double-word
+     * product on GCC/Clang, _umul128/__shiftright128 on MSVC x64, otherwise the portable
+     * umul_ppmm sequence with a single 64-bit multiply when both operands fit in 32 bits.
+     *
+     * @tparam Shift Right shift amount, range 0-63
+     * @param a First 64-bit unsigned integer
+     * @param b Second 64-bit unsigned integer
+     * @return Low 64 bits of (a*b)>>Shift, identical to MulU64Shifted(a, b, Shift)
+     */
+    template <int Shift>
+    [[nodiscard]] static constexpr auto MulU64Shifted(uint64_t a, uint64_t b) noexcept
+        -> uint64_t {
+        static_assert(Shift >= 0 && Shift < 64, "Shift out of range");
+        if constexpr (Shift == 0) {
+            return a * b;
+        } else {
+#if FIXED64_PRIMITIVES_USE_INTRINSICS && defined(__SIZEOF_INT128__)
+            return static_cast<uint64_t>((static_cast<UDWtype>(a) * b) >> Shift);
+#else
+#if FIXED64_PRIMITIVES_USE_INTRINSICS && defined(_MSC_VER) && defined(_M_X64)
+            if (!std::is_constant_evaluated()) {
+                uint64_t high;
+                const uint64_t low = _umul128(a, b, &high);
+                return __shiftright128(low, high, static_cast<unsigned char>(Shift));
+            }
+#endif
+            if constexpr (Shift <= 32) {
+                // Both operands below 2^32: the full product fits in one word
+                if (((a | b) >> 32) == 0) {
+                    return (a * b) >> Shift;
+                }
+            }
+            return MulU64Shifted(a, b, Shift);
+#endif
+        }
+    }
+
+    /**
+     * @brief Remainder of a division by a compile-time constant, using a precomputed reciprocal
+     *
+     * Barrett reduction with M = floor((2^64 - 1) / D): the quotient estimate hi(|x| * M) is
+     * floor(|x| / D) or one less, so a single conditional subtraction makes the remainder
+     * exact. The sequence has no loops and no hardware division, runs in constant time for
+     * every input and matches RemLanes lane for lane.
+     *
+     * @tparam D Positive divisor
+     * @param x Dividend
+     * @return x % D, truncated toward zero with the sign of x
+     */
+    template <int64_t D>
+    [[nodiscard]] static constexpr auto RemConstant(int64_t x) noexcept -> int64_t {
+        static_assert(D > 0, "Divisor must be positive");
+        constexpr uint64_t kReciprocal = ~uint64_t(0) / uint64_t(D);
+        return RemPreinv(x, uint64_t(D), kReciprocal);
+    }
+
+    /**
+     * @brief Remainder of a division by a runtime divisor with a precomputed reciprocal
+     *
+     * The Barrett reduction of RemConstant for a divisor that is only known at runtime but
+     * reused, e.g. a world size: the reciprocal costs one division, every remainder then one
+     * multiplication and a conditional subtraction.
+     *
+     * @param x Dividend
+     * @param d Absolute value of the divisor, not zero
+     * @param reciprocal floor((2^64 - 1) / d)
+     * @return x % d, truncated toward zero with the sign of x
+     */
+    [[nodiscard]] static constexpr auto RemPreinv(int64_t x,
+                                                  uint64_t d,
+                                                  uint64_t reciprocal) noexcept -> int64_t {
+        const uint64_t sign = static_cast<uint64_t>(x >> 63);
+        const uint64_t ax = (static_cast<uint64_t>(x) ^ sign) - sign;
+
+        uint64_t q;
+        [[maybe_unused]] uint64_t lo;  // only the high word is the quotient estimate
+        umul_ppmm(q, lo, ax, reciprocal);
+        uint64_t r = ax - q * d;
+        r -= (r >= d) ? d : 0;
+        return static_cast<int64_t>((r ^ sign) - sign);
+    }
+
+    /**
+     * @brief Add the signed 128-bit product a*b to a two's complement 128-bit accumulator
+     *
+     * The unsigned product is formed with umul_ppmm and its high word corrected for the
+     * operand signs, so no branches or absolute values are needed. Summing products this way
+     * and rounding the total once (see Round128) is exact until the final shift.
+     *
+     * @param a First operand
+     * @param b Second operand
+     * @param hi High 64 bits of the accumulator (two's complement)
+     * @param lo Low 64 bits of the accumulator
+     */
+    static constexpr auto MulAdd128(int64_t a, int64_t b, uint64_t& hi, uint64_t& lo) noexcept
+        -> void {
+        const uint64_t u = static_cast<uint64_t>(a);
+        const uint64_t v = static_cast<uint64_t>(b);
+        uint64_t p_hi, p_lo;
+        umul_ppmm(p_hi, p_lo, u, v);
+
+        // Signed high word: subtract v if a < 0 and u if b < 0
+        p_hi -= (v & static_cast<uint64_t>(a >> 63)) + (u & static_cast<uint64_t>(b >> 63));
+
+        lo += p_lo;
+        hi += p_hi + ((lo < p_lo) ? 1 : 0);
+    }
+
+    /**
+     * @brief Round a two's complement 128-bit value to 64 bits after dropping fraction bits
+     *
+     * @param hi High 64 bits (two's complement)
+     * @param lo Low 64 bits
+     * @param fractionBits Number of fraction bits to drop, range 1-63
+     * @return (hi:lo) >> fractionBits rounded to nearest, ties to even
+     * @note The rounded value must fit in 64 bits, out-of-range values are not saturated
+     */
+    [[nodiscard]] static constexpr auto Round128(uint64_t hi,
+                                                 uint64_t lo,
+                                                 int fractionBits) noexcept -> int64_t {
+        return ShortShiftRightRound64(static_cast<int64_t>(hi), lo,
+                                      static_cast<uint8_t>(fractionBits));
+    }
+
+    /**
+     * @brief Clamp a two's complement 128-bit value to the Fixed64 range
+     *
+     * @param hi High 64 bits (two's complement)
+     * @param lo Low 64 bits
+     * @return The value if it lies in [-(2^63 - 1), 2^63 - 1], INT64_MAX or -INT64_MAX
+     * (Infinity/NegInfinity) otherwise; never the NaN pattern
+     */
+    [[nodiscard]] static constexpr auto Saturate128(uint64_t hi, uint64_t lo) noexcept
+        -> int64_t {
+        const int64_t value = static_cast<int64_t>(lo);
+        if (static_cast<int64_t>(hi) != (value >> 63) || value == INT64_MIN) [[unlikely]] {
+            return static_cast<int64_t>(hi) < 0 ? -INT64_MAX : INT64_MAX;
+        }
+        return value;
+    }
+
     /**
      * @brief Signed 64-bit fixed-point multiplication, returns 64-bit result (using LLVM-style bit
      * operations for sign handling)
@@ -749,6 +1011,7 @@ class Primitives {
             c1 = ~c1;            // Flip result sign
             b_abs = ~b_abs + 1;  // Get absolute value
         }
+        RecordMul(a_abs, b_abs, fractionBits);
 
         // Call unsigned multiplication
         uint64_t result = MulU64Shifted(a_abs, b_abs, fractionBits);
@@ -760,6 +1023,34 @@ class Primitives {
             return static_cast<int64_t>(result);
     }
 
+    /**
+     * @brief Signed 64-bit fixed-point multiplication with the fraction bits known at compile
+     * time
+     *
+     * Used by the Fixed64<P> operators. Bit-identical to Fixed64Mul(a, b, P), the multiply
+     * sequence is chosen per precision by MulU64Shifted<P>.
+     *
+     * @tparam P Number of fraction bits
+     * @param a First operand
+     * @param b Second operand
+     * @return 64-bit result, preserving P fraction bits
+     */
+    template <int P>
+    [[nodiscard]] static constexpr auto Fixed64Mul(int64_t a, int64_t b) noexcept -> int64_t {
+        // Extract sign bits
+        int64_t s_a = a >> 63;  // s_a = a < 0 ? -1 : 0
+        int64_t s_b = b >> 63;  // s_b = b < 0 ? -1 : 0
+
+        // Convert signed numbers to unsigned
+        uint64_t a_abs = (static_cast<uint64_t>(a ^ s_a)) - s_a;
+        uint64_t b_abs = (static_cast<uint64_t>(b ^ s_b)) - s_b;
+        RecordMul(a_abs, b_abs, P);
+
+        // Apply sign: If s_result is -1, invert and add 1
+        int64_t s_result = s_a ^ s_b;
+        return (static_cast<int64_t>(MulU64Shifted<P>(a_abs, b_abs) ^ s_result)) - s_result;
+    }
+
     /**
      * @brief Divide 128-bit number by 64-bit number, returning 64-bit quotient
      *
@@ -779,6 +1070,22 @@ class Primitives {
             return UINT64_MAX;
         }
 
+        // The hardware 128/64 division needs no normalization once n1 < d0 is established
+#if FIXED64_PRIMITIVES_USE_INTRINSICS && (defined(__GNUC__) || defined(__clang__)) \
+    && defined(__x86_64__)
+        if (!std::is_constant_evaluated()) {
+            uint64_t q, r;
+            __asm__("divq %4" : "=a"(q), "=d"(r) : "0"(n0), "1"(n1), "rm"(d0));
+            return q;
+        }
+#elif FIXED64_PRIMITIVES_USE_INTRINSICS && defined(_MSC_VER) && defined(_M_X64) \
+    && _MSC_VER >= 1920
+        if (!std::is_constant_evaluated()) {
+            uint64_t r;
+            return _udiv128(n1, n0, d0, &r);
+        }
+#endif
+
         uint64_t q0;
         int bm = CountlZero(d0);
 
@@ -869,6 +1176,7 @@ class Primitives {
 
         // Call unsigned division
         uint64_t result_abs = DivU128ToU64(n_hi, n_lo, d_abs);
+        RecordDiv(d_abs, result_abs, fractionBits);
 
         // Apply sign
         if (c1)
@@ -877,6 +1185,401 @@ class Primitives {
             return static_cast<int64_t>(result_abs);
     }
 
+    /**
+     * @brief Signed 64-bit fixed-point division with the fraction bits known at compile time
+     *
+     * Used by the Fixed64<P> operators. Bit-identical to Fixed64Div(n, d, P). For P <= 32 a
+     * dividend whose shifted value fits in one word takes a single 64-bit division.
+     *
+     * @tparam P Number of fraction bits
+     * @param n Dividend
+     * @param d Divisor
+     * @return 64-bit quotient, preserving P fraction bits
+     */
+    template <int P>
+    [[nodiscard]] static constexpr auto Fixed64Div(int64_t n, int64_t d) noexcept -> int64_t {
+        static_assert(P >= 0 && P < 64, "Fraction bits out of range");
+
+        // Extract sign bits
+        int64_t s_n = n >> 63;  // s_n = n < 0 ? -1 : 0
+        int64_t s_d = d >> 63;  // s_d = d < 0 ? -1 : 0
+
+        // Convert signed numbers to unsigned
+        uint64_t n_abs = (static_cast<uint64_t>(n ^ s_n)) - s_n;
+        uint64_t d_abs = (static_cast<uint64_t>(d ^ s_d)) - s_d;
+
+        // Prepare 128-bit dividend: n_abs << P
+        uint64_t n_lo = n_abs << P;
+        uint64_t n_hi = 0;
+        if constexpr (P > 0) {
+            n_hi = n_abs >> (64 - P);
+        }
+
+        uint64_t result_abs;
+        if constexpr (P <= 32) {
+            if (n_hi == 0 && d_abs != 0) {
+                result_abs = n_lo / d_abs;
+            } else {
+                result_abs = DivU128ToU64(n_hi, n_lo, d_abs);
+            }
+        } else {
+            result_abs = DivU128ToU64(n_hi, n_lo, d_abs);
+        }
+        RecordDiv(d_abs, result_abs, P);
+
+        // Apply sign: If s_result is -1, invert and add 1
+        int64_t s_result = s_n ^ s_d;
+        return (static_cast<int64_t>(result_abs ^ s_result)) - s_result;
+    }
+
+    /**
+     * @brief Select value, or INT64_MAX / -INT64_MAX for the sign mask when overflow is set
+     *
+     * Written as a mask blend so the overflow flag never becomes a branch
+     */
+    [[nodiscard]] static constexpr auto SaturateIf(bool overflow,
+                                                   int64_t sign,
+                                                   int64_t value) noexcept -> int64_t {
+        const int64_t mask = -static_cast<int64_t>(overflow);
+        const int64_t saturated = (INT64_MAX ^ sign) - sign;
+        return (saturated & mask) | (value & ~mask);
+    }
+
+    /**
+     * @brief Fixed-point addition that detects overflow
+     *
+     * The sum wraps exactly like operator+; the operands share a sign that the wrapped sum
+     * lacks exactly when it overflowed, which also tells the sign of the exact result.
+     *
+     * @param a First operand
+     * @param b Second operand
+     * @param result a + b, or INT64_MAX / -INT64_MAX (Infinity / NegInfinity) on overflow
+     * @return true if the exact sum lies outside [-INT64_MAX, INT64_MAX]
+     */
+    [[nodiscard]] static constexpr auto Fixed64AddChecked(int64_t a,
+                                                          int64_t b,
+                                                          int64_t& result) noexcept -> bool {
+        const int64_t sum =
+            static_cast<int64_t>(static_cast<uint64_t>(a) + static_cast<uint64_t>(b));
+        const bool wrapped = ((a ^ sum) & (b ^ sum)) < 0;
+        const int64_t sign = (sum >> 63) ^ -static_cast<int64_t>(wrapped);
+        const bool overflow = wrapped | (sum == INT64_MIN);
+        result = SaturateIf(overflow, sign, sum);
+        return overflow;
+    }
+
+    /**
+     * @brief Fixed-point subtraction that detects overflow
+     *
+     * @param a Minuend
+     * @param b Subtrahend
+     * @param result a - b, or INT64_MAX / -INT64_MAX (Infinity / NegInfinity) on overflow
+     * @return true if the exact difference lies outside [-INT64_MAX, INT64_MAX]
+     */
+    [[nodiscard]] static constexpr auto Fixed64SubChecked(int64_t a,
+                                                          int64_t b,
+                                                          int64_t& result) noexcept -> bool {
+        const int64_t diff =
+            static_cast<int64_t>(static_cast<uint64_t>(a) - static_cast<uint64_t>(b));
+        const bool wrapped = ((a ^ b) & (a ^ diff)) < 0;
+        const int64_t sign = (diff >> 63) ^ -static_cast<int64_t>(wrapped);
+        const bool overflow = wrapped | (diff == INT64_MIN);
+        result = SaturateIf(overflow, sign, diff);
+        return overflow;
+    }
+
+    /**
+     * @brief Fixed-point multiplication that detects overflow
+     *
+     * Forms the 128-bit magnitude product with umul_ppmm like Fixed64Mul<P>. The truncated
+     * magnitude (hi:lo) >> P fits in 63 bits exactly when no bit of hi at or above P - 1 is
+     * set, so the overflow test costs one shift and compare on the word already computed.
+     *
+     * @tparam P Number of fraction bits
+     * @param a First operand
+     * @param b Second operand
+     * @param result Fixed64Mul<P>(a, b), or INT64_MAX / -INT64_MAX with the sign of the
+     * product on overflow
+     * @return true if the truncated product lies outside [-INT64_MAX, INT64_MAX]
+     */
+    template <int P>
+    [[nodiscard]] static constexpr auto Fixed64MulChecked(int64_t a,
+                                                          int64_t b,
+                                                          int64_t& result) noexcept -> bool {
+        static_assert(P >= 0 && P < 64, "Fraction bits out of range");
+        const int64_t s_a = a >> 63;
+        const int64_t s_b = b >> 63;
+        const uint64_t a_abs = (static_cast<uint64_t>(a ^ s_a)) - s_a;
+        const uint64_t b_abs = (static_cast<uint64_t>(b ^ s_b)) - s_b;
+
+        uint64_t hi, lo;
+        umul_ppmm(hi, lo, a_abs, b_abs);
+        uint64_t magnitude;
+        bool overflow;
+        if constexpr (P == 0) {
+            magnitude = lo;
+            overflow = (hi | (lo >> 63)) != 0;
+        } else {
+            magnitude = (lo >> P) | (hi << (64 - P));
+            overflow = (hi >> (P - 1)) != 0;
+        }
+
+        const int64_t sign = s_a ^ s_b;
+        result = SaturateIf(overflow, sign, (static_cast<int64_t>(magnitude ^ sign)) - sign);
+        return overflow;
+    }
+
+    /**
+     * @brief Fixed-point division that detects overflow and division by zero
+     *
+     * DivU128ToU64 already returns UINT64_MAX when the quotient needs more than 64 bits (and
+     * for a zero divisor), so every overflow shows as bit 63 of the magnitude.
+     *
+     * @tparam P Number of fraction bits
+     * @param n Dividend
+     * @param d Divisor
+     * @param result Fixed64Div<P>(n, d), or INT64_MAX / -INT64_MAX with the sign of the
+     * quotient on overflow; a zero divisor gives the Infinity / NegInfinity of operator/
+     * @return true if the quotient lies outside [-INT64_MAX, INT64_MAX] or d is zero
+     */
+    template <int P>
+    [[nodiscard]] static constexpr auto Fixed64DivChecked(int64_t n,
+                                                          int64_t d,
+                                                          int64_t& result) noexcept -> bool {
+        static_assert(P >= 0 && P < 64, "Fraction bits out of range");
+        const int64_t s_n = n >> 63;
+        const int64_t s_d = d >> 63;
+        const uint64_t n_abs = (static_cast<uint64_t>(n ^ s_n)) - s_n;
+        const uint64_t d_abs = (static_cast<uint64_t>(d ^ s_d)) - s_d;
+
+        const uint64_t n_lo = n_abs << P;
+        uint64_t n_hi = 0;
+        if constexpr (P > 0) {
+            n_hi = n_abs >> (64 - P);
+        }
+
+        uint64_t magnitude;
+        if constexpr (P <= 32) {
+            if (n_hi == 0 && d_abs != 0) {
+                magnitude = n_lo / d_abs;
+            } else {
+                magnitude = DivU128ToU64(n_hi, n_lo, d_abs);
+            }
+        } else {
+            magnitude = DivU128ToU64(n_hi, n_lo, d_abs);
+        }
+
+        const bool overflow = (magnitude >> 63) != 0;
+        const int64_t sign = s_n ^ s_d;
+        result = SaturateIf(overflow, sign, (static_cast<int64_t>(magnitude ^ sign)) - sign);
+        return overflow;
+    }
+
+    /**
+     * @brief Table of 11-bit reciprocal seeds for ReciprocalWord
+     *
+     * Entry i holds floor((2^19 - 3 * 2^8) / (256 + i)), the initial approximation of
+     * Moller-Granlund Algorithm 2 indexed by the top 9 bits of the normalized divisor.
+     */
+    static constexpr std::array<uint16_t, 256> kReciprocalWordTable = [] {
+        std::array<uint16_t, 256> table{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            table[i] = static_cast<uint16_t>(0x7FD00u / (256u + i));
+        }
+        return table;
+    }();
+
+    /**
+     * @brief Reciprocal of a normalized 64-bit divisor, floor((2^128 - 1) / d) - 2^64
+     *
+     * Implements Algorithm 2 of N. Moller and T. Granlund, "Improved division by invariant
+     * integers" (IEEE Trans. Computers, 2011): a table lookup followed by two Newton steps and
+     * a final adjustment, using multiplications only. The result is exact, so the quotients
+     * computed from it by DivU128ToU64Preinv are identical to DivU128ToU64 on every platform.
+     *
+     * @param d Divisor with the most significant bit set
+     * @return 64-bit reciprocal of d
+     */
+    [[nodiscard]] static constexpr auto ReciprocalWord(uint64_t d) noexcept -> uint64_t {
+        const uint64_t d0 = d & 1;
+        const uint64_t d9 = d >> 55;
+        const uint64_t d40 = (d >> 24) + 1;
+        const uint64_t d63 = (d >> 1) + d0;  // ceil(d / 2)
+
+        // 11, 21 and 34 bit approximations
+        const uint64_t v0 = kReciprocalWordTable[d9 - 256];
+        const uint64_t v1 = (v0 << 11) - ((v0 * v0 * d40) >> 40) - 1;
+        const uint64_t v2 = (v1 << 13) + ((v1 * ((1ULL << 60) - v1 * d40)) >> 47);
+
+        // 64 bit approximation, off by at most one
+        const uint64_t e = ((v2 >> 1) & (0 - d0)) - v2 * d63;
+        uint64_t hi, lo;
+        umul_ppmm(hi, lo, v2, e);
+        const uint64_t v3 = (v2 << 31) + (hi >> 1);
+
+        // Final adjustment: v4 = v3 - floor((v3 * d + d) / 2^64) - d
+        umul_ppmm(hi, lo, v3, d);
+        lo += d;
+        hi += (lo < d) ? 1 : 0;
+        return v3 - hi - d;
+    }
+
+    /**
+     * @brief Divide 128-bit number by 64-bit number using a precomputed reciprocal
+     *
+     * Same contract as DivU128ToU64, with the hardware division replaced by Algorithm 4 of
+     * Moller-Granlund (one 64x64->128 multiplication and at most two corrections). The shift
+     * and reciprocal depend on the divisor only, so repeated divisions by one value compute
+     * them once.
+     *
+     * @param n1 High 64 bits of dividend
+     * @param n0 Low 64 bits of dividend
+     * @param d0 64-bit divisor, cannot be 0
+     * @param shift CountlZero(d0)
+     * @param v ReciprocalWord(d0 << shift)
+     * @return 64-bit quotient, UINT64_MAX on overflow exactly like DivU128ToU64
+     */
+    [[nodiscard]] static constexpr auto DivU128ToU64Preinv(
+        uint64_t n1, uint64_t n0, uint64_t d0, int shift, uint64_t v) noexcept -> uint64_t {
+        // If d0 <= n1, overflow
+        if (d0 <= n1) {
+            return UINT64_MAX;
+        }
+
+        if (shift != 0) {
+            // Normalize
+            d0 = d0 << shift;
+            n1 = (n1 << shift) | (n0 >> (W_TYPE_SIZE - shift));
+            n0 = n0 << shift;
+        }
+
+        // Quotient estimate (q1, q0) = v * n1 + (n1, n0), then q1 + 1
+        uint64_t q1, q0;
+        umul_ppmm(q1, q0, v, n1);
+        q0 += n0;
+        q1 += n1 + ((q0 < n0) ? 1 : 0) + 1;
+
+        // The estimate is at most one too large or one too small
+        uint64_t r = n0 - q1 * d0;
+        if (r > q0) {
+            q1 -= 1;
+            r += d0;
+        }
+        if (r >= d0) [[unlikely]] {
+            q1 += 1;
+        }
+
+        return q1;
+    }
+
+    /**
+     * @brief Fixed-point reciprocal, bit-identical to Fixed64Div(1 << fractionBits, d,
+     * fractionBits)
+     *
+     * The dividend is a power of two, so for fractionBits < 32 the quotient is a single
+     * 64-bit division and otherwise the low dividend word is zero.
+     *
+     * @param d Divisor, cannot be 0
+     * @param fractionBits Number of fraction bits
+     * @return 64-bit quotient, preserving specified fraction bits
+     */
+    [[nodiscard]] static constexpr auto Fixed64Reciprocal(int64_t d, int fractionBits) noexcept
+        -> int64_t {
+        int64_t s_d = d >> 63;                                    // s_d = d < 0 ? -1 : 0
+        uint64_t d_abs = (static_cast<uint64_t>(d ^ s_d)) - s_d;  // |d|
+
+        // 128-bit dividend: 2^(2 * fractionBits)
+        uint64_t result_abs;
+        if (fractionBits < 32) {
+            result_abs = (1ULL << (2 * fractionBits)) / d_abs;
+        } else {
+            result_abs = DivU128ToU64(1ULL << (2 * fractionBits - 64), 0, d_abs);
+        }
+
+        return (static_cast<int64_t>(result_abs ^ s_d)) - s_d;
+    }
+
+    /**
+     * @brief Fixed-point reciprocal square root, 1 / sqrt(a)
+     *
+     * The 32-bit seed of softfloat_approxRecipSqrt32_1 is refined by one Newton-Raphson step
+     * r1 = r0 + r0 * (1 - a * r0^2) / 2 evaluated on the full 64-bit normalized significand,
+     * which roughly doubles its precision. The relative error of the result is below 2^-58
+     * before the final rounding, so results with fewer than 58 significant bits are within
+     * 1 ulp of the exact value.
+     *
+     * @param a Input value, raw fixed-point value
+     * @param fractionBits Number of fractional bits in the fixed-point format
+     * @return 1 / sqrt(a) as a raw fixed-point value, INT64_MAX for a == 0 or when the result
+     * overflows, INT64_MIN for negative inputs
+     */
+    [[nodiscard]] static constexpr auto Fixed64RSqrt(int64_t a, int fractionBits) noexcept
+        -> int64_t {
+        return Fixed64RSqrt(a, fractionBits, fractionBits);
+    }
+
+    /**
+     * @brief Fixed-point reciprocal square root with a separate result format
+     *
+     * Same algorithm and error bound as Fixed64RSqrt(a, fractionBits), but the result carries
+     * resultFractionBits fraction bits. Callers that go on to multiply by the result use this
+     * to keep the full 58 bits of precision when 1 / sqrt(a) is small.
+     *
+     * @param a Input value, raw fixed-point value
+     * @param fractionBits Number of fractional bits of a
+     * @param resultFractionBits Number of fractional bits of the result
+     * @return 1 / sqrt(a) as a raw fixed-point value, INT64_MAX for a == 0 or when the result
+     * overflows, INT64_MIN for negative inputs
+     */
+    [[nodiscard]] static constexpr auto Fixed64RSqrt(int64_t a,
+                                                     int fractionBits,
+                                                     int resultFractionBits) noexcept -> int64_t {
+        if (a <= 0) [[unlikely]] {
+            return a == 0 ? INT64_MAX : INT64_MIN;
+        }
+
+        // An even number of fraction bits keeps the exponent of the square root integral
+        const int odd_bits = fractionBits & 1;
+        const uint64_t u = static_cast<uint64_t>(a) << odd_bits;
+        const int even_bits = fractionBits + odd_bits;
+
+        // u = A * 4^k with A in [1, 4): [1, 2) for an even msb, [2, 4) for an odd msb
+        const int msb = 63 - CountlZero(u);
+        const int k = msb >> 1;
+        const uint32_t odd_exp = (msb & 1) ? 0 : 1;
+        const uint64_t sig = u << (63 - msb);
+
+        // 32-bit seed r0 ~ 2^32 / sqrt(A)
+        const uint64_t r0 =
+            softfloat_approxRecipSqrt32_1(odd_exp, static_cast<uint32_t>(sig >> 32));
+
+        // t = A * r0^2 in Q1.63, close to 1
+        uint64_t hi, lo;
+        umul_ppmm(hi, lo, sig, r0 * r0);
+        const uint64_t t = odd_exp ? hi : ((hi << 1) | (lo >> 63));
+
+        // Newton step in Q1.63: r1 = r0 + r0 * (1 - t) / 2
+        const uint64_t delta = (1ULL << 63) - t;
+        const bool negative = (delta >> 63) != 0;
+        umul_ppmm(hi, lo, r0, negative ? 0 - delta : delta);
+        const uint64_t correction = (hi << 31) | (lo >> 33);
+        const uint64_t r1 = (r0 << 31) + (negative ? 0 - correction : correction);
+
+        // result = r1 * 2^(resultFractionBits + even_bits / 2 - k - 63)
+        const int exponent = resultFractionBits + (even_bits >> 1) - k - 63;
+        if (exponent >= 0) {
+            if (exponent > 0 || r1 > static_cast<uint64_t>(INT64_MAX)) {
+                return INT64_MAX;
+            }
+            return static_cast<int64_t>(r1);
+        }
+        const int right_shift = -exponent;
+        if (right_shift >= 64) {
+            return 0;
+        }
+        return static_cast<int64_t>((r1 + (1ULL << (right_shift - 1))) >> right_shift);
+    }
+
     /**
      * @brief Divide 128-bit number by 64-bit number, returning quotient
      * @param numhi High 64 bits of 128-bit dividend
@@ -1223,5 +1926,46 @@ class Primitives {
 
         return std::bit_cast<double>(bits);
     }
+
+ private:
+    // Instrumentation of Fixed64Mul: the product overflows when (hi:lo) >> fractionBits needs
+    // more than 63 bits, the test of Fixed64MulChecked
+    static constexpr auto RecordMul(uint64_t a_abs, uint64_t b_abs, int fractionBits) noexcept
+        -> void {
+        if constexpr (Fixed64Instrumentation::kEnabled) {
+            Fixed64Instrumentation::Record(Fixed64Event::kMul);
+            uint64_t hi, lo;
+            umul_ppmm(hi, lo, a_abs, b_abs);
+            const bool overflow =
+                fractionBits == 0 ? (hi | (lo >> 63)) != 0 : (hi >> (fractionBits - 1)) != 0;
+            if (overflow) {
+                Fixed64Instrumentation::Record(Fixed64Event::kMulOverflow);
+            }
+        }
+        (void)a_abs;
+        (void)b_abs;
+        (void)fractionBits;
+    }
+
+    // Instrumentation of Fixed64Div from the divisor and quotient magnitudes; a divisor below
+    // 2^-(fractionBits/2) leaves the quotient only half of the fraction bits of the operands
+    static constexpr auto RecordDiv(uint64_t d_abs,
+                                    uint64_t quotient_abs,
+                                    int fractionBits) noexcept -> void {
+        if constexpr (Fixed64Instrumentation::kEnabled) {
+            Fixed64Instrumentation::Record(Fixed64Event::kDiv);
+            if ((quotient_abs >> 63) != 0) {
+                Fixed64Instrumentation::Record(Fixed64Event::kDivOverflow);
+            }
+            if (d_abs == 0) {
+                Fixed64Instrumentation::Record(Fixed64Event::kDivByZero);
+            } else if (d_abs < (uint64_t(1) << (fractionBits / 2))) {
+                Fixed64Instrumentation::Record(Fixed64Event::kDivNearZero);
+            }
+        }
+        (void)d_abs;
+        (void)quotient_abs;
+        (void)fractionBits;
+    }
 };
 }  // namespace math::fp
@@ -68,6 +68,7 @@ def generate_acos_lut(output_file="acos_lut.h"):
         f.write("#include <array>\n")
         f.write("#include <cstdint>\n")
         f.write("#include <algorithm>\n")
+        f.write("#include \"lut_format.h\"\n")
         f.write("#include \"primitives.h\"\n\n")
         f.write("namespace math::fp::detail {\n\n")
         
@@ -79,7 +80,7 @@ def generate_acos_lut(output_file="acos_lut.h"):
         f.write("// Region 4: 0.99-0.999 even denser (256+1 points)\n")
         f.write("// Region 5: 0.999-1.0 densest (256+1 points)\n")
         f.write(f"// Fixed-point format: Q{63-P}.{P}\n")
-        f.write(f"inline constexpr std::array<int64_t, {len(lut)}> AcosLut = {{\n    ")
+        f.write(f"alignas(64) inline constexpr std::array<int64_t, {len(lut)}> AcosLut = {{\n    ")
         
         # Write the values with each entry on its own line, including region markers
         for i, val in enumerate(lut):
@@ -144,7 +145,7 @@ def generate_acos_lut(output_file="acos_lut.h"):
         
         # Write the derivatives lookup table with comments
         f.write(f"// Derivatives for Region 2 (0.8-0.93)\n")
-        f.write(f"inline constexpr std::array<int64_t, {len(dydx_lut)}> AcosDyDxLut = {{\n    ")
+        f.write(f"alignas(64) inline constexpr std::array<int64_t, {len(dydx_lut)}> AcosDyDxLut = {{\n    ")
         
         # Write the AcosDyDxLut table with each entry on its own line
         for i, val in enumerate(dydx_lut):
@@ -160,11 +161,13 @@ def generate_acos_lut(output_file="acos_lut.h"):
         # Write the LookupAcos function directly based on the C++ example
         f.write("/**\n")
         f.write(" * @brief Calculate arccosine value with multi-region interpolation\n")
-        f.write(" * @param x Fixed-point value in [-1,1] range with input_fraction_bits precision\n")
-        f.write(" * @param input_fraction_bits Precision (fractional bits) of the input value\n")
-        f.write(" * @return Fixed-point arccosine value with input_fraction_bits precision in [0, pi] range\n")
+        f.write(" * @tparam P Precision (fractional bits) of the input value\n")
+        f.write(" * @param x Fixed-point value in [-1,1] range with P fraction bits\n")
+        f.write(" * @return Fixed-point arccosine value with P fraction bits in [0, pi] range\n")
         f.write(" */\n")
-        f.write("inline int64_t LookupAcos(int64_t x, int input_fraction_bits) noexcept {\n")
+        f.write("template <int P>\n")
+        f.write("inline constexpr auto LookupAcos(int64_t x) noexcept -> int64_t {\n")
+        f.write("    Fixed64Instrumentation::Record(Fixed64Event::kAcosLookup);\n")
         f.write("    // Fixed-point constants\n")
         f.write("    constexpr int kFractionBits = 32;\n")
         f.write(f"    constexpr int64_t kOne = 1LL << kFractionBits;\n")
@@ -192,35 +195,14 @@ def generate_acos_lut(output_file="acos_lut.h"):
         f.write("    constexpr int64_t kInvScale_5 = (1LL << (kFractionBits + 8)) / (kOne / 1000LL);\n\n")
         
         f.write("    // Adjust input to internal precision\n")
-        f.write("    int64_t scaled_x;\n")
-        f.write("    if (input_fraction_bits > kFractionBits) {\n")
-        f.write("        scaled_x = x >> (input_fraction_bits - kFractionBits);\n")
-        f.write("    } else if (input_fraction_bits < kFractionBits) {\n")
-        f.write("        scaled_x = x << (kFractionBits - input_fraction_bits);\n")
-        f.write("    } else {\n")
-        f.write("        scaled_x = x;\n")
-        f.write("    }\n\n")
+        f.write("    int64_t scaled_x = ToLutSaturated<P>(x);\n\n")
         
         f.write("    // Boundary check: ensure input is in [-kOne, kOne] range\n")
         f.write("    if (scaled_x >= kOne) {\n")
-        f.write("        int64_t result = 0;\n")
-        f.write("        // Adjust output precision\n")
-        f.write("        if (input_fraction_bits > kFractionBits) {\n")
-        f.write("            result = result << (input_fraction_bits - kFractionBits);\n")
-        f.write("        } else if (input_fraction_bits < kFractionBits) {\n")
-        f.write("            result = result >> (kFractionBits - input_fraction_bits);\n")
-        f.write("        }\n")
-        f.write("        return result;\n")
+        f.write("        return FromLutFormat<P>(0);\n")
         f.write("    }\n")
         f.write("    if (scaled_x <= -kOne) {\n")
-        f.write("        int64_t result = kPi;\n")
-        f.write("        // Adjust output precision\n")
-        f.write("        if (input_fraction_bits > kFractionBits) {\n")
-        f.write("            result = result << (input_fraction_bits - kFractionBits);\n")
-        f.write("        } else if (input_fraction_bits < kFractionBits) {\n")
-        f.write("            result = result >> (kFractionBits - input_fraction_bits);\n")
-        f.write("        }\n")
-        f.write("        return result;\n")
+        f.write("        return FromLutFormat<P>(kPi);\n")
         f.write("    }\n\n")
         
         f.write("    bool is_negative = scaled_x < 0;\n")
@@ -238,11 +220,7 @@ def generate_acos_lut(output_file="acos_lut.h"):
         f.write("        }\n")
         f.write("        \n")
         f.write("        // Adjust output precision\n")
-        f.write("        if (input_fraction_bits > kFractionBits) {\n")
-        f.write("            result = result << (input_fraction_bits - kFractionBits);\n")
-        f.write("        } else if (input_fraction_bits < kFractionBits) {\n")
-        f.write("            result = result >> (kFractionBits - input_fraction_bits);\n")
-        f.write("        }\n")
+        f.write("        result = FromLutFormat<P>(result);\n")
         f.write("        return result;\n")
         f.write("    }\n\n")
         
@@ -332,11 +310,7 @@ def generate_acos_lut(output_file="acos_lut.h"):
         f.write("    }\n\n")
         
         f.write("    // Adjust output precision\n")
-        f.write("    if (input_fraction_bits > kFractionBits) {\n")
-        f.write("        result = result << (input_fraction_bits - kFractionBits);\n")
-        f.write("    } else if (input_fraction_bits < kFractionBits) {\n")
-        f.write("        result = result >> (kFractionBits - input_fraction_bits);\n")
-        f.write("    }\n\n")
+        f.write("    result = FromLutFormat<P>(result);\n\n")
         
         f.write("    return result;\n")
         f.write("}\n\n")
@@ -349,4 +323,4 @@ if __name__ == "__main__":
     if len(sys.argv) > 1:
         generate_acos_lut(sys.argv[1])
     else:
-        generate_acos_lut()
\ No newline at end of file
+        generate_acos_lut()
\ No newline at end of file
@@ -32,13 +32,14 @@ def generate_atan2_lut(table_size=256, output_file="atan2_lut.h"):
         f.write("#pragma once\n\n")
         f.write("#include <array>\n")
         f.write("#include <cstdint>\n\n")
+        f.write("#include \"lut_format.h\"\n\n")
         f.write("namespace math::fp::detail {\n\n")
         
         # Write table as std::array with inline
         f.write(f"// Arctangent lookup table with {table_size + 1} entries for atan2 implementation\n")
         f.write(f"// Input range: [0, 1], Output: atan(x) in radians [0, pi/4]\n")
         f.write(f"// Fixed-point format: Q31.32\n")
-        f.write(f"inline constexpr std::array<int64_t, {table_size + 1}> kAtan2LUT = {{\n")
+        f.write(f"alignas(64) inline constexpr std::array<int64_t, {table_size + 1}> kAtan2LUT = {{\n")
         
         # Format the values with comments indicating actual values
         for i, val in enumerate(fixed_values):
@@ -58,20 +59,15 @@ def generate_atan2_lut(table_size=256, output_file="atan2_lut.h"):
         f.write("/**\n")
         f.write(" * @brief Lookup arctangent value for atan2 implementation with linear interpolation\n")
         f.write(" * @param ratio Fixed-point ratio value (y/x or x/y) in [0,1] range\n")
-        f.write(" * @param P Precision (fractional bits) of the input\n")
+        f.write(" * @tparam P Precision (fractional bits) of the input\n")
         f.write(" * @return Fixed-point arctangent value with P fractional bits in [0, pi/4] range\n")
         f.write(" */\n")
-        f.write("inline auto LookupAtan2(int64_t ratio, int P) noexcept -> int64_t {\n")
+        f.write("template <int P>\n")
+        f.write("inline constexpr auto LookupAtan2(int64_t ratio) noexcept -> int64_t {\n")
+        f.write("    Fixed64Instrumentation::Record(Fixed64Event::kAtan2Lookup);\n")
         f.write("    // Scale input to [0, 1] range in Q31.32 format\n")
-        f.write("    constexpr int kTableP = 32;\n")
-        f.write("    int64_t scaled_x;\n")
-        f.write("    if (P > kTableP) {\n")
-        f.write("        scaled_x = ratio >> (P - kTableP);\n")
-        f.write("    } else if (P < kTableP) {\n")
-        f.write("        scaled_x = ratio << (kTableP - P);\n")
-        f.write("    } else {\n")
-        f.write("        scaled_x = ratio;\n")
-        f.write("    }\n\n")
+        f.write("    constexpr int kTableP = kLutFractionBits;\n")
+        f.write("    int64_t scaled_x = ToLutFormat<P>(ratio);\n\n")
         
         f.write("    // Ensure input is in valid range\n")
         f.write("    constexpr int64_t kOne = 1LL << kTableP;\n")
@@ -90,14 +86,8 @@ def generate_atan2_lut(table_size=256, output_file="atan2_lut.h"):
         f.write(f"    int64_t y1 = kAtan2LUT[index + 1];\n")
         f.write(f"    int64_t result = y0 + ((y1 - y0) * frac) / kIndexScale;\n\n")
         
-        f.write(f"    // Adjust precision if needed\n")
-        f.write(f"    if (P > kTableP) {{\n")
-        f.write(f"        result = result << (P - kTableP);\n")
-        f.write(f"    }} else if (P < kTableP) {{\n")
-        f.write(f"        result = result >> (kTableP - P);\n")
-        f.write(f"    }}\n\n")
-        
-        f.write(f"    return result;\n")
+        f.write(f"    // Adjust precision\n")
+        f.write(f"    return FromLutFormat<P>(result);\n")
         f.write(f"}}\n\n")
         
         f.write("} // namespace math::fp::detail\n")
@@ -16,6 +16,7 @@ def generate_atan_lut(output_file=None, entries=512, fraction_bits=32):
     lines.append("")
     lines.append("#include <stdint.h>")
     lines.append("#include <array>")
+    lines.append("#include \"lut_format.h\"")
     lines.append("#include \"primitives.h\"")
     lines.append("")
     lines.append(f"// Atan lookup table with {entries + 1} entries")
@@ -30,7 +31,7 @@ def generate_atan_lut(output_file=None, entries=512, fraction_bits=32):
     lines.append("// Table maps x in [0,1] to atan(x)")
     lines.append(f"// Values stored in Q{int_bits}.{fraction_bits} fixed-point format")
     lines.append(
-        f"inline constexpr std::array<int64_t, {entries + 1}> kAtanLut = {{")
+        f"alignas(64) inline constexpr std::array<int64_t, {entries + 1}> kAtanLut = {{")
 
     # Generate the table entries
     scale = mp.mpf(2) ** fraction_bits
@@ -67,12 +68,14 @@ def generate_atan_lut(output_file=None, entries=512, fraction_bits=32):
     lines.append(
         "// Fast lookup atan(x) with linear interpolation between table entries")
     lines.append(
-        "// Input x is in fixed-point format with specified fraction bits representing a value in [-1,1]")
+        "// Input x is in fixed-point format with P fraction bits representing a value in [-1,1]")
     lines.append(
         f"// Output is in fixed-point format with the same fraction bits representing atan(x)")
-    lines.append("// Precision: ~3.1e-7 when fraction_bits=32")
+    lines.append("// Precision: ~3.1e-7 when P=32")
+    lines.append("template <int P>")
     lines.append(
-        "inline constexpr auto LookupAtanFast(int64_t x, int input_fraction_bits) noexcept -> int64_t {")
+        "inline constexpr auto LookupAtanFast(int64_t x) noexcept -> int64_t {")
+    lines.append("    Fixed64Instrumentation::Record(Fixed64Event::kAtanLookup);")
     lines.append("    // Constants")
     lines.append(
         f"    constexpr int kOutputFractionBits = {fraction_bits};  // Internal calculation format")
@@ -87,16 +90,8 @@ def generate_atan_lut(output_file=None, entries=512, fraction_bits=32):
     lines.append("    }")
     lines.append("")
 
-    lines.append("    // Convert input to internal format if needed")
-    lines.append("    if (input_fraction_bits != kOutputFractionBits) {")
-    lines.append("        if (input_fraction_bits < kOutputFractionBits) {")
-    lines.append(
-        "            x <<= (kOutputFractionBits - input_fraction_bits);")
-    lines.append("        } else {")
-    lines.append(
-        "            x >>= (input_fraction_bits - kOutputFractionBits);")
-    lines.append("        }")
-    lines.append("    }")
+    lines.append("    // Convert input to Q31.32")
+    lines.append("    x = ToLutSaturated<P>(x);")
     lines.append("")
 
     lines.append("    // 1. Ensure x is in [0,1] range")
@@ -143,16 +138,8 @@ def generate_atan_lut(output_file=None, entries=512, fraction_bits=32):
     lines.append("    }")
     lines.append("")
 
-    lines.append("    // 6. Convert result back to input format if needed")
-    lines.append("    if (input_fraction_bits != kOutputFractionBits) {")
-    lines.append("        if (input_fraction_bits < kOutputFractionBits) {")
-    lines.append(
-        "            result >>= (kOutputFractionBits - input_fraction_bits);")
-    lines.append("        } else {")
-    lines.append(
-        "            result <<= (input_fraction_bits - kOutputFractionBits);")
-    lines.append("        }")
-    lines.append("    }")
+    lines.append("    // 6. Convert result back to input format")
+    lines.append("    result = FromLutFormat<P>(result);")
     lines.append("")
 
     lines.append("    // Apply sign")
@@ -164,12 +151,14 @@ def generate_atan_lut(output_file=None, entries=512, fraction_bits=32):
     lines.append(
         "// High precision lookup atan(x) with quadratic interpolation between table entries")
     lines.append(
-        "// Input x is in fixed-point format with specified fraction bits representing a value in [-1,1]")
+        "// Input x is in fixed-point format with P fraction bits representing a value in [-1,1]")
     lines.append(
         f"// Output is in fixed-point format with the same fraction bits representing atan(x)")
-    lines.append("// Precision: ~5.5e-10 when fraction_bits=32")
+    lines.append("// Precision: ~5.5e-10 when P=32")
+    lines.append("template <int P>")
     lines.append(
-        "inline constexpr auto LookupAtan(int64_t x, int input_fraction_bits) noexcept -> int64_t {")
+        "inline constexpr auto LookupAtan(int64_t x) noexcept -> int64_t {")
+    lines.append("    Fixed64Instrumentation::Record(Fixed64Event::kAtanLookup);")
     lines.append("    // Constants")
     lines.append(
         f"    constexpr int kOutputFractionBits = {fraction_bits};  // Internal calculation format")
@@ -184,16 +173,8 @@ def generate_atan_lut(output_file=None, entries=512, fraction_bits=32):
     lines.append("    }")
     lines.append("")
 
-    lines.append("    // Convert input to internal format if needed")
-    lines.append("    if (input_fraction_bits != kOutputFractionBits) {")
-    lines.append("        if (input_fraction_bits < kOutputFractionBits) {")
-    lines.append(
-        "            x <<= (kOutputFractionBits - input_fraction_bits);")
-    lines.append("        } else {")
-    lines.append(
-        "            x >>= (input_fraction_bits - kOutputFractionBits);")
-    lines.append("        }")
-    lines.append("    }")
+    lines.append("    // Convert input to Q31.32")
+    lines.append("    x = ToLutSaturated<P>(x);")
     lines.append("")
 
     lines.append("    // 1. Ensure x is in [0,1] range")
@@ -268,16 +249,8 @@ def generate_atan_lut(output_file=None, entries=512, fraction_bits=32):
     lines.append("    }")
     lines.append("")
 
-    lines.append("    // 6. Convert result back to input format if needed")
-    lines.append("    if (input_fraction_bits != kOutputFractionBits) {")
-    lines.append("        if (input_fraction_bits < kOutputFractionBits) {")
-    lines.append(
-        "            result >>= (kOutputFractionBits - input_fraction_bits);")
-    lines.append("        } else {")
-    lines.append(
-        "            result <<= (input_fraction_bits - kOutputFractionBits);")
-    lines.append("        }")
-    lines.append("    }")
+    lines.append("    // 6. Convert result back to input format")
+    lines.append("    result = FromLutFormat<P>(result);")
     lines.append("")
 
     lines.append("    // Apply sign")
@@ -289,7 +262,7 @@ def generate_atan_lut(output_file=None, entries=512, fraction_bits=32):
     lines.append(
         "// Fast lookup atan(x) with linear interpolation between table entries")
     lines.append(
-        "// Input x is in fixed-point format with specified fraction bits representing a value in [-1,1]")
+        "// Input x is in fixed-point format with P fraction bits representing a value in [-1,1]")
     lines.append(
         f"// Output is in fixed-point format with the same fraction bits representing atan(x)")
 
@@ -4,68 +4,253 @@ import sys
 # Set high precision
 mp.mp.dps = 100
 
-def generate_cordic_table(output_file=None, iterations=32, scale_bits=63):
-    """Generate CORDIC angle table for atan2 implementation"""
-    
+def generate_cordic_table(output_file=None, iterations=62, scale_bits=62):
+    """Generate the CORDIC backend (angle table, gain and kernels) for sin/cos/atan2/hypot"""
+
+    scale = mp.mpf(2) ** scale_bits
+
+    def fixed(value, bits=scale_bits):
+        return int(mp.nint(value * mp.mpf(2) ** bits))
+
+    # Gain of the infinite sequence of micro-rotations: prod(1/sqrt(1 + 2^-2i))
+    gain = mp.mpf(1)
+    for i in range(200):
+        gain /= mp.sqrt(1 + mp.mpf(2) ** (-2 * i))
+
+    # pi/2 split so that q * pi/2 is exact to 2*scale_bits bits during argument reduction
+    half_pi_hi = fixed(mp.pi / 2)
+    half_pi_lo = fixed((mp.pi / 2 - mp.mpf(half_pi_hi) / scale) * scale)
+
     # Prepare the output with proper headers
     lines = []
     lines.append("#pragma once")
     lines.append("")
     lines.append("#include <stdint.h>")
     lines.append("#include <array>")
+    lines.append("#include <utility>")
+    lines.append("#include \"primitives.h\"")
     lines.append("")
     lines.append(f"// CORDIC angle table with {iterations} entries")
     lines.append(f"// Contains atan(2^-i) values for i=0...{iterations-1}")
     lines.append(f"// Values scaled by 2^{scale_bits}")
     lines.append(f"// Generated with mpmath library at {mp.mp.dps} digits precision")
     lines.append("")
-    
+
     # Generate the table header
-    lines.append(f"namespace math::fp {{")
-    lines.append(f"namespace detail {{")
+    lines.append(f"namespace math::fp::detail {{")
+    lines.append(f"inline constexpr int kCordicFractionBits = {scale_bits};")
+    lines.append(f"inline constexpr int kCordicMaxIterations = {iterations};")
+    lines.append("")
     lines.append(f"// Table contains atan(2^-i) values for CORDIC algorithm")
     lines.append(f"// Values scaled by 2^{scale_bits}")
-    lines.append(f"constexpr std::array<int64_t, {iterations}> CordicTable = {{")
-    
-    # Scale factor
-    scale = mp.mpf(2) ** scale_bits
-    
+    lines.append(f"inline constexpr std::array<int64_t, {iterations}> kCordicAngles = {{")
+
     # Generate table entries
     for i in range(iterations):
         angle = mp.atan(mp.mpf(1) / mp.mpf(2**i))
-        scaled_value = int(angle * scale)
-        
+        scaled_value = int(mp.nint(angle * scale))
+
         # Format as hex for compactness and readability
-        hex_val = f"0x{scaled_value & ((1 << 64) - 1):016x}LL"
-        
+        hex_val = f"0x{scaled_value & ((1 << 64) - 1):016X}LL"
+
         # Add comment with original values for verification
-        comment = f"// atan(2^-{i}) = {angle}"
-        
+        comment = f"// atan(2^-{i}) = {float(angle):.17g}"
+
         # Add the entry to lines
         if i < iterations - 1:
             lines.append(f"    {hex_val},  {comment}")
         else:
             # Last entry without comma
             lines.append(f"    {hex_val}   {comment}")
-    
+
     # Close the table
     lines.append("};")
-    lines.append("} // namespace detail")
-    lines.append("} // namespace math::fp")
-    
+    lines.append("")
+    lines.append(f"// prod(1/sqrt(1 + 2^-2i)), starting value that cancels the gain of the rotations")
+    lines.append(f"inline constexpr int64_t kCordicGain = 0x{fixed(gain):016X}LL;"
+                 f"  // {float(gain):.17g}")
+    lines.append(f"// pi/2 = kCordicHalfPiHi + kCordicHalfPiLo * 2^-{scale_bits}")
+    lines.append(f"inline constexpr int64_t kCordicHalfPiHi = 0x{half_pi_hi:016X}LL;")
+    lines.append(f"inline constexpr int64_t kCordicHalfPiLo = 0x{half_pi_lo:016X}LL;")
+    lines.append(f"inline constexpr int64_t kCordicTwoOverPi = 0x{fixed(2 / mp.pi):016X}LL;")
+    lines.append(f"// pi with {scale_bits - 1} fraction bits")
+    lines.append(f"inline constexpr int64_t kCordicPi = 0x{fixed(mp.pi, scale_bits - 1):016X}LL;")
+    lines.append("")
+    lines.append(CORDIC_FUNCTIONS.strip("\n"))
+    lines.append("}  // namespace math::fp::detail")
+
     # Output to file or stdout
     if output_file:
         with open(output_file, 'w', encoding='utf-8') as f:
-            f.write('\n'.join(lines))
+            f.write('\n'.join(lines) + '\n')
         print(f"CORDIC table written to {output_file}")
     else:
         print('\n'.join(lines))
 
+
+CORDIC_FUNCTIONS = r"""
+// Number of iterations for fraction_bits + 2 correct bits, each iteration adds one bit
+inline constexpr auto CordicIterations(int fraction_bits) noexcept -> int {
+    return fraction_bits + 3 < kCordicMaxIterations ? fraction_bits + 3 : kCordicMaxIterations;
+}
+
+// Round a value with kCordicFractionBits fraction bits to fraction_bits (at most as many)
+inline constexpr auto CordicRound(int64_t value, int fraction_bits) noexcept -> int64_t {
+    const int shift = kCordicFractionBits - fraction_bits;
+    return shift == 0 ? value : (value + (int64_t(1) << (shift - 1))) >> shift;
+}
+
+// Split an angle with fraction_bits (3-62) fraction bits into x = q*pi/2 + r
+// Returns the quadrant q and r in Q1.62, |r| stays well inside the convergence range of 1.74;
+// pi/2 is used with 124 bits, so r keeps full precision even for the largest angles
+inline constexpr auto CordicReduce(int64_t x, int fraction_bits) noexcept
+    -> std::pair<int64_t, int64_t> {
+    // q = x * 2/pi rounded, ignoring the low product word only matters next to a tie
+    uint64_t hi = 0;
+    uint64_t lo = 0;
+    Primitives::MulAdd128(x, kCordicTwoOverPi, hi, lo);
+    const int shift = fraction_bits + kCordicFractionBits - 64;
+    const int64_t q = (static_cast<int64_t>(hi) + (int64_t(1) << (shift - 1))) >> shift;
+
+    // r = x - q * pi/2 computed in 128 bits, the remainder fits in the low word
+    hi = 0;
+    lo = 0;
+    Primitives::MulAdd128(x, int64_t(1) << (kCordicFractionBits - fraction_bits), hi, lo);
+    Primitives::MulAdd128(-q, kCordicHalfPiHi, hi, lo);
+    const int64_t r = static_cast<int64_t>(lo)
+                      - Primitives::Fixed64Mul<kCordicFractionBits>(q, kCordicHalfPiLo);
+    return {q, r};
+}
+
+// Rotation mode: rotate (kCordicGain, 0) by z, |z| <= 1.74 in Q1.62
+// Returns (cos(z), sin(z)) in Q1.62 using shifts and adds only
+inline constexpr auto CordicRotate(int64_t z, int iterations) noexcept
+    -> std::pair<int64_t, int64_t> {
+    int64_t x = kCordicGain;
+    int64_t y = 0;
+    for (int i = 0; i < iterations; ++i) {
+        // Rotate towards z = 0: counterclockwise while z >= 0, d = -1 flips the direction
+        const int64_t d = z >> 63;
+        const int64_t dx = y >> i;
+        const int64_t dy = x >> i;
+        x -= (dx ^ d) - d;
+        y += (dy ^ d) - d;
+        z -= (kCordicAngles[i] ^ d) - d;
+    }
+    return {x, y};
+}
+
+// Vectoring mode: rotate (x, y) with x >= 0 onto the positive x axis
+// Returns (sqrt(x^2 + y^2) / kCordicGain, atan(y / x) in Q1.62) using shifts and adds only
+// |x| and |y| must stay below 2^61 so the gain of 1.65 cannot overflow
+inline constexpr auto CordicVector(int64_t x, int64_t y, int iterations) noexcept
+    -> std::pair<int64_t, int64_t> {
+    int64_t z = 0;
+    for (int i = 0; i < iterations; ++i) {
+        // Rotate towards y = 0: clockwise while y >= 0, d = -1 flips the direction
+        const int64_t d = y >> 63;
+        const int64_t dx = y >> i;
+        const int64_t dy = x >> i;
+        x += (dx ^ d) - d;
+        y -= (dy ^ d) - d;
+        z += (kCordicAngles[i] ^ d) - d;
+    }
+    return {x, z};
+}
+
+// Shift that scales max(|x|, |y|) into [2^60, 2^61) for CordicVector, negative for right shifts
+inline constexpr auto CordicNormalizeShift(uint64_t abs_x, uint64_t abs_y) noexcept -> int {
+    return Primitives::CountlZero(abs_x | abs_y) - 3;
+}
+
+inline constexpr auto CordicShift(int64_t value, int shift) noexcept -> int64_t {
+    return shift >= 0 ? value << shift : value >> -shift;
+}
+
+// sin(x) and cos(x) with CORDIC rotations
+// Input and output have fraction_bits fraction bits, range 3-62
+// Precision: within 1 ulp up to 54 fraction bits, about 2^-56 above
+inline constexpr auto CordicSinCos(int64_t x, int fraction_bits) noexcept
+    -> std::pair<int64_t, int64_t> {
+    const auto [q, r] = CordicReduce(x, fraction_bits);
+    const auto [c, s] = CordicRotate(r, CordicIterations(fraction_bits));
+    const int64_t sin_r = CordicRound(s, fraction_bits);
+    const int64_t cos_r = CordicRound(c, fraction_bits);
+
+    // Rotate by q quarter turns
+    switch (q & 3) {
+        case 0:
+            return {sin_r, cos_r};
+        case 1:
+            return {cos_r, -sin_r};
+        case 2:
+            return {-sin_r, -cos_r};
+        default:
+            return {-cos_r, sin_r};
+    }
+}
+
+// atan2(y, x) with CORDIC vectoring, in [-pi, pi]
+// Input and output have fraction_bits fraction bits, range 3-61, NaN inputs are not handled
+// (0, 0) gives 0 and (0, x < 0) gives pi within 1 ulp
+inline constexpr auto CordicAtan2(int64_t y, int64_t x, int fraction_bits) noexcept -> int64_t {
+    // (x, y) and (-x, -y) differ by pi: fold into the right half-plane
+    const int64_t flip = x >> 63;
+    const int64_t y_sign = y >> 63;
+    const int64_t abs_x = (x ^ flip) - flip;
+    const int64_t abs_y = (y ^ y_sign) - y_sign;
+    const int64_t folded_y = (y ^ flip) - flip;
+
+    const int shift = CordicNormalizeShift(static_cast<uint64_t>(abs_x),
+                                           static_cast<uint64_t>(abs_y));
+    const int64_t z = CordicVector(CordicShift(abs_x, shift),
+                                   CordicShift(folded_y, shift),
+                                   CordicIterations(fraction_bits))
+                          .second;
+
+    // Add pi for the left half-plane, on the side of the original y
+    const int64_t offset = ((kCordicPi ^ y_sign) - y_sign) & flip;
+    const int64_t angle = (z >> 1) + offset;
+    const int shift_out = kCordicFractionBits - 1 - fraction_bits;
+    return shift_out == 0 ? angle : (angle + (int64_t(1) << (shift_out - 1))) >> shift_out;
+}
+
+// sqrt(x^2 + y^2) with CORDIC vectoring, in the format of the inputs
+// Returns INT64_MAX if the result does not fit; one multiply removes the gain of the rotations
+// Precision: relative error about 2^-54, raw results below 2^53 are within 1 ulp
+inline constexpr auto CordicHypot(int64_t x, int64_t y) noexcept -> int64_t {
+    // 32 iterations leave a relative error of 2^-64 whatever the format
+    constexpr int kIterations = 32;
+    const uint64_t abs_x = x < 0 ? 0 - static_cast<uint64_t>(x) : static_cast<uint64_t>(x);
+    const uint64_t abs_y = y < 0 ? 0 - static_cast<uint64_t>(y) : static_cast<uint64_t>(y);
+    if ((abs_x | abs_y) == 0) {
+        return 0;
+    }
+
+    const int shift = CordicNormalizeShift(abs_x, abs_y);
+    const int64_t length = CordicVector(CordicShift(static_cast<int64_t>(abs_x), shift),
+                                        CordicShift(static_cast<int64_t>(abs_y), shift),
+                                        kIterations)
+                               .first;
+    uint64_t hi = 0;
+    uint64_t lo = 0;
+    Primitives::MulAdd128(length, kCordicGain, hi, lo);
+
+    // Undo the normalization, the scaled length has at least 60 significant bits
+    const int64_t scaled = Primitives::Round128(hi, lo, kCordicFractionBits);
+    if (shift > 0) {
+        return (scaled + (int64_t(1) << (shift - 1))) >> shift;
+    }
+    return scaled > (INT64_MAX >> -shift) ? INT64_MAX : scaled << -shift;
+}
+"""
+
+
 if __name__ == "__main__":
-    iterations = 32  # Default number of iterations
-    scale_bits = 63  # Default scale factor (standard for Fixed64)
+    iterations = 62  # Default number of iterations
+    scale_bits = 62  # Default scale factor (Q1.62, the widest format that holds +-pi/2)
     output_file = None
-    
+
     # Parse command line arguments if provided
     if len(sys.argv) > 1:
         try:
@@ -73,19 +258,19 @@ if __name__ == "__main__":
         except ValueError:
             # Not a number, assume it's a filename
             output_file = sys.argv[1]
-    
+
     if len(sys.argv) > 2:
         try:
             iterations = int(sys.argv[2])
         except ValueError:
             print(f"Error: Invalid number of iterations: {sys.argv[2]}")
             sys.exit(1)
-    
+
     if len(sys.argv) > 3:
         try:
             scale_bits = int(sys.argv[3])
         except ValueError:
             print(f"Error: Invalid scale bits: {sys.argv[3]}")
             sys.exit(1)
-    
-    generate_cordic_table(output_file, iterations, scale_bits) 
\ No newline at end of file
+
+    generate_cordic_table(output_file, iterations, scale_bits)
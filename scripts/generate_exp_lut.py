@@ -0,0 +1,363 @@
+import mpmath as mp
+import sys
+
+# Set very high precision
+mp.mp.dps = 100
+
+
+def _solve_linear(matrix, rhs):
+    """Solve matrix * x = rhs by Gaussian elimination with partial pivoting"""
+    n = len(rhs)
+    a = [list(row) + [rhs[i]] for i, row in enumerate(matrix)]
+    for col in range(n):
+        pivot = max(range(col, n), key=lambda r: abs(a[r][col]))
+        a[col], a[pivot] = a[pivot], a[col]
+        for r in range(col + 1, n):
+            factor = a[r][col] / a[col][col]
+            for c in range(col, n + 1):
+                a[r][c] -= factor * a[col][c]
+    x = [mp.mpf(0)] * n
+    for r in range(n - 1, -1, -1):
+        acc = a[r][n]
+        for c in range(r + 1, n):
+            acc -= a[r][c] * x[c]
+        x[r] = acc / a[r][r]
+    return x
+
+
+def _eval_poly(coeffs, t):
+    """Evaluate sum(coeffs[i] * t^i) with Horner's method"""
+    result = mp.mpf(0)
+    for c in reversed(coeffs):
+        result = result * t + c
+    return result
+
+
+def _remez(func, lo, hi, degree, grid_size=2000, iterations=10):
+    """Minimax polynomial p(t) ~ func(t) on [lo, hi] by the Remez exchange algorithm"""
+    n = degree
+    grid = [lo + (hi - lo) * mp.mpf(i) / (grid_size - 1) for i in range(grid_size)]
+    values = [func(t) for t in grid]
+
+    # Initial reference: Chebyshev extrema
+    reference = [(lo + hi) / 2 - (hi - lo) / 2 * mp.cos(mp.pi * i / (n + 1))
+                 for i in range(n + 2)]
+
+    coeffs = None
+    for _ in range(iterations):
+        # Solve p(x_i) + (-1)^i E = f(x_i) for the coefficients and the levelled error E
+        matrix = []
+        rhs = []
+        for i, x in enumerate(reference):
+            powers = [mp.mpf(1)]
+            for _ in range(n):
+                powers.append(powers[-1] * x)
+            matrix.append(powers + [mp.mpf((-1) ** i)])
+            rhs.append(func(x))
+        solution = _solve_linear(matrix, rhs)
+        coeffs = solution[:n + 1]
+
+        # New reference: the largest error of every run of equal sign on the grid
+        errors = [_eval_poly(coeffs, t) - v for t, v in zip(grid, values)]
+        extrema = []
+        for t, e in zip(grid, errors):
+            if extrema and (e >= 0) == (extrema[-1][1] >= 0):
+                if abs(e) > abs(extrema[-1][1]):
+                    extrema[-1] = (t, e)
+            else:
+                extrema.append((t, e))
+        while len(extrema) > n + 2:
+            extrema.pop(0 if abs(extrema[0][1]) < abs(extrema[-1][1]) else -1)
+        if len(extrema) < n + 2:
+            break
+        reference = [t for t, _ in extrema]
+
+    return coeffs, grid, values
+
+
+def generate_exp_lut(output_file=None, table_bits=6, low_degrees=(2, 3), high_degrees=(4, 5)):
+    """Generate the 2^(i/N) and log2 tables with their remainder polynomials"""
+
+    fraction_bits = 62
+    scale = mp.mpf(2) ** fraction_bits
+    entries = 1 << table_bits
+    width = mp.mpf(1) / entries
+    ln2 = mp.log(2)
+
+    def fixed(value):
+        return int(mp.nint(value * scale))
+
+    def hex_literal(value):
+        if value < 0:
+            return f"-0x{-value:016X}LL"
+        return f"0x{value:016X}LL"
+
+    # The polynomials approximate (2^t - 1) / t and log2(1 + r) / r, so that t * p(t) is exactly
+    # zero at t = 0 and Pow2 of integers and Log of powers of two stay exact
+    def exp2_ratio(t):
+        return ln2 if t == 0 else (mp.mpf(2) ** t - 1) / t
+
+    def log2_ratio(r):
+        return 1 / ln2 if r == 0 else mp.log(1 + r) / ln2 / r
+
+    def fit(func, degree):
+        coeffs, grid, values = _remez(func, mp.mpf(0), width, degree)
+        rounded = [fixed(c) for c in coeffs]
+        exact = [mp.mpf(c) / scale for c in rounded]
+        # Error of t * p(t), the term that is added to the table value
+        error = max(abs(_eval_poly(exact, t) - v) * t for t, v in zip(grid, values))
+        return rounded, error
+
+    polys = []
+    for name, func, degree in (("kExp2PolyLow", exp2_ratio, low_degrees[0]),
+                               ("kLog2PolyLow", log2_ratio, low_degrees[1]),
+                               ("kExp2PolyHigh", exp2_ratio, high_degrees[0]),
+                               ("kLog2PolyHigh", log2_ratio, high_degrees[1])):
+        rounded, error = fit(func, degree)
+        polys.append((name, degree, rounded, error))
+
+    lines = []
+    lines.append("#pragma once")
+    lines.append("")
+    lines.append("#include <stdint.h>")
+    lines.append("#include <array>")
+    lines.append("#include <utility>")
+    lines.append("#include \"primitives.h\"")
+    lines.append("")
+    lines.append(f"// Exp2 and log2 lookup tables with {entries} entries each and remainder polynomials")
+    lines.append(f"// Values in Q1.{fraction_bits} format ({3 * entries * 8} bytes of tables)")
+    lines.append(f"// Generated with mpmath library at {mp.mp.dps} digits precision (Remez exchange)")
+    for name, degree, _, error in polys:
+        lines.append(f"// {name}: degree {degree}, max error {float(error):.3e}")
+    lines.append("")
+    lines.append("namespace math::fp::detail {")
+    lines.append(f"inline constexpr int kExpLutBits = {table_bits};")
+    lines.append(f"inline constexpr int kExpLutFractionBits = {fraction_bits};")
+    lines.append("")
+
+    lines.append(f"// Table maps i to 2^(i/{entries})")
+    lines.append(f"alignas(64) inline constexpr std::array<int64_t, {entries}> kExp2Lut = {{")
+    for i in range(entries):
+        value = mp.mpf(2) ** (mp.mpf(i) / entries)
+        sep = "," if i < entries - 1 else ""
+        lines.append(f"    {hex_literal(fixed(value))}{sep}  // 2^({i}/{entries}) = {float(value):.14f}")
+    lines.append("};")
+    lines.append("")
+
+    # The rounded inverse is what the evaluation multiplies by, so the logarithm table holds
+    # the exact logarithm of that rounded value
+    inverses = [fixed(1 / (1 + mp.mpf(i) / entries)) for i in range(entries)]
+    lines.append(f"// Table maps i to 1 / (1 + i/{entries})")
+    lines.append(f"alignas(64) inline constexpr std::array<int64_t, {entries}> kLog2InvLut = {{")
+    for i, inv in enumerate(inverses):
+        sep = "," if i < entries - 1 else ""
+        lines.append(f"    {hex_literal(inv)}{sep}")
+    lines.append("};")
+    lines.append("")
+    lines.append("// Table maps i to -log2(kLog2InvLut[i])")
+    lines.append(f"alignas(64) inline constexpr std::array<int64_t, {entries}> kLog2Lut = {{")
+    for i, inv in enumerate(inverses):
+        value = -mp.log(mp.mpf(inv) / scale) / ln2
+        sep = "," if i < entries - 1 else ""
+        lines.append(f"    {hex_literal(fixed(value))}{sep}  // {float(value):.14f}")
+    lines.append("};")
+    lines.append("")
+
+    lines.append(f"// Coefficients c0..cN of (2^t - 1) / t and log2(1 + r) / r on [0, 1/{entries}]")
+    for name, degree, rounded, _ in polys:
+        lines.append(f"inline constexpr std::array<int64_t, {degree + 1}> {name} = {{")
+        for k, c in enumerate(rounded):
+            sep = "," if k < degree else ""
+            lines.append(f"    {hex_literal(c)}{sep}")
+        lines.append("};")
+    lines.append("")
+    lines.append(f"inline constexpr int64_t kExpLog2E = {hex_literal(fixed(1 / ln2))};  // log2(e)")
+    lines.append(f"inline constexpr int64_t kExpLn2 = {hex_literal(fixed(ln2))};  // ln(2)")
+    lines.append("")
+    lines.append(EXP_FUNCTIONS.strip("\n"))
+    lines.append("}  // namespace math::fp::detail")
+
+    if output_file:
+        with open(output_file, "w", encoding="utf-8") as f:
+            f.write("\n".join(lines) + "\n")
+        print(f"Exp lookup table written to {output_file}")
+    else:
+        print("\n".join(lines))
+
+
+EXP_FUNCTIONS = r"""
+// Formats supported by the lookup functions below
+template <int P>
+inline constexpr bool kExpLutSupported = P >= 2 && P <= 56;
+
+// Formats above Q31.32 use the higher-degree polynomials
+template <int P>
+inline constexpr bool kExpLutHighPrecision = P > 32;
+
+// Estrin's scheme: pairs c[2k] + c[2k+1]*t are independent and combined by Horner's method in
+// t^2, which halves the chain of dependent multiplies on the critical path
+template <size_t N>
+inline constexpr auto EvalExpPoly(const std::array<int64_t, N>& c, int64_t t) noexcept
+    -> int64_t {
+    constexpr size_t kPairs = (N + 1) / 2;
+    std::array<int64_t, kPairs> pairs{};
+    for (size_t k = 0; k < kPairs; ++k) {
+        pairs[k] = 2 * k + 1 < N
+                       ? c[2 * k] + Primitives::Fixed64Mul<kExpLutFractionBits>(c[2 * k + 1], t)
+                       : c[2 * k];
+    }
+    const int64_t t2 = Primitives::Fixed64Mul<kExpLutFractionBits>(t, t);
+    int64_t result = pairs[kPairs - 1];
+    for (size_t k = kPairs - 1; k-- > 0;) {
+        result = pairs[k] + Primitives::Fixed64Mul<kExpLutFractionBits>(result, t2);
+    }
+    return result;
+}
+
+// 2^f for a fraction f in [0, 1) with 62 fraction bits
+// Output in Q1.62, an entry of kExp2Lut times a short polynomial in the remaining bits
+template <bool kHighPrecision>
+inline constexpr auto Exp2Mantissa(uint64_t f) noexcept -> int64_t {
+    constexpr int kShift = kExpLutFractionBits - kExpLutBits;
+    const int64_t entry = kExp2Lut[f >> kShift];
+    const int64_t t = static_cast<int64_t>(f & ((uint64_t(1) << kShift) - 1));
+    int64_t q = 0;
+    if constexpr (kHighPrecision) {
+        q = Primitives::Fixed64Mul<kExpLutFractionBits>(t, EvalExpPoly(kExp2PolyHigh, t));
+    } else {
+        q = Primitives::Fixed64Mul<kExpLutFractionBits>(t, EvalExpPoly(kExp2PolyLow, t));
+    }
+
+    // entry * (1 + q), both terms are non-negative; values just below 2 may round up to 2
+    const uint64_t m = static_cast<uint64_t>(entry)
+                       + Primitives::MulU64Shifted<kExpLutFractionBits>(
+                           static_cast<uint64_t>(entry), static_cast<uint64_t>(q));
+    return m > static_cast<uint64_t>(INT64_MAX) ? INT64_MAX : static_cast<int64_t>(m);
+}
+
+// m * 2^n in a format with fraction_bits fraction bits, rounded to nearest
+// m is a Q1.62 mantissa; saturates to INT64_MAX and underflows to 0
+inline constexpr auto ScaleExp2(int64_t m, int64_t n, int fraction_bits) noexcept -> int64_t {
+    const int64_t shift = kExpLutFractionBits - fraction_bits - n;
+    if (shift < 0) {
+        return INT64_MAX;
+    }
+    if (shift > 63) {
+        return 0;
+    }
+    if (shift == 0) {
+        return m;
+    }
+    return static_cast<int64_t>((static_cast<uint64_t>(m) + (uint64_t(1) << (shift - 1)))
+                                >> shift);
+}
+
+// Split the 128-bit value (hi:lo) with fraction_bits fraction bits (2-125) into its floor n and
+// its fraction in [0, 1) with 62 fraction bits; |n| is clamped to 2^42, far outside any format
+inline constexpr auto SplitExp2Argument(uint64_t hi, uint64_t lo, int fraction_bits) noexcept
+    -> std::pair<int64_t, uint64_t> {
+    const int shift = fraction_bits - kExpLutFractionBits;
+    int64_t top = static_cast<int64_t>(hi);
+    uint64_t bottom = lo;
+    if (shift > 0) {
+        bottom = (lo >> shift) | (hi << (64 - shift));
+        top = static_cast<int64_t>(hi) >> shift;
+    } else if (shift < 0) {
+        top = static_cast<int64_t>((hi << -shift) | (lo >> (64 + shift)));
+        bottom = lo << -shift;
+    }
+
+    constexpr int64_t kLimit = int64_t(1) << 40;
+    const uint64_t fraction = bottom & ((uint64_t(1) << kExpLutFractionBits) - 1);
+    if (top >= kLimit || top < -kLimit) {
+        return {top < 0 ? -(kLimit << 2) : kLimit << 2, fraction};
+    }
+    return {static_cast<int64_t>((static_cast<uint64_t>(top) << 2) | (bottom >> 62)), fraction};
+}
+
+// log2(x) for x > 0 with fraction_bits fraction bits, output in Q7.56
+// x is normalized to [1, 2), divided by the nearest table point below it with one multiply
+// by kLog2InvLut and the remaining log2(1 + r), r < 1/64, is a short polynomial
+template <bool kHighPrecision>
+inline constexpr auto Log2Q56(int64_t x, int fraction_bits) noexcept -> int64_t {
+    constexpr int kShift = kExpLutFractionBits - kExpLutBits;
+    const int msb = 63 - Primitives::CountlZero(static_cast<uint64_t>(x));
+    const int64_t m = x << (kExpLutFractionBits - msb);
+    const int i = static_cast<int>((m >> kShift) & ((1 << kExpLutBits) - 1));
+    const int64_t r = Primitives::Fixed64Mul<kExpLutFractionBits>(m, kLog2InvLut[i])
+                      - (int64_t(1) << kExpLutFractionBits);
+    int64_t frac = kLog2Lut[i];
+    if constexpr (kHighPrecision) {
+        frac += Primitives::Fixed64Mul<kExpLutFractionBits>(r, EvalExpPoly(kLog2PolyHigh, r));
+    } else {
+        frac += Primitives::Fixed64Mul<kExpLutFractionBits>(r, EvalExpPoly(kLog2PolyLow, r));
+    }
+    return (int64_t(msb - fraction_bits) << 56) + ((frac + 32) >> 6);
+}
+
+// 2^x, input and output in Q(63-P).P, saturating to INT64_MAX
+template <int P>
+inline constexpr auto LookupPow2(int64_t x) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kExpLookup);
+    const int64_t n = x >> P;
+    const uint64_t f = static_cast<uint64_t>(x & ((int64_t(1) << P) - 1)) << (62 - P);
+    return ScaleExp2(Exp2Mantissa<kExpLutHighPrecision<P>>(f), n, P);
+}
+
+// e^x = 2^(x * log2(e)), input and output in Q(63-P).P, saturating to INT64_MAX
+// The product with log2(e) is kept in 128 bits so large arguments keep their fraction
+template <int P>
+inline constexpr auto LookupExp(int64_t x) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kExpLookup);
+    uint64_t hi = 0;
+    uint64_t lo = 0;
+    Primitives::MulAdd128(x, kExpLog2E, hi, lo);
+    const auto [n, f] = SplitExp2Argument(hi, lo, P + kExpLutFractionBits);
+    return ScaleExp2(Exp2Mantissa<kExpLutHighPrecision<P>>(f), n, P);
+}
+
+// ln(x) = log2(x) * ln(2) for x > 0, input and output in Q(63-P).P
+template <int P>
+inline constexpr auto LookupLog(int64_t x) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kLogLookup);
+    const int64_t result = Primitives::Fixed64Mul<kExpLutFractionBits>(
+        Log2Q56<kExpLutHighPrecision<P>>(x, P), kExpLn2);
+    constexpr int kShift = 56 - P;
+    if constexpr (kShift == 0) {
+        return result;
+    } else {
+        return (result + (int64_t(1) << (kShift - 1))) >> kShift;
+    }
+}
+
+// x^y = 2^(y * log2(x)) for x > 0, input and output in Q(63-P).P, saturating to INT64_MAX
+// log2(x) is kept with 56 fraction bits and multiplied by y in 128 bits, so y * log2(x) is
+// not rounded to P bits as in Exp(y * Log(x))
+template <int P>
+inline constexpr auto LookupPow(int64_t x, int64_t y) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kPowLookup);
+    uint64_t hi = 0;
+    uint64_t lo = 0;
+    Primitives::MulAdd128(y, Log2Q56<kExpLutHighPrecision<P>>(x, P), hi, lo);
+    const auto [n, f] = SplitExp2Argument(hi, lo, P + 56);
+    return ScaleExp2(Exp2Mantissa<kExpLutHighPrecision<P>>(f), n, P);
+}
+"""
+
+
+if __name__ == "__main__":
+    output_file = None
+    table_bits = 6  # 64 entries per table
+
+    # Parse command line arguments if provided
+    if len(sys.argv) > 1:
+        output_file = sys.argv[1]
+
+    if len(sys.argv) > 2:
+        try:
+            table_bits = int(sys.argv[2])
+        except ValueError:
+            print(f"Error: Invalid table bits: {sys.argv[2]}")
+            sys.exit(1)
+
+    generate_exp_lut(output_file, table_bits)
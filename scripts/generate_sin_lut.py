@@ -17,6 +17,7 @@ def generate_sin_lut(output_file=None, int_bits=31, fraction_bits=32):
     lines.append("")
     lines.append("#include <stdint.h>")
     lines.append("#include <array>")
+    lines.append("#include \"lut_format.h\"")
     lines.append("#include \"primitives.h\"")
     lines.append("")
     lines.append(f"// Sin lookup table with {lut_size} entries")
@@ -32,7 +33,7 @@ def generate_sin_lut(output_file=None, int_bits=31, fraction_bits=32):
     lines.append(
         f"// Values stored in Q{int_bits}.{fraction_bits} fixed-point format")
     lines.append(
-        f"inline constexpr std::array<int64_t, {lut_size + 1}> kSinLut = {{")
+        f"alignas(64) inline constexpr std::array<int64_t, {lut_size + 1}> kSinLut = {{")
 
     # Generate the table entries in Q31.32 format
     scale = mp.mpf(2) ** fraction_bits
@@ -87,12 +88,14 @@ def generate_sin_lut(output_file=None, int_bits=31, fraction_bits=32):
     lines.append(
         "// Fast lookup sin(x) with linear interpolation between table entries")
     lines.append(
-        "// Input x is in fixed-point format with specified fraction bits representing angle in radians")
+        "// Input x is in fixed-point format with P fraction bits representing angle in radians")
     lines.append(
         f"// Output is in Q{int_bits}.{fraction_bits} fixed-point format representing sin(x)")
-    lines.append("// Precision: ~1e-6 when input_fraction_bits=32")
+    lines.append("// Precision: ~1e-6 when P=32")
+    lines.append("template <int P>")
     lines.append(
-        "inline constexpr auto LookupSinFast(int64_t x, int input_fraction_bits) noexcept -> int64_t {")
+        "inline constexpr auto LookupSinFast(int64_t x) noexcept -> int64_t {")
+    lines.append("    Fixed64Instrumentation::Record(Fixed64Event::kSinLookup);")
     lines.append("    // Constants")
     lines.append(f"    constexpr int64_t kPi = {pi_hex};  // pi = {float(pi)}")
     lines.append(
@@ -105,20 +108,12 @@ def generate_sin_lut(output_file=None, int_bits=31, fraction_bits=32):
         f"    constexpr int kOutputFractionBits = {fraction_bits};  // Output format: Q{int_bits}.{fraction_bits}")
     lines.append("")
 
-    lines.append("    // Convert input to Q{int_bits}.{fraction_bits} format if needed")
-    lines.append("    if (input_fraction_bits != kOutputFractionBits) {")
-    lines.append("        if (input_fraction_bits < kOutputFractionBits) {")
-    lines.append(
-        "            x <<= (kOutputFractionBits - input_fraction_bits);")
-    lines.append("        } else {")
-    lines.append(
-        "            x >>= (input_fraction_bits - kOutputFractionBits);")
-    lines.append("        }")
-    lines.append("    }")
+    lines.append("    // Convert input to Q31.32")
+    lines.append("    x = ToLutAngle<P, kTwoPi>(x);")
     lines.append("")
 
     lines.append("    // 1. Normalize angle to [0, 2*pi)")
-    lines.append("    x = x % kTwoPi;")
+    lines.append("    x = Primitives::RemConstant<kTwoPi>(x);")
     lines.append("    if (x < 0) {")
     lines.append("        x += kTwoPi;")
     lines.append("    }")
@@ -161,16 +156,8 @@ def generate_sin_lut(output_file=None, int_bits=31, fraction_bits=32):
     lines.append("")
 
     lines.append(
-        "    // 6. Convert result back to original input format if needed")
-    lines.append("    if (input_fraction_bits != kOutputFractionBits) {")
-    lines.append("        if (input_fraction_bits < kOutputFractionBits) {")
-    lines.append(
-        "            interpolated_value >>= (kOutputFractionBits - input_fraction_bits);")
-    lines.append("        } else {")
-    lines.append(
-        "            interpolated_value <<= (input_fraction_bits - kOutputFractionBits);")
-    lines.append("        }")
-    lines.append("    }")
+        "    // 6. Convert result back to the input format")
+    lines.append("    interpolated_value = FromLutFormat<P>(interpolated_value);")
     lines.append("")
 
     lines.append("    return interpolated_value;")
@@ -181,13 +168,15 @@ def generate_sin_lut(output_file=None, int_bits=31, fraction_bits=32):
     lines.append(
         "// Lookup sin(x) with optimized Hermite cubic interpolation between table entries")
     lines.append(
-        "// Input x is in fixed-point format with specified fraction bits representing angle in radians")
+        "// Input x is in fixed-point format with P fraction bits representing angle in radians")
     lines.append(
         f"// Output is in Q{int_bits}.{fraction_bits} fixed-point format representing sin(x)")
     lines.append(
-        "// Precision: ~1.0e-9 when input_fraction_bits=32 (about 1500x more accurate than fast version)")
+        "// Precision: ~1.0e-9 when P=32 (about 1500x more accurate than fast version)")
+    lines.append("template <int P>")
     lines.append(
-        "inline constexpr auto LookupSin(int64_t x, int input_fraction_bits) noexcept -> int64_t {")
+        "inline constexpr auto LookupSin(int64_t x) noexcept -> int64_t {")
+    lines.append("    Fixed64Instrumentation::Record(Fixed64Event::kSinLookup);")
     lines.append("    // Constants")
     lines.append(f"    constexpr int64_t kPi = {pi_hex};  // pi = {float(pi)}")
     lines.append(
@@ -200,20 +189,12 @@ def generate_sin_lut(output_file=None, int_bits=31, fraction_bits=32):
         f"    constexpr int kOutputFractionBits = {fraction_bits};  // Output format: Q{int_bits}.{fraction_bits}")
     lines.append("")
 
-    lines.append("    // Convert input to Q{int_bits}.{fraction_bits} format if needed")
-    lines.append("    if (input_fraction_bits != kOutputFractionBits) {")
-    lines.append("        if (input_fraction_bits < kOutputFractionBits) {")
-    lines.append(
-        "            x <<= (kOutputFractionBits - input_fraction_bits);")
-    lines.append("        } else {")
-    lines.append(
-        "            x >>= (input_fraction_bits - kOutputFractionBits);")
-    lines.append("        }")
-    lines.append("    }")
+    lines.append("    // Convert input to Q31.32")
+    lines.append("    x = ToLutAngle<P, kTwoPi>(x);")
     lines.append("")
 
     lines.append("    // 1. Normalize angle to [0, 2*pi)")
-    lines.append("    x = x % kTwoPi;")
+    lines.append("    x = Primitives::RemConstant<kTwoPi>(x);")
     lines.append("    if (x < 0) {")
     lines.append("        x += kTwoPi;")
     lines.append("    }")
@@ -300,16 +281,8 @@ def generate_sin_lut(output_file=None, int_bits=31, fraction_bits=32):
     lines.append("")
 
     lines.append(
-        "    // 9. Convert result back to original input format if needed")
-    lines.append("    if (input_fraction_bits != kOutputFractionBits) {")
-    lines.append("        if (input_fraction_bits < kOutputFractionBits) {")
-    lines.append(
-        "            result >>= (kOutputFractionBits - input_fraction_bits);")
-    lines.append("        } else {")
-    lines.append(
-        "            result <<= (input_fraction_bits - kOutputFractionBits);")
-    lines.append("        }")
-    lines.append("    }")
+        "    // 9. Convert result back to the input format")
+    lines.append("    result = FromLutFormat<P>(result);")
     lines.append("")
 
     lines.append("    return result;")
@@ -326,21 +299,304 @@ def generate_sin_lut(output_file=None, int_bits=31, fraction_bits=32):
         print("\n".join(lines))
 
 
+def _solve_linear(matrix, rhs):
+    """Solve matrix * x = rhs by Gaussian elimination with partial pivoting"""
+    n = len(rhs)
+    a = [list(row) + [rhs[i]] for i, row in enumerate(matrix)]
+    for col in range(n):
+        pivot = max(range(col, n), key=lambda r: abs(a[r][col]))
+        a[col], a[pivot] = a[pivot], a[col]
+        for r in range(col + 1, n):
+            factor = a[r][col] / a[col][col]
+            for c in range(col, n + 1):
+                a[r][c] -= factor * a[col][c]
+    x = [mp.mpf(0)] * n
+    for r in range(n - 1, -1, -1):
+        acc = a[r][n]
+        for c in range(r + 1, n):
+            acc -= a[r][c] * x[c]
+        x[r] = acc / a[r][r]
+    return x
+
+
+def _eval_poly(coeffs, t):
+    """Evaluate sum(coeffs[i] * t^i) with Horner's method"""
+    result = mp.mpf(0)
+    for c in reversed(coeffs):
+        result = result * t + c
+    return result
+
+
+def _remez_sin(start, lo, hi, degree, grid_size=2000, iterations=10):
+    """Minimax polynomial p(t) ~ sin(start + t) on [lo, hi] by the Remez exchange algorithm"""
+    n = degree
+    grid = [lo + (hi - lo) * mp.mpf(i) / (grid_size - 1) for i in range(grid_size)]
+    values = [mp.sin(start + t) for t in grid]
+
+    # Initial reference: Chebyshev extrema
+    reference = [(lo + hi) / 2 - (hi - lo) / 2 * mp.cos(mp.pi * i / (n + 1))
+                 for i in range(n + 2)]
+
+    coeffs = None
+    for _ in range(iterations):
+        # Solve p(x_i) + (-1)^i E = f(x_i) for the coefficients and the levelled error E
+        matrix = []
+        rhs = []
+        for i, x in enumerate(reference):
+            powers = [mp.mpf(1)]
+            for _ in range(n):
+                powers.append(powers[-1] * x)
+            matrix.append(powers + [mp.mpf((-1) ** i)])
+            rhs.append(mp.sin(start + x))
+        solution = _solve_linear(matrix, rhs)
+        coeffs = solution[:n + 1]
+
+        # New reference: the largest error of every run of equal sign on the grid
+        errors = [_eval_poly(coeffs, t) - v for t, v in zip(grid, values)]
+        extrema = []
+        for t, e in zip(grid, errors):
+            if extrema and (e >= 0) == (extrema[-1][1] >= 0):
+                if abs(e) > abs(extrema[-1][1]):
+                    extrema[-1] = (t, e)
+            else:
+                extrema.append((t, e))
+        while len(extrema) > n + 2:
+            extrema.pop(0 if abs(extrema[0][1]) < abs(extrema[-1][1]) else -1)
+        if len(extrema) < n + 2:
+            break
+        reference = [t for t, _ in extrema]
+
+    return coeffs, grid, values
+
+
+def generate_sin_poly(output_file=None, segments=8, degree=5, coeff_bits=62):
+    """Generate segmented minimax polynomial coefficients for sin on [0,pi/2]"""
+
+    fraction_bits = 32
+    scale = mp.mpf(2) ** fraction_bits
+    coeff_scale = mp.mpf(2) ** coeff_bits
+
+    # Segment k covers [k*w, (k+1)*w) with w exact in Q31.32; the evaluation never
+    # overestimates the segment index, so the fit extends a few ulps past the right end
+    width_raw = int(mp.nint(mp.pi / 2 / segments * scale))
+    index_scale_raw = int(mp.floor(mp.mpf(2) ** 64 / width_raw))
+    width = mp.mpf(width_raw) / scale
+    pad = mp.mpf(2) ** -28
+
+    table = []
+    max_error = mp.mpf(0)
+    for k in range(segments):
+        start = k * width
+        coeffs, grid, values = _remez_sin(start, mp.mpf(0), width + pad, degree)
+        rounded = [int(mp.nint(c * coeff_scale)) for c in coeffs]
+        exact = [mp.mpf(c) / coeff_scale for c in rounded]
+        error = max(abs(_eval_poly(exact, t) - v) for t, v in zip(grid, values))
+        max_error = max(max_error, error)
+        table.append((start, rounded))
+
+    def hex_literal(value):
+        if value < 0:
+            return f"-0x{-value:016X}LL"
+        return f"0x{value:016X}LL"
+
+    total = segments * (degree + 1)
+    lines = []
+    lines.append("#pragma once")
+    lines.append("")
+    lines.append("#include <stdint.h>")
+    lines.append("#include <array>")
+    lines.append("#include <utility>")
+    lines.append("#include \"lut_format.h\"")
+    lines.append("#include \"primitives.h\"")
+    lines.append("")
+    lines.append(
+        f"// Segmented minimax polynomial for sin(x) with {segments} segments of degree {degree}")
+    lines.append(
+        f"// Covers the range [0,pi/2] with coefficients in Q1.{coeff_bits} format "
+        f"({total * 8} bytes)")
+    lines.append(
+        f"// Generated with mpmath library at {mp.mp.dps} digits precision (Remez exchange)")
+    lines.append(
+        f"// Max approximation error after coefficient rounding: {float(max_error):.3e}")
+    lines.append("")
+    lines.append("namespace math::fp::detail {")
+    lines.append(f"inline constexpr int kSinPolySegments = {segments};")
+    lines.append(f"inline constexpr int kSinPolyDegree = {degree};")
+    lines.append(f"inline constexpr int kSinPolyFractionBits = {coeff_bits};")
+    lines.append("")
+    lines.append("// Segment width in Q31.32, segment k covers [k*w, (k+1)*w)")
+    lines.append(
+        f"inline constexpr int64_t kSinPolySegmentWidth = {hex_literal(width_raw)};"
+        f"  // {float(width):.16f}")
+    lines.append("// floor(2^64 / kSinPolySegmentWidth), Q31.32 factor that maps x to its segment")
+    lines.append(
+        f"inline constexpr int64_t kSinPolyIndexScale = {hex_literal(index_scale_raw)};")
+    lines.append("")
+    lines.append("// Coefficients c0..cN of sin(k*w + t) ~ sum(c_i * t^i) for t in [0,w], per segment")
+    lines.append(f"inline constexpr std::array<int64_t, {total}> kSinPolyCoeffs = {{")
+    for k, (start, rounded) in enumerate(table):
+        lines.append(f"    // Segment {k}: [{float(start):.14f}, {float(start + width):.14f})")
+        for i, c in enumerate(rounded):
+            last = k == segments - 1 and i == degree
+            lines.append(f"    {hex_literal(c)}{'' if last else ','}")
+    lines.append("};")
+    lines.append("")
+    lines.append(POLY_FUNCTIONS.rstrip("\n"))
+    lines.append("")
+    lines.append("}  // namespace math::fp::detail")
+
+    if output_file:
+        with open(output_file, "w", encoding="utf-8") as f:
+            f.write("\n".join(lines) + "\n")
+    else:
+        print("\n".join(lines))
+
+
+POLY_FUNCTIONS = r"""
+// Evaluate the polynomial of the segment containing x
+// Input x in [0,pi/2] in Q31.32, output sin(x) in Q31.32 rounded to nearest
+// Horner's method runs in Q1.62, so only the final rounding is visible at 32 fraction bits
+inline constexpr auto EvalSinPoly(int64_t x) noexcept -> int64_t {
+    constexpr int kOutputFractionBits = 32;
+    constexpr int kShift = kSinPolyFractionBits - kOutputFractionBits;
+
+    // Segment index (truncated, never too large) and offset into the segment in Q1.62
+    int64_t idx = Primitives::Fixed64Mul<kOutputFractionBits>(x, kSinPolyIndexScale)
+                  >> kOutputFractionBits;
+    idx = idx < kSinPolySegments - 1 ? idx : kSinPolySegments - 1;
+    const int64_t t = (x - idx * kSinPolySegmentWidth) << kShift;
+
+    const int64_t* c = kSinPolyCoeffs.data() + idx * (kSinPolyDegree + 1);
+    int64_t result = c[kSinPolyDegree];
+    for (int i = kSinPolyDegree - 1; i >= 0; --i) {
+        result = c[i] + Primitives::Fixed64Mul<kSinPolyFractionBits>(result, t);
+    }
+    return (result + (1LL << (kShift - 1))) >> kShift;
+}
+
+// Lookup sin(x) with the segmented polynomial
+// Input x is in fixed-point format with P fraction bits representing angle in radians
+// Output is in the input fixed-point format
+// Precision: within 1 ulp of sin at the reduced Q31.32 angle (the table alone is ~1e-12)
+template <int P>
+inline constexpr auto LookupSinPoly(int64_t x) noexcept -> int64_t {
+    Fixed64Instrumentation::Record(Fixed64Event::kSinLookup);
+    // Constants (see LookupSin)
+    constexpr int64_t kPi = 0x00000003243F6A88LL;  // pi = 3.141592653589793
+    constexpr int64_t kPiOver2 = 0x00000001921FB544LL;  // pi/2 = 1.5707963267948966
+    constexpr int64_t kTwoPi = 0x00000006487ED511LL;  // 2*pi = 6.283185307179586
+
+    // Convert input to Q31.32
+    x = ToLutAngle<P, kTwoPi>(x);
+
+    // 1. Normalize angle to [0, 2*pi)
+    x = Primitives::RemConstant<kTwoPi>(x);
+    if (x < 0) {
+        x += kTwoPi;
+    }
+
+    // 2. Determine quadrant and map to [0, pi/2]
+    bool flip_sign = false;
+    if (x > kPi) {
+        // 3rd and 4th quadrants: sin(x) = -sin(x - pi)
+        x -= kPi;
+        flip_sign = true;
+    }
+    if (x > kPiOver2) {
+        // 2nd and 4th quadrants: sin(x) = sin(pi - x)
+        x = kPi - x;
+    }
+
+    // 3. Evaluate the polynomial and apply sign flip if necessary
+    int64_t result = EvalSinPoly(x);
+    if (flip_sign) {
+        result = -result;
+    }
+
+    // 4. Convert result back to the input format
+    result = FromLutFormat<P>(result);
+
+    return result;
+}
+
+// Lookup of sin(x) and cos(x) with the segmented polynomial sharing one angle reduction
+// cos(x) = sin(pi/2 - x) on the reduced angle, so both values come from EvalSinPoly
+// Output is a pair (sin, cos) in the input fixed-point format
+// The sin value is identical to LookupSinPoly; cos has the same precision
+template <int P>
+inline constexpr auto LookupSinCosPoly(int64_t x) noexcept
+    -> std::pair<int64_t, int64_t> {
+    Fixed64Instrumentation::Record(Fixed64Event::kSinLookup);
+    // Constants (see LookupSin)
+    constexpr int64_t kPi = 0x00000003243F6A88LL;  // pi = 3.141592653589793
+    constexpr int64_t kPiOver2 = 0x00000001921FB544LL;  // pi/2 = 1.5707963267948966
+    constexpr int64_t kTwoPi = 0x00000006487ED511LL;  // 2*pi = 6.283185307179586
+
+    // Convert input to Q31.32
+    x = ToLutAngle<P, kTwoPi>(x);
+
+    // 1. Normalize angle to [0, 2*pi)
+    x = Primitives::RemConstant<kTwoPi>(x);
+    if (x < 0) {
+        x += kTwoPi;
+    }
+
+    // 2. Determine quadrant and map to [0, pi/2]
+    // sin(x - pi) = -sin(x), cos(x - pi) = -cos(x)
+    // sin(pi - x) = sin(x),  cos(pi - x) = -cos(x)
+    bool flip_sin = false;
+    bool flip_cos = false;
+    if (x > kPi) {
+        x -= kPi;
+        flip_sin = true;
+        flip_cos = true;
+    }
+    if (x > kPiOver2) {
+        x = kPi - x;
+        flip_cos = !flip_cos;
+    }
+
+    // 3. Evaluate both polynomials and apply sign flips if necessary
+    int64_t sin_value = EvalSinPoly(x);
+    int64_t cos_value = EvalSinPoly(kPiOver2 - x);
+    if (flip_sin) {
+        sin_value = -sin_value;
+    }
+    if (flip_cos) {
+        cos_value = -cos_value;
+    }
+
+    // 4. Convert results back to the input format
+    sin_value = FromLutFormat<P>(sin_value);
+    cos_value = FromLutFormat<P>(cos_value);
+
+    return {sin_value, cos_value};
+}
+"""
+
+
 if __name__ == "__main__":
     int_bits = 31       # 31 bits for integer part
     fraction_bits = 32  # 32 bits for fractional part
     output_file = None
 
+    # --poly writes the segmented polynomial backend (sin_poly.h) instead of the table
+    args = sys.argv[1:]
+    if "--poly" in args:
+        args.remove("--poly")
+        generate_sin_poly(args[0] if args else None)
+        sys.exit(0)
+
     # Parse command line arguments if provided
-    if len(sys.argv) > 1:
-        output_file = sys.argv[1]
+    if len(args) > 0:
+        output_file = args[0]
 
-    if len(sys.argv) > 2:
+    if len(args) > 1:
         try:
-            fraction_bits = int(sys.argv[2])
+            fraction_bits = int(args[1])
             int_bits = 63 - fraction_bits  # Ensure we stay within 64-bit
         except ValueError:
-            print(f"Error: Invalid fraction bits: {sys.argv[2]}")
+            print(f"Error: Invalid fraction bits: {args[1]}")
             sys.exit(1)
 
     # Generate the sin lookup table
@@ -17,6 +17,7 @@ def generate_tan_lut(output_file=None, int_bits=23, fraction_bits=40):
     lines.append("")
     lines.append("#include <stdint.h>")
     lines.append("#include <array>")
+    lines.append("#include \"lut_format.h\"")
     lines.append("#include \"primitives.h\"")
     lines.append("")
     lines.append(f"// Tan lookup table with {lut_size + 1} entries")
@@ -32,7 +33,7 @@ def generate_tan_lut(output_file=None, int_bits=23, fraction_bits=40):
     lines.append(
         f"// Values stored in Q{int_bits}.{fraction_bits} fixed-point format")
     lines.append(
-        f"inline constexpr std::array<int64_t, {lut_size + 1}> kTanLut = {{")
+        f"alignas(64) inline constexpr std::array<int64_t, {lut_size + 1}> kTanLut = {{")
 
     # Generate the table entries in Q23.40 format
     scale = mp.mpf(2) ** fraction_bits
@@ -79,10 +80,12 @@ def generate_tan_lut(output_file=None, int_bits=23, fraction_bits=40):
     lines.append(
         "// Fast lookup tan(x) with linear interpolation between table entries")
     lines.append(
-        "// Input x is in fixed-point format with specified fraction bits representing angle in radians")
-    lines.append("// Precision: ~1.5e-5 when input_fraction_bits=32")
+        "// Input x is in fixed-point format with P fraction bits representing angle in radians")
+    lines.append("// Precision: ~1.5e-5 when P=32")
+    lines.append("template <int P>")
     lines.append(
-        "inline constexpr auto LookupTanFast(int64_t x, int input_fraction_bits) noexcept -> int64_t {")
+        "inline constexpr auto LookupTanFast(int64_t x) noexcept -> int64_t {")
+    lines.append("    Fixed64Instrumentation::Record(Fixed64Event::kTanLookup);")
     lines.append("    // Constants")
 
     # Calculate constants in Q23.40 format with truncation
@@ -106,20 +109,12 @@ def generate_tan_lut(output_file=None, int_bits=23, fraction_bits=40):
         f"    constexpr int kOutputFractionBits = {fraction_bits};  // Output format: Q{int_bits}.{fraction_bits}")
     lines.append("")
 
-    lines.append("    // Convert input to Q{int_bits}.{fraction_bits} format if needed")
-    lines.append("    if (input_fraction_bits != kOutputFractionBits) {")
-    lines.append("        if (input_fraction_bits < kOutputFractionBits) {")
-    lines.append(
-        "            x <<= (kOutputFractionBits - input_fraction_bits);")
-    lines.append("        } else {")
-    lines.append(
-        "            x >>= (input_fraction_bits - kOutputFractionBits);")
-    lines.append("        }")
-    lines.append("    }")
+    lines.append("    // Convert input to Q31.32")
+    lines.append("    x = ToLutAngle<P, kPi>(x);")
     lines.append("")
 
     lines.append("    // 1. Normalize angle to [-pi, pi]")
-    lines.append("    x = x % kPi;")
+    lines.append("    x = Primitives::RemConstant<kPi>(x);")
     lines.append("")
 
     lines.append("    // 2. Handle negative angles")
@@ -160,16 +155,8 @@ def generate_tan_lut(output_file=None, int_bits=23, fraction_bits=40):
     lines.append("")
 
     lines.append(
-        "    // 7. Convert result back to original input format if needed")
-    lines.append("    if (input_fraction_bits != kOutputFractionBits) {")
-    lines.append("        if (input_fraction_bits < kOutputFractionBits) {")
-    lines.append(
-        "            result >>= (kOutputFractionBits - input_fraction_bits);")
-    lines.append("        } else {")
-    lines.append(
-        "            result <<= (input_fraction_bits - kOutputFractionBits);")
-    lines.append("        }")
-    lines.append("    }")
+        "    // 7. Convert result back to the input format")
+    lines.append("    result = FromLutFormat<P>(result);")
     lines.append("")
 
     lines.append("    return result;")
@@ -180,11 +167,13 @@ def generate_tan_lut(output_file=None, int_bits=23, fraction_bits=40):
     lines.append(
         "// Lookup tan(x) with optimized Hermite cubic interpolation between table entries")
     lines.append(
-        "// Input x is in fixed-point format with specified fraction bits representing angle in radians")
+        "// Input x is in fixed-point format with P fraction bits representing angle in radians")
     lines.append(
-        "// Precision: ~2.0e-9 when input_fraction_bits=32 (about 1500x more accurate than fast version)")
+        "// Precision: ~2.0e-9 when P=32 (about 1500x more accurate than fast version)")
+    lines.append("template <int P>")
     lines.append(
-        "inline constexpr auto LookupTan(int64_t x, int input_fraction_bits) noexcept -> int64_t {")
+        "inline constexpr auto LookupTan(int64_t x) noexcept -> int64_t {")
+    lines.append("    Fixed64Instrumentation::Record(Fixed64Event::kTanLookup);")
     lines.append("    // Constants")
     lines.append(f"    constexpr int64_t kPi = {pi_hex};  // pi = {float(pi)}")
     lines.append(
@@ -197,20 +186,12 @@ def generate_tan_lut(output_file=None, int_bits=23, fraction_bits=40):
         "    constexpr int64_t kOne = 1LL << kOutputFractionBits;  // 1.0 in fixed-point")
     lines.append("")
 
-    lines.append("    // Convert input to Q{int_bits}.{fraction_bits} format if needed")
-    lines.append("    if (input_fraction_bits != kOutputFractionBits) {")
-    lines.append("        if (input_fraction_bits < kOutputFractionBits) {")
-    lines.append(
-        "            x <<= (kOutputFractionBits - input_fraction_bits);")
-    lines.append("        } else {")
-    lines.append(
-        "            x >>= (input_fraction_bits - kOutputFractionBits);")
-    lines.append("        }")
-    lines.append("    }")
+    lines.append("    // Convert input to Q31.32")
+    lines.append("    x = ToLutAngle<P, kPi>(x);")
     lines.append("")
 
     lines.append("    // 1. Normalize angle to [-pi, pi]")
-    lines.append("    x = x % kPi;")
+    lines.append("    x = Primitives::RemConstant<kPi>(x);")
     lines.append("")
 
     lines.append("    // 2. Handle negative angles")
@@ -299,16 +280,8 @@ def generate_tan_lut(output_file=None, int_bits=23, fraction_bits=40):
     lines.append("")
 
     lines.append(
-        "    // 10. Convert result back to original input format if needed")
-    lines.append("    if (input_fraction_bits != kOutputFractionBits) {")
-    lines.append("        if (input_fraction_bits < kOutputFractionBits) {")
-    lines.append(
-        "            result >>= (kOutputFractionBits - input_fraction_bits);")
-    lines.append("        } else {")
-    lines.append(
-        "            result <<= (input_fraction_bits - kOutputFractionBits);")
-    lines.append("        }")
-    lines.append("    }")
+        "    // 10. Convert result back to the input format")
+    lines.append("    result = FromLutFormat<P>(result);")
     lines.append("")
 
     lines.append("    return result;")
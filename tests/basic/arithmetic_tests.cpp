@@ -1,5 +1,7 @@
 #include <cmath>
+#include <cstdint>
 #include <limits>
+#include <random>
 
 #include "fixed64.h"
 #include "fixed64_math.h"
@@ -349,4 +351,44 @@ TEST(Fixed64ArithmeticTest, EpsilonBehavior) {
     EXPECT_NEAR(static_cast<double>(eps), expectedEpsilon, epsilon);
 }
 
+// The operators use the compile-time specialized primitives, which must reproduce the
+// runtime fraction-bit primitives bit for bit
+template <int P>
+static auto CheckSpecializedMulDiv(uint64_t seed) -> void {
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<int> shift(0, 63);
+    for (int i = 0; i < 20000; ++i) {
+        const int64_t a = static_cast<int64_t>(gen()) >> shift(gen);
+        const int64_t b = static_cast<int64_t>(gen()) >> shift(gen);
+        ASSERT_EQ(Primitives::Fixed64Mul<P>(a, b), Primitives::Fixed64Mul(a, b, P))
+            << "P=" << P << " a=" << a << " b=" << b;
+        ASSERT_EQ(Primitives::MulU64Shifted<P>(static_cast<uint64_t>(a), static_cast<uint64_t>(b)),
+                  Primitives::MulU64Shifted(static_cast<uint64_t>(a), static_cast<uint64_t>(b), P))
+            << "P=" << P << " a=" << a << " b=" << b;
+        ASSERT_EQ(Primitives::Fixed64Div<P>(a, b), Primitives::Fixed64Div(a, b, P))
+            << "P=" << P << " a=" << a << " b=" << b;
+        if (b != 0) {
+            const Fixed64<P> fa(a, detail::nothing{});
+            const Fixed64<P> fb(b, detail::nothing{});
+            ASSERT_EQ((fa * fb).value(), Primitives::Fixed64Mul(a, b, P));
+            ASSERT_EQ((fa / fb).value(), Primitives::Fixed64Div(a, b, P));
+        }
+    }
+}
+
+TEST(Fixed64ArithmeticTest, SpecializedMulDivMatchRuntimePrimitives) {
+    CheckSpecializedMulDiv<8>(1);
+    CheckSpecializedMulDiv<16>(2);
+    CheckSpecializedMulDiv<20>(3);
+    CheckSpecializedMulDiv<32>(4);
+    CheckSpecializedMulDiv<40>(5);
+    CheckSpecializedMulDiv<48>(6);
+    CheckSpecializedMulDiv<60>(7);
+
+    // Operands just below 2^32 whose raw product exceeds INT64_MAX
+    using Fixed = math::fp::Fixed64<16>;
+    const Fixed big(int64_t(0xFFFFFFFF), detail::nothing{});
+    EXPECT_EQ((big * big).value(), int64_t((uint64_t(0xFFFFFFFF) * 0xFFFFFFFF) >> 16));
+}
+
 }  // namespace math::fp::tests
\ No newline at end of file
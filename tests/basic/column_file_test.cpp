@@ -0,0 +1,158 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "fixed64.h"
+#include "fixed64_column_file.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64ColumnFileTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        path_ = (std::filesystem::temp_directory_path()
+                 / (std::string("fixed64_column_") + info->name() + ".fx64"))
+                    .string();
+    }
+
+    void TearDown() override {
+        std::remove(path_.c_str());
+    }
+
+    static auto MakeValues(size_t count, uint64_t seed) -> std::vector<Fixed64_32> {
+        std::mt19937_64 gen(seed);
+        std::vector<Fixed64_32> values(count);
+        for (auto& value : values) {
+            value = Fixed64_32(static_cast<int64_t>(gen()), detail::nothing{});
+        }
+        values[0] = Fixed64_32::NaN();
+        values[count / 2] = Fixed64_32::Infinity();
+        return values;
+    }
+
+    // Overwrite one byte of the file at offset
+    auto PatchByte(std::streamoff offset, char value) const -> void {
+        std::fstream file(path_, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(offset);
+        file.put(value);
+    }
+
+    std::string path_;
+};
+
+TEST_F(Fixed64ColumnFileTest, RoundTrip) {
+    const auto values = MakeValues(10001, 1);
+    Fixed64ColumnWriter<32> writer;
+    ASSERT_EQ(writer.Open(path_.c_str()), Fixed64FileError::None);
+    EXPECT_EQ(writer.Append(values), Fixed64FileError::None);
+    EXPECT_EQ(writer.count(), values.size());
+    ASSERT_EQ(writer.Close(), Fixed64FileError::None);
+    EXPECT_EQ(std::filesystem::file_size(path_), 64 + values.size() * sizeof(int64_t));
+
+    Fixed64ColumnReader<32> reader;
+    ASSERT_EQ(reader.Open(path_.c_str()), Fixed64FileError::None);
+    ASSERT_TRUE(reader.is_open());
+    const auto view = reader.values();
+    ASSERT_EQ(view.size(), values.size());
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(view.data()) % 64, 0u);
+    EXPECT_TRUE(std::equal(view.begin(), view.end(), values.begin(), [](auto a, auto b) {
+        return a.value() == b.value();
+    }));
+
+    // Moving the reader keeps the mapping
+    Fixed64ColumnReader<32> moved = std::move(reader);
+    EXPECT_FALSE(reader.is_open());
+    EXPECT_EQ(moved.values().data(), view.data());
+    moved.Close();
+    EXPECT_TRUE(moved.values().empty());
+}
+
+TEST_F(Fixed64ColumnFileTest, StreamingAppendMatchesSingleAppend) {
+    const auto values = MakeValues(1000, 2);
+    {
+        Fixed64ColumnWriter<32> writer;
+        ASSERT_EQ(writer.Open(path_.c_str()), Fixed64FileError::None);
+        // Uneven pieces, so the checksum lanes restart at every offset modulo four
+        size_t offset = 0;
+        for (size_t piece = 1; offset < values.size(); ++piece) {
+            const size_t n = std::min(piece, values.size() - offset);
+            ASSERT_EQ(writer.Append(std::span(values).subspan(offset, n)),
+                      Fixed64FileError::None);
+            offset += n;
+        }
+        // The destructor closes the file
+    }
+
+    Fixed64ColumnReader<32> reader;
+    ASSERT_EQ(reader.Open(path_.c_str()), Fixed64FileError::None);
+    ASSERT_EQ(reader.values().size(), values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(reader.values()[i].value(), values[i].value()) << i;
+    }
+
+    detail::ColumnChecksum whole;
+    detail::ColumnChecksum pieces;
+    whole.Add(reinterpret_cast<const int64_t*>(values.data()), values.size());
+    pieces.Add(reinterpret_cast<const int64_t*>(values.data()), 3);
+    pieces.Add(reinterpret_cast<const int64_t*>(values.data()) + 3, values.size() - 3);
+    EXPECT_EQ(whole.Finish(), pieces.Finish());
+}
+
+TEST_F(Fixed64ColumnFileTest, EmptyColumn) {
+    Fixed64ColumnWriter<32> writer;
+    ASSERT_EQ(writer.Open(path_.c_str()), Fixed64FileError::None);
+    ASSERT_EQ(writer.Close(), Fixed64FileError::None);
+
+    Fixed64ColumnReader<32> reader;
+    ASSERT_EQ(reader.Open(path_.c_str()), Fixed64FileError::None);
+    EXPECT_TRUE(reader.is_open());
+    EXPECT_TRUE(reader.values().empty());
+}
+
+TEST_F(Fixed64ColumnFileTest, Errors) {
+    Fixed64ColumnReader<32> reader;
+    EXPECT_EQ(reader.Open((path_ + ".missing").c_str()), Fixed64FileError::OpenFailed);
+
+    const auto values = MakeValues(100, 3);
+    Fixed64ColumnWriter<32> writer;
+    ASSERT_EQ(writer.Open(path_.c_str()), Fixed64FileError::None);
+    writer.Append(values);
+
+    // Not closed yet: the header still marks the file incomplete
+    std::fflush(nullptr);
+    EXPECT_EQ(reader.Open(path_.c_str()), Fixed64FileError::Incomplete);
+    EXPECT_FALSE(reader.is_open());
+    ASSERT_EQ(writer.Close(), Fixed64FileError::None);
+    EXPECT_EQ(writer.Append(values), Fixed64FileError::WriteFailed);
+
+    // The stored precision must match the reader
+    Fixed64ColumnReader<16> low;
+    EXPECT_EQ(low.Open(path_.c_str()), Fixed64FileError::PrecisionMismatch);
+    EXPECT_TRUE(low.values().empty());
+
+    // A flipped data bit fails the checksum unless verification is skipped
+    PatchByte(64 + 8 * 50 + 3, 0x5a);
+    EXPECT_EQ(reader.Open(path_.c_str()), Fixed64FileError::ChecksumMismatch);
+    EXPECT_EQ(reader.Open(path_.c_str(), false), Fixed64FileError::None);
+    EXPECT_EQ(reader.values().size(), values.size());
+    reader.Close();
+
+    // Missing data
+    std::filesystem::resize_file(path_, 64 + 8 * 99);
+    EXPECT_EQ(reader.Open(path_.c_str()), Fixed64FileError::Truncated);
+
+    // Wrong magic, short header
+    PatchByte(0, 'X');
+    EXPECT_EQ(reader.Open(path_.c_str()), Fixed64FileError::BadHeader);
+    std::filesystem::resize_file(path_, 10);
+    EXPECT_EQ(reader.Open(path_.c_str()), Fixed64FileError::BadHeader);
+    std::filesystem::resize_file(path_, 0);
+    EXPECT_EQ(reader.Open(path_.c_str()), Fixed64FileError::BadHeader);
+}
+
+}  // namespace math::fp::tests
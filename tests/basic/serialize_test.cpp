@@ -0,0 +1,233 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "fixed64.h"
+#include "fixed64_serialize.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64SerializeTest : public ::testing::Test {
+ protected:
+    // Raw values of every magnitude and both signs, plus the extremes
+    static auto RandomValues(size_t count, uint64_t seed) -> std::vector<Fixed64_32> {
+        std::mt19937_64 gen(seed);
+        std::vector<Fixed64_32> values(count);
+        for (auto& value : values) {
+            const auto raw = static_cast<int64_t>(gen()) >> (gen() % 64);
+            value = Fixed64_32(raw, detail::nothing{});
+        }
+        values[0] = Fixed64_32(INT64_MIN, detail::nothing{});
+        values[1] = Fixed64_32(INT64_MAX, detail::nothing{});
+        values[2] = Fixed64_32::Zero();
+        return values;
+    }
+};
+
+TEST_F(Fixed64SerializeTest, RawIsLittleEndian) {
+    const std::vector<Fixed64_32> values = {Fixed64_32(0x0102030405060708LL, detail::nothing{}),
+                                            Fixed64_32(-1)};
+    std::vector<uint8_t> bytes(16);
+    ASSERT_EQ(Fixed64Serialize::EncodeRaw<32>(values, bytes), 16u);
+    EXPECT_EQ(bytes, (std::vector<uint8_t>{8, 7, 6, 5, 4, 3, 2, 1, 0, 0, 0, 0, 0xFF, 0xFF, 0xFF,
+                                           0xFF}));
+
+    std::vector<Fixed64_32> decoded(2);
+    ASSERT_EQ(Fixed64Serialize::DecodeRaw<32>(bytes, decoded), 16u);
+    EXPECT_EQ(decoded, values);
+
+    EXPECT_EQ(Fixed64Serialize::EncodeRaw<32>(values, std::span(bytes).first(15)), 0u);
+    EXPECT_EQ(Fixed64Serialize::DecodeRaw<32>(std::span(bytes).first(15), decoded), 0u);
+}
+
+TEST_F(Fixed64SerializeTest, VarintEncoding) {
+    EXPECT_EQ(Fixed64Serialize::ZigZag(0), 0u);
+    EXPECT_EQ(Fixed64Serialize::ZigZag(-1), 1u);
+    EXPECT_EQ(Fixed64Serialize::ZigZag(1), 2u);
+    EXPECT_EQ(Fixed64Serialize::ZigZag(INT64_MIN), UINT64_MAX);
+    EXPECT_EQ(Fixed64Serialize::UnZigZag(UINT64_MAX), INT64_MIN);
+
+    const std::vector<Fixed64_32> values = {Fixed64_32(0, detail::nothing{}),
+                                            Fixed64_32(-1, detail::nothing{}),
+                                            Fixed64_32(63, detail::nothing{}),
+                                            Fixed64_32(64, detail::nothing{})};
+    std::vector<uint8_t> bytes(Fixed64Serialize::MaxVarintSize(values.size()));
+    bytes.resize(Fixed64Serialize::EncodeVarint<32>(values, bytes));
+    EXPECT_EQ(bytes, (std::vector<uint8_t>{0x00, 0x01, 0x7E, 0x80, 0x01}));
+
+    // The extremes take the full ten bytes
+    const std::vector<Fixed64_32> extremes = {Fixed64_32(INT64_MIN, detail::nothing{})};
+    std::vector<uint8_t> long_bytes(Fixed64Serialize::kMaxVarintBytes);
+    EXPECT_EQ(Fixed64Serialize::EncodeVarint<32>(extremes, long_bytes), 10u);
+}
+
+TEST_F(Fixed64SerializeTest, VarintRoundTrip) {
+    // Longer than one block of the batch kernels and not a multiple of the lane count
+    const auto values = RandomValues(1003, 1);
+    std::vector<uint8_t> bytes(Fixed64Serialize::MaxVarintSize(values.size()));
+    const size_t size = Fixed64Serialize::EncodeVarint<32>(values, bytes);
+    ASSERT_GT(size, 0u);
+
+    std::vector<Fixed64_32> decoded(values.size());
+    EXPECT_EQ(Fixed64Serialize::DecodeVarint<32>(std::span(bytes).first(size), decoded), size);
+    EXPECT_EQ(decoded, values);
+
+    // Every byte count is reproduced by the scalar mapping
+    size_t expected = 0;
+    for (const auto& value : values) {
+        for (uint64_t code = Fixed64Serialize::ZigZag(value.value());; code >>= 7) {
+            ++expected;
+            if (code < 0x80) {
+                break;
+            }
+        }
+    }
+    EXPECT_EQ(size, expected);
+}
+
+TEST_F(Fixed64SerializeTest, DeltaRoundTrip) {
+    std::mt19937_64 gen(2);
+    const auto baseline = RandomValues(777, 3);
+    std::vector<Fixed64_32> values(baseline.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        // Small changes, and wrapping differences at the extremes
+        const auto change = static_cast<int64_t>(gen() % 101) - 50;
+        values[i] = Fixed64_32(static_cast<int64_t>(static_cast<uint64_t>(baseline[i].value())
+                                                    + static_cast<uint64_t>(change)),
+                               detail::nothing{});
+    }
+
+    std::vector<uint8_t> bytes(Fixed64Serialize::MaxVarintSize(values.size()));
+    const size_t size = Fixed64Serialize::EncodeDelta<32>(values, baseline, bytes);
+    EXPECT_EQ(size, values.size());  // |delta| < 64 takes one byte
+
+    std::vector<Fixed64_32> decoded(values.size());
+    EXPECT_EQ(Fixed64Serialize::DecodeDelta<32>(std::span(bytes).first(size), baseline, decoded),
+              size);
+    EXPECT_EQ(decoded, values);
+
+    // Unchanged values encode to zero bytes only
+    bytes.assign(bytes.size(), 0xAA);
+    EXPECT_EQ(Fixed64Serialize::EncodeDelta<32>(baseline, baseline, bytes), baseline.size());
+    EXPECT_EQ(bytes[0], 0);
+    EXPECT_EQ(bytes[baseline.size() - 1], 0);
+
+    // Baselines shorter than the values are rejected
+    EXPECT_EQ(Fixed64Serialize::EncodeDelta<32>(values, std::span(baseline).first(10), bytes), 0u);
+}
+
+TEST_F(Fixed64SerializeTest, RejectsMalformedInput) {
+    std::vector<Fixed64_32> one(1);
+
+    // Truncated: continuation bit on the last byte
+    const std::vector<uint8_t> truncated = {0x80, 0x80};
+    EXPECT_EQ(Fixed64Serialize::DecodeVarint<32>(truncated, one), 0u);
+    EXPECT_EQ(Fixed64Serialize::DecodeVarint<32>(std::span<const uint8_t>(), one), 0u);
+
+    // More than 64 bits
+    std::vector<uint8_t> overlong(10, 0xFF);
+    overlong.push_back(0x01);
+    EXPECT_EQ(Fixed64Serialize::DecodeVarint<32>(overlong, one), 0u);
+    overlong.assign(9, 0xFF);
+    overlong.push_back(0x02);
+    EXPECT_EQ(Fixed64Serialize::DecodeVarint<32>(overlong, one), 0u);
+    overlong.back() = 0x01;
+    EXPECT_EQ(Fixed64Serialize::DecodeVarint<32>(overlong, one), 10u);
+    EXPECT_EQ(one[0].value(), INT64_MIN);
+
+    // Output buffer too small
+    const auto values = RandomValues(100, 4);
+    std::vector<uint8_t> bytes(Fixed64Serialize::MaxVarintSize(values.size()));
+    const size_t size = Fixed64Serialize::EncodeVarint<32>(values, bytes);
+    EXPECT_EQ(Fixed64Serialize::EncodeVarint<32>(values, std::span(bytes).first(size)), size);
+    EXPECT_EQ(Fixed64Serialize::EncodeVarint<32>(values, std::span(bytes).first(size - 1)), 0u);
+}
+
+TEST_F(Fixed64SerializeTest, QuantizerErrorBound) {
+    const Fixed64_32 min(-100);
+    const Fixed64_32 max(250.5);
+    std::mt19937_64 gen(5);
+    std::uniform_real_distribution<double> dist(-120.0, 270.0);
+    for (const int bits : {1, 7, 12, 16, 24, 33}) {
+        const Fixed64Quantizer<32> quantizer(min, max, bits);
+        const uint64_t levels = (uint64_t(1) << bits) - 1;
+        const auto half_step = static_cast<int64_t>(
+            static_cast<uint64_t>((max - min).value()) / levels / 2 + 1);
+
+        std::vector<Fixed64_32> values(517);
+        for (auto& value : values) {
+            value = Fixed64_32(dist(gen));
+        }
+        values[0] = min;
+        values[1] = max;
+
+        std::vector<uint8_t> packed(quantizer.PackedSize(values.size()));
+        ASSERT_EQ(quantizer.Encode(values, packed), packed.size());
+        std::vector<Fixed64_32> decoded(values.size());
+        ASSERT_EQ(quantizer.Decode(packed, decoded), packed.size());
+
+        for (size_t i = 0; i < values.size(); ++i) {
+            const Fixed64_32 clamped = std::clamp(values[i], min, max);
+            const uint64_t code = quantizer.Quantize(values[i]);
+            ASSERT_LE(code, levels);
+            // The batch kernels match the scalar mapping
+            ASSERT_EQ(decoded[i], quantizer.Dequantize(code)) << bits << " " << i;
+            ASSERT_LE(std::abs(decoded[i].value() - clamped.value()), half_step) << bits;
+            ASSERT_GE(decoded[i], min);
+            ASSERT_LE(decoded[i], max);
+            // Decoded values are fixed points of the mapping
+            ASSERT_EQ(quantizer.Quantize(decoded[i]), code);
+        }
+        EXPECT_EQ(decoded[0], min);
+        EXPECT_EQ(decoded[1], max);
+    }
+}
+
+TEST_F(Fixed64SerializeTest, QuantizerLosslessRange) {
+    // 2^20 raw units with 20-bit codes and the whole range with 64-bit codes
+    const Fixed64_32 min(3);
+    const Fixed64_32 max(Fixed64_32(3).value() + ((1 << 20) - 1), detail::nothing{});
+    const auto values = RandomValues(300, 6);
+    for (const auto& quantizer : {Fixed64Quantizer<32>(min, max, 20),
+                                  Fixed64Quantizer<32>(Fixed64_32(INT64_MIN, detail::nothing{}),
+                                                       Fixed64_32(INT64_MAX, detail::nothing{}),
+                                                       64)}) {
+        std::vector<Fixed64_32> inside(values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            inside[i] = quantizer.bits() == 64
+                            ? values[i]
+                            : Fixed64_32(min.value() + (values[i].value() & ((1 << 20) - 1)),
+                                         detail::nothing{});
+        }
+        std::vector<uint8_t> packed(quantizer.PackedSize(inside.size()));
+        ASSERT_EQ(quantizer.Encode(inside, packed), packed.size());
+        std::vector<Fixed64_32> decoded(inside.size());
+        ASSERT_EQ(quantizer.Decode(packed, decoded), packed.size());
+        EXPECT_EQ(decoded, inside) << quantizer.bits();
+    }
+}
+
+TEST_F(Fixed64SerializeTest, QuantizerBitPacking) {
+    // Every width packs to exactly count * bits bits
+    for (int bits = 1; bits <= 64; ++bits) {
+        const Fixed64Quantizer<32> quantizer(Fixed64_32(-1), Fixed64_32(1), bits);
+        const std::vector<Fixed64_32> values = {Fixed64_32(1), Fixed64_32(-1), Fixed64_32(0.25),
+                                                Fixed64_32(1), Fixed64_32(-0.5)};
+        EXPECT_EQ(quantizer.PackedSize(values.size()), (values.size() * bits + 7) / 8);
+        std::vector<uint8_t> packed(quantizer.PackedSize(values.size()));
+        ASSERT_EQ(quantizer.Encode(values, packed), packed.size()) << bits;
+        std::vector<Fixed64_32> decoded(values.size());
+        ASSERT_EQ(quantizer.Decode(packed, decoded), packed.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(decoded[i], quantizer.Dequantize(quantizer.Quantize(values[i]))) << bits;
+        }
+        EXPECT_EQ(decoded[0], Fixed64_32(1));
+        EXPECT_EQ(decoded[1], Fixed64_32(-1));
+        EXPECT_EQ(quantizer.Encode(values, std::span(packed).first(packed.size() - 1)), 0u);
+    }
+}
+
+}  // namespace math::fp::tests
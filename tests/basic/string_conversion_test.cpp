@@ -1,5 +1,8 @@
+#include <charconv>
 #include <cmath>
+#include <random>
 #include <string>
+#include <string_view>
 #include <vector>
 #include "fixed64.h"
 #include "gtest/gtest.h"
@@ -271,4 +274,148 @@ TEST(Fixed64StringConversionTest, CrossPrecisionStringConversion) {
     }
 }
 
+// One multiply and shift per decimal digit, the formatting ToChars replaces (valid to P = 60)
+template <int P>
+static auto DigitLoopReference(Fixed64<P> x) -> std::string {
+    std::string text = x.value() < 0 ? "-" : "";
+    const uint64_t abs_value =
+        x.value() < 0 ? 0 - static_cast<uint64_t>(x.value()) : static_cast<uint64_t>(x.value());
+    text += std::to_string(abs_value >> P);
+    uint64_t frac = abs_value & ((1ULL << P) - 1);
+    if (frac > 0) {
+        text += '.';
+        constexpr int kDecimalPlaces = ((P * 1233) >> 12) + 2;
+        for (int i = 0; i < kDecimalPlaces && frac > 0; ++i) {
+            frac *= 10;
+            text += static_cast<char>('0' + (frac >> P));
+            frac &= (1ULL << P) - 1;
+        }
+        while (text.back() == '0' && text[text.size() - 2] != '.') {
+            text.pop_back();
+        }
+    }
+    return text;
+}
+
+template <int P>
+static void CheckToCharsMatchesReference(uint64_t seed) {
+    std::mt19937_64 gen(seed);
+    char buffer[Fixed64<P>::kMaxChars];
+    for (int i = 0; i < 5000; ++i) {
+        // Raw values of every magnitude
+        const auto raw = static_cast<int64_t>(gen() >> (gen() % 64));
+        const Fixed64<P> x(i % 2 == 0 ? raw : -raw, detail::nothing{});
+        const auto [end, ec] = x.ToChars(buffer, buffer + sizeof(buffer));
+        ASSERT_EQ(ec, std::errc());
+        ASSERT_EQ(std::string_view(buffer, end - buffer), DigitLoopReference(x)) << x.value();
+        ASSERT_EQ(x.ToString(), DigitLoopReference(x));
+    }
+}
+
+// Tests for the allocation-free ToChars / to_chars
+TEST(Fixed64StringConversionTest, ToCharsMatchesDigitLoop) {
+    CheckToCharsMatchesReference<8>(1);
+    CheckToCharsMatchesReference<16>(2);
+    CheckToCharsMatchesReference<32>(3);
+    CheckToCharsMatchesReference<40>(4);
+    CheckToCharsMatchesReference<60>(5);
+
+    // Above 60 fraction bits the digit loop overflows, the 128-bit extraction does not
+    EXPECT_EQ(Fixed64<63>(INT64_MAX, detail::nothing{}).ToString(), "0.99999999999999999989");
+    EXPECT_EQ(Fixed64<62>(int64_t(1) << 61, detail::nothing{}).ToString(), "0.5");
+    EXPECT_EQ(Fixed64<32>(INT64_MIN, detail::nothing{}).ToString(), "-2147483648");
+}
+
+TEST(Fixed64StringConversionTest, ToCharsBufferBounds) {
+    const Fixed64<32> x(-1234.5);
+    char buffer[16];
+
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), x);
+    ASSERT_EQ(result.ec, std::errc());
+    EXPECT_EQ(std::string_view(buffer, result.ptr - buffer), "-1234.5");
+
+    // Exactly large enough and one too small
+    result = x.ToChars(buffer, buffer + 7);
+    EXPECT_EQ(result.ec, std::errc());
+    EXPECT_EQ(result.ptr, buffer + 7);
+    result = x.ToChars(buffer, buffer + 6);
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+    EXPECT_EQ(result.ptr, buffer + 6);
+    result = x.ToChars(buffer, buffer);
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+}
+
+// Tests for the allocation-free FromChars / from_chars
+TEST(Fixed64StringConversionTest, FromCharsMatchesFromString) {
+    using Fixed32 = math::fp::Fixed64<32>;
+    const std::vector<std::string> inputs = {
+        "0", "1", "-1", "+2.5", "3.14159265358979", "-0.000001", "1e3", "2.5E-2", "-7e+1",
+        "123456789012345678901234", "0.1234567890123456789012345", "2147483647.9999999999",
+        "-2147483648", "1e30", "-1e30", "12.34.56", "5e", "5e+", ".5", "5.", "1e-40"};
+    for (const auto& input : inputs) {
+        Fixed32 value;
+        const auto [ptr, ec] = Fixed32::FromChars(input.data(), input.data() + input.size(), value);
+        EXPECT_TRUE(ec == std::errc() || ec == std::errc::result_out_of_range) << input;
+        EXPECT_EQ(value, Fixed32::FromString(input)) << input;
+    }
+
+    // Round trip through the buffer APIs at full precision
+    std::mt19937_64 gen(6);
+    char buffer[Fixed32::kMaxChars];
+    for (int i = 0; i < 5000; ++i) {
+        const Fixed32 x(static_cast<int64_t>(gen()) >> 20, detail::nothing{});
+        const auto written = std::to_chars(buffer, buffer + sizeof(buffer), x);
+        Fixed32 parsed;
+        const auto read = std::from_chars(buffer, written.ptr, parsed);
+        ASSERT_EQ(read.ec, std::errc());
+        ASSERT_EQ(read.ptr, written.ptr);
+        ASSERT_EQ(parsed, Fixed32::FromString(std::string(buffer, written.ptr)));
+    }
+}
+
+TEST(Fixed64StringConversionTest, FromCharsErrorsAndEndPointer) {
+    using Fixed32 = math::fp::Fixed64<32>;
+    const auto parse = [](std::string_view text, Fixed32& value) {
+        return Fixed32::FromChars(text.data(), text.data() + text.size(), value);
+    };
+
+    // No digits: invalid_argument and the value is left untouched
+    for (const std::string_view text : {"", "-", "+", ".", "abc", " 1", "e5"}) {
+        Fixed32 value(7);
+        const auto [ptr, ec] = parse(text, value);
+        EXPECT_EQ(ec, std::errc::invalid_argument) << text;
+        EXPECT_EQ(ptr, text.data()) << text;
+        EXPECT_EQ(value, Fixed32(7)) << text;
+    }
+
+    // The end pointer stops after the number, an exponent without digits is not consumed
+    const std::string_view row = "1.25,2e1x3e";
+    Fixed32 value;
+    auto result = parse(row, value);
+    EXPECT_EQ(result.ec, std::errc());
+    EXPECT_EQ(result.ptr, row.data() + 4);
+    EXPECT_EQ(value, Fixed32(1.25));
+    result = Fixed32::FromChars(result.ptr + 1, row.data() + row.size(), value);
+    EXPECT_EQ(result.ptr, row.data() + 8);
+    EXPECT_EQ(value, Fixed32(20));
+    result = Fixed32::FromChars(result.ptr + 1, row.data() + row.size(), value);
+    EXPECT_EQ(result.ptr, row.data() + 10);
+    EXPECT_EQ(value, Fixed32(3));
+
+    // The range is honoured without a terminator
+    const char digits[] = {'4', '2', '9'};
+    EXPECT_EQ(Fixed32::FromChars(digits, digits + 2, value).ptr, digits + 2);
+    EXPECT_EQ(value, Fixed32(42));
+
+    // Overflow saturates like FromString
+    result = parse("1e30", value);
+    EXPECT_EQ(result.ec, std::errc::result_out_of_range);
+    EXPECT_EQ(result.ptr, std::string_view("1e30").data() + 4);
+    EXPECT_EQ(value.value(), INT64_MAX);
+
+    // FromString takes any string_view and still skips leading whitespace
+    EXPECT_EQ(Fixed32::FromString(std::string_view(" \t-2.5;", 6)), Fixed32(-2.5));
+    EXPECT_EQ(Fixed32::FromString("  "), Fixed32::Zero());
+}
+
 }  // namespace math::fp::tests
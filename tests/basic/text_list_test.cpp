@@ -0,0 +1,161 @@
+#include <random>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "fixed64.h"
+#include "fixed64_text.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64TextTest : public ::testing::Test {
+ protected:
+    // A table of mixed fields: integers, long fixed-width decimals, exponents and signs
+    static auto MakeTable(size_t count, uint64_t seed, std::vector<std::string>& fields)
+        -> std::string {
+        std::mt19937_64 gen(seed);
+        std::string text;
+        const char* separators[] = {",", ";", " ", "\t", "\n", "\r\n", ", "};
+        for (size_t i = 0; i < count; ++i) {
+            std::string field;
+            switch (gen() % 5) {
+                case 0:
+                    field = std::to_string(static_cast<int64_t>(gen() % 2000000) - 1000000);
+                    break;
+                case 1:
+                    field = std::to_string(gen() % 100000) + "." + std::to_string(gen());
+                    break;
+                case 2:
+                    field = "-0." + std::to_string(gen()) + std::to_string(gen());
+                    break;
+                case 3:
+                    field = std::to_string(gen() % 1000) + "." + std::to_string(gen() % 1000)
+                          + "e" + std::to_string(static_cast<int>(gen() % 9) - 4);
+                    break;
+                default:
+                    field = "+" + std::to_string(gen() % 100) + ".25";
+                    break;
+            }
+            fields.push_back(field);
+            text += field;
+            text += separators[gen() % 7];
+        }
+        return text;
+    }
+};
+
+TEST_F(Fixed64TextTest, ParseEightDigits) {
+    uint64_t value = 0;
+    EXPECT_TRUE(detail::ParseEightDigits("12345678", value));
+    EXPECT_EQ(value, 12345678u);
+    EXPECT_TRUE(detail::ParseEightDigits("00000000", value));
+    EXPECT_EQ(value, 0u);
+    EXPECT_TRUE(detail::ParseEightDigits("99999999", value));
+    EXPECT_EQ(value, 99999999u);
+
+    // Any non-digit byte, including those one step outside '0'..'9'
+    for (const char bad : {'/', ':', '*', '.', 'e', ' ', '\0', '\x7f', '\xff', '\xb0'}) {
+        for (int i = 0; i < 8; ++i) {
+            char text[8] = {'1', '2', '3', '4', '5', '6', '7', '8'};
+            text[i] = bad;
+            EXPECT_FALSE(detail::ParseEightDigits(text, value)) << int(bad) << " at " << i;
+        }
+    }
+}
+
+TEST_F(Fixed64TextTest, ParseMatchesFromString) {
+    std::vector<std::string> fields;
+    const std::string text = MakeTable(5000, 1, fields);
+
+    std::vector<Fixed64_32> values;
+    const auto result = Fixed64Text::ParseList<32>(text, values);
+    EXPECT_EQ(result.ec, std::errc());
+    EXPECT_EQ(result.ptr, text.data() + text.size());
+    ASSERT_EQ(result.count, fields.size());
+    ASSERT_EQ(values.size(), fields.size());
+    for (size_t i = 0; i < fields.size(); ++i) {
+        ASSERT_EQ(values[i], Fixed64_32::FromString(fields[i])) << fields[i];
+    }
+
+    std::vector<Fixed64_16> low;
+    Fixed64Text::ParseList<16>(text, low);
+    ASSERT_EQ(low.size(), fields.size());
+    for (size_t i = 0; i < fields.size(); ++i) {
+        ASSERT_EQ(low[i], Fixed64_16::FromString(fields[i])) << fields[i];
+    }
+}
+
+TEST_F(Fixed64TextTest, ParallelMatchesSerial) {
+    // Several chunks, so fields straddle chunk offsets
+    std::vector<std::string> fields;
+    const std::string text = MakeTable(60000, 2, fields);
+    ASSERT_GT(text.size(), 3 * Fixed64Text::kParseChunkBytes);
+
+    std::vector<Fixed64_32> serial;
+    std::vector<Fixed64_32> parallel;
+    const auto serial_result = Fixed64Text::ParseList<32>(text, serial, false);
+    const auto parallel_result = Fixed64Text::ParseList<32>(text, parallel, true);
+    EXPECT_EQ(serial_result.ec, std::errc());
+    EXPECT_EQ(parallel_result.ec, std::errc());
+    EXPECT_EQ(parallel_result.count, fields.size());
+    EXPECT_EQ(parallel, serial);
+    for (size_t i = 0; i < fields.size(); i += 97) {
+        ASSERT_EQ(parallel[i], Fixed64_32::FromString(fields[i])) << fields[i];
+    }
+}
+
+TEST_F(Fixed64TextTest, Errors) {
+    std::vector<Fixed64_32> values;
+
+    // Parsing stops at the first field that is not a number
+    const std::string_view bad = "1, 2.5, 3x, 4";
+    auto result = Fixed64Text::ParseList<32>(bad, values);
+    EXPECT_EQ(result.ec, std::errc::invalid_argument);
+    EXPECT_EQ(result.ptr, bad.data() + 8);
+    EXPECT_EQ(result.count, 2u);
+    EXPECT_EQ(values, (std::vector<Fixed64_32>{Fixed64_32(1), Fixed64_32(2.5)}));
+
+    // Out-of-range numbers saturate like FromString and parsing continues
+    values.clear();
+    const std::string_view large = "1;1e20;-1e20;2";
+    result = Fixed64Text::ParseList<32>(large, values);
+    EXPECT_EQ(result.ec, std::errc::result_out_of_range);
+    EXPECT_EQ(result.ptr, large.data() + 2);
+    ASSERT_EQ(result.count, 4u);
+    EXPECT_EQ(values[1], Fixed64_32::FromString("1e20"));
+    EXPECT_EQ(values[2], Fixed64_32::FromString("-1e20"));
+    EXPECT_EQ(values[3], Fixed64_32(2));
+
+    // Empty and separator-only texts parse to nothing
+    values.clear();
+    EXPECT_EQ(Fixed64Text::ParseList<32>("", values).count, 0u);
+    EXPECT_EQ(Fixed64Text::ParseList<32>(" ,;\n", values).count, 0u);
+    EXPECT_TRUE(values.empty());
+}
+
+TEST_F(Fixed64TextTest, FormatRoundTrip) {
+    std::mt19937_64 gen(3);
+    std::vector<Fixed64_32> values(1000);
+    for (auto& value : values) {
+        value = Fixed64_32(static_cast<int64_t>(gen()) >> 8, detail::nothing{});
+    }
+
+    std::string text;
+    Fixed64Text::FormatList<32>(values, text);
+    std::string expected;
+    for (size_t i = 0; i < values.size(); ++i) {
+        expected += (i > 0 ? "," : "") + values[i].ToString();
+    }
+    EXPECT_EQ(text, expected);
+
+    std::vector<Fixed64_32> parsed;
+    EXPECT_EQ(Fixed64Text::ParseList<32>(text, parsed).ec, std::errc());
+    ASSERT_EQ(parsed.size(), values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(parsed[i], Fixed64_32::FromString(values[i].ToString()));
+    }
+}
+
+}  // namespace math::fp::tests
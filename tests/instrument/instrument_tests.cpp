@@ -0,0 +1,120 @@
+#include <string_view>
+#include <thread>
+
+#include "fixed64.h"
+#include "fixed64_instrument.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+
+// Built into fixed64_instrument_tests with FIXED64_INSTRUMENT=1 for every translation unit
+static_assert(math::fp::Fixed64Instrumentation::kEnabled);
+
+namespace math::fp::tests {
+
+class Fixed64InstrumentTest : public ::testing::Test {
+ protected:
+    void SetUp() override { Fixed64Instrumentation::Reset(); }
+
+    static auto Count(Fixed64Event event) -> uint64_t {
+        return Fixed64Instrumentation::Snapshot()[event];
+    }
+};
+
+TEST_F(Fixed64InstrumentTest, CountsArithmeticEdgeCases) {
+    const Fixed64_32 a(3.5);
+    const Fixed64_32 b(1.25);
+    Fixed64_32 r = a * b;
+    r = r / b;
+    EXPECT_EQ(Count(Fixed64Event::kMul), 1u);
+    EXPECT_EQ(Count(Fixed64Event::kDiv), 1u);
+    EXPECT_EQ(Count(Fixed64Event::kMulOverflow), 0u);
+    EXPECT_EQ(Count(Fixed64Event::kDivOverflow), 0u);
+
+    // A product of 2^20 * 2^20 does not fit Q31.32
+    r = Fixed64_32(1 << 20) * Fixed64_32(1 << 20);
+    EXPECT_EQ(Count(Fixed64Event::kMulOverflow), 1u);
+
+    // 2^-20 is below 2^-16, a near-zero divisor at P = 32; the quotient of 2^20 saturates
+    r = Fixed64_32(1 << 20) / Fixed64_32(int64_t(1) << 12, detail::nothing{});
+    EXPECT_EQ(Count(Fixed64Event::kDivNearZero), 1u);
+    EXPECT_EQ(Count(Fixed64Event::kDivOverflow), 1u);
+
+    r = a / Fixed64_32::Zero();
+    EXPECT_EQ(Count(Fixed64Event::kDivByZero), 1u);
+    EXPECT_EQ(Primitives::Fixed64Div(a.value(), 0, 32), -1);
+    EXPECT_EQ(Count(Fixed64Event::kDivByZero), 2u);
+    EXPECT_EQ(Count(Fixed64Event::kDivOverflow), 2u);
+
+    r = Fixed64Math::Sqrt(a);
+    EXPECT_EQ(Count(Fixed64Event::kSqrt), 1u);
+}
+
+TEST_F(Fixed64InstrumentTest, CountsLookupsAndRangeChecks) {
+    const Fixed64_32 x(0.5);
+    (void)Fixed64Math::Sin(x);
+    (void)Fixed64Math::Tan(x);
+    (void)Fixed64Math::Atan(x);
+    (void)Fixed64Math::Asin(x);
+    EXPECT_EQ(Count(Fixed64Event::kSinLookup), 1u);
+    EXPECT_EQ(Count(Fixed64Event::kTanLookup), 1u);
+    EXPECT_EQ(Count(Fixed64Event::kAtanLookup), 1u);
+    EXPECT_EQ(Count(Fixed64Event::kAcosLookup), 1u);
+
+    // Clamped arguments return without a lookup
+    EXPECT_EQ(Fixed64Math::Acos(Fixed64_32(2)), Fixed64_32::Zero());
+    EXPECT_EQ(Fixed64Math::Asin(Fixed64_32(-2)), -Fixed64_32::HalfPi());
+    EXPECT_EQ(Count(Fixed64Event::kRangeClamp), 2u);
+    EXPECT_EQ(Count(Fixed64Event::kAcosLookup), 1u);
+
+    (void)Fixed64Math::NormalizeAngle(Fixed64_32(1));
+    EXPECT_EQ(Count(Fixed64Event::kAngleWrap), 0u);
+    (void)Fixed64Math::NormalizeAngle(Fixed64_32(7));
+    (void)Fixed64Math::NormalizeAngle(Fixed64_32(-1));
+    EXPECT_EQ(Count(Fixed64Event::kAngleWrap), 2u);
+}
+
+TEST_F(Fixed64InstrumentTest, CountsParsing) {
+    EXPECT_EQ(Fixed64_32::FromString(" 1.5"), Fixed64_32(1.5));
+    EXPECT_EQ(Count(Fixed64Event::kParseError), 0u);
+    (void)Fixed64_32::FromString("1.5x");
+    (void)Fixed64_32::FromString("abc");
+    EXPECT_EQ(Count(Fixed64Event::kFromString), 3u);
+    EXPECT_EQ(Count(Fixed64Event::kParseError), 2u);
+}
+
+TEST_F(Fixed64InstrumentTest, CountersArePerThread) {
+    Fixed64Counters worker;
+    std::thread thread([&] {
+        const Fixed64_32 a(2);
+        (void)(a * a * a);
+        worker = Fixed64Instrumentation::Snapshot();
+    });
+    thread.join();
+    EXPECT_EQ(worker[Fixed64Event::kMul], 2u);
+    EXPECT_EQ(Count(Fixed64Event::kMul), 0u);
+
+    (void)(Fixed64_32(2) * Fixed64_32(3));
+    Fixed64Counters total = Fixed64Instrumentation::Snapshot();
+    total += worker;
+    EXPECT_EQ(total[Fixed64Event::kMul], 3u);
+
+    Fixed64Instrumentation::Reset();
+    EXPECT_EQ(Count(Fixed64Event::kMul), 0u);
+}
+
+TEST_F(Fixed64InstrumentTest, SkipsConstantEvaluation) {
+    constexpr Fixed64_32 kProduct = Fixed64_32(2) * Fixed64_32(3);
+    EXPECT_EQ(kProduct, Fixed64_32(6));
+    EXPECT_EQ(Count(Fixed64Event::kMul), 0u);
+}
+
+TEST_F(Fixed64InstrumentTest, NamesEveryEvent) {
+    for (size_t i = 0; i < kFixed64EventCount; ++i) {
+        EXPECT_FALSE(Fixed64Counters::Name(static_cast<Fixed64Event>(i)).empty());
+    }
+    EXPECT_EQ(Fixed64Counters::Name(Fixed64Event::kDivNearZero), "div_near_zero");
+    EXPECT_EQ(Fixed64Counters::Name(Fixed64Event::kAngleWrap), "angle_wrap");
+    EXPECT_TRUE(Fixed64Counters::Name(Fixed64Event::kCount).empty());
+}
+
+}  // namespace math::fp::tests
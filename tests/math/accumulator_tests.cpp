@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "fixed64.h"
+#include "fixed64_accumulator.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64AccumulatorTest : public ::testing::Test {
+ protected:
+    template <int P>
+    static auto MakeValues(uint64_t seed, size_t count, double range) -> std::vector<Fixed64<P>> {
+        std::mt19937_64 gen(seed);
+        std::uniform_real_distribution<double> dist(-range, range);
+        std::vector<Fixed64<P>> values(count);
+        for (auto& v : values) {
+            v = Fixed64<P>(dist(gen));
+        }
+        return values;
+    }
+
+#if defined(__SIZEOF_INT128__)
+    // Exact sum of products, rounded once to nearest (ties to even) with native 128-bit math
+    template <int P>
+    static auto ReferenceDot(const std::vector<Fixed64<P>>& a, const std::vector<Fixed64<P>>& b)
+        -> int64_t {
+        __extension__ typedef __int128 int128;
+        int128 sum = 0;
+        for (size_t i = 0; i < a.size(); ++i) {
+            sum += int128(a[i].value()) * b[i].value();
+        }
+        const bool negative = sum < 0;
+        const int128 magnitude = negative ? -sum : sum;
+        const int128 half = int128(1) << (P - 1);
+        int128 q = magnitude >> P;
+        const int128 rem = magnitude & ((int128(1) << P) - 1);
+        if (rem > half || (rem == half && (q & 1))) {
+            ++q;
+        }
+        return static_cast<int64_t>(negative ? -q : q);
+    }
+
+    template <int P>
+    static auto CheckDot(uint64_t seed, double range) -> void {
+        for (size_t count : {0, 1, 7, 64, 1000}) {
+            const auto a = MakeValues<P>(seed, count, range);
+            const auto b = MakeValues<P>(seed + 1, count, range);
+            ASSERT_EQ(Fixed64Math::Dot<P>(a, b).value(), ReferenceDot<P>(a, b))
+                << "P=" << P << " count=" << count;
+        }
+    }
+#endif
+};
+
+#if defined(__SIZEOF_INT128__)
+TEST_F(Fixed64AccumulatorTest, DotRoundsOnce) {
+    CheckDot<16>(1, 1000.0);
+    CheckDot<32>(2, 100.0);
+    CheckDot<40>(3, 10.0);
+    CheckDot<48>(4, 1.0);
+}
+#endif
+
+TEST_F(Fixed64AccumulatorTest, OrderIndependent) {
+    const auto a = MakeValues<32>(5, 513, 1000.0);
+    const auto b = MakeValues<32>(6, 513, 1000.0);
+    const Fixed64_32 forward = Fixed64Math::Dot<32>(a, b);
+
+    // Backwards, and split into strided partial sums merged afterwards
+    Fixed64Accumulator<32> backward;
+    for (size_t i = a.size(); i-- > 0;) {
+        backward.MulAdd(a[i], b[i]);
+    }
+    Fixed64Accumulator<32> lanes[4];
+    for (size_t i = 0; i < a.size(); ++i) {
+        lanes[i % 4].MulAdd(a[i], b[i]);
+    }
+    for (int lane = 1; lane < 4; ++lane) {
+        lanes[0].Merge(lanes[lane]);
+    }
+    EXPECT_EQ(backward.Result(), forward);
+    EXPECT_EQ(lanes[0].Result(), forward);
+}
+
+TEST_F(Fixed64AccumulatorTest, IntermediateSumMayExceedRange) {
+    // 40000 * 40000 is far outside Q31.32, but the total is back in range
+    Fixed64Accumulator<32> acc;
+    acc.MulAdd(Fixed64_32(40000), Fixed64_32(40000));
+    acc.MulAdd(Fixed64_32(40000), Fixed64_32(40000));
+    acc.MulSub(Fixed64_32(40000), Fixed64_32(80000));
+    acc.Add(Fixed64_32(1.5));
+    EXPECT_EQ(acc.Result(), Fixed64_32(1.5));
+
+    acc.Reset();
+    EXPECT_EQ(acc.Result(), Fixed64_32::Zero());
+}
+
+TEST_F(Fixed64AccumulatorTest, RoundsToNearestEven) {
+    const Fixed64_32 half(int64_t(1) << 31, detail::nothing{});
+    const Fixed64_32 ulp = Fixed64_32::Epsilon();
+    Fixed64Accumulator<32> acc;
+
+    // Epsilon * half is exactly half an ulp
+    acc.MulAdd(ulp, half);
+    EXPECT_EQ(acc.Result().value(), 0);
+    acc.Add(ulp);
+    EXPECT_EQ(acc.Result().value(), 2);
+    acc.Add(ulp);
+    EXPECT_EQ(acc.Result().value(), 2);
+
+    acc.Reset();
+    acc.MulSub(ulp, half);
+    EXPECT_EQ(acc.Result().value(), 0);
+    acc.Add(-ulp);
+    EXPECT_EQ(acc.Result().value(), -2);
+}
+
+TEST_F(Fixed64AccumulatorTest, SaturatesOutOfRange) {
+    Fixed64Accumulator<32> acc;
+    acc.MulAdd(Fixed64_32(50000), Fixed64_32(50000));
+    EXPECT_EQ(acc.Result(), Fixed64_32::Infinity());
+    acc.MulSub(Fixed64_32(100000), Fixed64_32(50000));
+    EXPECT_EQ(acc.Result(), Fixed64_32::NegInfinity());
+
+    acc.Reset();
+    acc.Add(Fixed64_32::Max());
+    EXPECT_EQ(acc.Result(), Fixed64_32::Max());
+    acc.Add(Fixed64_32::Max());
+    EXPECT_EQ(acc.Result(), Fixed64_32::Infinity());
+
+    const std::vector<Fixed64_32> a{Fixed64_32(2), Fixed64_32(-3)};
+    const std::vector<Fixed64_32> b{Fixed64_32(0.5), Fixed64_32(4), Fixed64_32(7)};
+    EXPECT_EQ(Fixed64Math::Dot<32>(a, b), Fixed64_32(-11));
+    EXPECT_EQ(Fixed64Math::Dot<32>({}, b), Fixed64_32::Zero());
+}
+
+TEST_F(Fixed64AccumulatorTest, DivideByKeepsUnroundedTotal) {
+    Fixed64Accumulator<32> acc;
+    acc.MulAdd(Fixed64_32(3), Fixed64_32(7));
+    acc.MulSub(Fixed64_32(0.5), Fixed64_32(2));
+    EXPECT_EQ(acc.DivideBy(Fixed64_32(4)), Fixed64_32(5));
+    EXPECT_EQ(acc.DivideBy(Fixed64_32(-8)), Fixed64_32(-2.5));
+    EXPECT_EQ(acc.DivideBy(Fixed64_32(3)), Fixed64_32(20) / Fixed64_32(3));
+
+    // A total of half an ulp divided by one half is one ulp; Result() / 0.5 would be zero
+    acc.Reset();
+    acc.MulAdd(Fixed64_32::Epsilon(), Fixed64_32(0.5));
+    EXPECT_EQ(acc.DivideBy(Fixed64_32(0.5)), Fixed64_32::Epsilon());
+    EXPECT_EQ(acc.Result() / Fixed64_32(0.5), Fixed64_32::Zero());
+
+    // Overflow and division by zero saturate
+    acc.Reset();
+    acc.MulSub(Fixed64_32(50000), Fixed64_32(50000));
+    EXPECT_EQ(acc.DivideBy(Fixed64_32(1000)), Fixed64_32(-2500000));
+    EXPECT_EQ(acc.DivideBy(Fixed64_32(0.5)), Fixed64_32::NegInfinity());
+    EXPECT_EQ(acc.DivideBy(Fixed64_32(-0.5)), Fixed64_32::Infinity());
+    EXPECT_EQ(acc.DivideBy(Fixed64_32::Zero()), Fixed64_32::NegInfinity());
+    acc.Reset();
+    EXPECT_EQ(acc.DivideBy(Fixed64_32::Zero()), Fixed64_32::Infinity());
+}
+
+}  // namespace math::fp::tests
@@ -0,0 +1,108 @@
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "fixed64.h"
+#include "fixed64_array.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64ArrayTest : public ::testing::Test {
+ protected:
+    using Array = Fixed64Array<32>;
+
+    // Spans several parallel chunks and ends with a partial SIMD block
+    static constexpr size_t kCount = 3 * detail::kChunkSize + 5;
+
+    static auto MakeArray(uint64_t seed, double range) -> Array {
+        std::mt19937_64 gen(seed);
+        std::uniform_real_distribution<double> dist(-range, range);
+        Array values(kCount);
+        for (auto& v : values) {
+            v = Fixed64_32(dist(gen));
+        }
+        return values;
+    }
+};
+
+TEST_F(Fixed64ArrayTest, StorageIsAlignedAndPadded) {
+    Array a(13, Fixed64_32(2));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(a.data()) % 64, 0u);
+    EXPECT_EQ(a.size(), 13u);
+    for (const auto& v : a) {
+        EXPECT_EQ(v, Fixed64_32(2));
+    }
+    // Padding up to the next cache line is zero
+    for (size_t i = 13; i < 16; ++i) {
+        EXPECT_EQ(a.data()[i], Fixed64_32::Zero());
+    }
+
+    a.Resize(5);
+    a.Resize(9);
+    EXPECT_EQ(a[4], Fixed64_32(2));
+    EXPECT_EQ(a[5], Fixed64_32::Zero());
+    EXPECT_EQ(a[8], Fixed64_32::Zero());
+
+    const std::vector<Fixed64_32> values{Fixed64_32(1), Fixed64_32(-1)};
+    const Array b(values);
+    EXPECT_EQ(b.size(), 2u);
+    EXPECT_EQ(b[1], Fixed64_32(-1));
+    EXPECT_TRUE(Array().empty());
+}
+
+TEST_F(Fixed64ArrayTest, ArithmeticMatchesScalar) {
+    const Array a = MakeArray(1, 1000.0);
+    const Array b = MakeArray(2, 1000.0);
+    const Fixed64_32 s(-0.375);
+
+    const Array sum = a + b;
+    const Array diff = a - b;
+    const Array product = a * b;
+    const Array scaled = a * s;
+    for (size_t i = 0; i < kCount; ++i) {
+        ASSERT_EQ(sum[i], a[i] + b[i]) << i;
+        ASSERT_EQ(diff[i], a[i] - b[i]) << i;
+        ASSERT_EQ(product[i], a[i] * b[i]) << i;
+        ASSERT_EQ(scaled[i], a[i] * s) << i;
+    }
+}
+
+TEST_F(Fixed64ArrayTest, FunctionsMatchScalar) {
+    const Array a = MakeArray(3, 100.0);
+    const Array b = MakeArray(4, 100.0);
+    const Fixed64_32 t(0.3);
+
+    Array lerp = a;
+    lerp.Lerp(b, t);
+    Array clamped = a;
+    clamped.Clamp(Fixed64_32(-10), Fixed64_32(25));
+    Array roots = a;
+    roots.Clamp(Fixed64_32::Zero(), Fixed64_32::Max()).Sqrt();
+    Array sines = a;
+    sines.Sin();
+    for (size_t i = 0; i < kCount; ++i) {
+        ASSERT_EQ(lerp[i], Fixed64Math::Lerp(a[i], b[i], t)) << i;
+        ASSERT_EQ(clamped[i], Fixed64Math::Clamp(a[i], Fixed64_32(-10), Fixed64_32(25))) << i;
+        ASSERT_EQ(roots[i], Fixed64Math::Sqrt(Fixed64Math::Max(a[i], Fixed64_32::Zero()))) << i;
+        ASSERT_EQ(sines[i], Fixed64Math::Sin(a[i])) << i;
+    }
+
+    // Interpolation factors outside [0, 1] are clamped like Fixed64Math::Lerp
+    Array past = a;
+    past.Lerp(b, Fixed64_32(2));
+    EXPECT_EQ(past[7], b[7]);
+}
+
+TEST_F(Fixed64ArrayTest, ChunkPoolRunsEveryChunkOnce) {
+    std::vector<int> hits(1000, 0);
+    auto fn = [&](size_t c) { ++hits[c]; };
+    detail::ChunkPool::Instance().Run(hits.size(), fn);
+    for (int h : hits) {
+        ASSERT_EQ(h, 1);
+    }
+    EXPECT_GE(detail::ChunkPool::Instance().concurrency(), 1u);
+}
+
+}  // namespace math::fp::tests
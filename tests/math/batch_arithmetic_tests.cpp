@@ -0,0 +1,268 @@
+#include <bit>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "fixed64.h"
+#include "fixed64_batch.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64BatchTest : public ::testing::Test {
+ protected:
+    // Odd sizes exercise both the vector body and the scalar tail
+    static constexpr size_t kCount = 1027;
+
+    template <int P>
+    static auto MakeValues(uint64_t seed, int64_t range) -> std::vector<Fixed64<P>> {
+        std::mt19937_64 gen(seed);
+        std::uniform_int_distribution<int64_t> dist(-range, range);
+        std::vector<Fixed64<P>> values(kCount);
+        for (auto& v : values) {
+            v = Fixed64<P>(dist(gen), detail::nothing{});
+        }
+        return values;
+    }
+
+    template <int P>
+    static auto CheckMul(uint64_t seed, int64_t range) -> void {
+        auto a = MakeValues<P>(seed, range);
+        auto b = MakeValues<P>(seed + 1, range);
+
+        // Edge values that stress sign handling and the 128-bit recombination
+        a[0] = Fixed64<P>::Min();
+        b[0] = Fixed64<P>::One();
+        a[1] = Fixed64<P>::Max();
+        b[1] = Fixed64<P>::NegOne();
+        a[2] = Fixed64<P>(-1LL, detail::nothing{});
+        b[2] = Fixed64<P>(INT64_MAX, detail::nothing{});
+        a[3] = Fixed64<P>::Zero();
+        b[3] = Fixed64<P>::Min();
+
+        std::vector<Fixed64<P>> out(kCount);
+        Fixed64Batch::Mul<P>(a, b, out);
+        for (size_t i = 0; i < kCount; ++i) {
+            ASSERT_EQ(out[i].value(), Primitives::Fixed64Mul(a[i].value(), b[i].value(), P))
+                << "P=" << P << " index " << i;
+        }
+
+        const Fixed64<P> factor = b[17];
+        Fixed64Batch::Mul<P>(a, factor, out);
+        for (size_t i = 0; i < kCount; ++i) {
+            ASSERT_EQ(out[i].value(), Primitives::Fixed64Mul(a[i].value(), factor.value(), P))
+                << "P=" << P << " index " << i;
+        }
+    }
+
+    // Raw values with every magnitude, including exact rounding ties and INT64_MIN
+    static auto MakeRawForConversion(uint64_t seed) -> std::vector<int64_t> {
+        std::mt19937_64 gen(seed);
+        std::vector<int64_t> raw(kCount);
+        for (auto& r : raw) {
+            const int shift = static_cast<int>(gen() % 64);
+            r = static_cast<int64_t>(gen()) >> shift;
+            if (gen() % 4 == 0) {
+                // Exactly halfway between two double (or float) neighbours
+                const int mantissa_bits = gen() % 2 == 0 ? 52 : 23;
+                const int msb = mantissa_bits + 2 + static_cast<int>(gen() % (61 - mantissa_bits));
+                const int ulp = msb - mantissa_bits;
+                const uint64_t mantissa = gen() & ((uint64_t(1) << mantissa_bits) - 1);
+                r = static_cast<int64_t>((uint64_t(1) << msb) | mantissa << ulp
+                                         | uint64_t(1) << (ulp - 1));
+                r = gen() % 2 == 0 ? r : -r;
+            }
+        }
+        raw[0] = INT64_MIN;
+        raw[1] = INT64_MAX;
+        raw[2] = 0;
+        raw[3] = -1;
+        raw[4] = 1;
+        raw[5] = (int64_t(1) << 53) - 1;
+        raw[6] = (int64_t(1) << 54) - 1;
+        raw[7] = -((int64_t(1) << 25) - 1);
+        return raw;
+    }
+
+    template <int P>
+    static auto CheckToFloating(uint64_t seed) -> void {
+        const auto raw = MakeRawForConversion(seed);
+        std::vector<Fixed64<P>> in(kCount);
+        for (size_t i = 0; i < kCount; ++i) {
+            in[i] = Fixed64<P>(raw[i], detail::nothing{});
+        }
+
+        std::vector<double> doubles(kCount);
+        std::vector<float> floats(kCount);
+        Fixed64Batch::ConvertToDouble<P>(in, doubles);
+        Fixed64Batch::ConvertToFloat<P>(in, floats);
+        for (size_t i = 0; i < kCount; ++i) {
+            ASSERT_EQ(std::bit_cast<uint64_t>(doubles[i]),
+                      std::bit_cast<uint64_t>(static_cast<double>(in[i])))
+                << "P=" << P << " raw " << raw[i];
+            ASSERT_EQ(std::bit_cast<uint32_t>(floats[i]),
+                      std::bit_cast<uint32_t>(static_cast<float>(in[i])))
+                << "P=" << P << " raw " << raw[i];
+        }
+    }
+
+    template <int P>
+    static auto CheckFromFloating(uint64_t seed) -> void {
+        // Random bit patterns cover every exponent, subnormals, infinities and NaNs
+        std::mt19937_64 gen(seed);
+        std::vector<double> doubles(kCount);
+        std::vector<float> floats(kCount);
+        for (size_t i = 0; i < kCount; ++i) {
+            const uint64_t bits = gen();
+            if (i % 2 == 0) {
+                // Exponents around the fixed-point range, where rounding and saturation happen
+                const uint64_t exponent = 1023 - 80 + bits % 160;
+                doubles[i] = std::bit_cast<double>((bits & 0x800FFFFFFFFFFFFFULL) | exponent << 52);
+                const uint32_t exponent32 = 127 - 80 + static_cast<uint32_t>(bits >> 20) % 160;
+                floats[i] = std::bit_cast<float>((static_cast<uint32_t>(bits) & 0x807FFFFFu)
+                                                 | exponent32 << 23);
+            } else {
+                doubles[i] = std::bit_cast<double>(bits);
+                floats[i] = std::bit_cast<float>(static_cast<uint32_t>(bits));
+            }
+        }
+        const double special[] = {0.0,
+                                  -0.0,
+                                  0.5,
+                                  -1.5,
+                                  std::numeric_limits<double>::infinity(),
+                                  -std::numeric_limits<double>::infinity(),
+                                  std::numeric_limits<double>::quiet_NaN(),
+                                  std::numeric_limits<double>::denorm_min(),
+                                  1e300,
+                                  -1e300};
+        for (size_t i = 0; i < std::size(special); ++i) {
+            doubles[i] = special[i];
+            floats[i] = static_cast<float>(special[i]);
+        }
+
+        std::vector<Fixed64<P>> from_double(kCount);
+        std::vector<Fixed64<P>> from_float(kCount);
+        Fixed64Batch::ConvertFromDouble<P>(doubles, from_double);
+        Fixed64Batch::ConvertFromFloat<P>(floats, from_float);
+        for (size_t i = 0; i < kCount; ++i) {
+            ASSERT_EQ(from_double[i].value(), Fixed64<P>(doubles[i]).value())
+                << "P=" << P << " value " << doubles[i];
+            ASSERT_EQ(from_float[i].value(), Fixed64<P>(floats[i]).value())
+                << "P=" << P << " value " << floats[i];
+        }
+    }
+};
+
+TEST_F(Fixed64BatchTest, MulMatchesScalarPrimitive) {
+    CheckMul<16>(1, INT64_MAX);
+    CheckMul<16>(2, int64_t(1) << 40);
+    CheckMul<32>(3, INT64_MAX);
+    CheckMul<32>(4, int64_t(1) << 48);
+    CheckMul<40>(5, INT64_MAX);
+    CheckMul<40>(6, int64_t(1) << 44);
+    CheckMul<1>(7, INT64_MAX);
+    CheckMul<63>(8, INT64_MAX);
+}
+
+TEST_F(Fixed64BatchTest, MulMatchesOperatorInRange) {
+    using Fixed = Fixed64<32>;
+    auto a = MakeValues<32>(11, int64_t(1) << 40);
+    auto b = MakeValues<32>(12, int64_t(1) << 40);
+    std::vector<Fixed> out(kCount);
+
+    Fixed64Batch::Mul<32>(a, b, out);
+    for (size_t i = 0; i < kCount; ++i) {
+        ASSERT_EQ(out[i], a[i] * b[i]) << "index " << i;
+    }
+}
+
+TEST_F(Fixed64BatchTest, MulInPlace) {
+    auto a = MakeValues<32>(21, INT64_MAX);
+    const auto b = MakeValues<32>(22, INT64_MAX);
+    const auto original = a;
+
+    Fixed64Batch::Mul<32>(a, b, a);
+    for (size_t i = 0; i < kCount; ++i) {
+        ASSERT_EQ(a[i].value(), Primitives::Fixed64Mul(original[i].value(), b[i].value(), 32));
+    }
+}
+
+TEST_F(Fixed64BatchTest, MulUsesShortestSpan) {
+    using Fixed = Fixed64<16>;
+    std::vector<Fixed> a(10, Fixed(3));
+    std::vector<Fixed> b(7, Fixed(2));
+    std::vector<Fixed> out(10, Fixed(-1));
+
+    Fixed64Batch::Mul<16>(a, b, out);
+    for (size_t i = 0; i < 7; ++i) {
+        EXPECT_EQ(out[i], Fixed(6));
+    }
+    for (size_t i = 7; i < 10; ++i) {
+        EXPECT_EQ(out[i], Fixed(-1)) << "Elements beyond the shortest span must be untouched";
+    }
+}
+
+TEST_F(Fixed64BatchTest, DivMatchesOperator) {
+    auto a = MakeValues<32>(31, int64_t(1) << 50);
+    auto b = MakeValues<32>(32, int64_t(1) << 36);
+    b[5] = Fixed64<32>::Zero();
+    a[6] = -a[6];
+    b[6] = Fixed64<32>::Zero();
+    std::vector<Fixed64<32>> out(kCount);
+
+    Fixed64Batch::Div<32>(a, b, out);
+    for (size_t i = 0; i < kCount; ++i) {
+        ASSERT_EQ(out[i], a[i] / b[i]) << "index " << i;
+    }
+
+    const Fixed64<32> divisor(-7.25);
+    Fixed64Batch::Div<32>(a, divisor, out);
+    for (size_t i = 0; i < kCount; ++i) {
+        ASSERT_EQ(out[i], a[i] / divisor) << "index " << i;
+    }
+
+    auto a16 = MakeValues<16>(33, int64_t(1) << 40);
+    auto b16 = MakeValues<16>(34, int64_t(1) << 20);
+    std::vector<Fixed64<16>> out16(kCount);
+    Fixed64Batch::Div<16>(a16, b16, out16);
+    for (size_t i = 0; i < kCount; ++i) {
+        ASSERT_EQ(out16[i], a16[i] / b16[i]) << "index " << i;
+    }
+}
+
+TEST_F(Fixed64BatchTest, EmptySpans) {
+    std::vector<Fixed64<32>> empty;
+    Fixed64Batch::Mul<32>(empty, empty, empty);
+    Fixed64Batch::Div<32>(empty, Fixed64<32>::One(), empty);
+    EXPECT_TRUE(empty.empty());
+}
+
+TEST_F(Fixed64BatchTest, ConvertToFloatingMatchesScalar) {
+    CheckToFloating<1>(21);
+    CheckToFloating<16>(22);
+    CheckToFloating<32>(23);
+    CheckToFloating<40>(24);
+    CheckToFloating<63>(25);
+}
+
+TEST_F(Fixed64BatchTest, ConvertFromFloatingMatchesScalar) {
+    CheckFromFloating<1>(31);
+    CheckFromFloating<16>(32);
+    CheckFromFloating<32>(33);
+    CheckFromFloating<40>(34);
+    CheckFromFloating<63>(35);
+}
+
+TEST_F(Fixed64BatchTest, ConvertRoundTrip) {
+    auto values = MakeValues<32>(41, int64_t(1) << 52);
+    std::vector<double> doubles(kCount);
+    std::vector<Fixed64_32> back(kCount);
+    Fixed64Batch::ConvertToDouble<32>(values, doubles);
+    Fixed64Batch::ConvertFromDouble<32>(doubles, back);
+    EXPECT_EQ(back, values);
+}
+
+}  // namespace math::fp::tests
@@ -0,0 +1,222 @@
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "fixed64.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64BatchTrigTest : public ::testing::Test {
+ protected:
+    // Odd sizes exercise both the vector body and the scalar tail
+    static constexpr size_t kCount = 1031;
+
+    // Angles covering the principal range, many periods, quadrant boundaries and extremes
+    template <int P>
+    static auto MakeAngles(uint64_t seed) -> std::vector<Fixed64<P>> {
+        std::mt19937_64 gen(seed);
+        std::uniform_int_distribution<int64_t> small(-(int64_t(8) << P), int64_t(8) << P);
+        std::uniform_int_distribution<int64_t> any(INT64_MIN, INT64_MAX);
+        std::vector<Fixed64<P>> values(kCount);
+        for (size_t i = 0; i < kCount; ++i) {
+            values[i] = Fixed64<P>(i % 4 == 3 ? any(gen) : small(gen), detail::nothing{});
+        }
+
+        const Fixed64<P> edges[] = {Fixed64<P>::Zero(),    Fixed64<P>::Pi(),
+                                    -Fixed64<P>::Pi(),     Fixed64<P>::HalfPi(),
+                                    -Fixed64<P>::HalfPi(), Fixed64<P>::TwoPi(),
+                                    -Fixed64<P>::TwoPi(),  Fixed64<P>::Max(),
+                                    Fixed64<P>::Min(),     Fixed64<P>::NegInfinity(),
+                                    Fixed64<P>::Epsilon(), -Fixed64<P>::Epsilon()};
+        size_t i = 0;
+        for (const auto& edge : edges) {
+            values[i++] = edge;
+            values[i++] = edge + Fixed64<P>::Epsilon();
+            values[i++] = edge - Fixed64<P>::Epsilon();
+        }
+        return values;
+    }
+
+    template <int P>
+    static auto CheckSinCosTan(uint64_t seed) -> void {
+        const auto x = MakeAngles<P>(seed);
+        std::vector<Fixed64<P>> out(kCount);
+
+        Fixed64Math::SinBatch<P>(x, out);
+        for (size_t i = 0; i < kCount; ++i) {
+            ASSERT_EQ(out[i].value(), Fixed64Math::Sin(x[i]).value()) << "P=" << P << " i=" << i;
+        }
+
+        Fixed64Math::CosBatch<P>(x, out);
+        for (size_t i = 0; i < kCount; ++i) {
+            ASSERT_EQ(out[i].value(), Fixed64Math::Cos(x[i]).value()) << "P=" << P << " i=" << i;
+        }
+
+        Fixed64Math::TanBatch<P>(x, out);
+        for (size_t i = 0; i < kCount; ++i) {
+            ASSERT_EQ(out[i].value(), Fixed64Math::Tan(x[i]).value()) << "P=" << P << " i=" << i;
+        }
+    }
+
+    // The public API follows FIXED64_MATH_USE_FAST_TRIG, so check both kernels directly
+    template <int P, bool Fast>
+    static auto CheckKernels(uint64_t seed) -> void {
+        const auto x = MakeAngles<P>(seed);
+        const auto* raw = reinterpret_cast<const int64_t*>(x.data());
+        std::vector<int64_t> out(kCount);
+
+        const size_t sin_count = detail::SinBatch<P, Fast>(raw, 0, out.data(), kCount);
+        EXPECT_LE(sin_count, kCount);
+        for (size_t i = 0; i < sin_count; ++i) {
+            const int64_t expected =
+                Fast ? detail::LookupSinFast<P>(raw[i]) : detail::LookupSin<P>(raw[i]);
+            ASSERT_EQ(out[i], expected) << "P=" << P << " i=" << i;
+        }
+
+        const size_t tan_count = detail::TanBatch<P, Fast>(raw, out.data(), kCount);
+        EXPECT_EQ(tan_count, sin_count);
+        for (size_t i = 0; i < tan_count; ++i) {
+            const int64_t expected =
+                Fast ? detail::LookupTanFast<P>(raw[i]) : detail::LookupTan<P>(raw[i]);
+            ASSERT_EQ(out[i], expected) << "P=" << P << " i=" << i;
+        }
+    }
+
+    // The branching formulation Atan2 used before its octant selection became branch-free
+    template <int P>
+    static auto ReferenceAtan2(Fixed64<P> y, Fixed64<P> x) -> Fixed64<P> {
+        if (x == Fixed64<P>::Zero() && y == Fixed64<P>::Zero()) {
+            return Fixed64<P>::Zero();
+        }
+        if (x == Fixed64<P>::Zero()) {
+            return y > Fixed64<P>::Zero() ? Fixed64<P>::HalfPi() : -Fixed64<P>::HalfPi();
+        }
+        bool x_neg = x < Fixed64<P>::Zero();
+        bool y_neg = y < Fixed64<P>::Zero();
+        bool swapped = Fixed64Math::Abs(y) > Fixed64Math::Abs(x);
+        Fixed64<P> ratio = swapped ? Fixed64Math::Abs(x) / Fixed64Math::Abs(y)
+                                   : Fixed64Math::Abs(y) / Fixed64Math::Abs(x);
+        Fixed64<P> angle(detail::LookupAtan2<P>(ratio.value()), detail::nothing{});
+        if (swapped) {
+            angle = Fixed64<P>::HalfPi() - angle;
+        }
+        if (x_neg && y_neg) {
+            return -Fixed64<P>::Pi() + angle;
+        } else if (x_neg) {
+            return Fixed64<P>::Pi() - angle;
+        } else if (y_neg) {
+            return -angle;
+        }
+        return angle;
+    }
+
+    template <int P>
+    static auto CheckAtan2(uint64_t seed) -> void {
+        std::mt19937_64 gen(seed);
+        std::uniform_int_distribution<int64_t> any(INT64_MIN + 1, INT64_MAX);
+        std::uniform_int_distribution<int64_t> small(-(int64_t(1) << (P + 4)),
+                                                      int64_t(1) << (P + 4));
+        std::uniform_int_distribution<int> shift(0, 62);
+        std::vector<Fixed64<P>> y(kCount);
+        std::vector<Fixed64<P>> x(kCount);
+        for (size_t i = 0; i < kCount; ++i) {
+            // Mix full-range, small and very different magnitudes
+            int64_t yi = i % 3 == 0 ? any(gen) : small(gen);
+            int64_t xi = i % 3 == 1 ? any(gen) : small(gen);
+            if (i % 5 == 0) {
+                xi >>= shift(gen);
+            }
+            y[i] = Fixed64<P>(yi, detail::nothing{});
+            x[i] = Fixed64<P>(xi, detail::nothing{});
+        }
+
+        // Axes, diagonals and extremes
+        const Fixed64<P> edges[] = {Fixed64<P>::Zero(), Fixed64<P>::One(), -Fixed64<P>::One(),
+                                    Fixed64<P>::Max(),  -Fixed64<P>::Max(), Fixed64<P>::Epsilon(),
+                                    -Fixed64<P>::Epsilon()};
+        size_t i = 0;
+        for (const auto& ey : edges) {
+            for (const auto& ex : edges) {
+                y[i] = ey;
+                x[i] = ex;
+                ++i;
+            }
+        }
+
+        std::vector<Fixed64<P>> out(kCount);
+        Fixed64Math::Atan2Batch<P>(y, x, out);
+        for (size_t j = 0; j < kCount; ++j) {
+            const Fixed64<P> scalar = Fixed64Math::Atan2(y[j], x[j]);
+            ASSERT_EQ(out[j].value(), scalar.value()) << "P=" << P << " j=" << j;
+            // FIXED64_MATH_USE_CORDIC routes both through Cordic::Atan2 instead of the table
+            if constexpr (!FIXED64_MATH_USE_CORDIC) {
+                ASSERT_EQ(scalar.value(), ReferenceAtan2(y[j], x[j]).value())
+                    << "P=" << P << " j=" << j;
+            }
+        }
+    }
+};
+
+TEST_F(Fixed64BatchTrigTest, MatchesScalarFunctions) {
+    CheckSinCosTan<32>(1);
+    CheckSinCosTan<40>(2);
+    CheckSinCosTan<48>(3);
+    // Below Q31.32 the lanes reduce the angle before converting it
+    CheckSinCosTan<16>(4);
+    CheckSinCosTan<3>(5);
+}
+
+TEST_F(Fixed64BatchTrigTest, FastAndPreciseKernelsMatchLookups) {
+    CheckKernels<32, true>(11);
+    CheckKernels<32, false>(12);
+    CheckKernels<44, true>(13);
+    CheckKernels<44, false>(14);
+    CheckKernels<16, true>(15);
+    CheckKernels<16, false>(16);
+}
+
+TEST_F(Fixed64BatchTrigTest, InPlaceAndShortestSpan) {
+    using Fixed = Fixed64<32>;
+    auto x = MakeAngles<32>(21);
+    const auto original = x;
+
+    Fixed64Math::SinBatch<32>(x, x);
+    for (size_t i = 0; i < kCount; ++i) {
+        ASSERT_EQ(x[i], Fixed64Math::Sin(original[i])) << "i=" << i;
+    }
+
+    std::vector<Fixed> angles(9, Fixed::Pi());
+    std::vector<Fixed> out(12, Fixed(7));
+    Fixed64Math::CosBatch<32>(angles, out);
+    for (size_t i = 0; i < 9; ++i) {
+        EXPECT_EQ(out[i], Fixed64Math::Cos(Fixed::Pi()));
+    }
+    for (size_t i = 9; i < 12; ++i) {
+        EXPECT_EQ(out[i], Fixed(7)) << "Elements beyond the shortest span must be untouched";
+    }
+}
+
+TEST_F(Fixed64BatchTrigTest, Atan2MatchesBranchingReference) {
+    CheckAtan2<16>(31);
+    CheckAtan2<32>(32);
+    CheckAtan2<40>(33);
+    CheckAtan2<48>(34);
+    CheckAtan2<8>(35);
+}
+
+TEST_F(Fixed64BatchTrigTest, Atan2NaNInput) {
+    using Fixed = Fixed64<32>;
+    std::vector<Fixed> y = {Fixed::NaN(), Fixed::One(), Fixed::NaN(), Fixed::Zero(), Fixed(2)};
+    std::vector<Fixed> x = {Fixed::One(), Fixed::NaN(), Fixed::NaN(), Fixed::NaN(), Fixed(3)};
+    std::vector<Fixed> out(y.size());
+    Fixed64Math::Atan2Batch<32>(y, x, out);
+    for (size_t i = 0; i + 1 < y.size(); ++i) {
+        EXPECT_EQ(Fixed64Math::Atan2(y[i], x[i]), Fixed::NaN());
+        EXPECT_EQ(out[i], Fixed::NaN());
+    }
+    EXPECT_EQ(out.back(), Fixed64Math::Atan2(Fixed(2), Fixed(3)));
+}
+
+}  // namespace math::fp::tests
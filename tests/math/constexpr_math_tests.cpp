@@ -0,0 +1,97 @@
+#include <array>
+#include <cstddef>
+
+#include "fixed64.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64ConstexprMathTest : public ::testing::Test {
+ protected:
+    using Fixed = Fixed64<32>;
+
+    // Sine table built entirely at compile time
+    static constexpr size_t kTableSize = 64;
+    static constexpr std::array<Fixed, kTableSize> kSinTable = [] {
+        std::array<Fixed, kTableSize> table{};
+        for (size_t i = 0; i < kTableSize; ++i) {
+            table[i] = Fixed64Math::Sin(Fixed::TwoPi() * Fixed(static_cast<int>(i)) /
+                                        Fixed(static_cast<int>(kTableSize)));
+        }
+        return table;
+    }();
+};
+
+// Results are checked at compile time
+static_assert(Fixed64Math::Sin(Fixed64_32::Zero()) == Fixed64_32::Zero());
+static_assert(Fixed64Math::Abs(Fixed64Math::Cos(Fixed64_32::Zero()) - Fixed64_32::One()) <
+              Fixed64_32(1e-8));
+static_assert(Fixed64Math::Exp(Fixed64_32::Zero()) == Fixed64_32::One());
+static_assert(Fixed64Math::Log(Fixed64_32::One()) == Fixed64_32::Zero());
+static_assert(Fixed64Math::Sqrt(Fixed64_32(16)) == Fixed64_32(4));
+static_assert(Fixed64Math::Acos(Fixed64_32(2)) == Fixed64_32::Zero());
+static_assert(Fixed64Math::Atan(Fixed64_32::Zero()) == Fixed64_32::Zero());
+static_assert(Fixed64Math::Pow(Fixed64_32(2), 10) == Fixed64_32(1024));
+static_assert(Fixed64Math::Sin(Fixed64_16::HalfPi()) > Fixed64_16(0.999));
+static_assert(Fixed64Math::Atan2(Fixed64_16::One(), Fixed64_16::Zero()) == Fixed64_16::HalfPi());
+static_assert(Fixed64Math::Exp(Fixed64_16::One()) > Fixed64_16(2.718));
+
+TEST_F(Fixed64ConstexprMathTest, MatchesRuntimeBitForBit) {
+    constexpr Fixed kX(0.7);
+    constexpr Fixed kY(-1.3);
+
+    constexpr Fixed kSin = Fixed64Math::Sin(kX);
+    constexpr Fixed kCos = Fixed64Math::Cos(kX);
+    constexpr auto kSinCos = Fixed64Math::SinCos(kX);
+    constexpr Fixed kTan = Fixed64Math::Tan(kX);
+    constexpr Fixed kAsin = Fixed64Math::Asin(kX);
+    constexpr Fixed kAcos = Fixed64Math::Acos(kX);
+    constexpr Fixed kAtan = Fixed64Math::Atan(kY);
+    constexpr Fixed kAtan2 = Fixed64Math::Atan2(kY, kX);
+    constexpr Fixed kExp = Fixed64Math::Exp(kY);
+    constexpr Fixed kLog = Fixed64Math::Log(kX);
+    constexpr Fixed kPow = Fixed64Math::Pow(kX, kY);
+    constexpr Fixed kSqrt = Fixed64Math::Sqrt(kX);
+
+    // volatile keeps the runtime calls from being folded into constants
+    volatile int64_t x_raw = kX.value();
+    volatile int64_t y_raw = kY.value();
+    const Fixed x(x_raw, detail::nothing{});
+    const Fixed y(y_raw, detail::nothing{});
+
+    EXPECT_EQ(kSin, Fixed64Math::Sin(x));
+    EXPECT_EQ(kCos, Fixed64Math::Cos(x));
+    EXPECT_EQ(kSinCos.first, Fixed64Math::SinCos(x).first);
+    EXPECT_EQ(kSinCos.second, Fixed64Math::SinCos(x).second);
+    EXPECT_EQ(kTan, Fixed64Math::Tan(x));
+    EXPECT_EQ(kAsin, Fixed64Math::Asin(x));
+    EXPECT_EQ(kAcos, Fixed64Math::Acos(x));
+    EXPECT_EQ(kAtan, Fixed64Math::Atan(y));
+    EXPECT_EQ(kAtan2, Fixed64Math::Atan2(y, x));
+    EXPECT_EQ(kExp, Fixed64Math::Exp(y));
+    EXPECT_EQ(kLog, Fixed64Math::Log(x));
+    EXPECT_EQ(kPow, Fixed64Math::Pow(x, y));
+    EXPECT_EQ(kSqrt, Fixed64Math::Sqrt(x));
+}
+
+TEST_F(Fixed64ConstexprMathTest, RawSqrtPrimitivesAreConstexpr) {
+    constexpr int64_t kTwo = int64_t(2) << 32;
+    constexpr int64_t kSqrt = Primitives::Fixed64Sqrt(kTwo, 32);
+    constexpr int64_t kSqrtFast = Primitives::Fixed64SqrtFast(kTwo, 32);
+
+    volatile int64_t two = kTwo;
+    EXPECT_EQ(kSqrt, Primitives::Fixed64Sqrt(two, 32));
+    EXPECT_EQ(kSqrtFast, Primitives::Fixed64SqrtFast(two, 32));
+}
+
+TEST_F(Fixed64ConstexprMathTest, BuildsTablesAtCompileTime) {
+    for (size_t i = 0; i < kTableSize; ++i) {
+        const Fixed angle = Fixed::TwoPi() * Fixed(static_cast<int>(i)) /
+                            Fixed(static_cast<int>(kTableSize));
+        EXPECT_EQ(kSinTable[i], Fixed64Math::Sin(angle)) << "index " << i;
+    }
+    EXPECT_EQ(kSinTable[0], Fixed::Zero());
+}
+
+}  // namespace math::fp::tests
@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "detail/cordic.h"
+#include "detail/sin_lut.h"
+#include "fixed64.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64CordicTest : public ::testing::Test {
+ protected:
+    template <int P>
+    static auto ToReal(Fixed64<P> x) -> long double {
+        return std::ldexp(static_cast<long double>(x.value()), -P);
+    }
+
+    template <int P>
+    static auto Ulp() -> long double {
+        return std::ldexp(1.0L, -P);
+    }
+
+    template <int P>
+    static auto MakeValues(uint64_t seed, size_t count, double range) -> std::vector<Fixed64<P>> {
+        std::mt19937_64 gen(seed);
+        std::uniform_real_distribution<double> dist(-range, range);
+        std::vector<Fixed64<P>> values(count);
+        for (auto& v : values) {
+            v = Fixed64<P>(dist(gen));
+        }
+        return values;
+    }
+
+    // Largest error of Cordic::SinCos against long double over random angles, in ulps
+    template <int P>
+    static auto SinCosError(uint64_t seed, double range) -> long double {
+        long double error = 0;
+        for (const auto x : MakeValues<P>(seed, 20000, range)) {
+            const auto [s, c] = Fixed64Math::Cordic::SinCos(x);
+            error = std::max(error, std::fabs(ToReal(s) - std::sin(ToReal(x))));
+            error = std::max(error, std::fabs(ToReal(c) - std::cos(ToReal(x))));
+        }
+        return error / Ulp<P>();
+    }
+};
+
+TEST_F(Fixed64CordicTest, SinCosWithinOneUlp) {
+    EXPECT_LE(SinCosError<16>(1, 1000.0), 1.0L);
+    EXPECT_LE(SinCosError<32>(2, 1000.0), 1.0L);
+    EXPECT_LE(SinCosError<40>(3, 1000.0), 1.0L);
+    EXPECT_LE(SinCosError<48>(4, 100.0), 1.0L);
+
+    // Large angles are reduced with a 124-bit pi/2
+    EXPECT_LE(SinCosError<32>(5, 2.0e9), 1.0L);
+
+    EXPECT_EQ(Fixed64Math::Cordic::Sin(Fixed64_32::Zero()), Fixed64_32::Zero());
+    EXPECT_EQ(Fixed64Math::Cordic::Cos(Fixed64_32::Zero()), Fixed64_32::One());
+    EXPECT_EQ(Fixed64Math::Cordic::Sin(Fixed64_40::HalfPi()), Fixed64_40::One());
+}
+
+TEST_F(Fixed64CordicTest, MorePreciseThanTablesAboveQ31_32) {
+    // The table lookups are limited to 32 fraction bits, whichever backend Fixed64Math uses
+    long double cordic_error = 0;
+    long double table_error = 0;
+    for (const auto x : MakeValues<40>(6, 20000, 10.0)) {
+        const long double expected = std::sin(ToReal(x));
+        cordic_error =
+            std::max(cordic_error, std::fabs(ToReal(Fixed64Math::Cordic::Sin(x)) - expected));
+        const Fixed64_40 table(detail::LookupSin<40>(x.value()), detail::nothing{});
+        table_error = std::max(table_error, std::fabs(ToReal(table) - expected));
+    }
+    EXPECT_LT(cordic_error * 64, table_error);
+}
+
+TEST_F(Fixed64CordicTest, Atan2AllQuadrants) {
+    const auto y = MakeValues<40>(7, 20000, 1000.0);
+    const auto x = MakeValues<40>(8, 20000, 1000.0);
+    long double error = 0;
+    for (size_t i = 0; i < y.size(); ++i) {
+        const long double expected = std::atan2(ToReal(y[i]), ToReal(x[i]));
+        error =
+            std::max(error, std::fabs(ToReal(Fixed64Math::Cordic::Atan2(y[i], x[i])) - expected));
+    }
+    EXPECT_LE(error, Ulp<40>());
+
+    // Tiny vectors keep full angular precision
+    const Fixed64_32 tiny = Fixed64_32::Epsilon();
+    EXPECT_NEAR(ToReal(Fixed64Math::Cordic::Atan2(tiny, tiny)), 0.785398163397448L, 2e-10L);
+
+    EXPECT_EQ(Fixed64Math::Cordic::Atan2(Fixed64_32::Zero(), Fixed64_32::Zero()),
+              Fixed64_32::Zero());
+    EXPECT_EQ(Fixed64Math::Cordic::Atan2(Fixed64_32::Zero(), Fixed64_32(-2)), Fixed64_32::Pi());
+    EXPECT_EQ(Fixed64Math::Cordic::Atan2(Fixed64_32::NaN(), Fixed64_32(1)), Fixed64_32::NaN());
+    EXPECT_NEAR(ToReal(Fixed64Math::Cordic::Atan2(Fixed64_32(3), Fixed64_32::Zero())),
+                1.5707963267948966L,
+                Ulp<32>());
+}
+
+TEST_F(Fixed64CordicTest, HypotDoesNotOverflow) {
+    const auto x = MakeValues<32>(9, 20000, 1.0e6);
+    const auto y = MakeValues<32>(10, 20000, 1.0e6);
+    for (size_t i = 0; i < x.size(); ++i) {
+        const long double expected = std::hypot(ToReal(x[i]), ToReal(y[i]));
+        ASSERT_LE(std::fabs(ToReal(Fixed64Math::Cordic::Hypot(x[i], y[i])) - expected),
+                  Ulp<32>())
+            << i;
+    }
+
+    EXPECT_EQ(Fixed64Math::Cordic::Hypot(Fixed64_32(3), Fixed64_32(-4)), Fixed64_32(5));
+    EXPECT_EQ(Fixed64Math::Cordic::Hypot(Fixed64_32::Zero(), Fixed64_32::Zero()),
+              Fixed64_32::Zero());
+    // x * x overflows Q31.32, the length does not
+    EXPECT_EQ(Fixed64Math::Cordic::Hypot(Fixed64_32(60000), Fixed64_32(80000)),
+              Fixed64_32(100000));
+    EXPECT_EQ(Fixed64Math::Cordic::Hypot(Fixed64_32::Max(), Fixed64_32::Max()),
+              Fixed64_32::Infinity());
+    EXPECT_EQ(Fixed64Math::Cordic::Hypot(Fixed64_32(1), Fixed64_32::NaN()), Fixed64_32::NaN());
+}
+
+TEST_F(Fixed64CordicTest, ConstexprMatchesRuntime) {
+    constexpr auto kAngle = Fixed64_32(0x12345678LL, detail::nothing{});
+    constexpr auto kValue = Fixed64Math::Cordic::SinCos(kAngle);
+    constexpr auto kLength = Fixed64Math::Cordic::Hypot(kAngle, kAngle);
+    volatile int64_t raw = kAngle.value();
+    const Fixed64_32 angle(raw, detail::nothing{});
+    EXPECT_EQ(Fixed64Math::Cordic::SinCos(angle), kValue);
+    EXPECT_EQ(Fixed64Math::Cordic::Hypot(angle, angle), kLength);
+}
+
+}  // namespace math::fp::tests
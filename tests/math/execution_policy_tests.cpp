@@ -0,0 +1,205 @@
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "fixed64.h"
+#include "fixed64_batch.h"
+#include "fixed64_execution.h"
+#include "fixed64_math.h"
+#include "fixed64_random.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64ExecutionPolicyTest : public ::testing::Test {
+ protected:
+    using Fixed = Fixed64<32>;
+
+    // Several chunks plus a partial one, so every split boundary and the tail are exercised
+    static constexpr size_t kCount = 3 * detail::kChunkSize + 1234;
+
+    static auto MakeValues(uint64_t seed) -> std::vector<Fixed> {
+        std::vector<Fixed> values;
+        uint64_t x = seed;
+        for (size_t i = 0; i < kCount; ++i) {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            values.emplace_back(static_cast<int64_t>(x) >> (20 + i % 16), detail::nothing{});
+        }
+        return values;
+    }
+
+    // The policies every result is compared under, from one thread to the whole pool
+    static auto Policies() -> std::vector<execution::ParallelPolicy> {
+        return {execution::par.WithThreads(1), execution::par.WithThreads(2),
+                execution::par.WithThreads(3), execution::par, execution::par_unseq};
+    }
+
+    const std::vector<Fixed> a_ = MakeValues(0x9E3779B97F4A7C15);
+    const std::vector<Fixed> b_ = MakeValues(0x243F6A8885A308D3);
+};
+
+TEST_F(Fixed64ExecutionPolicyTest, BatchMathIsBitIdentical) {
+    std::vector<Fixed> expected(kCount);
+    std::vector<Fixed> out(kCount);
+    auto check = [&](const char* name) {
+        for (size_t i = 0; i < kCount; ++i) {
+            ASSERT_EQ(out[i], expected[i]) << name << " " << i;
+        }
+        std::fill(out.begin(), out.end(), Fixed::Zero());
+    };
+
+    Fixed64Math::SinBatch<32>(a_, expected);
+    Fixed64Math::SinBatch<32>(execution::seq, a_, out);
+    check("seq sin");
+    for (const auto& policy : Policies()) {
+        Fixed64Math::SinBatch<32>(policy, a_, out);
+        check("sin");
+    }
+
+    Fixed64Math::CosBatch<32>(a_, expected);
+    Fixed64Math::CosBatch<32>(execution::par, a_, out);
+    check("cos");
+    Fixed64Math::TanBatch<32>(a_, expected);
+    Fixed64Math::TanBatch<32>(execution::par, a_, out);
+    check("tan");
+    Fixed64Math::Atan2Batch<32>(a_, b_, expected);
+    Fixed64Math::Atan2Batch<32>(execution::par, a_, b_, out);
+    check("atan2");
+    Fixed64Math::HypotBatch<32>(a_, b_, expected);
+    Fixed64Math::HypotBatch<32>(execution::par, a_, b_, out);
+    check("hypot");
+    Fixed64Math::Hypot3Batch<32>(a_, b_, a_, expected);
+    Fixed64Math::Hypot3Batch<32>(execution::par, a_, b_, a_, out);
+    check("hypot3");
+    Fixed64Math::DistanceBatch<32>(a_, b_, b_, a_, expected);
+    Fixed64Math::DistanceBatch<32>(execution::par, a_, b_, b_, a_, out);
+    check("distance");
+
+    // The shortest span sets the count
+    std::vector<Fixed> short_out(100, Fixed(-1));
+    Fixed64Math::SinBatch<32>(execution::par, std::span<const Fixed>(a_).first(50), short_out);
+    EXPECT_EQ(short_out[49], Fixed64Math::Sin(a_[49]));
+    EXPECT_EQ(short_out[50], Fixed(-1));
+}
+
+TEST_F(Fixed64ExecutionPolicyTest, BatchArithmeticAndConversionAreBitIdentical) {
+    std::vector<Fixed> expected(kCount);
+    std::vector<Fixed> out(kCount);
+    for (const auto& policy : Policies()) {
+        Fixed64Batch::Mul<32>(a_, b_, expected);
+        Fixed64Batch::Mul<32>(policy, a_, b_, out);
+        EXPECT_EQ(out, expected);
+        Fixed64Batch::Mul<32>(a_, Fixed(-2.5), expected);
+        Fixed64Batch::Mul<32>(policy, a_, Fixed(-2.5), out);
+        EXPECT_EQ(out, expected);
+        Fixed64Batch::Div<32>(a_, b_, expected);
+        Fixed64Batch::Div<32>(policy, a_, b_, out);
+        EXPECT_EQ(out, expected);
+        Fixed64Batch::Div<32>(a_, Fixed(3), expected);
+        Fixed64Batch::Div<32>(policy, a_, Fixed(3), out);
+        EXPECT_EQ(out, expected);
+    }
+
+    std::vector<double> doubles(kCount);
+    std::vector<double> expected_doubles(kCount);
+    Fixed64Batch::ConvertToDouble<32>(a_, expected_doubles);
+    Fixed64Batch::ConvertToDouble<32>(execution::par, a_, doubles);
+    EXPECT_EQ(doubles, expected_doubles);
+    Fixed64Batch::ConvertFromDouble<32>(doubles, expected);
+    Fixed64Batch::ConvertFromDouble<32>(execution::par.WithThreads(2), doubles, out);
+    EXPECT_EQ(out, expected);
+
+    std::vector<float> floats(kCount);
+    std::vector<float> expected_floats(kCount);
+    Fixed64Batch::ConvertToFloat<32>(a_, expected_floats);
+    Fixed64Batch::ConvertToFloat<32>(execution::par, a_, floats);
+    EXPECT_EQ(floats, expected_floats);
+    Fixed64Batch::ConvertFromFloat<32>(floats, expected);
+    Fixed64Batch::ConvertFromFloat<32>(execution::seq, floats, out);
+    EXPECT_EQ(out, expected);
+}
+
+TEST_F(Fixed64ExecutionPolicyTest, ReductionsAreBitIdentical) {
+    const std::span<const Fixed> a(a_);
+    const std::span<const Fixed> b(b_);
+    const Fixed sum = Fixed64Math::Sum(a);
+    const Fixed mean = Fixed64Math::Mean(a);
+    const auto min_max = Fixed64Math::MinMax(a);
+    const Fixed variance = Fixed64Math::Variance(a);
+    const Fixed dot = Fixed64Math::Dot(a, b);
+
+    EXPECT_EQ(Fixed64Math::Sum<32>(execution::seq, a), sum);
+    EXPECT_EQ(Fixed64Math::Dot<32>(execution::seq, a, b), dot);
+    for (const auto& policy : Policies()) {
+        EXPECT_EQ(Fixed64Math::Sum<32>(policy, a), sum);
+        EXPECT_EQ(Fixed64Math::Mean<32>(policy, a), mean);
+        EXPECT_EQ(Fixed64Math::MinMax<32>(policy, a), min_max);
+        EXPECT_EQ(Fixed64Math::Variance<32>(policy, a), variance);
+        EXPECT_EQ(Fixed64Math::Dot<32>(policy, a, b), dot);
+    }
+    EXPECT_EQ(Fixed64Math::Dot<32>(execution::par, a.first(0), b), Fixed::Zero());
+}
+
+TEST_F(Fixed64ExecutionPolicyTest, RandomFillsMatchSequentialFills) {
+    for (auto make : {+[] { return Fixed64Random::CounterBased(42, 3); },
+                      +[] { return Fixed64Random(12345); }}) {
+        for (const auto& policy : Policies()) {
+            Fixed64Random serial = make();
+            Fixed64Random parallel = make();
+            (void)serial.random();  // Start mid-stream
+            (void)parallel.random();
+
+            std::vector<Fixed> expected(kCount);
+            std::vector<Fixed> out(kCount);
+            serial.fill<32>(expected, Fixed(-10), Fixed(10));
+            parallel.fill<32>(policy, out, Fixed(-10), Fixed(10));
+            EXPECT_EQ(out, expected);
+
+            std::vector<int32_t> expected_ints(kCount);
+            std::vector<int32_t> ints(kCount);
+            serial.fillIntegers(expected_ints, -5, 100);
+            parallel.fillIntegers(policy, ints, -5, 100);
+            EXPECT_EQ(ints, expected_ints);
+
+            auto expected_bits = std::make_unique<bool[]>(kCount);
+            auto bits = std::make_unique<bool[]>(kCount);
+            serial.fillBernoulli(std::span<bool>(expected_bits.get(), kCount), Fixed64_16(0.3));
+            parallel.fillBernoulli(policy, std::span<bool>(bits.get(), kCount), Fixed64_16(0.3));
+            EXPECT_TRUE(std::equal(bits.get(), bits.get() + kCount, expected_bits.get()));
+            parallel.fillBernoulli(policy, std::span<bool>(bits.get(), 10), Fixed64_16::One());
+            EXPECT_TRUE(bits[9]);
+
+            // Both generators end in the same state
+            EXPECT_EQ(parallel.getRandomCount(), serial.getRandomCount());
+            EXPECT_EQ(parallel.getIndex(), serial.getIndex());
+            EXPECT_EQ(parallel.random(), serial.random());
+        }
+    }
+}
+
+TEST_F(Fixed64ExecutionPolicyTest, ThreadCapIsRespected) {
+    auto threads_used = [](size_t max_threads) {
+        std::mutex mutex;
+        std::set<std::thread::id> ids;
+        detail::ForEachChunk(
+            64 * detail::kChunkSize,
+            [&](size_t, size_t) {
+                std::lock_guard<std::mutex> lock(mutex);
+                ids.insert(std::this_thread::get_id());
+            },
+            max_threads);
+        return ids;
+    };
+    const auto one = threads_used(detail::MaxThreads(execution::seq));
+    ASSERT_EQ(one.size(), 1u);
+    EXPECT_EQ(*one.begin(), std::this_thread::get_id());
+    EXPECT_LE(threads_used(2).size(), 2u);
+    EXPECT_LE(threads_used(0).size(), detail::ChunkPool::Instance().concurrency());
+}
+
+}  // namespace math::fp::tests
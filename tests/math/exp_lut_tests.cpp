@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+#include "detail/exp_lut.h"
+#include "fixed64.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+// The table backend is selected at compile time with FIXED64_MATH_USE_LUT_EXP, so these tests
+// exercise the detail functions directly
+class Fixed64ExpLutTest : public ::testing::Test {
+ protected:
+    template <int P>
+    static auto ToReal(int64_t raw) -> long double {
+        return std::ldexp(static_cast<long double>(raw), -P);
+    }
+
+    // Error in ulps, relative to the result above 1 where the ulp is no longer the limit
+    template <int P>
+    static auto Error(int64_t got, long double expected) -> long double {
+        return std::fabs(ToReal<P>(got) - expected) / std::ldexp(1.0L, -P)
+             / std::max(1.0L, std::fabs(expected));
+    }
+
+    struct Errors {
+        long double pow2 = 0;
+        long double exp = 0;
+        long double log = 0;
+        long double pow = 0;
+    };
+
+    template <int P>
+    static auto MaxErrors(uint64_t seed) -> Errors {
+        std::mt19937_64 gen(seed);
+        std::uniform_real_distribution<double> exponent(-10.0, 10.0);
+        std::uniform_real_distribution<double> positive(1.0e-3, 1.0e3);
+        std::uniform_real_distribution<double> base(0.1, 2.0);
+        std::uniform_real_distribution<double> power(-3.0, 3.0);
+        Errors errors;
+        for (int i = 0; i < 20000; ++i) {
+            const int64_t x = Fixed64<P>(exponent(gen)).value();
+            errors.pow2 = std::max(errors.pow2,
+                                   Error<P>(detail::LookupPow2<P>(x), std::exp2(ToReal<P>(x))));
+            errors.exp =
+                std::max(errors.exp, Error<P>(detail::LookupExp<P>(x), std::exp(ToReal<P>(x))));
+
+            const int64_t a = Fixed64<P>(positive(gen)).value();
+            errors.log =
+                std::max(errors.log, Error<P>(detail::LookupLog<P>(a), std::log(ToReal<P>(a))));
+
+            const int64_t b = Fixed64<P>(base(gen)).value();
+            const int64_t y = Fixed64<P>(power(gen)).value();
+            errors.pow = std::max(errors.pow,
+                                  Error<P>(detail::LookupPow<P>(b, y),
+                                           std::pow(ToReal<P>(b), ToReal<P>(y))));
+        }
+        return errors;
+    }
+};
+
+TEST_F(Fixed64ExpLutTest, WithinOneUlp) {
+    const auto check = [](const Errors& errors) {
+        EXPECT_LE(errors.pow2, 1.0L);
+        EXPECT_LE(errors.exp, 1.0L);
+        EXPECT_LE(errors.log, 1.0L);
+        EXPECT_LE(errors.pow, 1.0L);
+    };
+    check(MaxErrors<16>(1));
+    check(MaxErrors<32>(2));
+    check(MaxErrors<40>(3));
+    check(MaxErrors<48>(4));
+}
+
+TEST_F(Fixed64ExpLutTest, MorePreciseThanSeries) {
+    if (FIXED64_MATH_USE_LUT_EXP) {
+        GTEST_SKIP() << "Fixed64Math::Log already uses the tables";
+    }
+    std::mt19937_64 gen(5);
+    std::uniform_real_distribution<double> dist(0.1, 20.0);
+    long double table_error = 0;
+    long double series_error = 0;
+    for (int i = 0; i < 20000; ++i) {
+        const Fixed64_32 x(dist(gen));
+        const long double expected = std::log(ToReal<32>(x.value()));
+        table_error = std::max(table_error, Error<32>(detail::LookupLog<32>(x.value()), expected));
+        series_error = std::max(series_error, Error<32>(Fixed64Math::Log(x).value(), expected));
+    }
+    EXPECT_LT(table_error, series_error);
+}
+
+TEST_F(Fixed64ExpLutTest, ExactValues) {
+    for (int n = -20; n <= 20; ++n) {
+        ASSERT_EQ(detail::LookupPow2<32>(Fixed64_32(n).value()), int64_t(1) << (32 + n)) << n;
+    }
+    for (int n = -16; n <= 16; ++n) {
+        // n * ln(2) rounded once
+        const auto expected = std::llround(std::ldexp(n * 0.693147180559945309417L, 32));
+        ASSERT_EQ(detail::LookupLog<32>(int64_t(1) << (32 + n)), expected) << n;
+    }
+    EXPECT_EQ(detail::LookupExp<32>(0), Fixed64_32::One().value());
+    EXPECT_EQ(detail::LookupLog<32>(Fixed64_32::One().value()), 0);
+    EXPECT_EQ(detail::LookupPow<32>(Fixed64_32(3).value(), Fixed64_32(2).value()),
+              Fixed64_32(9).value());
+}
+
+TEST_F(Fixed64ExpLutTest, SaturatesAndUnderflows) {
+    EXPECT_EQ(detail::LookupPow2<32>(Fixed64_32(31).value()), INT64_MAX);
+    EXPECT_EQ(detail::LookupExp<32>(Fixed64_32(22).value()), INT64_MAX);
+    EXPECT_EQ(detail::LookupExp<32>(INT64_MAX), INT64_MAX);
+    EXPECT_EQ(detail::LookupPow<32>(Fixed64_32(1000).value(), Fixed64_32(10).value()), INT64_MAX);
+
+    EXPECT_EQ(detail::LookupPow2<32>(Fixed64_32(-34).value()), 0);
+    EXPECT_EQ(detail::LookupExp<32>(Fixed64_32(-40).value()), 0);
+    EXPECT_EQ(detail::LookupExp<32>(INT64_MIN + 1), 0);
+    EXPECT_EQ(detail::LookupPow<32>(Fixed64_32(0.001).value(), Fixed64_32(100).value()), 0);
+}
+
+TEST_F(Fixed64ExpLutTest, ConstexprMatchesRuntime) {
+    constexpr int64_t kX = 0x12345678LL;
+    constexpr int64_t kExp = detail::LookupExp<32>(kX);
+    constexpr int64_t kLog = detail::LookupLog<32>(kX);
+    constexpr int64_t kPow = detail::LookupPow<40>(kX, kX);
+    volatile int64_t x = kX;
+    EXPECT_EQ(detail::LookupExp<32>(x), kExp);
+    EXPECT_EQ(detail::LookupLog<32>(x), kLog);
+    EXPECT_EQ(detail::LookupPow<40>(x, x), kPow);
+}
+
+}  // namespace math::fp::tests
@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "fixed64.h"
+#include "fixed64_fft.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64FftTest : public ::testing::Test {
+ protected:
+    __extension__ typedef __int128 int128;
+    using Fixed = Fixed64_32;
+    using Complex = Fixed64Complex<32>;
+
+    static auto RandomValues(size_t count, double scale, uint64_t seed) -> std::vector<Fixed> {
+        std::mt19937_64 gen(seed);
+        std::uniform_real_distribution<double> dist(-scale, scale);
+        std::vector<Fixed> values(count);
+        for (auto& value : values) {
+            value = Fixed(dist(gen));
+        }
+        return values;
+    }
+
+    static auto ToComplex(const Complex& value) -> std::complex<long double> {
+        return {static_cast<long double>(static_cast<double>(value.re)),
+                static_cast<long double>(static_cast<double>(value.im))};
+    }
+
+    // Naive DFT in long double, scaled by 1/N like Fixed64Fft::Forward
+    static auto ReferenceDft(const std::vector<Complex>& x)
+        -> std::vector<std::complex<long double>> {
+        const size_t n = x.size();
+        std::vector<std::complex<long double>> result(n);
+        for (size_t k = 0; k < n; ++k) {
+            std::complex<long double> sum = 0;
+            for (size_t j = 0; j < n; ++j) {
+                const long double angle = -2.0L * 3.14159265358979323846L
+                                        * static_cast<long double>((j * k) % n) / n;
+                sum += ToComplex(x[j]) * std::polar(1.0L, angle);
+            }
+            result[k] = sum / static_cast<long double>(n);
+        }
+        return result;
+    }
+};
+
+TEST_F(Fixed64FftTest, ForwardMatchesReferenceDft) {
+    for (size_t n : {4, 8, 16, 32, 64, 128, 512}) {
+        const auto re = RandomValues(n, 1000.0, n);
+        const auto im = RandomValues(n, 1000.0, n + 1);
+        std::vector<Complex> data(n);
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = {re[i], im[i]};
+        }
+        const auto expected = ReferenceDft(data);
+
+        const Fixed64Fft<32> fft(n);
+        ASSERT_TRUE(fft.Forward(data));
+        for (size_t k = 0; k < n; ++k) {
+            // Twiddle accuracy (about 1e-9) relative to the input magnitude
+            EXPECT_LT(std::abs(ToComplex(data[k]) - expected[k]), 4e-6L) << "n=" << n << " k=" << k;
+        }
+    }
+}
+
+TEST_F(Fixed64FftTest, RoundTrip) {
+    for (size_t n : {4, 32, 2048, 8192}) {
+        const auto re = RandomValues(n, 1.0, 2 * n);
+        const auto im = RandomValues(n, 1.0, 2 * n + 1);
+        std::vector<Complex> data(n);
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = {re[i], im[i]};
+        }
+        const Fixed64Fft<32> fft(n);
+        ASSERT_TRUE(fft.Forward(data));
+        ASSERT_TRUE(fft.Inverse(data));
+        // Twiddle errors of about 5e-10 accumulate over the passes of both transforms
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_NEAR(static_cast<double>(data[i].re), static_cast<double>(re[i]), 5e-8);
+            EXPECT_NEAR(static_cast<double>(data[i].im), static_cast<double>(im[i]), 5e-8);
+        }
+
+        // Real transforms of the real parts
+        std::vector<Complex> bins(n / 2 + 1);
+        std::vector<Fixed> back(n);
+        ASSERT_TRUE(fft.ForwardReal(re, bins));
+        ASSERT_TRUE(fft.InverseReal(bins, back));
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_NEAR(static_cast<double>(back[i]), static_cast<double>(re[i]), 5e-8);
+        }
+    }
+}
+
+TEST_F(Fixed64FftTest, RealMatchesComplex) {
+    for (size_t n : {4, 8, 64, 256}) {
+        const auto x = RandomValues(n, 100.0, 3 * n);
+        std::vector<Complex> data(n);
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = {x[i], Fixed::Zero()};
+        }
+        std::vector<Complex> bins(n / 2 + 1);
+        const Fixed64Fft<32> fft(n);
+        ASSERT_TRUE(fft.Forward(data));
+        ASSERT_TRUE(fft.ForwardReal(x, bins));
+        for (size_t k = 0; k <= n / 2; ++k) {
+            EXPECT_NEAR(static_cast<double>(bins[k].re), static_cast<double>(data[k].re), 1e-7);
+            EXPECT_NEAR(static_cast<double>(bins[k].im), static_cast<double>(data[k].im), 1e-7);
+        }
+    }
+}
+
+TEST_F(Fixed64FftTest, ImpulseIsExact) {
+    // No twiddle is ever applied to a non-zero value, so only the exact 1/N scaling remains
+    const size_t n = 1024;
+    std::vector<Complex> data(n, Complex{Fixed::Zero(), Fixed::Zero()});
+    data[0] = {Fixed(3), Fixed(-5)};
+    const Fixed64Fft<32> fft(n);
+    ASSERT_TRUE(fft.Forward(data));
+    for (const auto& bin : data) {
+        ASSERT_EQ(bin.re, Fixed(3) / Fixed(1024));
+        ASSERT_EQ(bin.im, Fixed(-5) / Fixed(1024));
+    }
+    ASSERT_TRUE(fft.Inverse(data));
+    EXPECT_EQ(data[0].re, Fixed(3));
+    EXPECT_EQ(data[0].im, Fixed(-5));
+    EXPECT_EQ(data[1].re, Fixed::Zero());
+}
+
+TEST_F(Fixed64FftTest, ConvolveMatchesDirectSum) {
+    // A 4096-tap filter over a block of samples, and short sequences at both scales
+    struct Case {
+        size_t signal, taps;
+        double signal_scale, tap_scale;
+    };
+    const Case cases[] = {{4096, 4096, 1.0, 0.01}, {5, 3, 1e6, 1e-6}, {7, 1, 1.0, 1.0}};
+    for (const Case& c : cases) {
+        const auto a = RandomValues(c.signal, c.signal_scale, c.signal);
+        const auto b = RandomValues(c.taps, c.tap_scale, c.taps + 7);
+        Fixed64Fft<32> fft(std::bit_ceil(c.signal + c.taps - 1));
+        std::vector<Fixed> out(c.signal + c.taps - 1);
+        ASSERT_TRUE(fft.Convolve(a, b, out));
+
+        std::vector<int128> exact(out.size(), 0);
+        int128 largest = 1;
+        for (size_t i = 0; i < a.size(); ++i) {
+            for (size_t j = 0; j < b.size(); ++j) {
+                exact[i + j] += int128(a[i].value()) * b[j].value();
+            }
+        }
+        for (const int128 value : exact) {
+            largest = std::max(largest, value < 0 ? -value : value);
+        }
+        const double tolerance = 1e-8 * static_cast<double>(largest >> 32) + 4.0;
+        for (size_t n = 0; n < out.size(); ++n) {
+            const double expected = static_cast<double>(exact[n] >> 32);
+            ASSERT_NEAR(static_cast<double>(out[n].value()), expected, tolerance) << n;
+        }
+    }
+
+    // A delta kernel reproduces the signal up to the twiddle accuracy
+    const auto signal = RandomValues(100, 50.0, 9);
+    const std::vector<Fixed> delta = {Fixed::One()};
+    std::vector<Fixed> out(100);
+    Fixed64Fft<32> fft(128);
+    ASSERT_TRUE(fft.Convolve(signal, delta, out));
+    for (size_t i = 0; i < out.size(); ++i) {
+        EXPECT_NEAR(static_cast<double>(out[i]), static_cast<double>(signal[i]), 1e-7);
+    }
+}
+
+TEST_F(Fixed64FftTest, InvalidSizes) {
+    EXPECT_TRUE(Fixed64Fft<32>(0).empty());
+    EXPECT_TRUE(Fixed64Fft<32>(2).empty());
+    EXPECT_TRUE(Fixed64Fft<32>(96).empty());
+    EXPECT_TRUE(Fixed64Fft<32>(Fixed64Fft<32>::kMaxSize * 2).empty());
+    EXPECT_EQ(Fixed64Fft<32>(64).size(), 64u);
+
+    Fixed64Fft<32> fft(16);
+    std::vector<Complex> data(8);
+    std::vector<Fixed> values(16);
+    EXPECT_FALSE(fft.Forward(data));
+    EXPECT_FALSE(fft.Inverse(data));
+    EXPECT_FALSE(fft.ForwardReal(values, data));
+    EXPECT_FALSE(fft.InverseReal(data, values));
+    EXPECT_FALSE(fft.Convolve(values, values, values));
+    EXPECT_FALSE(fft.Convolve(std::span<const Fixed>(), values, values));
+}
+
+}  // namespace math::fp::tests
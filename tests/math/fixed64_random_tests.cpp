@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <memory>
 #include <numeric>
+#include <span>
 #include <vector>
 
 #include "fixed64_random.h"
@@ -287,4 +289,179 @@ TEST_F(Fixed64RandomTest, DifferentPrecisions) {
         EXPECT_GE(value, Fixed64_40::Zero());
         EXPECT_LT(value, Fixed64_40(10));
     }
-}
\ No newline at end of file
+}
+
+// Test that skip matches drawing the skipped values, for both generators
+TEST_F(Fixed64RandomTest, SkipMatchesSequentialDraws) {
+    for (const uint64_t n : {0ULL, 1ULL, 2ULL, 31ULL, 1000ULL, 4097ULL}) {
+        Fixed64Random drawn(42);
+        Fixed64Random skipped(42);
+        for (uint64_t i = 0; i < n; ++i) {
+            static_cast<void>(drawn.next());
+        }
+        skipped.skip(n);
+        EXPECT_EQ(skipped.getRandomCount(), drawn.getRandomCount());
+        EXPECT_EQ(skipped.next(), drawn.next()) << "n=" << n;
+
+        Fixed64Random counter_drawn = Fixed64Random::CounterBased(42, 7);
+        Fixed64Random counter_skipped = Fixed64Random::CounterBased(42, 7);
+        for (uint64_t i = 0; i < n; ++i) {
+            static_cast<void>(counter_drawn.next());
+        }
+        counter_skipped.skip(n);
+        EXPECT_EQ(counter_skipped.getIndex(), n);
+        EXPECT_EQ(counter_skipped.next(), counter_drawn.next()) << "n=" << n;
+    }
+
+    // Huge jumps are cheap and consistent: skip(a + b) == skip(a), skip(b)
+    Fixed64Random once(7);
+    Fixed64Random twice(7);
+    once.skip(123456789012ULL);
+    twice.skip(123456789000ULL);
+    twice.skip(12);
+    EXPECT_EQ(once.next(), twice.next());
+}
+
+// Test counter-based streams
+TEST_F(Fixed64RandomTest, CounterBasedStreams) {
+    Fixed64Random a = Fixed64Random::CounterBased(2024, 1);
+    Fixed64Random b = Fixed64Random::CounterBased(2024, 1);
+    Fixed64Random other_stream = Fixed64Random::CounterBased(2024, 2);
+    Fixed64Random other_seed = Fixed64Random::CounterBased(2025, 1);
+    EXPECT_TRUE(a.isCounterBased());
+    EXPECT_FALSE(rng->isCounterBased());
+
+    int same_stream = 0;
+    int same_seed = 0;
+    for (int i = 0; i < 1000; ++i) {
+        const int32_t value = a.next();
+        EXPECT_EQ(value, b.next());
+        same_stream += value == other_stream.next();
+        same_seed += value == other_seed.next();
+    }
+    EXPECT_LT(same_stream, 3);
+    EXPECT_LT(same_seed, 3);
+
+    // Values stay in range and are spread over [0, 1)
+    Fixed64Random c = Fixed64Random::CounterBased(0);
+    Fixed64_16 sum = Fixed64_16::Zero();
+    for (int i = 0; i < 4000; ++i) {
+        const auto value = c.random();
+        EXPECT_GE(value, Fixed64_16::Zero());
+        EXPECT_LT(value, Fixed64_16::One());
+        sum += value;
+    }
+    EXPECT_NEAR(static_cast<double>(sum) / 4000, 0.5, 0.03);
+
+    // setSeed returns to the sequential generator
+    c.setSeed(42);
+    EXPECT_FALSE(c.isCounterBased());
+    EXPECT_EQ(c.next(), Fixed64Random(42).next());
+}
+
+// Test that forked streams can be drawn from in any order and replay deterministically
+TEST_F(Fixed64RandomTest, ForkIsDeterministic) {
+    const Fixed64Random root = Fixed64Random::CounterBased(99);
+
+    // Interleaved draws from several entities
+    std::vector<Fixed64Random> entities;
+    for (uint64_t id = 0; id < 4; ++id) {
+        entities.push_back(root.fork(id));
+    }
+    std::vector<std::vector<int32_t>> interleaved(4);
+    for (int i = 0; i < 100; ++i) {
+        for (size_t id = 0; id < 4; ++id) {
+            interleaved[id].push_back(entities[id].next());
+        }
+    }
+
+    // The same entities drawn one after another, and after the root advanced
+    Fixed64Random advanced = root;
+    advanced.skip(12345);
+    for (uint64_t id = 0; id < 4; ++id) {
+        Fixed64Random entity = advanced.fork(id);
+        for (int i = 0; i < 100; ++i) {
+            ASSERT_EQ(entity.next(), interleaved[id][i]) << "entity " << id << " draw " << i;
+        }
+    }
+    EXPECT_NE(interleaved[0], interleaved[1]);
+
+    // Forks of forks are distinct from their parents' other children
+    EXPECT_NE(root.fork(1).fork(0).next(), root.fork(0).next());
+
+    // Sequential generators fork from their current state
+    Fixed64Random sequential(42);
+    EXPECT_EQ(sequential.fork(3).next(), Fixed64Random(42).fork(3).next());
+    EXPECT_TRUE(sequential.fork(3).isCounterBased());
+}
+
+// Test that the generator no longer carries a large engine state
+TEST_F(Fixed64RandomTest, CompactState) {
+    EXPECT_LE(sizeof(Fixed64Random), 32u);
+}
+
+// Test that random() is exactly the former divide by 2^31
+TEST_F(Fixed64RandomTest, UnitShiftMatchesDivide) {
+    const Fixed64_16 divisor = Fixed64_16(INT32_MAX) + Fixed64_16(1);
+    Fixed64Random a(2024);
+    Fixed64Random b(2024);
+    for (int i = 0; i < 10000; ++i) {
+        const int32_t draw = a.next();
+        ASSERT_EQ(b.random(), Fixed64_16(draw & INT32_MAX) / divisor) << i;
+    }
+}
+
+// Test that the bulk generators match the per-value calls, for both generator kinds
+TEST_F(Fixed64RandomTest, FillMatchesSingleDraws) {
+    auto check = [](Fixed64Random a) {
+        Fixed64Random b = a;
+        constexpr size_t kCount = 1003;  // several blocks and a partial vector
+
+        std::vector<Fixed64_32> values(kCount);
+        a.fill<32>(values, Fixed64_32(-2.5), Fixed64_32(7.25));
+        for (size_t i = 0; i < kCount; ++i) {
+            ASSERT_EQ(values[i], b.random(Fixed64_32(-2.5), Fixed64_32(7.25))) << i;
+        }
+
+        std::vector<Fixed64_40> fine(kCount);
+        a.fill<40>(fine, Fixed64_40(1.0 / 3), Fixed64_40(-100));
+        for (size_t i = 0; i < kCount; ++i) {
+            ASSERT_EQ(fine[i], b.random(Fixed64_40(1.0 / 3), Fixed64_40(-100))) << i;
+        }
+
+        std::vector<Fixed64<8>> coarse(kCount);
+        a.fill<8>(coarse, Fixed64<8>(-1000), Fixed64<8>(1000));
+        for (size_t i = 0; i < kCount; ++i) {
+            ASSERT_EQ(coarse[i], b.random(Fixed64<8>(-1000), Fixed64<8>(1000))) << i;
+        }
+
+        std::vector<int32_t> integers(kCount);
+        a.fillIntegers(integers, -50, 75);
+        for (size_t i = 0; i < kCount; ++i) {
+            ASSERT_EQ(integers[i], b.randomInteger(-50, 75)) << i;
+        }
+
+        std::unique_ptr<bool[]> decisions(new bool[kCount]);
+        a.fillBernoulli(std::span<bool>(decisions.get(), kCount), Fixed64_16(0.3));
+        for (size_t i = 0; i < kCount; ++i) {
+            ASSERT_EQ(decisions[i], b.result01(Fixed64_16(0.3))) << i;
+        }
+
+        // Certain outcomes do not consume draws
+        a.fillBernoulli(std::span<bool>(decisions.get(), kCount), Fixed64_16::One());
+        EXPECT_TRUE(std::all_of(decisions.get(), decisions.get() + kCount, [](bool d) {
+            return d;
+        }));
+        a.fillBernoulli(std::span<bool>(decisions.get(), kCount), Fixed64_16::Zero());
+        EXPECT_TRUE(std::none_of(decisions.get(), decisions.get() + kCount, [](bool d) {
+            return d;
+        }));
+
+        EXPECT_EQ(a.getSeed(), b.getSeed());
+        EXPECT_EQ(a.getIndex(), b.getIndex());
+        EXPECT_EQ(a.getRandomCount(), b.getRandomCount());
+        EXPECT_EQ(a.next(), b.next());
+    };
+    check(Fixed64Random(12345));
+    check(Fixed64Random::CounterBased(12345, 6));
+}
@@ -0,0 +1,105 @@
+#include <cstdint>
+#include <random>
+
+#include "fixed64.h"
+#include "fixed64_fuse.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+#if defined(__SIZEOF_INT128__)
+class Fixed64FuseTest : public ::testing::Test {
+ protected:
+    __extension__ typedef __int128 int128;
+
+    // Exact value rounded once to nearest, ties to even
+    static auto RoundShift(int128 value, int shift) -> int64_t {
+        const bool negative = value < 0;
+        const int128 magnitude = negative ? -value : value;
+        const int128 half = int128(1) << (shift - 1);
+        int128 q = magnitude >> shift;
+        const int128 rem = magnitude & ((int128(1) << shift) - 1);
+        if (rem > half || (rem == half && (q & 1))) {
+            ++q;
+        }
+        return static_cast<int64_t>(negative ? -q : q);
+    }
+
+    static auto Random(std::mt19937_64& gen) -> Fixed64_32 {
+        return Fixed64_32(static_cast<int64_t>(gen()) >> (gen() % 16 + 30), detail::nothing{});
+    }
+};
+
+TEST_F(Fixed64FuseTest, RoundsSumOfProductsOnce) {
+    std::mt19937_64 gen(1);
+    for (int i = 0; i < 20000; ++i) {
+        const Fixed64_32 a = Random(gen);
+        const Fixed64_32 b = Random(gen);
+        const Fixed64_32 c = Random(gen);
+        const Fixed64_32 d = Random(gen);
+        const int128 ab = int128(a.value()) * b.value();
+        const int128 cd = int128(c.value()) * d.value();
+        const int128 one = int128(1) << 32;
+
+        ASSERT_EQ(fuse(lazy(a) * b + lazy(c) * d).value(), RoundShift(ab + cd, 32));
+        ASSERT_EQ(fuse(lazy(a) * b - c * lazy(d)).value(), RoundShift(ab - cd, 32));
+        ASSERT_EQ(fuse(-(lazy(a) * b) + lazy(c)).value(), RoundShift(c.value() * one - ab, 32));
+        ASSERT_EQ(fuse(d - lazy(a) * b - c).value(),
+                  RoundShift((int128(d.value()) - c.value()) * one - ab, 32));
+        ASSERT_EQ(fuse(-(lazy(a) * b - lazy(c) * d)).value(), RoundShift(cd - ab, 32));
+    }
+}
+
+TEST_F(Fixed64FuseTest, IntermediatesMayExceedRange) {
+    // Each product is far beyond the Fixed64_32 range, their difference is not
+    const Fixed64_32 big(1 << 20);
+    const Fixed64_32 bigger = big + Fixed64_32::Epsilon();
+    const Fixed64_32 expected = Fixed64_32(1 << 20) * Fixed64_32::Epsilon();
+    EXPECT_EQ(fuse(lazy(big) * bigger - lazy(big) * big), expected);
+
+    EXPECT_EQ(fuse(lazy(big) * big), Fixed64_32::Infinity());
+    EXPECT_EQ(fuse(-(lazy(big) * big)), Fixed64_32::NegInfinity());
+}
+
+TEST_F(Fixed64FuseTest, DividesUnshiftedNumerator) {
+    std::mt19937_64 gen(2);
+    for (int i = 0; i < 20000; ++i) {
+        const Fixed64_32 a = Random(gen);
+        const Fixed64_32 b = Random(gen);
+        const Fixed64_32 c = Random(gen);
+        const Fixed64_32 d = Random(gen);
+        const Fixed64_32 e = Random(gen);
+        if (e == Fixed64_32::Zero()) {
+            continue;
+        }
+        const int128 numerator = int128(a.value()) * b.value() + int128(c.value()) * d.value();
+        const int128 quotient = numerator / e.value();  // Truncates toward zero
+        const Fixed64_32 fused = fuse((lazy(a) * b + lazy(c) * d) / e);
+        if (quotient > INT64_MAX) {
+            ASSERT_EQ(fused, Fixed64_32::Infinity());
+        } else if (quotient < -INT64_MAX) {
+            ASSERT_EQ(fused, Fixed64_32::NegInfinity());
+        } else {
+            ASSERT_EQ(fused.value(), static_cast<int64_t>(quotient));
+        }
+    }
+
+    // Rounding the numerator first loses the low bits that the quotient keeps
+    const Fixed64_32 tiny = Fixed64_32::Epsilon();
+    const Fixed64_32 half(0.5);
+    EXPECT_EQ(fuse(lazy(tiny) * half) / half, Fixed64_32::Zero());
+    EXPECT_EQ(fuse((lazy(tiny) * half) / half), tiny);
+    EXPECT_EQ(fuse((lazy(tiny) * tiny) / lazy(tiny)), tiny);
+
+    EXPECT_EQ(fuse((lazy(tiny) * tiny) / Fixed64_32::Zero()), Fixed64_32::Infinity());
+    EXPECT_EQ(fuse((-(lazy(tiny) * tiny)) / Fixed64_32::Zero()), Fixed64_32::NegInfinity());
+}
+
+TEST_F(Fixed64FuseTest, ConstantEvaluated) {
+    static_assert(fuse(lazy(Fixed64_32(1.5)) * Fixed64_32(4) - Fixed64_32(2)) == Fixed64_32(4));
+    static_assert(fuse((lazy(Fixed64_32(3)) * Fixed64_32(3) + Fixed64_32(1)) / Fixed64_32(4))
+                  == Fixed64_32(2.5));
+}
+#endif
+
+}  // namespace math::fp::tests
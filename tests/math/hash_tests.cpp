@@ -0,0 +1,119 @@
+#include <cstdint>
+#include <vector>
+
+#include "fixed64.h"
+#include "fixed64_hash.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64HashTest : public ::testing::Test {
+ protected:
+    // Raw words with every bit pattern class: small, negative, large and sentinels
+    static auto MakeState(size_t count) -> std::vector<Fixed64_32> {
+        std::vector<Fixed64_32> state;
+        uint64_t x = 0x243F6A8885A308D3;
+        for (size_t i = 0; i < count; ++i) {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            state.emplace_back(static_cast<int64_t>(x) >> (i % 64), detail::nothing{});
+        }
+        return state;
+    }
+
+    static auto Hash(const std::vector<Fixed64_32>& state, uint64_t seed = 0) -> uint64_t {
+        return Fixed64Hash::Span<32>(state, seed);
+    }
+};
+
+// Pinned values: the hash must not change between builds, instruction sets or releases
+TEST_F(Fixed64HashTest, MatchesPinnedValues) {
+    EXPECT_EQ(Hash({}), 0x77CC4799B3EC8F1Fu);
+    EXPECT_EQ(Hash(MakeState(1)), 0x8154832C37C614D1u);
+    EXPECT_EQ(Hash(MakeState(1000)), 0x44C59DBB8E73CDCBu);
+    EXPECT_EQ(Hash(MakeState(1000), 42), 0xF772F73ED2611D4Bu);
+    const auto wide = Fixed64Hash::Span128<32>(MakeState(1000));
+    EXPECT_EQ(wide.low, 0xA74192CDDF19CE9Bu);
+    EXPECT_EQ(wide.high, 0xB2DBE2E3EF217EFCu);
+}
+
+TEST_F(Fixed64HashTest, DetectsEveryBitFlip) {
+    // Covers the batch stripes, the scramble after 256 words and the padded tail
+    auto state = MakeState(300);
+    const uint64_t reference = Hash(state);
+    for (size_t i = 0; i < state.size(); i += 7) {
+        for (int bit = 0; bit < 64; bit += 9) {
+            const int64_t raw = state[i].value();
+            state[i] = Fixed64_32(raw ^ (int64_t(1) << bit), detail::nothing{});
+            EXPECT_NE(Hash(state), reference) << "word " << i << " bit " << bit;
+            state[i] = Fixed64_32(raw, detail::nothing{});
+        }
+    }
+    EXPECT_EQ(Hash(state), reference);
+}
+
+TEST_F(Fixed64HashTest, DependsOnLengthOrderAndSeed) {
+    const std::vector<Fixed64_32> one = {Fixed64_32(1)};
+    const std::vector<Fixed64_32> padded = {Fixed64_32(1), Fixed64_32(0)};
+    const std::vector<Fixed64_32> swapped = {Fixed64_32(0), Fixed64_32(1)};
+    EXPECT_NE(Hash(one), Hash(padded));
+    EXPECT_NE(Hash(padded), Hash(swapped));
+    EXPECT_NE(Hash({}), Hash({Fixed64_32(0)}));
+    EXPECT_NE(Hash(one), Hash(one, 1));
+
+    const auto wide = Fixed64Hash::Span128<32>(one);
+    EXPECT_NE(wide.low, wide.high);
+    EXPECT_NE(wide.low, Hash(one));
+    EXPECT_EQ(Fixed64Hash::Span128<32>(one), wide);
+}
+
+TEST_F(Fixed64HashTest, HashesSentinelsByRawWord) {
+    const std::vector<Fixed64_32> nan = {Fixed64_32::NaN(), Fixed64_32(2)};
+    const std::vector<Fixed64_32> inf = {Fixed64_32::Infinity(), Fixed64_32(2)};
+    const std::vector<Fixed64_32> neg_inf = {Fixed64_32::NegInfinity(), Fixed64_32(2)};
+    EXPECT_EQ(Hash(nan), Hash({Fixed64_32::NaN(), Fixed64_32(2)}));
+    EXPECT_NE(Hash(nan), Hash(inf));
+    EXPECT_NE(Hash(inf), Hash(neg_inf));
+    EXPECT_NE(Hash(nan), Hash({Fixed64_32::Zero(), Fixed64_32(2)}));
+
+    // Same raw words at another precision give the same hash
+    const std::vector<Fixed64_16> nan16 = {Fixed64_16::NaN(),
+                                           Fixed64_16(int64_t(2) << 32, detail::nothing{})};
+    EXPECT_EQ(Fixed64Hash::Span<16>(nan16), Hash(nan));
+}
+
+TEST_F(Fixed64HashTest, ChunkedUpdateMatchesFullRehash) {
+    auto state = MakeState(5000);
+    Fixed64ChunkedHash incremental(256, 7);
+    const uint64_t initial = incremental.Assign<32>(state);
+    EXPECT_EQ(incremental.Chunks().size(), 20u);
+    EXPECT_EQ(incremental.size(), 5000u);
+
+    // Change values in chunks 3 and 4 only
+    const std::vector<uint64_t> before(incremental.Chunks().begin(), incremental.Chunks().end());
+    for (size_t i = 1000; i < 1030; ++i) {
+        state[i] = -state[i];
+    }
+    const uint64_t updated = incremental.Update<32>(state, 1000, 30);
+    EXPECT_NE(updated, initial);
+    for (size_t c = 0; c < before.size(); ++c) {
+        EXPECT_EQ(incremental.Chunks()[c] != before[c], c == 3 || c == 4) << "chunk " << c;
+    }
+
+    Fixed64ChunkedHash full(256, 7);
+    EXPECT_EQ(full.Assign<32>(state), updated);
+
+    // Growing and shrinking rehash the chunks past the old end
+    state.resize(5300, Fixed64_32(3));
+    EXPECT_EQ(incremental.Update<32>(state, 0, 0), full.Assign<32>(state));
+    state.resize(700);
+    EXPECT_EQ(incremental.Update<32>(state, 0, 0), full.Assign<32>(state));
+    EXPECT_EQ(incremental.Chunks().size(), 3u);
+
+    // Out-of-range updates are clamped
+    EXPECT_EQ(incremental.Update<32>(state, 650, 1000), full.Digest());
+    EXPECT_EQ(incremental.Update<32>(state, 9000, 5), full.Digest());
+}
+
+}  // namespace math::fp::tests
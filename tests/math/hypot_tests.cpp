@@ -0,0 +1,169 @@
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "fixed64.h"
+#include "fixed64_linalg.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64HypotTest : public ::testing::Test {
+ protected:
+    using Fixed = Fixed64<32>;
+
+    static auto FromRaw(int64_t raw) -> Fixed {
+        return Fixed(raw, detail::nothing{});
+    }
+
+#if defined(__SIZEOF_INT128__)
+    // Correctly rounded integer root of x² + y² + z² on the raw values
+    static auto ReferenceRaw(int64_t x, int64_t y, int64_t z = 0) -> int64_t {
+        using U128 = unsigned __int128;
+        auto square = [](int64_t v) {
+            const U128 m = v < 0 ? U128(0) - U128(v) : U128(v);
+            return m * m;
+        };
+        const U128 n = square(x) + square(y) + square(z);
+        // Floor root corrected from the long double estimate
+        auto root = static_cast<uint64_t>(std::sqrt(static_cast<long double>(n)));
+        while (U128(root) * root > n) {
+            --root;
+        }
+        while (U128(root + 1) * (root + 1) <= n) {
+            ++root;
+        }
+        // Round up when n > root² + root, i.e. n >= (root + 1/2)²
+        if (n > U128(root) * root + root) {
+            ++root;
+        }
+        return root > uint64_t(INT64_MAX) ? INT64_MAX : static_cast<int64_t>(root);
+    }
+#endif
+};
+
+static_assert(Fixed64Math::Hypot(Fixed64_32(3), Fixed64_32(4)) == Fixed64_32(5));
+static_assert(Fixed64Math::Hypot3(Fixed64_32(2), Fixed64_32(3), Fixed64_32(6)) == Fixed64_32(7));
+static_assert(Primitives::SqrtU128(0, 16) == 4);
+static_assert(Primitives::SqrtU128(1, 0) == uint64_t(1) << 32);
+
+TEST_F(Fixed64HypotTest, ExactAndLargeValues) {
+    EXPECT_EQ(Fixed64Math::Hypot(Fixed(-3), Fixed(4)), Fixed(5));
+    EXPECT_EQ(Fixed64Math::Hypot(Fixed::Zero(), Fixed::Zero()), Fixed::Zero());
+    EXPECT_EQ(Fixed64Math::Hypot(Fixed(-7.5), Fixed::Zero()), Fixed(7.5));
+
+    // Beyond sqrt(Max()) the squares no longer fit, but the length does
+    EXPECT_EQ(Fixed64Math::Hypot(Fixed(300000), Fixed(400000)), Fixed(500000));
+    EXPECT_EQ(Fixed64Math::Hypot3(Fixed(200000), Fixed(300000), Fixed(600000)), Fixed(700000));
+    const Fixed big = Fixed::Max() / 2;
+    EXPECT_EQ(Fixed64Math::Hypot(big, Fixed::Zero()), big);
+    EXPECT_NEAR(static_cast<double>(Fixed64Math::Hypot(big, big)),
+                static_cast<double>(big) * std::sqrt(2.0), 1.0);
+}
+
+TEST_F(Fixed64HypotTest, SaturatesAndPropagatesNaN) {
+    EXPECT_EQ(Fixed64Math::Hypot(Fixed::Max(), Fixed::Max()), Fixed::Infinity());
+    EXPECT_EQ(Fixed64Math::Hypot(Fixed::Max(), Fixed::Zero()), Fixed::Max());
+    EXPECT_EQ(Fixed64Math::Hypot(Fixed::NegInfinity(), Fixed(1)), Fixed::Infinity());
+    EXPECT_EQ(Fixed64Math::Hypot(Fixed::NaN(), Fixed(1)), Fixed::NaN());
+    EXPECT_EQ(Fixed64Math::Hypot3(Fixed(1), Fixed(1), Fixed::NaN()), Fixed::NaN());
+    EXPECT_EQ(Fixed64Math::Distance(Fixed::Zero(), Fixed::NaN(), Fixed(1), Fixed(1)), Fixed::NaN());
+
+    // Points at opposite ends of the range: the difference does not wrap
+    EXPECT_EQ(Fixed64Math::Distance(Fixed::NegInfinity(), Fixed::Zero(), Fixed::Max(),
+                                    Fixed::Zero()),
+              Fixed::Infinity());
+    EXPECT_EQ(Fixed64Math::Distance(Fixed(-100000), Fixed::Zero(), Fixed::Zero(), Fixed::Zero(),
+                                    Fixed(100000), Fixed::Zero()),
+              Fixed64Math::Hypot(Fixed(100000), Fixed(100000)));
+}
+
+#if defined(__SIZEOF_INT128__)
+TEST_F(Fixed64HypotTest, CorrectlyRoundedOnRandomValues) {
+    std::mt19937_64 gen(37);
+    for (int i = 0; i < 20000; ++i) {
+        // Magnitudes from a few ulp to the full range
+        const int shift = static_cast<int>(gen() % 63);
+        const auto x = static_cast<int64_t>(gen()) >> shift;
+        const auto y = static_cast<int64_t>(gen()) >> (gen() % 63);
+        const auto z = static_cast<int64_t>(gen()) >> (gen() % 63);
+        if (x == INT64_MIN || y == INT64_MIN || z == INT64_MIN) {
+            continue;
+        }
+        ASSERT_EQ(Fixed64Math::Hypot(FromRaw(x), FromRaw(y)).value(), ReferenceRaw(x, y))
+            << x << " " << y;
+        ASSERT_EQ(Fixed64Math::Hypot3(FromRaw(x), FromRaw(y), FromRaw(z)).value(),
+                  ReferenceRaw(x, y, z))
+            << x << " " << y << " " << z;
+    }
+}
+#endif
+
+TEST_F(Fixed64HypotTest, ExactSquaredDistancesCompare) {
+    // The squared distances differ by 2^-64, far below the resolution of Fixed64<32>
+    const Fixed origin = Fixed::Zero();
+    const Fixed a = FromRaw(int64_t(3) << 40);
+    const Fixed b = FromRaw((int64_t(3) << 40) + 1);
+    const auto near = Fixed64Math::DistanceSquared128(origin, origin, a, origin);
+    const auto far = Fixed64Math::DistanceSquared128(origin, origin, b, origin);
+    EXPECT_LT(near, far);
+    EXPECT_EQ(near, Fixed64Math::DistanceSquared128(a, origin, origin, origin));
+    EXPECT_NE(near, far);
+
+    // Far beyond Max() when rounded, still ordered exactly
+    const auto huge = Fixed64Math::DistanceSquared128(Fixed(-1000000), Fixed(-1000000),
+                                                      Fixed(1000000), Fixed(1000000));
+    const auto huger = Fixed64Math::DistanceSquared128(Fixed(-1000000), Fixed(-1000000),
+                                                       Fixed(1000000), Fixed(1000001));
+    EXPECT_LT(huge, huger);
+    EXPECT_EQ(huge.Result(), Fixed::Infinity());
+
+    const auto d3 = Fixed64Math::DistanceSquared128(Fixed(1), Fixed(2), Fixed(3), Fixed(3),
+                                                    Fixed(5), Fixed(9));
+    EXPECT_EQ(d3.Result(), Fixed(49));
+    EXPECT_GT(d3, Fixed64Math::DistanceSquared128(Fixed(1), Fixed(2), Fixed(3), Fixed(3),
+                                                  Fixed(4), Fixed(-2)));
+}
+
+TEST_F(Fixed64HypotTest, BatchMatchesScalar) {
+    std::mt19937_64 gen(7);
+    constexpr size_t kCount = 1001;
+    std::vector<Fixed> ax(kCount), ay(kCount), bx(kCount), by(kCount);
+    for (size_t i = 0; i < kCount; ++i) {
+        ax[i] = FromRaw(static_cast<int64_t>(gen()) >> (gen() % 32 + 1));
+        ay[i] = FromRaw(static_cast<int64_t>(gen()) >> (gen() % 32 + 1));
+        bx[i] = FromRaw(static_cast<int64_t>(gen()) >> (gen() % 32 + 1));
+        by[i] = FromRaw(static_cast<int64_t>(gen()) >> (gen() % 32 + 1));
+    }
+    std::vector<Fixed> out(kCount);
+    Fixed64Math::HypotBatch<32>(ax, ay, out);
+    for (size_t i = 0; i < kCount; ++i) {
+        ASSERT_EQ(out[i], Fixed64Math::Hypot(ax[i], ay[i])) << i;
+    }
+    Fixed64Math::Hypot3Batch<32>(ax, ay, bx, out);
+    for (size_t i = 0; i < kCount; ++i) {
+        ASSERT_EQ(out[i], Fixed64Math::Hypot3(ax[i], ay[i], bx[i])) << i;
+    }
+    Fixed64Math::DistanceBatch<32>(ax, ay, bx, by, out);
+    for (size_t i = 0; i < kCount; ++i) {
+        ASSERT_EQ(out[i], Fixed64Math::Distance(ax[i], ay[i], bx[i], by[i])) << i;
+    }
+
+    // The shortest span sets the count
+    std::vector<Fixed> short_out(3, Fixed(-1));
+    Fixed64Math::HypotBatch<32>(std::span<const Fixed>(ax).first(2), ay, short_out);
+    EXPECT_EQ(short_out[1], Fixed64Math::Hypot(ax[1], ay[1]));
+    EXPECT_EQ(short_out[2], Fixed(-1));
+}
+
+TEST_F(Fixed64HypotTest, VectorLengthsDoNotOverflow) {
+    EXPECT_EQ((Vec2<32>{Fixed(300000), Fixed(-400000)}.Length()), Fixed(500000));
+    EXPECT_EQ((Vec3<32>{Fixed(2), Fixed(-3), Fixed(6)}.Length()), Fixed(7));
+    EXPECT_EQ((Vec4<32>{Fixed(100000), Fixed(100000), Fixed(100000), Fixed(100000)}.Length()),
+              Fixed(200000));
+    EXPECT_EQ((Vec4<32>{Fixed::NaN(), Fixed(1), Fixed(1), Fixed(1)}.Length()), Fixed::NaN());
+}
+
+}  // namespace math::fp::tests
@@ -0,0 +1,153 @@
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+#include "fixed64.h"
+#include "fixed64_linalg.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64LinalgTest : public ::testing::Test {
+ protected:
+    using Fixed = Fixed64<32>;
+    using V3 = Vec3<32>;
+
+    static constexpr double kEpsilon = static_cast<double>(Fixed::Epsilon());
+
+    static auto RandomVec3(std::mt19937_64& gen) -> V3 {
+        std::uniform_real_distribution<double> dist(-100.0, 100.0);
+        return {Fixed(dist(gen)), Fixed(dist(gen)), Fixed(dist(gen))};
+    }
+
+    static auto ToDouble(Fixed f) -> double {
+        return static_cast<double>(f);
+    }
+
+    static auto ExpectNear(const V3& actual, const V3& expected, double tolerance) -> void {
+        EXPECT_NEAR(ToDouble(actual.x), ToDouble(expected.x), tolerance);
+        EXPECT_NEAR(ToDouble(actual.y), ToDouble(expected.y), tolerance);
+        EXPECT_NEAR(ToDouble(actual.z), ToDouble(expected.z), tolerance);
+    }
+
+    // Exact sum of products, rounded once to nearest (ties to even) with native 128-bit math
+    static auto ReferenceDot(const V3& a, const V3& b) -> int64_t {
+        __extension__ typedef __int128 int128;
+        const int128 sum = int128(a.x.value()) * b.x.value() + int128(a.y.value()) * b.y.value()
+                           + int128(a.z.value()) * b.z.value();
+        const bool negative = sum < 0;
+        const int128 magnitude = negative ? -sum : sum;
+        int128 q = magnitude >> 32;
+        const int128 rem = magnitude & 0xFFFFFFFF;
+        if (rem > 0x80000000 || (rem == 0x80000000 && (q & 1))) {
+            ++q;
+        }
+        return static_cast<int64_t>(negative ? -q : q);
+    }
+};
+
+TEST_F(Fixed64LinalgTest, LayoutIsRegisterAligned) {
+    static_assert(alignof(Vec2<32>) == 16 && sizeof(Vec2<32>) == 16);
+    static_assert(alignof(Vec3<32>) == 32 && sizeof(Vec3<32>) == 32);
+    static_assert(alignof(Vec4<32>) == 32 && sizeof(Vec4<32>) == 32);
+    static_assert(alignof(Quat<32>) == 32 && sizeof(Quat<32>) == 32);
+    static_assert(sizeof(Mat3<32>) == 3 * sizeof(Vec3<32>));
+    static_assert(sizeof(Mat4<32>) == 4 * sizeof(Vec4<32>));
+}
+
+#if defined(__SIZEOF_INT128__)
+TEST_F(Fixed64LinalgTest, DotRoundsOnce) {
+    std::mt19937_64 gen(1);
+    for (int i = 0; i < 10000; ++i) {
+        const V3 a = RandomVec3(gen);
+        const V3 b = RandomVec3(gen);
+        ASSERT_EQ(V3::Dot(a, b).value(), ReferenceDot(a, b));
+    }
+}
+#endif
+
+TEST_F(Fixed64LinalgTest, DotAndCross) {
+    const V3 a{Fixed(1), Fixed(2), Fixed(3)};
+    const V3 b{Fixed(-4), Fixed(5), Fixed(0.5)};
+    EXPECT_EQ(V3::Dot(a, b), Fixed(7.5));
+    EXPECT_EQ(V3::Cross(a, b), (V3{Fixed(-14), Fixed(-12.5), Fixed(13)}));
+    EXPECT_EQ(V3::Dot(V3::Cross(a, b), a), Fixed::Zero());
+
+    const Vec2<32> p{Fixed(3), Fixed(-4)};
+    EXPECT_EQ(Vec2<32>::Dot(p, p), Fixed(25));
+    EXPECT_EQ(Vec2<32>::Cross(p, Vec2<32>{Fixed(1), Fixed(2)}), Fixed(10));
+
+    const Vec4<32> q{Fixed(1), Fixed(-1), Fixed(2), Fixed(0.25)};
+    EXPECT_EQ(Vec4<32>::Dot(q, q), Fixed(6.0625));
+}
+
+TEST_F(Fixed64LinalgTest, LengthAndNormalize) {
+    const V3 v{Fixed(2), Fixed(3), Fixed(6)};
+    EXPECT_EQ(v.LengthSquared(), Fixed(49));
+    EXPECT_NEAR(ToDouble(v.Length()), 7.0, kEpsilon);
+
+    std::mt19937_64 gen(2);
+    for (int i = 0; i < 1000; ++i) {
+        const V3 n = RandomVec3(gen).Normalized();
+        EXPECT_NEAR(ToDouble(n.LengthSquared()), 1.0, 1e-8);
+    }
+
+    EXPECT_EQ(V3::Zero().Normalized(), V3::Zero());
+    EXPECT_NEAR(ToDouble(Vec2<32>{Fixed(3), Fixed(4)}.Normalized().x), 0.6, 1e-9);
+}
+
+TEST_F(Fixed64LinalgTest, MatrixVectorProducts) {
+    const Mat3<32> m{{{{Fixed(1), Fixed(2), Fixed(3)},
+                       {Fixed(0), Fixed(1), Fixed(4)},
+                       {Fixed(5), Fixed(6), Fixed(0)}}}};
+    const V3 v{Fixed(1), Fixed(-1), Fixed(2)};
+    EXPECT_EQ(m * v, (V3{Fixed(5), Fixed(7), Fixed(-1)}));
+    EXPECT_EQ(Mat3<32>::Identity() * v, v);
+    EXPECT_EQ(m * Mat3<32>::Identity(), m);
+    EXPECT_EQ(m.Transposed().Transposed(), m);
+    EXPECT_EQ(m.Transposed() * v, (V3{Fixed(11), Fixed(13), Fixed(-1)}));
+    EXPECT_EQ((m * m) * v, m * (m * v));
+
+    Mat4<32> t = Mat4<32>::Identity();
+    t.rows[0].w = Fixed(10);
+    t.rows[1].w = Fixed(-2);
+    EXPECT_EQ(t.TransformPoint(v), (V3{Fixed(11), Fixed(-3), Fixed(2)}));
+    EXPECT_EQ(t.TransformVector(v), v);
+    EXPECT_EQ(t * Mat4<32>::Identity(), t);
+    EXPECT_EQ((t * t).TransformPoint(V3::Zero()), (V3{Fixed(20), Fixed(-4), Fixed(0)}));
+}
+
+TEST_F(Fixed64LinalgTest, QuaternionRotation) {
+    using Q = Quat<32>;
+    constexpr V3 z_axis{Fixed(0), Fixed(0), Fixed(1)};
+    constexpr Q quarter = Q::FromAxisAngle(z_axis, Fixed::HalfPi());  // Built at compile time
+
+    // A quarter turn around z maps x onto y
+    ExpectNear(quarter.Rotate(V3{Fixed(1), Fixed(0), Fixed(0)}), V3{Fixed(0), Fixed(1), Fixed(0)},
+               1e-8);
+
+    // Composition, conjugation and the matrix form agree with rotating directly
+    std::mt19937_64 gen(3);
+    for (int i = 0; i < 200; ++i) {
+        const V3 axis = RandomVec3(gen).Normalized();
+        const Fixed angle(std::uniform_real_distribution<double>(-3.0, 3.0)(gen));
+        const Q a = Q::FromAxisAngle(axis, angle);
+        const Q b = Q::FromAxisAngle(RandomVec3(gen).Normalized(), Fixed(0.75));
+        const V3 v = RandomVec3(gen);
+
+        const V3 composed = (a * b).Rotate(v);
+        const V3 sequential = a.Rotate(b.Rotate(v));
+        const V3 by_matrix = a.ToMat3() * v;
+        const V3 back = a.Conjugate().Rotate(a.Rotate(v));
+        ExpectNear(composed, sequential, 1e-6);
+        ExpectNear(by_matrix, a.Rotate(v), 1e-6);
+        ExpectNear(back, v, 1e-6);
+        EXPECT_NEAR(ToDouble(Q::Dot(a, a)), 1.0, 1e-8);
+    }
+
+    EXPECT_EQ(Q::Identity() * quarter, quarter);
+    EXPECT_NEAR(ToDouble(Q::Dot((quarter * quarter).Normalized(), quarter * quarter)), 1.0, 1e-8);
+}
+
+}  // namespace math::fp::tests
@@ -0,0 +1,85 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+#include "detail/lut_format.h"
+#include "detail/sin_lut.h"
+#include "fixed64.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+// Formats below Q31.32 convert to the tables with a fixed shift, or an exact reduction first
+// when the shift would overflow
+class Fixed64LowPrecisionTrigTest : public ::testing::Test {
+ protected:
+    template <int P>
+    static auto ToReal(Fixed64<P> x) -> long double {
+        return std::ldexp(static_cast<long double>(x.value()), -P);
+    }
+
+    // Largest error of each function against long double over random arguments, in ulps
+    template <int P>
+    static auto MaxError(uint64_t seed, double range) -> long double {
+        std::mt19937_64 gen(seed);
+        std::uniform_real_distribution<double> angle(-range, range);
+        std::uniform_real_distribution<double> unit(-1.0, 1.0);
+        long double error = 0;
+        for (int i = 0; i < 20000; ++i) {
+            const Fixed64<P> x(angle(gen));
+            const long double xr = ToReal(x);
+            error = std::max(error, std::fabs(ToReal(Fixed64Math::Sin(x)) - std::sin(xr)));
+            error = std::max(error, std::fabs(ToReal(Fixed64Math::Cos(x)) - std::cos(xr)));
+            error = std::max(error, std::fabs(ToReal(Fixed64Math::Atan(x)) - std::atan(xr)));
+
+            const Fixed64<P> a(unit(gen));
+            error = std::max(error, std::fabs(ToReal(Fixed64Math::Acos(a)) - std::acos(ToReal(a))));
+            error = std::max(error, std::fabs(ToReal(Fixed64Math::Asin(a)) - std::asin(ToReal(a))));
+        }
+        return std::ldexp(error, P);
+    }
+};
+
+TEST_F(Fixed64LowPrecisionTrigTest, WithinTwoUlps) {
+    // The Q31.32 result is truncated to P bits, close to 1 ulp from the tables and less
+    // than 1 ulp from the truncated input
+    EXPECT_LE(MaxError<16>(1, 100.0), 2.0L);
+    EXPECT_LE(MaxError<8>(2, 1.0e5), 2.0L);
+
+    EXPECT_EQ(Fixed64Math::Sin(Fixed64_16::Zero()), Fixed64_16::Zero());
+    EXPECT_EQ(Fixed64Math::Cos(Fixed64_16::Zero()), Fixed64_16::One());
+    EXPECT_EQ(Fixed64Math::Atan2(Fixed64_16(1), Fixed64_16::Zero()), Fixed64_16::HalfPi());
+    EXPECT_NEAR(ToReal(Fixed64Math::Tan(Fixed64_16(0.5))), std::tan(0.5L), 0x1p-15L);
+    EXPECT_NEAR(ToReal(Fixed64Math::Atan(Fixed64_16::Max())), 1.5707963267948966L, 0x1p-15L);
+}
+
+TEST_F(Fixed64LowPrecisionTrigTest, LargeAnglesReduceExactly) {
+    // The converted angle has the remainder of the exact Q31.32 angle
+    __extension__ typedef __int128 int128;
+    constexpr int64_t kTwoPi = 0x00000006487ED511LL;
+    const auto reduce16 = [](int64_t x) { return detail::ToLutAngle<16, kTwoPi>(x) % kTwoPi; };
+    const auto reduce3 = [](int64_t x) { return detail::ToLutAngle<3, kTwoPi>(x) % kTwoPi; };
+    std::mt19937_64 gen(4);
+    for (int i = 0; i < 20000; ++i) {
+        const int64_t x = static_cast<int64_t>(gen());
+        ASSERT_EQ(reduce16(x), static_cast<int64_t>((static_cast<int128>(x) << 16) % kTwoPi)) << x;
+        ASSERT_EQ(reduce3(x), static_cast<int64_t>((static_cast<int128>(x) << 29) % kTwoPi)) << x;
+    }
+
+    // 2^40 radians, beyond the Q31.32 range, gives the table value of the exact Q31.32 angle
+    const int64_t far = int64_t(1) << 56;
+    const auto reduced = static_cast<int64_t>((static_cast<int128>(far) << 16) % kTwoPi);
+    EXPECT_EQ(detail::LookupSin<16>(far), detail::LookupSin<32>(reduced) >> 16);
+}
+
+TEST_F(Fixed64LowPrecisionTrigTest, ConstexprLookups) {
+    constexpr int64_t kSin = detail::LookupSin<16>(Fixed64_16::HalfPi().value());
+    static_assert(kSin == Fixed64_16::One().value());
+    static_assert(detail::ToLutFormat<16>(1) == int64_t(1) << 16);
+    static_assert(detail::FromLutFormat<40>(1) == int64_t(1) << 8);
+    static_assert(detail::ToLutSaturated<16>(INT64_MAX) == (INT64_MAX >> 16) << 16);
+}
+
+}  // namespace math::fp::tests
@@ -0,0 +1,46 @@
+#include <cstdint>
+
+#include "fixed64.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64LutPrefetchTest : public ::testing::Test {
+ protected:
+    template <typename Table>
+    static auto IsLineAligned(const Table& table) -> bool {
+        return reinterpret_cast<uintptr_t>(table.data()) % detail::kLutCacheLine == 0;
+    }
+};
+
+TEST_F(Fixed64LutPrefetchTest, TablesAreLineAligned) {
+    EXPECT_TRUE(IsLineAligned(detail::kSinLut));
+    EXPECT_TRUE(IsLineAligned(detail::kTanLut));
+    EXPECT_TRUE(IsLineAligned(detail::kAtanLut));
+    EXPECT_TRUE(IsLineAligned(detail::kAtan2LUT));
+    EXPECT_TRUE(IsLineAligned(detail::AcosLut));
+    EXPECT_TRUE(IsLineAligned(detail::AcosDyDxLut));
+    EXPECT_TRUE(IsLineAligned(detail::kExp2Lut));
+    EXPECT_TRUE(IsLineAligned(detail::kLog2InvLut));
+    EXPECT_TRUE(IsLineAligned(detail::kLog2Lut));
+}
+
+TEST_F(Fixed64LutPrefetchTest, LeavesResultsUnchanged) {
+    const Fixed64_32 x(0.75);
+    const Fixed64_32 sin = Fixed64Math::Sin(x);
+    const Fixed64_32 acos = Fixed64Math::Acos(x);
+    const Fixed64_32 atan2 = Fixed64Math::Atan2(x, Fixed64_32(2));
+
+    Fixed64Math::PrefetchTables();
+    Fixed64Math::WarmTables();
+    Fixed64Math::PrefetchTables(Fixed64Math::kSinTable | Fixed64Math::kAtan2Table);
+    Fixed64Math::WarmTables(Fixed64Math::kAcosTable);
+    Fixed64Math::PrefetchTables(0);
+
+    EXPECT_EQ(Fixed64Math::Sin(x), sin);
+    EXPECT_EQ(Fixed64Math::Acos(x), acos);
+    EXPECT_EQ(Fixed64Math::Atan2(x, Fixed64_32(2)), atan2);
+}
+
+}  // namespace math::fp::tests
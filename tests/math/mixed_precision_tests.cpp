@@ -0,0 +1,84 @@
+#include <cstdint>
+#include <random>
+
+#include "fixed64.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64MixedPrecisionTest : public ::testing::Test {
+ protected:
+    __extension__ typedef __int128 int128;
+
+    // Quotient of the exact values, truncated toward zero
+    static auto TruncatedShift(int128 value, int shift) -> int128 {
+        const int128 magnitude = (value < 0 ? -value : value) >> shift;
+        return value < 0 ? -magnitude : magnitude;
+    }
+
+    template <int S, int Q, int R>
+    static auto CheckAgainstReference(uint64_t seed) -> void {
+        std::mt19937_64 gen(seed);
+        for (int i = 0; i < 20000; ++i) {
+            // Magnitudes that keep every product and quotient in range
+            const Fixed64<Q> a(static_cast<int64_t>(gen()) >> (gen() % 32 + 32), detail::nothing{});
+            const Fixed64<R> b(static_cast<int64_t>(gen()) >> (gen() % 32 + 32), detail::nothing{});
+
+            const int128 product = int128(a.value()) * b.value();
+            ASSERT_EQ(Fixed64Math::Mul<S>(a, b).value(), TruncatedShift(product, Q + R - S))
+                << a.value() << " * " << b.value();
+
+            if (b.value() != 0) {
+                const int128 dividend = int128(a.value()) << (S + R - Q);
+                const int128 quotient = dividend / b.value();  // Truncates toward zero
+                if (quotient >= -INT64_MAX && quotient <= INT64_MAX) {
+                    ASSERT_EQ(Fixed64Math::Div<S>(a, b).value(), quotient)
+                        << a.value() << " / " << b.value();
+                }
+            }
+        }
+    }
+};
+
+TEST_F(Fixed64MixedPrecisionTest, MatchesWideReference) {
+    CheckAgainstReference<16, 16, 32>(1);
+    CheckAgainstReference<32, 16, 32>(2);
+    CheckAgainstReference<16, 32, 16>(3);
+    CheckAgainstReference<24, 16, 8>(4);
+    CheckAgainstReference<0, 16, 16>(5);
+    CheckAgainstReference<40, 20, 20>(6);
+}
+
+TEST_F(Fixed64MixedPrecisionTest, MatchesOperatorsInTheLeftPrecision) {
+    std::mt19937_64 gen(7);
+    for (int i = 0; i < 10000; ++i) {
+        const Fixed64_16 position(static_cast<int64_t>(gen()) >> 24, detail::nothing{});
+        const Fixed64_32 ratio(static_cast<int64_t>(gen()) >> 28, detail::nothing{});
+        ASSERT_EQ(Fixed64Math::Mul<16>(position, ratio), position * ratio);
+        if (ratio != Fixed64_32::Zero()) {
+            ASSERT_EQ(Fixed64Math::Div<16>(position, ratio), position / ratio);
+        }
+    }
+}
+
+TEST_F(Fixed64MixedPrecisionTest, KeepsLowBits) {
+    // The product has 1.5 ulps of Fixed64_16 below the integer part: kept exactly in a
+    // Fixed64_32 result, truncated to one ulp by operator*
+    const Fixed64_16 position(3);
+    const Fixed64_32 ratio(Fixed64_32::One() + Fixed64_32::Epsilon() * Fixed64_32(1 << 15));
+    EXPECT_EQ(Fixed64Math::Mul<32>(position, ratio).value(),
+              (int64_t(3) << 32) + 3 * (int64_t(1) << 15));
+    EXPECT_EQ(Fixed64_32(position * ratio).value(), (int64_t(3) << 32) + (int64_t(1) << 16));
+
+    EXPECT_EQ(Fixed64Math::Div<32>(Fixed64_16(1), Fixed64_16(3)).value(),
+              (int64_t(1) << 32) / 3);
+    EXPECT_EQ(Fixed64Math::Div<32>(Fixed64_16(1), Fixed64_16::Zero()), Fixed64_32::Infinity());
+    EXPECT_EQ(Fixed64Math::Div<32>(Fixed64_16(-1), Fixed64_16::Zero()),
+              Fixed64_32::NegInfinity());
+
+    static_assert(Fixed64Math::Mul<16>(Fixed64_32(1.5), Fixed64_16(4)) == Fixed64_16(6));
+    static_assert(Fixed64Math::Div<24>(Fixed64_32(3), Fixed64_16(2)) == Fixed64<24>(1.5));
+}
+
+}  // namespace math::fp::tests
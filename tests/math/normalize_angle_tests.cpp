@@ -0,0 +1,142 @@
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+#include "fixed64.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+#include "primitives.h"
+
+namespace math::fp::tests {
+
+class Fixed64NormalizeAngleTest : public ::testing::Test {
+ protected:
+    // The repeat-subtract normalization NormalizeAngle used before the remainder
+    template <int P>
+    static auto LoopReference(Fixed64<P> angle) -> Fixed64<P> {
+        while (angle >= Fixed64<P>::TwoPi()) {
+            angle -= Fixed64<P>::TwoPi();
+        }
+        while (angle < Fixed64<P>::Zero()) {
+            angle += Fixed64<P>::TwoPi();
+        }
+        return angle;
+    }
+
+    template <int P>
+    static auto ExactReference(int64_t raw) -> int64_t {
+        const int64_t two_pi = Fixed64<P>::TwoPi().value();
+        const int64_t r = raw % two_pi;
+        return r < 0 ? r + two_pi : r;
+    }
+
+    template <int64_t D>
+    static void CheckRemConstant(std::mt19937_64& gen) {
+        for (const int64_t x : {int64_t(0), int64_t(1), int64_t(-1), D - 1, D, -D, INT64_MAX,
+                                INT64_MIN, INT64_MIN + 1}) {
+            ASSERT_EQ(Primitives::RemConstant<D>(x), x % D) << x;
+        }
+        for (int i = 0; i < 10000; ++i) {
+            const auto x = static_cast<int64_t>(gen());
+            // Also dividends near multiples of D, where the quotient estimate is one short
+            const int64_t near = (x / D) * D - 1 + static_cast<int64_t>(gen() % 3);
+            ASSERT_EQ(Primitives::RemConstant<D>(x), x % D) << x;
+            ASSERT_EQ(Primitives::RemConstant<D>(near), near % D) << near;
+        }
+    }
+};
+
+TEST_F(Fixed64NormalizeAngleTest, RemConstantMatchesDivision) {
+    std::mt19937_64 gen(1);
+    CheckRemConstant<1>(gen);
+    CheckRemConstant<3>(gen);
+    CheckRemConstant<Fixed64_32::TwoPi().value()>(gen);
+    CheckRemConstant<Fixed64_16::Pi().value()>(gen);
+    CheckRemConstant<(int64_t(1) << 62) + 12345>(gen);
+    CheckRemConstant<INT64_MAX>(gen);
+}
+
+TEST_F(Fixed64NormalizeAngleTest, MatchesLoopReference) {
+    std::mt19937_64 gen(2);
+    std::uniform_real_distribution<double> dist(-200.0, 200.0);
+    for (int i = 0; i < 10000; ++i) {
+        const Fixed64_32 angle(dist(gen));
+        ASSERT_EQ(Fixed64Math::NormalizeAngle(angle), LoopReference(angle)) << angle.value();
+    }
+    for (const auto angle : {Fixed64_32::Zero(), Fixed64_32::TwoPi(), -Fixed64_32::TwoPi(),
+                             Fixed64_32::TwoPi() - Fixed64_32::Epsilon(), -Fixed64_32::Epsilon(),
+                             Fixed64_32::Pi() * Fixed64_32(7)}) {
+        EXPECT_EQ(Fixed64Math::NormalizeAngle(angle), LoopReference(angle)) << angle.value();
+    }
+}
+
+TEST_F(Fixed64NormalizeAngleTest, LargeAnglesReduceExactly) {
+    std::mt19937_64 gen(3);
+    for (int i = 0; i < 10000; ++i) {
+        const auto raw = static_cast<int64_t>(gen());
+        ASSERT_EQ(Fixed64Math::NormalizeAngle(Fixed64_32(raw, detail::nothing{})).value(),
+                  ExactReference<32>(raw))
+            << raw;
+        ASSERT_EQ(Fixed64Math::NormalizeAngle(Fixed64_16(raw, detail::nothing{})).value(),
+                  ExactReference<16>(raw))
+            << raw;
+    }
+
+    // A million radians is about 159155 turns
+    const auto normalized = Fixed64Math::NormalizeAngle(Fixed64_32(1000000));
+    EXPECT_EQ(normalized.value(), ExactReference<32>(Fixed64_32(1000000).value()));
+    EXPECT_GE(normalized, Fixed64_32::Zero());
+    EXPECT_LT(normalized, Fixed64_32::TwoPi());
+    EXPECT_EQ(Fixed64Math::NormalizeAngle(Fixed64_32::Max()).value(),
+              ExactReference<32>(INT64_MAX));
+}
+
+TEST_F(Fixed64NormalizeAngleTest, RepeatIsExact) {
+    using Fixed = Fixed64_32;
+    EXPECT_EQ(Fixed64Math::Repeat(Fixed(5.5), Fixed(4)), Fixed(1.5));
+    EXPECT_EQ(Fixed64Math::Repeat(Fixed(-1.5), Fixed(4)), Fixed(2.5));
+    EXPECT_EQ(Fixed64Math::Repeat(Fixed(8), Fixed(4)), Fixed::Zero());
+    EXPECT_EQ(Fixed64Math::Repeat(Fixed(-8), Fixed(4)), Fixed::Zero());
+    EXPECT_EQ(Fixed64Math::Repeat(Fixed(1000000.25), Fixed(0.5)), Fixed(0.25));
+    EXPECT_EQ(Fixed64Math::Repeat(Fixed(3), Fixed::Zero()), Fixed::Zero());
+    EXPECT_EQ(Fixed64Math::Repeat(Fixed(3), Fixed(-2)), Fixed::Zero());
+
+    std::mt19937_64 gen(4);
+    std::uniform_real_distribution<double> value(-1.0e6, 1.0e6);
+    std::uniform_real_distribution<double> length(0.001, 100.0);
+    for (int i = 0; i < 10000; ++i) {
+        const Fixed x(value(gen));
+        const Fixed l(length(gen));
+        const Fixed r = Fixed64Math::Repeat(x, l);
+        ASSERT_GE(r, Fixed::Zero());
+        ASSERT_LT(r, l);
+        ASSERT_EQ((x.value() - r.value()) % l.value(), 0);
+    }
+}
+
+TEST_F(Fixed64NormalizeAngleTest, LerpAngleTakesShortestPath) {
+    using Fixed = Fixed64_32;
+    const Fixed start(0.5);
+    const Fixed end(0.25);
+    const Fixed t(0.5);
+    const Fixed expected = Fixed64Math::LerpAngle(start, end, t);
+    for (int turns = -1000; turns <= 1000; turns += 7) {
+        const Fixed wrapped = end + Fixed::TwoPi() * Fixed(turns);
+        ASSERT_EQ(Fixed64Math::LerpAngle(start, wrapped, t), expected) << turns;
+    }
+
+    // Differences just beyond pi go the other way round
+    const Fixed across = Fixed64Math::LerpAngle(Fixed(0.1), Fixed(-3.1), Fixed::One());
+    EXPECT_NEAR(static_cast<double>(across), 0.1 + (2.0 * M_PI - 3.2), 1e-6);
+}
+
+TEST_F(Fixed64NormalizeAngleTest, Constexpr) {
+    constexpr auto kNormalized = Fixed64Math::NormalizeAngle(Fixed64_32(-100));
+    constexpr auto kRepeated = Fixed64Math::Repeat(Fixed64_32(-100), Fixed64_32(3));
+    static_assert(kNormalized >= Fixed64_32::Zero() && kNormalized < Fixed64_32::TwoPi());
+    static_assert(kRepeated == Fixed64_32(2));
+    volatile int64_t raw = Fixed64_32(-100).value();
+    EXPECT_EQ(Fixed64Math::NormalizeAngle(Fixed64_32(raw, detail::nothing{})), kNormalized);
+}
+
+}  // namespace math::fp::tests
@@ -0,0 +1,169 @@
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "fixed64.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64PolynomialTest : public ::testing::Test {
+ protected:
+    using Fixed = Fixed64_32;
+
+    static auto Ulps(Fixed value, long double expected) -> long double {
+        return std::fabs(static_cast<long double>(value.value()) - std::ldexp(expected, 32));
+    }
+
+    static auto Exact(Fixed value) -> long double {
+        return std::ldexp(static_cast<long double>(value.value()), -32);
+    }
+
+    template <size_t N>
+    static auto CheckAgainstReference(uint64_t seed) -> void {
+        std::mt19937_64 gen(seed);
+        std::uniform_real_distribution<double> coefficient(-4.0, 4.0);
+        std::uniform_real_distribution<double> argument(-1.0, 1.0);
+        for (int trial = 0; trial < 2000; ++trial) {
+            std::array<Fixed, N> c;
+            for (auto& value : c) {
+                value = Fixed(coefficient(gen));
+            }
+            const Fixed x(argument(gen));
+            long double expected = 0;
+            for (size_t i = N; i-- > 0;) {
+                expected = expected * Exact(x) + Exact(c[i]);
+            }
+            // Half an ulp per rounding, each rounding error scaled by a power of |x| <= 1
+            // and, for the powers themselves, by coefficients below 4
+            const long double tolerance = 2.0L * N + 1;
+            ASSERT_LE(Ulps(Fixed64Math::EvalPoly(c, x), expected), tolerance) << "N=" << N;
+            ASSERT_LE(Ulps(Fixed64Math::EvalPolyHorner(c, x), expected), N * 0.5L) << "N=" << N;
+        }
+    }
+};
+
+TEST_F(Fixed64PolynomialTest, MatchesReference) {
+    CheckAgainstReference<1>(1);
+    CheckAgainstReference<2>(2);
+    CheckAgainstReference<3>(3);
+    CheckAgainstReference<4>(4);
+    CheckAgainstReference<5>(5);
+    CheckAgainstReference<8>(8);
+    CheckAgainstReference<9>(9);
+}
+
+TEST_F(Fixed64PolynomialTest, ExactCases) {
+    // Integer arguments and coefficients leave nothing to round
+    const std::array<Fixed, 5> c = {Fixed(3), Fixed(-2), Fixed(1), Fixed(0), Fixed(-1)};
+    EXPECT_EQ(Fixed64Math::EvalPoly(c, Fixed(2)), Fixed(3 - 4 + 4 - 16));
+    EXPECT_EQ(Fixed64Math::EvalPolyHorner(c, Fixed(-3)), Fixed(3 + 6 + 9 - 81));
+    EXPECT_EQ(Fixed64Math::EvalPoly(c, Fixed::Zero()), c[0]);
+
+    // One rounding for the final product: 1 + eps * 0.5 lies halfway, ties to even
+    const std::array<Fixed, 2> line = {Fixed::One(), Fixed::Epsilon()};
+    EXPECT_EQ(Fixed64Math::EvalPoly(line, Fixed::Half()), Fixed::One());
+
+    static_assert(Fixed64Math::EvalPoly(std::array<Fixed64_16, 3>{Fixed64_16(1), Fixed64_16(2),
+                                                                  Fixed64_16(3)},
+                                        Fixed64_16(2))
+                  == Fixed64_16(17));
+}
+
+TEST_F(Fixed64PolynomialTest, BatchMatchesScalar) {
+    const std::array<Fixed, 6> c = {Fixed(0.5), Fixed(-1.25), Fixed(0.75),
+                                    Fixed(2),   Fixed(-0.1),  Fixed(0.01)};
+    std::mt19937_64 gen(7);
+    std::uniform_real_distribution<double> dist(-2.0, 2.0);
+    std::vector<Fixed> x(1000);
+    for (auto& value : x) {
+        value = Fixed(dist(gen));
+    }
+    std::vector<Fixed> out(x.size());
+    Fixed64Math::EvalPoly(c, std::span<const Fixed>(x), std::span<Fixed>(out));
+    for (size_t i = 0; i < x.size(); ++i) {
+        ASSERT_EQ(out[i], Fixed64Math::EvalPoly(c, x[i])) << i;
+    }
+}
+
+TEST_F(Fixed64PolynomialTest, Hermite) {
+    const Fixed p0(1.5), m0(-2), p1(-0.75), m1(3.25);
+    EXPECT_EQ(Fixed64Math::Hermite(p0, m0, p1, m1, Fixed::Zero()), p0);
+    EXPECT_EQ(Fixed64Math::Hermite(p0, m0, p1, m1, Fixed::One()), p1);
+
+    for (int i = 0; i <= 64; ++i) {
+        const Fixed t = Fixed(i) / Fixed(64);
+        const long double s = Exact(t);
+        const long double expected = (2 * s * s * s - 3 * s * s + 1) * Exact(p0)
+                                   + (s * s * s - 2 * s * s + s) * Exact(m0)
+                                   + (-2 * s * s * s + 3 * s * s) * Exact(p1)
+                                   + (s * s * s - s * s) * Exact(m1);
+        EXPECT_LE(Ulps(Fixed64Math::Hermite(p0, m0, p1, m1, t), expected), 4.0L) << i;
+    }
+
+    // Equal tangents matching the chord give the straight line
+    EXPECT_EQ(Fixed64Math::Hermite(Fixed(1), Fixed(2), Fixed(3), Fixed(2), Fixed(0.25)),
+              Fixed(1.5));
+}
+
+TEST_F(Fixed64PolynomialTest, CatmullRom) {
+    const Fixed p0(0.1), p1(1.7), p2(-0.4), p3(2.3);
+    EXPECT_EQ(Fixed64Math::CatmullRom(p0, p1, p2, p3, Fixed::Zero()), p1);
+    EXPECT_EQ(Fixed64Math::CatmullRom(p0, p1, p2, p3, Fixed::One()), p2);
+
+    // Same curve as Hermite with the halved chords as tangents
+    for (int i = 0; i <= 16; ++i) {
+        const Fixed t = Fixed(i) / Fixed(16);
+        const long double s = Exact(t);
+        const long double m1 = (Exact(p2) - Exact(p0)) / 2;
+        const long double m2 = (Exact(p3) - Exact(p1)) / 2;
+        const long double expected = (2 * s * s * s - 3 * s * s + 1) * Exact(p1)
+                                   + (s * s * s - 2 * s * s + s) * m1
+                                   + (-2 * s * s * s + 3 * s * s) * Exact(p2)
+                                   + (s * s * s - s * s) * m2;
+        EXPECT_LE(Ulps(Fixed64Math::CatmullRom(p0, p1, p2, p3, t), expected), 4.0L) << i;
+    }
+
+    // Equally spaced collinear points: the line p1 + (p2 - p1) * t, rounded once
+    const Fixed step = Fixed::Epsilon() * Fixed(3);
+    const Fixed base(5);
+    const Fixed t(0.5);
+    EXPECT_EQ(Fixed64Math::CatmullRom(base - step, base, base + step, base + step * Fixed(2), t),
+              base + Fixed::Epsilon() * Fixed(2));  // 1.5 ulps rounds to even
+}
+
+TEST_F(Fixed64PolynomialTest, SplineBatch) {
+    const std::vector<Fixed> points = {Fixed(0), Fixed(2), Fixed(-1), Fixed(4), Fixed(3)};
+    std::vector<Fixed> u;
+    for (int i = -8; i <= 48; ++i) {
+        u.push_back(Fixed(i) / Fixed(8));
+    }
+    std::vector<Fixed> out(u.size());
+    Fixed64Math::CatmullRom(std::span<const Fixed>(points), std::span<const Fixed>(u),
+                            std::span<Fixed>(out));
+
+    for (size_t i = 0; i < u.size(); ++i) {
+        const Fixed clamped = std::clamp(u[i], Fixed::Zero(), Fixed(4));
+        const int segment = std::min(static_cast<int>(clamped), 3);
+        const Fixed t = clamped - Fixed(segment);
+        const Fixed expected = Fixed64Math::CatmullRom(
+            points[std::max(segment - 1, 0)], points[segment], points[segment + 1],
+            points[std::min(segment + 2, 4)], t);
+        ASSERT_EQ(out[i], expected) << static_cast<double>(u[i]);
+    }
+    // The spline passes through every point
+    for (size_t k = 0; k < points.size(); ++k) {
+        EXPECT_EQ(out[8 + 8 * k], points[k]) << k;
+    }
+
+    const std::vector<Fixed> single = {Fixed(7)};
+    Fixed64Math::CatmullRom(std::span<const Fixed>(single), std::span<const Fixed>(u),
+                            std::span<Fixed>(out));
+    EXPECT_EQ(out.front(), Fixed(7));
+    EXPECT_EQ(out.back(), Fixed(7));
+}
+
+}  // namespace math::fp::tests
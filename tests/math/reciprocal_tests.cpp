@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "fixed64.h"
+#include "fixed64_divider.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64ReciprocalTest : public ::testing::Test {
+ protected:
+    // Random raw values of every magnitude, both signs, plus the extremes
+    template <int P>
+    static auto MakeValues(uint64_t seed) -> std::vector<Fixed64<P>> {
+        std::mt19937_64 gen(seed);
+        std::uniform_int_distribution<int> shift(0, 62);
+        std::vector<Fixed64<P>> values;
+        for (int i = 0; i < 4000; ++i) {
+            int64_t raw = static_cast<int64_t>(gen()) >> shift(gen);
+            values.push_back(Fixed64<P>(raw, detail::nothing{}));
+        }
+        const Fixed64<P> edges[] = {Fixed64<P>::Zero(),     Fixed64<P>::One(),
+                                    -Fixed64<P>::One(),     Fixed64<P>::Epsilon(),
+                                    -Fixed64<P>::Epsilon(), Fixed64<P>::Max(),
+                                    -Fixed64<P>::Max(),     Fixed64<P>::Pi(),
+                                    Fixed64<P>(3),          Fixed64<P>(-7)};
+        for (const auto& edge : edges) {
+            values.push_back(edge);
+        }
+        return values;
+    }
+
+    template <int P>
+    static auto CheckReciprocal(uint64_t seed) -> void {
+        for (const auto& x : MakeValues<P>(seed)) {
+            ASSERT_EQ(Fixed64Math::Reciprocal(x).value(), (Fixed64<P>::One() / x).value())
+                << "P=" << P << " x=" << x.value();
+        }
+    }
+
+    template <int P>
+    static auto CheckDivider(uint64_t seed) -> void {
+        const auto values = MakeValues<P>(seed);
+        for (size_t i = 0; i < values.size(); i += 37) {
+            const Fixed64Divider<P> divider(values[i]);
+            EXPECT_EQ(divider.divisor(), values[i]);
+            for (const auto& n : values) {
+                ASSERT_EQ(divider.Divide(n).value(), (n / values[i]).value())
+                    << "P=" << P << " n=" << n.value() << " d=" << values[i].value();
+            }
+        }
+    }
+
+    template <int P>
+    static auto CheckRemainder(uint64_t seed) -> void {
+        const auto values = MakeValues<P>(seed);
+        for (size_t i = 0; i < values.size(); i += 37) {
+            const Fixed64Remainder<P> modulus(values[i]);
+            EXPECT_EQ(modulus.modulus(), values[i]);
+            for (const auto& x : values) {
+                ASSERT_EQ(modulus.Remainder(x), x % values[i])
+                    << "P=" << P << " x=" << x.value() << " m=" << values[i].value();
+                ASSERT_EQ(modulus.Wrap(x), Fixed64Math::Repeat(x, values[i]))
+                    << "P=" << P << " x=" << x.value() << " m=" << values[i].value();
+            }
+        }
+    }
+
+    // Compare against long double, which carries 64 significant bits on x86 and at least 53
+    // elsewhere; the tolerance covers the rounding of the result plus the documented 2^-58
+    static constexpr int kReferenceBits = std::numeric_limits<long double>::digits;
+    static constexpr long double kRelativeError =
+        kReferenceBits > 58 ? 0x1p-58L : 2.0L / (uint64_t(1) << kReferenceBits);
+
+    template <int P>
+    static auto CheckRSqrt(uint64_t seed) -> void {
+        std::mt19937_64 gen(seed);
+        std::uniform_int_distribution<int> shift(1, 62);
+        for (int i = 0; i < 20000; ++i) {
+            const int64_t raw = std::max<int64_t>(static_cast<int64_t>(gen() >> shift(gen)), 1);
+            const Fixed64<P> x(raw, detail::nothing{});
+            const long double expected =
+                std::ldexp(1.0L / std::sqrt(std::ldexp(static_cast<long double>(raw), -P)), P);
+            const int64_t actual = Fixed64Math::RSqrt(x).value();
+            if (expected >= std::ldexp(1.0L, 63)) {
+                ASSERT_EQ(actual, INT64_MAX) << "P=" << P << " x=" << raw;
+                continue;
+            }
+            const long double tolerance = 1.0L + expected * kRelativeError;
+            ASSERT_LE(std::fabs(static_cast<long double>(actual) - expected), tolerance)
+                << "P=" << P << " x=" << raw;
+        }
+    }
+};
+
+TEST_F(Fixed64ReciprocalTest, ReciprocalMatchesDivision) {
+    CheckReciprocal<16>(1);
+    CheckReciprocal<32>(2);
+    CheckReciprocal<40>(3);
+    CheckReciprocal<48>(4);
+    CheckReciprocal<8>(5);
+}
+
+TEST_F(Fixed64ReciprocalTest, ReciprocalOfZero) {
+    EXPECT_EQ(Fixed64Math::Reciprocal(Fixed64_16::Zero()), Fixed64_16::Infinity());
+    EXPECT_EQ(Fixed64Math::Reciprocal(Fixed64_32::Zero()), Fixed64_32::Infinity());
+    EXPECT_EQ(Fixed64Math::Reciprocal(Fixed64_32(4)), Fixed64_32(0.25));
+    EXPECT_EQ(Fixed64Math::Reciprocal(Fixed64_32(-0.5)), Fixed64_32(-2));
+}
+
+TEST_F(Fixed64ReciprocalTest, DividerMatchesDivision) {
+    CheckDivider<16>(11);
+    CheckDivider<32>(12);
+    CheckDivider<40>(13);
+    CheckDivider<48>(14);
+    CheckDivider<8>(15);
+}
+
+TEST_F(Fixed64ReciprocalTest, DividerByZero) {
+    const Fixed64Divider<32> divider(Fixed64_32::Zero());
+    EXPECT_EQ(divider.Divide(Fixed64_32(3)), Fixed64_32::Infinity());
+    EXPECT_EQ(divider.Divide(Fixed64_32::Zero()), Fixed64_32::Infinity());
+    EXPECT_EQ(divider.Divide(Fixed64_32(-3)), Fixed64_32::NegInfinity());
+    EXPECT_EQ(Fixed64_32(6) / Fixed64Divider<32>(Fixed64_32(-4)), Fixed64_32(-1.5));
+}
+
+TEST_F(Fixed64ReciprocalTest, RemainderMatchesModulo) {
+    CheckRemainder<16>(21);
+    CheckRemainder<32>(22);
+    CheckRemainder<48>(23);
+    CheckRemainder<8>(24);
+}
+
+TEST_F(Fixed64ReciprocalTest, RemainderWrapsWorld) {
+    const Fixed64Remainder<16> world(Fixed64_16(1000));
+    EXPECT_EQ(Fixed64_16(2500.5) % world, Fixed64_16(500.5));
+    EXPECT_EQ(Fixed64_16(-2500.5) % world, Fixed64_16(-500.5));
+    EXPECT_EQ(world.Wrap(Fixed64_16(-0.25)), Fixed64_16(999.75));
+
+    std::vector<Fixed64_16> xs = {Fixed64_16(-1000), Fixed64_16(1000), Fixed64_16(1234),
+                                  Fixed64_16(-1e6)};
+    world.Wrap(std::span<Fixed64_16>(xs));
+    EXPECT_EQ(xs, (std::vector<Fixed64_16>{Fixed64_16(0), Fixed64_16(0), Fixed64_16(234),
+                                           Fixed64_16(0)}));
+
+    const Fixed64Remainder<16> zero(Fixed64_16::Zero());
+    EXPECT_EQ(zero.Remainder(Fixed64_16(3)), Fixed64_16::NaN());
+    EXPECT_EQ(zero.Wrap(Fixed64_16(3)), Fixed64_16::Zero());
+    EXPECT_EQ(Fixed64Remainder<16>(Fixed64_16(-4)).Wrap(Fixed64_16(3)), Fixed64_16::Zero());
+
+    static_assert(Fixed64Remainder<32>(Fixed64_32(0.75)).Wrap(Fixed64_32(-1)) == Fixed64_32(0.5));
+}
+
+TEST_F(Fixed64ReciprocalTest, ReciprocalWordIsExact) {
+    std::mt19937_64 gen(21);
+    for (int i = 0; i < 100000; ++i) {
+        const uint64_t d = gen() | (uint64_t(1) << 63);
+        ASSERT_EQ(Primitives::ReciprocalWord(d), Primitives::DivU128ToU64(~d, UINT64_MAX, d))
+            << "d=" << d;
+    }
+    // Smallest and largest normalized divisors
+    static_assert(Primitives::ReciprocalWord(uint64_t(1) << 63) == UINT64_MAX);
+    static_assert(Primitives::ReciprocalWord(UINT64_MAX) == 1);
+}
+
+TEST_F(Fixed64ReciprocalTest, RSqrtAccuracy) {
+    CheckRSqrt<16>(31);
+    CheckRSqrt<31>(32);
+    CheckRSqrt<32>(33);
+    CheckRSqrt<40>(34);
+    CheckRSqrt<48>(35);
+
+    EXPECT_EQ(Fixed64Math::RSqrt(Fixed64_32(4)), Fixed64_32(0.5));
+    EXPECT_EQ(Fixed64Math::RSqrt(Fixed64_32(0.25)), Fixed64_32(2));
+    EXPECT_EQ(Fixed64Math::RSqrt(Fixed64_16(1)), Fixed64_16(1));
+    EXPECT_EQ(Fixed64Math::RSqrt(Fixed64_32::Zero()), Fixed64_32::Infinity());
+    EXPECT_EQ(Fixed64Math::RSqrt(Fixed64_32(-1)), Fixed64_32::NaN());
+    EXPECT_EQ(Fixed64Math::RSqrt(Fixed64<48>::Epsilon()), Fixed64<48>::Infinity());
+}
+
+}  // namespace math::fp::tests
@@ -0,0 +1,126 @@
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "fixed64.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64ReductionTest : public ::testing::Test {
+ protected:
+    __extension__ typedef __int128 int128;
+
+    // Values with up to `bits` magnitude bits; long enough to span several chunks
+    template <int P>
+    static auto MakeValues(size_t count, int bits, uint64_t seed) -> std::vector<Fixed64<P>> {
+        std::mt19937_64 gen(seed);
+        std::vector<Fixed64<P>> values(count);
+        for (auto& value : values) {
+            value = Fixed64<P>(static_cast<int64_t>(gen()) >> (64 - bits), detail::nothing{});
+        }
+        return values;
+    }
+
+    template <int P>
+    static auto ExactSum(const std::vector<Fixed64<P>>& values) -> int128 {
+        int128 sum = 0;
+        for (const auto& value : values) {
+            sum += value.value();
+        }
+        return sum;
+    }
+};
+
+TEST_F(Fixed64ReductionTest, SumIsExact) {
+    for (size_t count : {0, 1, 7, 1000, 16384, 16385, 100003}) {
+        const auto values = MakeValues<32>(count, 48, count);
+        EXPECT_EQ(Fixed64Math::Sum<32>(values).value(), static_cast<int64_t>(ExactSum(values)))
+            << count;
+    }
+
+    // Partial sums far beyond the range still give the exact final total
+    std::vector<Fixed64_32> values(50000, Fixed64_32::Max());
+    for (size_t i = 0; i < values.size(); i += 2) {
+        values[i] = -Fixed64_32::Max();
+    }
+    values.push_back(Fixed64_32(3));
+    EXPECT_EQ(Fixed64Math::Sum<32>(values), Fixed64_32(3));
+
+    // Totals outside the range saturate
+    values.back() = Fixed64_32::Max();
+    EXPECT_EQ(Fixed64Math::Sum<32>(values), Fixed64_32::Infinity());
+    const std::vector<Fixed64_32> low(40000, Fixed64_32::NaN());
+    EXPECT_EQ(Fixed64Math::Sum<32>(low), Fixed64_32::NegInfinity());
+}
+
+TEST_F(Fixed64ReductionTest, Mean) {
+    const auto values = MakeValues<16>(70001, 62, 2);
+    const int128 sum = ExactSum(values);
+    const int128 n = static_cast<int128>(values.size());
+    const int128 magnitude = (sum < 0 ? -sum : sum) + n / 2;
+    const int128 expected = sum < 0 ? -(magnitude / n) : magnitude / n;
+    EXPECT_EQ(Fixed64Math::Mean<16>(values).value(), static_cast<int64_t>(expected));
+
+    EXPECT_EQ(Fixed64Math::Mean<16>(std::span<const Fixed64_16>()), Fixed64_16::Zero());
+    const std::vector<Fixed64_16> big(3, Fixed64_16::Max());
+    EXPECT_EQ(Fixed64Math::Mean<16>(big), Fixed64_16::Max());
+
+    // Ties round away from zero
+    const std::vector<Fixed64_16> ties = {Fixed64_16::Epsilon(), Fixed64_16::Zero()};
+    EXPECT_EQ(Fixed64Math::Mean<16>(ties), Fixed64_16::Epsilon());
+    const std::vector<Fixed64_16> negative_ties = {-Fixed64_16::Epsilon(), Fixed64_16::Zero()};
+    EXPECT_EQ(Fixed64Math::Mean<16>(negative_ties), -Fixed64_16::Epsilon());
+}
+
+TEST_F(Fixed64ReductionTest, MinMax) {
+    auto values = MakeValues<32>(50001, 63, 3);
+    values[12345] = Fixed64_32::Max();
+    values[49999] = Fixed64_32::NegInfinity();
+    const auto [min, max] = Fixed64Math::MinMax<32>(values);
+    EXPECT_EQ(min, Fixed64_32::NegInfinity());
+    EXPECT_EQ(max, Fixed64_32::Max());
+
+    const std::vector<Fixed64_32> small = {Fixed64_32(2), Fixed64_32(-1), Fixed64_32(5)};
+    EXPECT_EQ(Fixed64Math::MinMax<32>(small).first, Fixed64_32(-1));
+    EXPECT_EQ(Fixed64Math::MinMax<32>(small).second, Fixed64_32(5));
+
+    const auto empty = Fixed64Math::MinMax<32>(std::span<const Fixed64_32>());
+    EXPECT_EQ(empty.first, Fixed64_32::Max());
+    EXPECT_EQ(empty.second, Fixed64_32::Min());
+}
+
+TEST_F(Fixed64ReductionTest, Variance) {
+    for (size_t count : {1, 2, 999, 40000}) {
+        const auto values = MakeValues<32>(count, 40, count + 10);
+        int128 sum = 0;
+        int128 squares = 0;
+        for (const auto& value : values) {
+            sum += value.value();
+            squares += int128(value.value()) * value.value();
+        }
+        // Exact variance times n^2 * 2^P, compared after truncation
+        const int128 n = static_cast<int128>(count);
+        const int128 scaled = n * squares - sum * sum;
+        const int128 truncated = scaled / (n * n) >> 32;
+        const int64_t result = Fixed64Math::Variance<32>(values).value();
+        EXPECT_GE(result, static_cast<int64_t>(truncated)) << count;
+        EXPECT_LE(result, static_cast<int64_t>(truncated) + 1) << count;
+    }
+
+    const std::vector<Fixed64_32> constant(20000, Fixed64_32(-7.5));
+    EXPECT_EQ(Fixed64Math::Variance<32>(constant), Fixed64_32::Zero());
+    const std::vector<Fixed64_32> pair = {Fixed64_32(1), Fixed64_32(3)};
+    EXPECT_EQ(Fixed64Math::Variance<32>(pair), Fixed64_32(1));
+    EXPECT_EQ(Fixed64Math::Variance<32>(std::span<const Fixed64_32>()), Fixed64_32::Zero());
+
+    // Deviations near 2^63 are squared exactly, and the too-large variance saturates
+    const std::vector<Fixed64_32> wide = {Fixed64_32::Max(), -Fixed64_32::Max()};
+    EXPECT_EQ(Fixed64Math::Variance<32>(wide), Fixed64_32::Infinity());
+    const std::vector<Fixed64<62>> unit = {Fixed64<62>(1), Fixed64<62>(-1)};
+    EXPECT_EQ(Fixed64Math::Variance<62>(unit), Fixed64<62>(1));
+}
+
+}  // namespace math::fp::tests
@@ -0,0 +1,154 @@
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "fixed64.h"
+#include "fixed64_random.h"
+#include "fixed64_sampling.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64SamplingTest : public ::testing::Test {
+ protected:
+    static auto MakeWeights(size_t count, uint64_t seed) -> std::vector<Fixed64_16> {
+        std::mt19937_64 gen(seed);
+        std::vector<Fixed64_16> weights(count);
+        for (auto& weight : weights) {
+            weight = Fixed64_16(static_cast<int64_t>(gen() % 100000), detail::nothing{});
+        }
+        weights[count / 3] = Fixed64_16::Zero();
+        return weights;
+    }
+
+    // Draw often and check every observed frequency against its expected probability
+    template <typename Table>
+    static auto CheckFrequencies(const Table& table, const std::vector<double>& probability)
+        -> void {
+        constexpr int kDraws = 200000;
+        Fixed64Random random(7);
+        std::vector<int> counts(probability.size());
+        for (int i = 0; i < kDraws; ++i) {
+            const int index = table.Sample(random);
+            ASSERT_GE(index, 0);
+            ASSERT_LT(index, static_cast<int>(probability.size()));
+            ++counts[index];
+        }
+        for (size_t i = 0; i < probability.size(); ++i) {
+            if (probability[i] == 0) {
+                EXPECT_EQ(counts[i], 0) << i;
+                continue;
+            }
+            const double expected = probability[i] * kDraws;
+            EXPECT_NEAR(counts[i], expected, 5 * std::sqrt(expected) + 1) << i;
+        }
+    }
+};
+
+TEST_F(Fixed64SamplingTest, AliasTableIsExact) {
+    const auto weights = MakeWeights(1000, 1);
+    const Fixed64AliasTable table(weights);
+    ASSERT_EQ(table.size(), weights.size());
+
+    uint64_t total = 0;
+    for (const auto& weight : weights) {
+        total += static_cast<uint64_t>(weight.value());
+    }
+    EXPECT_EQ(table.Total(), total);
+    for (size_t i = 0; i < weights.size(); ++i) {
+        ASSERT_EQ(table.Mass(i), static_cast<uint64_t>(weights[i].value()) * weights.size()) << i;
+    }
+}
+
+TEST_F(Fixed64SamplingTest, AliasTableFrequencies) {
+    const std::vector<Fixed64_16> weights = {Fixed64_16(1), Fixed64_16(0), Fixed64_16(2),
+                                             Fixed64_16(0.5), Fixed64_16(4.5)};
+    const Fixed64AliasTable table(weights);
+    CheckFrequencies(table, {0.125, 0, 0.25, 0.0625, 0.5625});
+}
+
+TEST_F(Fixed64SamplingTest, AliasTableRescalesLargeWeights) {
+    // The raw sum exceeds 64 bits; every positive weight must keep a non-zero share
+    const std::vector<Fixed64_16> weights = {Fixed64_16::Max(), Fixed64_16::Epsilon(),
+                                             Fixed64_16::Zero(), Fixed64_16::Max()};
+    const Fixed64AliasTable table(weights);
+    ASSERT_EQ(table.size(), weights.size());
+    EXPECT_LE(table.Total() * table.size(), uint64_t(1) << 62);
+    uint64_t mass = 0;
+    for (size_t i = 0; i < weights.size(); ++i) {
+        mass += table.Mass(i);
+    }
+    EXPECT_EQ(mass, table.Total() * table.size());
+    EXPECT_GT(table.Mass(1), 0u);
+    EXPECT_EQ(table.Mass(2), 0u);
+    EXPECT_EQ(table.Mass(0), table.Mass(3));
+}
+
+TEST_F(Fixed64SamplingTest, InvalidWeights) {
+    Fixed64Random random(1);
+    EXPECT_EQ(Fixed64AliasTable().Sample(random), -1);
+    EXPECT_EQ(Fixed64AliasTable(std::vector<Fixed64_16>{}).Sample(random), -1);
+    EXPECT_EQ(Fixed64AliasTable(std::vector<Fixed64_16>{Fixed64_16(1), Fixed64_16(-1)})
+                  .Sample(random),
+              -1);
+    EXPECT_EQ(Fixed64AliasTable(std::vector<Fixed64_16>{Fixed64_16::Zero()}).Sample(random), -1);
+
+    EXPECT_EQ(Fixed64CumulativeTable().Sample(random), -1);
+    EXPECT_TRUE(Fixed64CumulativeTable(std::vector<Fixed64_16>{Fixed64_16(-1)}).empty());
+    EXPECT_TRUE(
+        Fixed64CumulativeTable(std::vector<Fixed64_16>{Fixed64_16::Max(), Fixed64_16::Max()})
+            .empty());
+    EXPECT_EQ(Fixed64CumulativeTable(std::vector<Fixed64_16>{Fixed64_16::Zero()}).Sample(random),
+              -1);
+}
+
+TEST_F(Fixed64SamplingTest, CumulativeTableUpdate) {
+    std::vector<Fixed64_16> weights = {Fixed64_16(1), Fixed64_16(2), Fixed64_16(3),
+                                       Fixed64_16(4), Fixed64_16(5), Fixed64_16(1)};
+    Fixed64CumulativeTable table(weights);
+    EXPECT_EQ(table.Total(), static_cast<uint64_t>(Fixed64_16(16).value()));
+    CheckFrequencies(table, {1 / 16.0, 2 / 16.0, 3 / 16.0, 4 / 16.0, 5 / 16.0, 1 / 16.0});
+
+    EXPECT_TRUE(table.Update(4, Fixed64_16::Zero()));
+    EXPECT_TRUE(table.Update(0, Fixed64_16(3)));
+    EXPECT_FALSE(table.Update(6, Fixed64_16(1)));
+    EXPECT_FALSE(table.Update(1, Fixed64_16(-1)));
+    EXPECT_FALSE(table.Update(1, Fixed64_16::Max()));
+    EXPECT_EQ(table.Total(), static_cast<uint64_t>(Fixed64_16(13).value()));
+    CheckFrequencies(table, {3 / 13.0, 2 / 13.0, 3 / 13.0, 4 / 13.0, 0, 1 / 13.0});
+}
+
+TEST_F(Fixed64SamplingTest, Deterministic) {
+    const auto weights = MakeWeights(4097, 2);
+    const Fixed64AliasTable alias(weights);
+    const Fixed64CumulativeTable cumulative(weights);
+    Fixed64Random a(42);
+    Fixed64Random b(42);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(alias.Sample(a), alias.Sample(b));
+        ASSERT_EQ(cumulative.Sample(a), cumulative.Sample(b));
+    }
+    EXPECT_EQ(a.getSeed(), b.getSeed());
+}
+
+TEST_F(Fixed64SamplingTest, NextBounded) {
+    Fixed64Random random(3);
+    EXPECT_EQ(random.nextBounded(0), 0u);
+    EXPECT_EQ(random.nextBounded(1), 0u);
+    std::vector<int> counts(7);
+    for (int i = 0; i < 70000; ++i) {
+        const uint64_t value = random.nextBounded(7);
+        ASSERT_LT(value, 7u);
+        ++counts[value];
+    }
+    for (const int count : counts) {
+        EXPECT_NEAR(count, 10000, 500);
+    }
+    const uint64_t big = (uint64_t(1) << 63) + 12345;
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_LT(random.nextBounded(big), big);
+    }
+}
+
+}  // namespace math::fp::tests
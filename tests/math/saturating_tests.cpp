@@ -0,0 +1,132 @@
+#include <cstdint>
+#include <random>
+
+#include "fixed64.h"
+#include "fixed64_math.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64SaturatingTest : public ::testing::Test {
+ protected:
+    __extension__ typedef __int128 int128;
+
+    // Raw value with a random magnitude, so that both overflowing and in-range results occur
+    static auto RandomRaw(std::mt19937_64& gen) -> int64_t {
+        return static_cast<int64_t>(gen()) >> (gen() % 64);
+    }
+
+    // Clamp an exact result to [NegInfinity, Infinity], reporting whether it was out of range
+    static auto Saturate(int128 exact, int64_t& result) -> bool {
+        if (exact > INT64_MAX) {
+            result = INT64_MAX;
+            return true;
+        }
+        if (exact < -int128(INT64_MAX)) {
+            result = -INT64_MAX;
+            return true;
+        }
+        result = static_cast<int64_t>(exact);
+        return false;
+    }
+
+    template <int P>
+    static auto CheckAgainstReference(uint64_t seed) -> void {
+        using Fixed = Fixed64<P>;
+        std::mt19937_64 gen(seed);
+        for (int i = 0; i < 20000; ++i) {
+            const Fixed a(RandomRaw(gen), detail::nothing{});
+            const Fixed b(RandomRaw(gen), detail::nothing{});
+            int64_t expected;
+            Fixed result;
+
+            bool overflow = Saturate(int128(a.value()) + b.value(), expected);
+            ASSERT_EQ(Fixed64Math::CheckedAdd(a, b, result), overflow);
+            ASSERT_EQ(result.value(), expected);
+            ASSERT_EQ(Fixed64Math::SaturatingAdd(a, b).value(), expected);
+
+            overflow = Saturate(int128(a.value()) - b.value(), expected);
+            ASSERT_EQ(Fixed64Math::CheckedSub(a, b, result), overflow);
+            ASSERT_EQ(result.value(), expected);
+            ASSERT_EQ(Fixed64Math::SaturatingSub(a, b).value(), expected);
+
+            // Truncation toward zero, like operator*
+            overflow = Saturate(int128(a.value()) * b.value() / (int128(1) << P), expected);
+            ASSERT_EQ(Fixed64Math::CheckedMul(a, b, result), overflow)
+                << "P=" << P << " " << a.value() << " * " << b.value();
+            ASSERT_EQ(result.value(), expected);
+            ASSERT_EQ(Fixed64Math::SaturatingMul(a, b).value(), expected);
+            if (!overflow) {
+                ASSERT_EQ(result, a * b);
+            }
+
+            if (b.value() != 0) {
+                overflow = Saturate((int128(a.value()) << P) / b.value(), expected);
+                ASSERT_EQ(Fixed64Math::CheckedDiv(a, b, result), overflow)
+                    << "P=" << P << " " << a.value() << " / " << b.value();
+                ASSERT_EQ(result.value(), expected);
+                ASSERT_EQ(Fixed64Math::SaturatingDiv(a, b).value(), expected);
+                if (!overflow) {
+                    ASSERT_EQ(result, a / b);
+                }
+            }
+        }
+    }
+};
+
+TEST_F(Fixed64SaturatingTest, MatchesWideReference) {
+    CheckAgainstReference<0>(1);
+    CheckAgainstReference<1>(2);
+    CheckAgainstReference<16>(3);
+    CheckAgainstReference<32>(4);
+    CheckAgainstReference<40>(5);
+    CheckAgainstReference<63>(6);
+}
+
+TEST_F(Fixed64SaturatingTest, Limits) {
+    using Fixed = Fixed64_32;
+    const Fixed max = Fixed::Max();
+    const Fixed low = Fixed::NegInfinity();
+    Fixed result;
+
+    EXPECT_EQ(Fixed64Math::SaturatingAdd(max, Fixed::One()), max);
+    EXPECT_EQ(Fixed64Math::SaturatingAdd(low, -Fixed::One()), low);
+    EXPECT_EQ(Fixed64Math::SaturatingSub(low, Fixed::One()), low);
+    EXPECT_EQ(Fixed64Math::SaturatingSub(max, -Fixed::One()), max);
+    EXPECT_EQ(Fixed64Math::SaturatingMul(Fixed(1 << 20), Fixed(-(1 << 20))), low);
+    EXPECT_EQ(Fixed64Math::SaturatingMul(Fixed(-(1 << 20)), Fixed(-(1 << 20))), max);
+    EXPECT_EQ(Fixed64Math::SaturatingDiv(Fixed(1 << 20), Fixed(0.0001)), max);
+
+    // A sum that lands exactly on the NaN pattern saturates as well
+    const Fixed half_low(INT64_MIN / 2, detail::nothing{});
+    EXPECT_TRUE(Fixed64Math::CheckedAdd(half_low, half_low, result));
+    EXPECT_EQ(result, low);
+    EXPECT_FALSE(Fixed64Math::CheckedAdd(half_low, half_low + Fixed::Epsilon(), result));
+    EXPECT_EQ(result.value(), INT64_MIN + 1);
+
+    // Products that just fit are exact
+    EXPECT_FALSE(Fixed64Math::CheckedMul(max, Fixed::One(), result));
+    EXPECT_EQ(result, max);
+    EXPECT_FALSE(Fixed64Math::CheckedMul(low, Fixed::One(), result));
+    EXPECT_EQ(result, low);
+    EXPECT_TRUE(Fixed64Math::CheckedMul(max, Fixed::One() + Fixed::Epsilon(), result));
+    EXPECT_EQ(result, max);
+
+    // Division by zero reports overflow and gives the same result as operator/
+    EXPECT_TRUE(Fixed64Math::CheckedDiv(Fixed(3), Fixed::Zero(), result));
+    EXPECT_EQ(result, Fixed(3) / Fixed::Zero());
+    EXPECT_TRUE(Fixed64Math::CheckedDiv(Fixed(-3), Fixed::Zero(), result));
+    EXPECT_EQ(result, Fixed(-3) / Fixed::Zero());
+    EXPECT_EQ(Fixed64Math::SaturatingDiv(Fixed::Zero(), Fixed::Zero()), Fixed::Infinity());
+}
+
+TEST_F(Fixed64SaturatingTest, Constexpr) {
+    using Fixed = Fixed64_16;
+    static_assert(Fixed64Math::SaturatingMul(Fixed(3), Fixed(4)) == Fixed(12));
+    static_assert(Fixed64Math::SaturatingMul(Fixed::Max(), Fixed(2)) == Fixed::Max());
+    static_assert(Fixed64Math::SaturatingAdd(Fixed::Max(), Fixed::Max()) == Fixed::Max());
+    static_assert(Fixed64Math::SaturatingDiv(Fixed(1), Fixed::Zero()) == Fixed::Infinity());
+    SUCCEED();
+}
+
+}  // namespace math::fp::tests
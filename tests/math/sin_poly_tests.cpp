@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "detail/sin_lut.h"
+#include "detail/sin_poly.h"
+#include "detail/trig_batch.h"
+#include "fixed64.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+// The polynomial backend is selected at compile time with FIXED64_MATH_USE_POLY_SIN, so these
+// tests exercise the detail functions directly
+class Fixed64SinPolyTest : public ::testing::Test {
+ protected:
+    static constexpr long double kUlp = 0x1p-32L;
+
+    static auto ToAngle(int64_t raw) -> long double {
+        return std::ldexp(static_cast<long double>(raw), -32);
+    }
+
+    static auto MakeAngles(uint64_t seed, size_t count) -> std::vector<int64_t> {
+        std::mt19937_64 gen(seed);
+        std::uniform_int_distribution<int64_t> dist(-(int64_t(7) << 32), int64_t(7) << 32);
+        std::vector<int64_t> values(count);
+        for (auto& v : values) {
+            v = dist(gen);
+        }
+        return values;
+    }
+};
+
+TEST_F(Fixed64SinPolyTest, FootprintUnderOneKilobyte) {
+    static_assert(sizeof(detail::kSinPolyCoeffs) < 1024);
+    static_assert(detail::kSinPolyCoeffs.size()
+                  == detail::kSinPolySegments * (detail::kSinPolyDegree + 1));
+    // The segments tile [0, pi/2]
+    static_assert(detail::kSinPolySegments * detail::kSinPolySegmentWidth - 0x1921FB544LL < 16);
+}
+
+TEST_F(Fixed64SinPolyTest, AtLeastAsAccurateAsHermiteTable) {
+    // Error against sin of the Q31.32 input; within [-2*pi, 2*pi] the only other error is the
+    // truncated pi of the quadrant folding, below 1 ulp
+    long double poly_error = 0;
+    long double table_error = 0;
+    for (int64_t raw : MakeAngles(1, 200000)) {
+        if (std::fabs(ToAngle(raw)) >= 6.28L) {
+            continue;
+        }
+        const long double expected = std::sin(ToAngle(raw));
+        poly_error =
+            std::max(poly_error, std::fabs(ToAngle(detail::LookupSinPoly<32>(raw)) - expected));
+        table_error =
+            std::max(table_error, std::fabs(ToAngle(detail::LookupSin<32>(raw)) - expected));
+    }
+    EXPECT_LE(poly_error, 2.0L * kUlp);
+    EXPECT_LE(poly_error, table_error);
+
+    EXPECT_EQ(detail::LookupSinPoly<32>(0), 0);
+    EXPECT_EQ(detail::LookupSinPoly<32>(0x1921FB544LL), int64_t(1) << 32);
+    EXPECT_EQ(detail::LookupSinPoly<32>(-0x1921FB544LL), -(int64_t(1) << 32));
+}
+
+TEST_F(Fixed64SinPolyTest, SinCosSharesReduction) {
+    for (int64_t raw : MakeAngles(2, 20000)) {
+        const auto [s, c] = detail::LookupSinCosPoly<32>(raw);
+        ASSERT_EQ(s, detail::LookupSinPoly<32>(raw)) << raw;
+        ASSERT_LE(std::fabs(ToAngle(c) - std::cos(ToAngle(raw))), 2.0L * kUlp) << raw;
+    }
+
+    // Other formats convert through Q31.32 like the table lookups
+    const int64_t angle = int64_t(3) << 39;
+    EXPECT_EQ(detail::LookupSinPoly<40>(angle), detail::LookupSinPoly<32>(angle >> 8) << 8);
+}
+
+TEST_F(Fixed64SinPolyTest, ConstexprMatchesRuntime) {
+    constexpr int64_t kAngle = 0x12345678LL;
+    constexpr int64_t kValue = detail::LookupSinPoly<32>(kAngle);
+    volatile int64_t angle = kAngle;
+    EXPECT_EQ(detail::LookupSinPoly<32>(angle), kValue);
+}
+
+TEST_F(Fixed64SinPolyTest, BatchMatchesScalar) {
+    // Includes extreme inputs to cover the reduction of every quadrant
+    std::vector<int64_t> x = MakeAngles(3, 1031);
+    x[0] = INT64_MAX;
+    x[1] = INT64_MIN + 1;
+    x[2] = 0x1921FB544LL;
+    std::vector<int64_t> out(x.size());
+    const size_t done = detail::SinPolyBatch<32>(x.data(), 0, out.data(), x.size());
+    for (size_t i = 0; i < done; ++i) {
+        ASSERT_EQ(out[i], detail::LookupSinPoly<32>(x[i])) << i;
+    }
+
+    // The same raw values read as Q23.40 angles
+    const size_t done40 = detail::SinPolyBatch<40>(x.data(), 0, out.data(), x.size());
+    for (size_t i = 0; i < done40; ++i) {
+        ASSERT_EQ(out[i], detail::LookupSinPoly<40>(x[i])) << i;
+    }
+}
+
+}  // namespace math::fp::tests
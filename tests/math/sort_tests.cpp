@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "fixed64.h"
+#include "fixed64_sort.h"
+#include "gtest/gtest.h"
+
+namespace math::fp::tests {
+
+class Fixed64SortTest : public ::testing::Test {
+ protected:
+    // xorshift values narrowed by a per-element shift, so most passes see several digits
+    static auto MakeValues(size_t count, uint64_t seed = 0x9E3779B97F4A7C15)
+        -> std::vector<Fixed64_32> {
+        std::vector<Fixed64_32> values;
+        uint64_t x = seed;
+        for (size_t i = 0; i < count; ++i) {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            values.emplace_back(static_cast<int64_t>(x) >> (i % 48), detail::nothing{});
+        }
+        return values;
+    }
+
+    static auto StdSorted(std::vector<Fixed64_32> values) -> std::vector<Fixed64_32> {
+        std::sort(values.begin(), values.end());
+        return values;
+    }
+};
+
+TEST_F(Fixed64SortTest, MatchesStdSort) {
+    // Insertion sort, single-chunk and pool paths
+    for (size_t count : {0u, 1u, 2u, 63u, 64u, 65u, 1000u, 16384u, 16385u, 100000u}) {
+        auto values = MakeValues(count);
+        const auto expected = StdSorted(values);
+        RadixSort<32>(values);
+        EXPECT_EQ(values, expected) << "count " << count;
+    }
+}
+
+TEST_F(Fixed64SortTest, OrdersSentinelsAndNarrowRanges) {
+    std::vector<Fixed64_32> values = {Fixed64_32::Infinity(),    Fixed64_32(-1),
+                                      Fixed64_32::NaN(),         Fixed64_32::Zero(),
+                                      Fixed64_32::NegInfinity(), Fixed64_32(1)};
+    RadixSort<32>(values);
+    EXPECT_EQ(values, StdSorted(values));
+    EXPECT_EQ(values.front(), Fixed64_32::NaN());
+    EXPECT_EQ(values.back(), Fixed64_32::Infinity());
+
+    // Raw values below 2^8, 2^16 and 2^24 share their high digits, so those passes are skipped;
+    // odd and even numbers of executed passes both end in the input array
+    for (int64_t range : {int64_t(0xFF), int64_t(0xFFFF), int64_t(0xFFFFFF)}) {
+        auto narrow = MakeValues(30000);
+        for (auto& v : narrow) {
+            v = Fixed64_32(v.value() & range, detail::nothing{});
+        }
+        const auto expected = StdSorted(narrow);
+        RadixSort<32>(narrow);
+        EXPECT_EQ(narrow, expected) << "range " << range;
+    }
+}
+
+TEST_F(Fixed64SortTest, KeyValueSortIsStable) {
+    for (size_t count : {50u, 5000u, 40000u}) {
+        auto keys = MakeValues(count);
+        for (auto& k : keys) {
+            k = Fixed64_32(k.value() % 1000, detail::nothing{});  // Many equal keys
+        }
+        std::vector<uint32_t> ids(count);
+        std::iota(ids.begin(), ids.end(), 0u);
+
+        std::vector<uint32_t> expected = ids;
+        std::stable_sort(expected.begin(), expected.end(),
+                         [&](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+        const auto sorted_keys = StdSorted(keys);
+
+        RadixSort<32, uint32_t>(keys, ids);
+        EXPECT_EQ(keys, sorted_keys) << "count " << count;
+        EXPECT_EQ(ids, expected) << "count " << count;
+    }
+
+    // Only the common prefix of mismatched spans is sorted
+    std::vector<Fixed64_32> keys = {Fixed64_32(3), Fixed64_32(1), Fixed64_32(2)};
+    std::vector<uint32_t> ids = {0, 1};
+    RadixSort<32, uint32_t>(keys, ids);
+    EXPECT_EQ(keys, (std::vector<Fixed64_32>{Fixed64_32(1), Fixed64_32(3), Fixed64_32(2)}));
+    EXPECT_EQ(ids, (std::vector<uint32_t>{1, 0}));
+}
+
+TEST_F(Fixed64SortTest, LowerBoundMatchesStd) {
+    auto sorted = StdSorted(MakeValues(5000));
+    sorted.insert(sorted.begin() + 2500, 40, sorted[2500]);  // A run of duplicates
+    const std::span<const Fixed64_32> view(sorted);
+    for (size_t count : {size_t(0), size_t(1), size_t(15), size_t(16), size_t(17), sorted.size()}) {
+        const auto prefix = view.first(count);
+        for (size_t i = 0; i < sorted.size(); i += 37) {
+            for (int64_t delta : {-1, 0, 1}) {
+                const Fixed64_32 key(sorted[i].value() + delta, detail::nothing{});
+                const size_t expected = static_cast<size_t>(
+                    std::lower_bound(prefix.begin(), prefix.end(), key) - prefix.begin());
+                EXPECT_EQ(LowerBound(prefix, key), expected) << "count " << count << " i " << i;
+            }
+        }
+        EXPECT_EQ(LowerBound(prefix, Fixed64_32::NaN()), 0u);
+        EXPECT_EQ(LowerBound(prefix, Fixed64_32::Infinity()), count);
+    }
+}
+
+TEST_F(Fixed64SortTest, FindNearest) {
+    const std::array<Fixed64_32, 5> sorted = {Fixed64_32(-10), Fixed64_32(1), Fixed64_32(3),
+                                              Fixed64_32(3), Fixed64_32(8)};
+    const std::span<const Fixed64_32> view(sorted);
+    EXPECT_EQ(FindNearest(view, Fixed64_32(-100)), 0u);
+    EXPECT_EQ(FindNearest(view, Fixed64_32(100)), 4u);
+    EXPECT_EQ(FindNearest(view, Fixed64_32(1.9)), 1u);
+    EXPECT_EQ(FindNearest(view, Fixed64_32(2)), 1u);  // Tie picks the smaller value
+    EXPECT_EQ(FindNearest(view, Fixed64_32(2.1)), 2u);
+    EXPECT_EQ(FindNearest(view, Fixed64_32(3)), 2u);  // First of equal values
+    EXPECT_EQ(FindNearest(view, Fixed64_32(5.6)), 4u);
+    EXPECT_EQ(FindNearest(std::span<const Fixed64_32>(), Fixed64_32(1)), 0u);
+
+    // Differences beyond the int64_t range do not overflow
+    const std::array<Fixed64_32, 2> extremes = {Fixed64_32::NegInfinity(), Fixed64_32::Infinity()};
+    EXPECT_EQ(FindNearest(std::span<const Fixed64_32>(extremes), Fixed64_32(-1)), 0u);
+    EXPECT_EQ(FindNearest(std::span<const Fixed64_32>(extremes), Fixed64_32(1)), 1u);
+
+    // Brute force on random data
+    const auto values = StdSorted(MakeValues(3000));
+    const auto queries = MakeValues(200, 12345);
+    for (const auto& q : queries) {
+        size_t best = 0;
+        for (size_t i = 1; i < values.size(); ++i) {
+            const uint64_t d_best = q >= values[best]
+                                        ? uint64_t(q.value()) - uint64_t(values[best].value())
+                                        : uint64_t(values[best].value()) - uint64_t(q.value());
+            const uint64_t d = q >= values[i] ? uint64_t(q.value()) - uint64_t(values[i].value())
+                                              : uint64_t(values[i].value()) - uint64_t(q.value());
+            best = d < d_best ? i : best;
+        }
+        EXPECT_EQ(FindNearest(std::span<const Fixed64_32>(values), q), best);
+    }
+}
+
+}  // namespace math::fp::tests
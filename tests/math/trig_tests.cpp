@@ -323,4 +323,39 @@ TEST_F(Fixed64TrigTest, LookupTableImplementation) {
     }
 }
 
+// Fused sine/cosine
+TEST_F(Fixed64TrigTest, SinCosMatchesSinAndCos) {
+    std::vector<Fixed> angles = testAngles;
+    for (double angle = -20.0; angle < 20.0; angle += 0.0371) {
+        angles.push_back(Fixed(angle));
+    }
+    // Segment boundaries around pi/2, where the mirrored cosine index reaches the table end
+    for (int i = -3; i <= 3; ++i) {
+        angles.push_back(Fixed::HalfPi() + Fixed::Epsilon() * Fixed(i));
+        angles.push_back(-Fixed::HalfPi() + Fixed::Epsilon() * Fixed(i));
+    }
+
+    for (const auto& angle : angles) {
+        double dblAngle = static_cast<double>(angle);
+        auto [sinValue, cosValue] = Fixed64Math::SinCos(angle);
+
+        // Sine shares the exact computation of Sin
+        EXPECT_EQ(sinValue, Fixed64Math::Sin(angle)) << "SinCos sin differs at " << dblAngle;
+
+        EXPECT_NEAR(static_cast<double>(cosValue), std::cos(dblAngle), epsilon)
+            << "SinCos cos failed at angle " << dblAngle << " radians";
+        EXPECT_NEAR(static_cast<double>(cosValue), static_cast<double>(Fixed64Math::Cos(angle)),
+                    epsilon)
+            << "SinCos cos differs from Cos at angle " << dblAngle << " radians";
+    }
+
+    // Higher precision formats reduce the angle the same way
+    using Fixed40 = Fixed64<40>;
+    for (double angle = -7.0; angle < 7.0; angle += 0.173) {
+        auto [sinValue, cosValue] = Fixed64Math::SinCos(Fixed40(angle));
+        EXPECT_EQ(sinValue, Fixed64Math::Sin(Fixed40(angle)));
+        EXPECT_NEAR(static_cast<double>(cosValue), std::cos(angle), epsilon);
+    }
+}
+
 }  // namespace math::fp::tests
\ No newline at end of file